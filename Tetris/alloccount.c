@@ -0,0 +1,149 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#define ALLOC_COUNT_IMPLEMENTATION
+#include "alloccount.h"
+#include "tetris.h"
+
+// Distinct call sites remembered. Any more are put down to the last one.
+#define MAX_ALLOC_SITES 64
+
+struct AllocSite {
+	const char* name;
+	int line;
+	Uint64 count;
+	Uint64 bytes;
+};
+
+// Only touched from the tracked thread, and never allocating itself
+static struct {
+	bool tracking;
+	SDL_threadID thread;
+	const char* site;
+
+	struct AllocSite sites[MAX_ALLOC_SITES];
+	int siteCount;
+
+	SDL_malloc_func malloc;
+	SDL_calloc_func calloc;
+	SDL_realloc_func realloc;
+	SDL_free_func free;
+} allocs;
+
+static void countAllocation(const char* name, int line, size_t size) {
+	if (!allocs.tracking || SDL_ThreadID() != allocs.thread) {
+		return;
+	}
+
+	struct AllocSite* site = NULL;
+	for (int i = 0; i < allocs.siteCount; i++) {
+		if (allocs.sites[i].line == line && strcmp(allocs.sites[i].name, name) == 0) {
+			site = &allocs.sites[i];
+			break;
+		}
+	}
+
+	if (site == NULL) {
+		site = &allocs.sites[allocs.siteCount < MAX_ALLOC_SITES ? allocs.siteCount++ : MAX_ALLOC_SITES - 1];
+		site->name = name;
+		site->line = line;
+	}
+
+	site->count++;
+	site->bytes += size;
+}
+
+static void* sdlMalloc(size_t size) {
+	countAllocation(allocs.site, 0, size);
+	return allocs.malloc(size);
+}
+
+static void* sdlCalloc(size_t count, size_t size) {
+	countAllocation(allocs.site, 0, count * size);
+	return allocs.calloc(count, size);
+}
+
+static void* sdlRealloc(void* data, size_t size) {
+	countAllocation(allocs.site, 0, size);
+	return allocs.realloc(data, size);
+}
+
+static void sdlFree(void* data) {
+	allocs.free(data);
+}
+
+void startAllocTracking() {
+	SDL_GetMemoryFunctions(&allocs.malloc, &allocs.calloc, &allocs.realloc, &allocs.free);
+	SDL_SetMemoryFunctions(sdlMalloc, sdlCalloc, sdlRealloc, sdlFree);
+
+	allocs.thread = SDL_ThreadID();
+	allocs.site = "SDL";
+	allocs.tracking = true;
+	resetAllocCounts();
+}
+
+void stopAllocTracking() {
+	allocs.tracking = false;
+}
+
+const char* setAllocSite(const char* site) {
+	const char* previous = allocs.site;
+	allocs.site = site;
+	return previous;
+}
+
+void resetAllocCounts() {
+	memset(allocs.sites, 0, sizeof(allocs.sites));
+	allocs.siteCount = 0;
+}
+
+void* countedMalloc(size_t size, const char* file, int line) {
+	countAllocation(file, line, size);
+	return malloc(size);
+}
+
+void* countedCalloc(size_t count, size_t size, const char* file, int line) {
+	countAllocation(file, line, count * size);
+	return calloc(count, size);
+}
+
+void* countedRealloc(void* data, size_t size, const char* file, int line) {
+	countAllocation(file, line, size);
+	return realloc(data, size);
+}
+
+void countedFree(void* data) {
+	free(data);
+}
+
+Uint64 reportAllocations(int frames) {
+	Uint64 total = 0;
+	for (int i = 0; i < allocs.siteCount; i++) {
+		total += allocs.sites[i].count;
+	}
+
+	if (total == 0) {
+		printf("No allocations in %d frames\n", frames);
+		return 0;
+	}
+
+	printf("%-32s %12s %12s\n", "site", "allocs/frame", "bytes/frame");
+	for (int i = 0; i < allocs.siteCount; i++) {
+		const struct AllocSite* site = &allocs.sites[i];
+
+		char name[64];
+		if (site->line > 0) {
+			snprintf(name, sizeof(name), "%s:%d", site->name, site->line);
+		}
+		else {
+			snprintf(name, sizeof(name), "%s", site->name);
+		}
+
+		printf("%-32s %12.2f %12.1f\n", name, (double)site->count / frames, (double)site->bytes / frames);
+	}
+	return total;
+}
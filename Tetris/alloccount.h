@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <SDL2/SDL.h>
+
+// Counts heap allocations made by one thread, by where they came from, so the
+// allocation check can show that drawing a frame never touches the heap.
+// SDL's own allocations are caught through SDL_SetMemoryFunctions and put down
+// to whichever SDL call is running (see setAllocSite), and the game's own through
+// the macros below, which record the file and line. Those only reach files that
+// include this header, so every module that runs on the logic thread does.
+
+// Hook SDL's allocator and start counting allocations on the calling thread.
+// Must come before SDL allocates anything, so before SDL_Init.
+void startAllocTracking();
+void stopAllocTracking();
+
+// Name the SDL call about to run, for SDL allocations it makes. Returns the
+// previous name to put back afterwards.
+const char* setAllocSite(const char* site);
+
+void resetAllocCounts();
+
+// Print allocations and bytes per frame by call site. Returns the number of
+// allocations counted since the last reset.
+Uint64 reportAllocations(int frames);
+
+void* countedMalloc(size_t size, const char* file, int line);
+void* countedCalloc(size_t count, size_t size, const char* file, int line);
+void* countedRealloc(void* data, size_t size, const char* file, int line);
+void countedFree(void* data);
+
+#ifndef ALLOC_COUNT_IMPLEMENTATION
+#define malloc(size) countedMalloc(size, __FILE__, __LINE__)
+#define calloc(count, size) countedCalloc(count, size, __FILE__, __LINE__)
+#define realloc(data, size) countedRealloc(data, size, __FILE__, __LINE__)
+#define free(data) countedFree(data)
+#endif
@@ -0,0 +1,491 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "batch.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BATCH_SSE2
+#include <emmintrin.h>
+#endif
+
+SDL_COMPILE_TIME_ASSERT(batchLanes, BATCH_LANES % 8 == 0);
+
+// Every rotation's rows as they are at the spawn column
+static Uint16 spawnRows[NUM_BLOCKS][4][4];
+
+void initBatch() {
+	initEngine();
+
+	for (int type = 0; type < NUM_BLOCKS; type++) {
+		for (int rotation = 0; rotation < 4; rotation++) {
+			for (int i = 0; i < 4; i++) {
+				spawnRows[type][rotation][i] = PIECE_SHAPES[type][rotation].rows[i] << SPAWN_X;
+			}
+		}
+	}
+}
+
+static bool collidesAtSpawn(const struct BatchGames* batch, int lane, enum PieceType type, int rotation) {
+	const Uint16* rows = spawnRows[type][rotation];
+	return ((batch->rows[SPAWN_Y][lane] & rows[0]) | (batch->rows[SPAWN_Y + 1][lane] & rows[1]) |
+		(batch->rows[SPAWN_Y + 2][lane] & rows[2]) | (batch->rows[SPAWN_Y + 3][lane] & rows[3])) != 0;
+}
+
+static void spawnLane(struct BatchGames* batch, int lane) {
+	enum PieceType type = nextBagPiece(&batch->bags[lane]);
+	batch->current[lane] = type;
+	batch->rotation[lane] = 0;
+	batch->target[lane] = SPAWN_X;
+
+	if (collidesAtSpawn(batch, lane, type, 0)) {
+		batch->active[lane] = 0;
+	}
+}
+
+void batchResetLane(struct BatchGames* batch, int lane, Uint32 seed) {
+	for (int y = 0; y < BLOCKS_Y; y++) {
+		batch->rows[y][lane] = 0;
+	}
+	for (int y = BLOCKS_Y; y < BLOCKS_Y + BATCH_FLOOR_ROWS; y++) {
+		batch->rows[y][lane] = FULL_ROW;
+	}
+
+	seedBag(&batch->bags[lane], seed);
+	batch->active[lane] = 0xffff;
+	batch->lines[lane] = 0;
+	batch->pieces[lane] = 0;
+
+	spawnLane(batch, lane);
+}
+
+// Put each active lane's piece at the spawn row in its chosen rotation, or
+// unrotated if that doesn't fit. Finished lanes get an empty shape, which
+// never moves or collides.
+static void setShapes(struct BatchGames* batch) {
+	for (int lane = 0; lane < BATCH_LANES; lane++) {
+		enum PieceType type = batch->current[lane];
+		int rotation = batch->rotation[lane] & 3;
+
+		if (batch->active[lane] && collidesAtSpawn(batch, lane, type, rotation)) {
+			rotation = 0;
+		}
+		batch->rotation[lane] = rotation;
+		batch->x[lane] = SPAWN_X;
+
+		for (int i = 0; i < 4; i++) {
+			batch->shape[i][lane] = batch->active[lane] ? spawnRows[type][rotation][i] : 0;
+		}
+	}
+}
+
+// The rows the active pieces among count lanes landed in. Nothing else can
+// have changed, so locking and clearing can skip the rest.
+static bool landingRows(const struct BatchGames* batch, int lane, int count, int* first, int* last) {
+	*first = BLOCKS_Y;
+	*last = -1;
+
+	for (int i = lane; i < lane + count; i++) {
+		if (batch->active[i]) {
+			*first = SDL_min(*first, SPAWN_Y + batch->dropY[i]);
+			*last = SDL_max(*last, SPAWN_Y + batch->dropY[i] + 3);
+		}
+	}
+
+	*last = SDL_min(*last, BLOCKS_Y - 1);
+	return *first <= *last;
+}
+
+#ifdef BATCH_SSE2
+
+#define LOAD(p) _mm_loadu_si128((const __m128i*)(p))
+#define STORE(p, v) _mm_storeu_si128((__m128i*)(p), v)
+
+static __m128i blend(__m128i mask, __m128i a, __m128i b) {
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+static __m128i nonZero(__m128i v) {
+	return _mm_xor_si128(_mm_cmpeq_epi16(v, _mm_setzero_si128()), _mm_set1_epi16(-1));
+}
+
+// Slide the pieces one column at a time until every lane has reached its
+// target or been blocked. The box is still at the spawn row, so only the top
+// 4 rows of the board matter.
+static void shiftPieces(struct BatchGames* batch) {
+	const __m128i leftWall = _mm_set1_epi16(1);
+	const __m128i rightWall = _mm_set1_epi16(1 << (BLOCKS_X - 1));
+
+	for (int lane = 0; lane < BATCH_LANES; lane += 8) {
+		__m128i s[4];
+		__m128i board[4];
+		for (int i = 0; i < 4; i++) {
+			s[i] = LOAD(&batch->shape[i][lane]);
+			board[i] = LOAD(&batch->rows[SPAWN_Y + i][lane]);
+		}
+		__m128i x = LOAD(&batch->x[lane]);
+		__m128i target = LOAD(&batch->target[lane]);
+
+		for (int step = 0; step < BLOCKS_X; step++) {
+			__m128i wantLeft = _mm_cmpgt_epi16(x, target);
+			__m128i wantRight = _mm_cmpgt_epi16(target, x);
+			if (_mm_movemask_epi8(_mm_or_si128(wantLeft, wantRight)) == 0) {
+				break;
+			}
+
+			__m128i left[4];
+			__m128i right[4];
+			__m128i blockedLeft = _mm_setzero_si128();
+			__m128i blockedRight = _mm_setzero_si128();
+
+			for (int i = 0; i < 4; i++) {
+				left[i] = _mm_srli_epi16(s[i], 1);
+				right[i] = _mm_slli_epi16(s[i], 1);
+				blockedLeft = _mm_or_si128(blockedLeft, _mm_or_si128(_mm_and_si128(s[i], leftWall), _mm_and_si128(left[i], board[i])));
+				blockedRight = _mm_or_si128(blockedRight, _mm_or_si128(_mm_and_si128(s[i], rightWall), _mm_and_si128(right[i], board[i])));
+			}
+
+			__m128i moveLeft = _mm_andnot_si128(nonZero(blockedLeft), wantLeft);
+			__m128i moveRight = _mm_andnot_si128(nonZero(blockedRight), wantRight);
+
+			for (int i = 0; i < 4; i++) {
+				s[i] = blend(moveLeft, left[i], blend(moveRight, right[i], s[i]));
+			}
+
+			// The masks are -1 where set
+			x = _mm_sub_epi16(_mm_add_epi16(x, moveLeft), moveRight);
+
+			// A blocked lane settles for where it is
+			__m128i stuck = _mm_or_si128(_mm_andnot_si128(moveLeft, wantLeft), _mm_andnot_si128(moveRight, wantRight));
+			target = blend(stuck, x, target);
+		}
+
+		for (int i = 0; i < 4; i++) {
+			STORE(&batch->shape[i][lane], s[i]);
+		}
+		STORE(&batch->x[lane], x);
+		STORE(&batch->target[lane], target);
+	}
+}
+
+// Every piece starts at the same row, so testing a drop of d rows reads the
+// same board rows in every lane, whatever the piece.
+static void dropPieces(struct BatchGames* batch) {
+	for (int lane = 0; lane < BATCH_LANES; lane += 8) {
+		__m128i s[4];
+		for (int i = 0; i < 4; i++) {
+			s[i] = LOAD(&batch->shape[i][lane]);
+		}
+
+		__m128i landed = _mm_cmpeq_epi16(LOAD(&batch->active[lane]), _mm_setzero_si128());
+		__m128i dropY = _mm_setzero_si128();
+
+		for (int d = 1; d <= BLOCKS_Y; d++) {
+			__m128i hit = _mm_setzero_si128();
+			for (int i = 0; i < 4; i++) {
+				hit = _mm_or_si128(hit, _mm_and_si128(s[i], LOAD(&batch->rows[SPAWN_Y + d + i][lane])));
+			}
+
+			__m128i newlyLanded = _mm_andnot_si128(landed, nonZero(hit));
+			dropY = blend(newlyLanded, _mm_set1_epi16(d - 1), dropY);
+			landed = _mm_or_si128(landed, newlyLanded);
+
+			if (_mm_movemask_epi8(landed) == 0xffff) {
+				break;
+			}
+		}
+
+		STORE(&batch->dropY[lane], dropY);
+	}
+}
+
+// Lock the pieces in and remove full rows
+static void lockPieces(struct BatchGames* batch) {
+	const __m128i full = _mm_set1_epi16(FULL_ROW);
+
+	for (int lane = 0; lane < BATCH_LANES; lane += 8) {
+		int first;
+		int last;
+		if (!landingRows(batch, lane, 8, &first, &last)) {
+			continue;
+		}
+
+		__m128i s[4];
+		for (int i = 0; i < 4; i++) {
+			s[i] = LOAD(&batch->shape[i][lane]);
+		}
+		__m128i dropY = LOAD(&batch->dropY[lane]);
+
+		for (int y = first; y <= last; y++) {
+			__m128i row = LOAD(&batch->rows[y][lane]);
+			for (int i = 0; i < 4; i++) {
+				int d = y - SPAWN_Y - i;
+				if (d >= 0) {
+					row = _mm_or_si128(row, _mm_and_si128(s[i], _mm_cmpeq_epi16(dropY, _mm_set1_epi16(d))));
+				}
+			}
+			STORE(&batch->rows[y][lane], row);
+		}
+
+		// Going down, rows above the one being cleared never hold a full row,
+		// so one pass is enough. Lanes without a full row keep their rows.
+		__m128i lines = LOAD(&batch->lines[lane]);
+
+		for (int y = first; y <= last; y++) {
+			__m128i cleared = _mm_cmpeq_epi16(LOAD(&batch->rows[y][lane]), full);
+			if (_mm_movemask_epi8(cleared) == 0) {
+				continue;
+			}
+
+			lines = _mm_sub_epi16(lines, cleared);
+			for (int above = y; above > 0; above--) {
+				__m128i row = LOAD(&batch->rows[above][lane]);
+				STORE(&batch->rows[above][lane], blend(cleared, LOAD(&batch->rows[above - 1][lane]), row));
+			}
+			STORE(&batch->rows[0][lane], _mm_andnot_si128(cleared, LOAD(&batch->rows[0][lane])));
+		}
+
+		STORE(&batch->lines[lane], lines);
+	}
+}
+
+#else
+
+static void shiftPieces(struct BatchGames* batch) {
+	for (int lane = 0; lane < BATCH_LANES; lane++) {
+		while (batch->x[lane] != batch->target[lane]) {
+			int dx = batch->target[lane] > batch->x[lane] ? 1 : -1;
+			bool blocked = false;
+			Uint16 moved[4];
+
+			for (int i = 0; i < 4; i++) {
+				Uint16 bits = batch->shape[i][lane];
+				blocked |= (bits & (dx < 0 ? 1 : 1 << (BLOCKS_X - 1))) != 0;
+				moved[i] = dx < 0 ? bits >> 1 : bits << 1;
+				blocked |= (moved[i] & batch->rows[SPAWN_Y + i][lane]) != 0;
+			}
+
+			if (blocked) {
+				batch->target[lane] = batch->x[lane];
+				break;
+			}
+
+			for (int i = 0; i < 4; i++) {
+				batch->shape[i][lane] = moved[i];
+			}
+			batch->x[lane] += dx;
+		}
+	}
+}
+
+static void dropPieces(struct BatchGames* batch) {
+	for (int lane = 0; lane < BATCH_LANES; lane++) {
+		int d = 0;
+		while (batch->active[lane] && d < BLOCKS_Y) {
+			Uint16 hit = 0;
+			for (int i = 0; i < 4; i++) {
+				hit |= batch->shape[i][lane] & batch->rows[SPAWN_Y + d + 1 + i][lane];
+			}
+			if (hit) {
+				break;
+			}
+			d++;
+		}
+		batch->dropY[lane] = d;
+	}
+}
+
+static void lockPieces(struct BatchGames* batch) {
+	for (int lane = 0; lane < BATCH_LANES; lane++) {
+		int first;
+		int last;
+		if (!landingRows(batch, lane, 1, &first, &last)) {
+			continue;
+		}
+
+		for (int i = 0; i < 4; i++) {
+			batch->rows[SPAWN_Y + batch->dropY[lane] + i][lane] |= batch->shape[i][lane];
+		}
+
+		for (int y = first; y <= last; y++) {
+			if (batch->rows[y][lane] == FULL_ROW) {
+				batch->lines[lane]++;
+				for (int above = y; above > 0; above--) {
+					batch->rows[above][lane] = batch->rows[above - 1][lane];
+				}
+				batch->rows[0][lane] = 0;
+			}
+		}
+	}
+}
+
+#endif
+
+int batchPlay(struct BatchGames* batch) {
+	setShapes(batch);
+	shiftPieces(batch);
+	dropPieces(batch);
+	lockPieces(batch);
+
+	int active = 0;
+	for (int lane = 0; lane < BATCH_LANES; lane++) {
+		if (batch->active[lane]) {
+			batch->pieces[lane]++;
+			spawnLane(batch, lane);
+			active += batch->active[lane] != 0;
+		}
+	}
+	return active;
+}
+
+// Random games end quickly, but don't let a lucky one run forever
+#define BENCH_MAX_PIECES 1000
+
+struct BenchResult {
+	int lines;
+	int pieces;
+};
+
+// The same random choice for a given game and piece, however it's simulated
+static void benchMove(Uint32 seed, int piece, enum PieceType type, int* rotation, int* target) {
+	Uint32 h = seed * 0x9e3779b1 ^ (piece + 1) * 0x85ebca6b;
+	h ^= h >> 15;
+	h *= 0x2c1b3c6d;
+	h ^= h >> 13;
+
+	*rotation = h & 3;
+	const struct PieceShape* shape = &PIECE_SHAPES[type][*rotation];
+	int lowest = -shape->left;
+	int highest = BLOCKS_X - 1 - shape->right;
+	*target = lowest + (int)((h >> 8) % (highest - lowest + 1));
+}
+
+// The scalar engine playing the same moves, both as the baseline and to check the batch against
+static struct BenchResult scalarGame(Uint32 seed) {
+	struct SimGame game;
+	simReset(&game, seed);
+
+	while (!game.over && game.pieces < BENCH_MAX_PIECES) {
+		struct Move move = { false, 0, SPAWN_X, SPAWN_Y };
+		int target;
+		benchMove(seed, game.pieces, game.current, &move.rotation, &target);
+
+		if (bitboardCollides(&game.board, game.current, move.rotation, move.x, move.y)) {
+			move.rotation = 0;
+		}
+
+		int dx = target > move.x ? 1 : -1;
+		while (move.x != target && !bitboardCollides(&game.board, game.current, move.rotation, move.x + dx, move.y)) {
+			move.x += dx;
+		}
+
+		move.y = bitboardDropY(&game.board, game.current, move.rotation, move.x, move.y);
+		simPlay(&game, &move);
+	}
+
+	struct BenchResult result = { game.lines, game.pieces };
+	return result;
+}
+
+int benchBatchMain(int argc, char* argv[]) {
+	int games = argc > 0 ? atoi(argv[0]) : 100000;
+	Uint32 seed = argc > 1 ? (Uint32)strtoul(argv[1], NULL, 10) : 1;
+	games = SDL_max(games, 1);
+
+	initBatch();
+
+	struct BenchResult* expected = malloc(games * sizeof(struct BenchResult));
+	struct BenchResult* actual = malloc(games * sizeof(struct BenchResult));
+	struct BatchGames* batch = malloc(sizeof(struct BatchGames));
+	if (expected == NULL || actual == NULL || batch == NULL) {
+		printf("Out of memory\n");
+		return 1;
+	}
+
+	Uint64 start = SDL_GetPerformanceCounter();
+	Uint64 scalarPieces = 0;
+	for (int i = 0; i < games; i++) {
+		expected[i] = scalarGame(seed + i);
+		scalarPieces += expected[i].pieces;
+	}
+	double scalarSeconds = (SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+
+	// Each lane starts a new game as soon as its last one ends
+	start = SDL_GetPerformanceCounter();
+
+	int laneGame[BATCH_LANES];
+	int nextGame = 0;
+	int running = 0;
+	Uint64 batchPieces = 0;
+
+	for (int lane = 0; lane < BATCH_LANES; lane++) {
+		laneGame[lane] = -1;
+		batch->active[lane] = 0;
+		batch->current[lane] = O_PIECE;
+		for (int y = 0; y < BLOCKS_Y + BATCH_FLOOR_ROWS; y++) {
+			batch->rows[y][lane] = FULL_ROW;
+		}
+	}
+
+	do {
+		running = 0;
+		for (int lane = 0; lane < BATCH_LANES; lane++) {
+			bool finished = !batch->active[lane] || batch->pieces[lane] >= BENCH_MAX_PIECES;
+
+			if (finished && laneGame[lane] >= 0) {
+				actual[laneGame[lane]].lines = batch->lines[lane];
+				actual[laneGame[lane]].pieces = batch->pieces[lane];
+				batchPieces += batch->pieces[lane];
+				laneGame[lane] = -1;
+				batch->active[lane] = 0;
+			}
+			if (finished && nextGame < games) {
+				laneGame[lane] = nextGame++;
+				batchResetLane(batch, lane, seed + laneGame[lane]);
+			}
+
+			if (batch->active[lane]) {
+				int rotation;
+				int target;
+				benchMove(seed + laneGame[lane], batch->pieces[lane], batch->current[lane], &rotation, &target);
+				batch->rotation[lane] = rotation;
+				batch->target[lane] = target;
+				running++;
+			}
+		}
+
+		if (running > 0) {
+			batchPlay(batch);
+		}
+	} while (running > 0);
+
+	double batchSeconds = (SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+
+	int mismatches = 0;
+	for (int i = 0; i < games; i++) {
+		if (expected[i].lines != actual[i].lines || expected[i].pieces != actual[i].pieces) {
+			if (mismatches++ < 5) {
+				printf("Game %d differs: scalar %d lines in %d pieces, batch %d lines in %d pieces\n",
+					i, expected[i].lines, expected[i].pieces, actual[i].lines, actual[i].pieces);
+			}
+		}
+	}
+
+#ifdef BATCH_SSE2
+	const char* kind = "SSE2";
+#else
+	const char* kind = "scalar fallback";
+#endif
+
+	printf("%d random games, %llu pieces\n", games, (unsigned long long)scalarPieces);
+	printf("  scalar engine: %.3fs, %.0f pieces/s\n", scalarSeconds, scalarPieces / SDL_max(scalarSeconds, 1e-9));
+	printf("  %d lanes, %s: %.3fs, %.0f pieces/s (%.1fx)\n", BATCH_LANES, kind, batchSeconds,
+		batchPieces / SDL_max(batchSeconds, 1e-9), scalarSeconds / SDL_max(batchSeconds, 1e-9));
+	printf("%s\n", mismatches == 0 ? "All games match" : "Games differ");
+
+	free(expected);
+	free(actual);
+	free(batch);
+
+	return mismatches == 0 ? 0 : 1;
+}
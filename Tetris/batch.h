@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+#include "engine.h"
+
+// Many games stepped in lock-step for rollouts. State is stored as one array
+// per field with a lane per game, so each row of every board can be tested
+// with one vector operation. Uses SSE2 where the compiler targets it, and
+// plain loops over the lanes otherwise.
+//
+// Each play spawns the lane's piece in the chosen rotation, slides it along
+// the spawn row towards the target column and drops it, the same placements
+// forEachPlacement makes. There is no hold.
+
+// 8, 16 or 32. A multiple of 8 so every row fills whole SSE2 registers.
+#ifndef BATCH_LANES
+#define BATCH_LANES 16
+#endif
+
+// Full rows under the board, so a falling piece lands on the floor like on anything else
+#define BATCH_FLOOR_ROWS 4
+
+struct BatchGames {
+	Uint16 rows[BLOCKS_Y + BATCH_FLOOR_ROWS][BATCH_LANES];
+
+	// The falling piece's rows, starting at the spawn row
+	Uint16 shape[4][BATCH_LANES];
+
+	// Left edge of the piece's 4x4 box, and where the policy wants it
+	Sint16 x[BATCH_LANES];
+	Sint16 target[BATCH_LANES];
+
+	// How far the piece fell
+	Sint16 dropY[BATCH_LANES];
+
+	// 0xffff for lanes still playing, 0 once a lane's game is over
+	Uint16 active[BATCH_LANES];
+
+	Sint16 lines[BATCH_LANES];
+
+	// Per lane, but only touched once a piece
+	struct PieceBag bags[BATCH_LANES];
+	enum PieceType current[BATCH_LANES];
+	Uint8 rotation[BATCH_LANES];
+	int pieces[BATCH_LANES];
+};
+
+// Calls initEngine as well. Must be called before anything else here.
+void initBatch();
+
+void batchResetLane(struct BatchGames* batch, int lane, Uint32 seed);
+
+// Play the current piece of every active lane with the rotation and target
+// set beforehand, then spawn the next. A lane whose next piece doesn't fit is
+// marked inactive. Returns the number of lanes still active.
+int batchPlay(struct BatchGames* batch);
+
+// Arguments: [games] [seed]
+int benchBatchMain(int argc, char* argv[]);
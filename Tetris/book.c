@@ -0,0 +1,389 @@
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "book.h"
+#include "mapfile.h"
+
+SDL_COMPILE_TIME_ASSERT(bookHeaderSize, sizeof(struct BookHeader) == 24);
+SDL_COMPILE_TIME_ASSERT(bookEntrySize, sizeof(struct BookEntry) == 16);
+
+// Every order the first bag can come in
+#define BAG_ORDERS 5040
+
+// Worse than any board, but not so low that adding to it overflows
+#define LOST_SCORE (-1e30f)
+
+static Uint64 mix(Uint64 x) {
+	x ^= x >> 30;
+	x *= 0xbf58476d1ce4e5b9ull;
+	x ^= x >> 27;
+	x *= 0x94d049bb133111ebull;
+	x ^= x >> 31;
+	return x;
+}
+
+// The board packed 6 rows to a word, then everything else about the position in one more
+static Uint64 hashPosition(const struct SimGame* game, Uint64 seed) {
+	Uint64 words[4] = { 0 };
+	for (int y = 0; y < BLOCKS_Y; y++) {
+		words[y / 6] |= (Uint64)game->board.rows[y] << (y % 6 * BLOCKS_X);
+	}
+
+	Uint64 pieces = game->current | game->held << 3 | (Uint64)game->canHold << 6;
+	for (int i = 0; i < QUEUE_LENGTH; i++) {
+		pieces |= (Uint64)game->queue[i] << (7 + 3 * i);
+	}
+
+	Uint64 hash = seed;
+	for (int i = 0; i < 4; i++) {
+		hash = mix(hash ^ words[i]);
+	}
+	return mix(hash ^ pieces);
+}
+
+#define KEY_SEED 0x243f6a8885a308d3ull
+#define CHECK_SEED 0x13198a2e03707344ull
+
+bool openBook(struct OpeningBook* book, const char* path) {
+	memset(book, 0, sizeof(*book));
+
+	book->data = mapFile(path, &book->size);
+	if (book->data == NULL) {
+		return false;
+	}
+
+	const struct BookHeader* header = book->data;
+
+	bool valid = book->size >= sizeof(*header) &&
+		header->magic == BOOK_MAGIC &&
+		header->version == BOOK_VERSION &&
+		header->entrySize == sizeof(struct BookEntry) &&
+		header->headerSize + header->count * sizeof(struct BookEntry) <= book->size;
+
+	if (!valid) {
+		printf("%s is not a valid opening book\n", path);
+		closeBook(book);
+		return false;
+	}
+
+	book->header = header;
+	book->entries = (const struct BookEntry*)((const Uint8*)book->data + header->headerSize);
+	return true;
+}
+
+void closeBook(struct OpeningBook* book) {
+	if (book->data != NULL) {
+		unmapFile(book->data, book->size);
+	}
+	memset(book, 0, sizeof(*book));
+}
+
+const struct BookEntry* lookupBook(const struct OpeningBook* book, const struct SimGame* game) {
+	Uint64 key = hashPosition(game, KEY_SEED);
+	Uint64 low = 0;
+	Uint64 high = book->header->count;
+
+	while (low < high) {
+		Uint64 middle = low + (high - low) / 2;
+		if (book->entries[middle].key < key) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
+	}
+
+	if (low >= book->header->count || book->entries[low].key != key) {
+		return NULL;
+	}
+
+	const struct BookEntry* entry = &book->entries[low];
+	return entry->check == (Uint32)hashPosition(game, CHECK_SEED) ? entry : NULL;
+}
+
+// The score of the best board depth pieces from here. Only the top level asks
+// for the move, and gets false back if there wasn't one.
+static float searchDeep(const struct SimGame* game, const struct Weights* weights, int depth, int lines, struct Move* bestMove, bool* found) {
+	struct Move moves[MAX_MOVES];
+	int count = listMoves(game, moves);
+
+	float best = LOST_SCORE;
+	for (int i = 0; i < count; i++) {
+		struct SimGame next = *game;
+		int cleared = simPlay(&next, &moves[i]);
+
+		float score = LOST_SCORE;
+		if (!next.over) {
+			score = depth > 1 ?
+				searchDeep(&next, weights, depth - 1, lines + cleared, NULL, NULL) :
+				evaluateBoard(&next.board, lines + cleared, weights);
+		}
+
+		if (score > best || (bestMove != NULL && i == 0)) {
+			best = score;
+			if (bestMove != NULL) {
+				*bestMove = moves[i];
+			}
+		}
+	}
+
+	if (found != NULL) {
+		*found = count > 0;
+	}
+	return best;
+}
+
+bool findDeepMove(const struct SimGame* game, const struct Weights* weights, int depth, struct BotMove* best) {
+	// Only the pieces in view are known, and holding can use up one of them
+	depth = SDL_min(SDL_max(depth, 1), QUEUE_LENGTH);
+
+	bool found;
+	best->score = searchDeep(game, weights, depth, 0, &best->move, &found);
+	if (!found) {
+		return false;
+	}
+
+	struct SimGame next = *game;
+	best->linesCleared = simPlay(&next, &best->move);
+	return true;
+}
+
+// A game whose first bag comes out in the order'th way, with seeded bags after it
+struct Opening {
+	struct SimGame game;
+	enum PieceType firstBag[NUM_BLOCKS];
+	int dealt;
+	struct PieceBag bag;
+};
+
+static void startOpening(struct Opening* opening, Uint32 order) {
+	simReset(&opening->game, 1);
+	decodeBagPrefix(order, opening->firstBag, NUM_BLOCKS);
+	seedBag(&opening->bag, (order + 1) * 0x9e3779b9u);
+
+	opening->game.current = opening->firstBag[0];
+	for (int i = 0; i < QUEUE_LENGTH; i++) {
+		opening->game.queue[i] = opening->firstBag[i + 1];
+	}
+	opening->dealt = QUEUE_LENGTH + 1;
+}
+
+// Play a move, replacing whatever the game dealt into the queue with the opening's own pieces
+static void playOpening(struct Opening* opening, const struct Move* move) {
+	int taken = move->useHold && opening->game.held == NO_PIECE ? 2 : 1;
+	simPlay(&opening->game, move);
+
+	for (int i = QUEUE_LENGTH - taken; i < QUEUE_LENGTH; i++) {
+		opening->game.queue[i] = opening->dealt < NUM_BLOCKS ?
+			opening->firstBag[opening->dealt] :
+			nextBagPiece(&opening->bag);
+		opening->dealt++;
+	}
+}
+
+struct BookWorker {
+	struct BookEntry* entries;
+	Uint64 count;
+	Uint64 capacity;
+
+	// Set if the entries couldn't grow, which stops this worker and fails the build
+	bool outOfMemory;
+};
+
+static SDL_atomic_t nextOrder;
+static int bookPieces;
+static int bookDepth;
+static struct Weights bookWeights;
+
+static int bookThread(void* data) {
+	struct BookWorker* worker = data;
+
+	for (;;) {
+		Uint32 order = SDL_AtomicAdd(&nextOrder, 1);
+		if (order >= BAG_ORDERS) {
+			break;
+		}
+
+		struct Opening opening;
+		startOpening(&opening, order);
+
+		for (int i = 0; i < bookPieces && !opening.game.over; i++) {
+			struct BotMove best;
+			if (!findDeepMove(&opening.game, &bookWeights, bookDepth, &best)) {
+				break;
+			}
+
+			if (worker->count == worker->capacity) {
+				Uint64 capacity = SDL_max(worker->capacity * 2, 1024);
+				struct BookEntry* entries = realloc(worker->entries, capacity * sizeof(struct BookEntry));
+				if (entries == NULL) {
+					worker->outOfMemory = true;
+					return 0;
+				}
+				worker->entries = entries;
+				worker->capacity = capacity;
+			}
+
+			struct BookEntry* entry = &worker->entries[worker->count++];
+			entry->key = hashPosition(&opening.game, KEY_SEED);
+			entry->check = (Uint32)hashPosition(&opening.game, CHECK_SEED);
+			entry->useHold = best.move.useHold;
+			entry->rotation = best.move.rotation;
+			entry->x = best.move.x;
+			entry->y = best.move.y;
+
+			playOpening(&opening, &best.move);
+		}
+	}
+
+	return 0;
+}
+
+static int compareEntries(const void* a, const void* b) {
+	const struct BookEntry* x = a;
+	const struct BookEntry* y = b;
+	if (x->key != y->key) {
+		return x->key < y->key ? -1 : 1;
+	}
+	return x->check < y->check ? -1 : x->check > y->check;
+}
+
+// Play some openings again from the book alone, timing the lookups
+static void benchmarkBook(const char* path, double searchSeconds, Uint64 decisions) {
+	struct OpeningBook book;
+	if (!openBook(&book, path)) {
+		return;
+	}
+
+	Uint64 found = 0;
+	Uint64 lookups = 0;
+	Uint64 ticks = 0;
+
+	for (Uint32 order = 0; order < BAG_ORDERS; order += 7) {
+		struct Opening opening;
+		startOpening(&opening, order);
+
+		for (int i = 0; i < bookPieces && !opening.game.over; i++) {
+			Uint64 start = SDL_GetPerformanceCounter();
+			const struct BookEntry* entry = lookupBook(&book, &opening.game);
+			ticks += SDL_GetPerformanceCounter() - start;
+			lookups++;
+
+			if (entry == NULL) {
+				break;
+			}
+			found++;
+
+			struct Move move = { entry->useHold, entry->rotation, entry->x, entry->y };
+			playOpening(&opening, &move);
+		}
+	}
+
+	double lookupSeconds = ticks / (double)SDL_GetPerformanceFrequency();
+	printf("Replayed %llu of %llu moves from the book: %.0fns a lookup, against %.3fms a search\n",
+		(unsigned long long)found, (unsigned long long)lookups, lookupSeconds * 1e9 / SDL_max(lookups, 1),
+		searchSeconds * 1000 / SDL_max(decisions, 1));
+
+	closeBook(&book);
+}
+
+int buildBookMain(int argc, char* argv[]) {
+	if (argc < 1) {
+		printf("Usage: --build-book <book> [pieces] [depth] [threads] [weights file]\n");
+		return 1;
+	}
+
+	bookPieces = argc > 1 ? atoi(argv[1]) : NUM_BLOCKS;
+	bookDepth = argc > 2 ? atoi(argv[2]) : 2;
+	int threadCount = argc > 3 ? atoi(argv[3]) : SDL_GetCPUCount();
+	threadCount = SDL_max(threadCount, 1);
+
+	bookWeights = DEFAULT_WEIGHTS;
+	if (argc > 4 && !loadWeights(argv[4], &bookWeights)) {
+		printf("Failed to read weights from %s\n", argv[4]);
+		return 1;
+	}
+
+	initEngine();
+
+	struct BookWorker* workers = calloc(threadCount, sizeof(struct BookWorker));
+	SDL_Thread** threads = calloc(threadCount, sizeof(SDL_Thread*));
+	if (workers == NULL || threads == NULL) {
+		printf("Out of memory starting %d threads\n", threadCount);
+		free(threads);
+		free(workers);
+		return 1;
+	}
+
+	SDL_AtomicSet(&nextOrder, 0);
+	Uint64 start = SDL_GetPerformanceCounter();
+
+	for (int i = 0; i < threadCount; i++) {
+		threads[i] = SDL_CreateThread(bookThread, "book", &workers[i]);
+	}
+	for (int i = 0; i < threadCount; i++) {
+		SDL_WaitThread(threads[i], NULL);
+	}
+
+	double seconds = (SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+
+	// Gather everything into one sorted array, keeping one of each position
+	struct BookHeader header = { BOOK_MAGIC, BOOK_VERSION, sizeof(header), sizeof(struct BookEntry), SDL_min(SDL_max(bookDepth, 1), QUEUE_LENGTH), 0 };
+	Uint64 decisions = 0;
+	bool outOfMemory = false;
+	for (int i = 0; i < threadCount; i++) {
+		decisions += workers[i].count;
+		outOfMemory |= workers[i].outOfMemory;
+	}
+
+	// A book missing some openings would quietly play worse, so nothing is written
+	struct BookEntry* entries = outOfMemory ? NULL : malloc(SDL_max(decisions, 1) * sizeof(struct BookEntry));
+	if (entries == NULL) {
+		printf("Out of memory after searching %llu moves\n", (unsigned long long)decisions);
+	}
+	for (int i = 0; entries != NULL && i < threadCount; i++) {
+		memcpy(&entries[header.count], workers[i].entries, workers[i].count * sizeof(struct BookEntry));
+		header.count += workers[i].count;
+	}
+
+	SDL_RWops* file = entries != NULL ? SDL_RWFromFile(argv[0], "wb") : NULL;
+	bool success = entries != NULL && file != NULL;
+
+	if (success) {
+		qsort(entries, header.count, sizeof(struct BookEntry), compareEntries);
+
+		Uint64 unique = 0;
+		for (Uint64 i = 0; i < header.count; i++) {
+			if (unique == 0 || compareEntries(&entries[unique - 1], &entries[i]) != 0) {
+				entries[unique++] = entries[i];
+			}
+		}
+		header.count = unique;
+
+		success = SDL_RWwrite(file, &header, sizeof(header), 1) == 1 &&
+			SDL_RWwrite(file, entries, sizeof(struct BookEntry), header.count) == header.count;
+	}
+	if (file != NULL) {
+		success &= SDL_RWclose(file) == 0;
+	}
+	free(entries);
+
+	if (success) {
+		printf("Searched %llu moves from %d openings in %.2fs, %llu positions in the book\n",
+			(unsigned long long)decisions, BAG_ORDERS, seconds, (unsigned long long)header.count);
+		benchmarkBook(argv[0], seconds * threadCount, decisions);
+	}
+	else {
+		printf("Failed to write %s\n", argv[0]);
+	}
+
+	for (int i = 0; i < threadCount; i++) {
+		free(workers[i].entries);
+	}
+	free(threads);
+	free(workers);
+
+	return success ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <SDL2/SDL.h>
+
+#include "bot.h"
+#include "engine.h"
+
+#define BOOK_MAGIC SDL_FOURCC('T', 'B', 'O', 'K')
+#define BOOK_VERSION 1
+
+// An opening book of the bot's moves for the start of a game, found offline
+// with a deeper search than the bot can afford while playing. Positions are
+// keyed by a hash of the board, current piece, hold and queue, with a second,
+// independent hash to catch collisions. Entries are sorted by key, so the book
+// is binary searched straight from a memory-mapped file.
+struct BookHeader {
+	Uint32 magic;
+	Uint16 version;
+	Uint16 headerSize;
+	Uint32 entrySize;
+
+	// Pieces looked ahead when building the book
+	Uint32 depth;
+	Uint64 count;
+};
+
+struct BookEntry {
+	Uint64 key;
+	Uint32 check;
+
+	Uint8 useHold;
+	Uint8 rotation;
+	Sint8 x;
+	Sint8 y;
+};
+
+struct OpeningBook {
+	const void* data;
+	size_t size;
+	const struct BookHeader* header;
+	const struct BookEntry* entries;
+};
+
+bool openBook(struct OpeningBook* book, const char* path);
+void closeBook(struct OpeningBook* book);
+
+// The book's move for a position, or NULL if it isn't in the book
+const struct BookEntry* lookupBook(const struct OpeningBook* book, const struct SimGame* game);
+
+// Pick a move by trying every placement of the next depth pieces, with hold,
+// and scoring the boards at the end. Depth 1 is the same as findBestMove.
+bool findDeepMove(const struct SimGame* game, const struct Weights* weights, int depth, struct BotMove* best);
+
+// Play the start of a game from every order the first bag can come in, and
+// store every decision.
+// Arguments: <book> [pieces] [depth] [threads] [weights file]
+int buildBookMain(int argc, char* argv[]);
@@ -0,0 +1,188 @@
+#include <float.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bot.h"
+
+// Last, so the autoplay search on the logic thread is counted
+#include "alloccount.h"
+
+const struct Weights DEFAULT_WEIGHTS = {
+	.height = -0.51f,
+	.holes = -0.36f,
+	.bumpiness = -0.18f,
+	.wells = -0.05f,
+	.lines = 0.76f,
+};
+
+static const struct {
+	const char* name;
+	size_t offset;
+} WEIGHT_NAMES[] = {
+	{ "height", offsetof(struct Weights, height) },
+	{ "holes", offsetof(struct Weights, holes) },
+	{ "bumpiness", offsetof(struct Weights, bumpiness) },
+	{ "wells", offsetof(struct Weights, wells) },
+	{ "lines", offsetof(struct Weights, lines) },
+};
+
+bool loadWeights(const char* path, struct Weights* weights) {
+	SDL_RWops* file = SDL_RWFromFile(path, "rb");
+	if (file == NULL) {
+		return false;
+	}
+
+	Sint64 size = SDL_RWsize(file);
+	char* text = malloc(size + 1);
+	bool read = text != NULL && size >= 0 && SDL_RWread(file, text, size, 1) == (size > 0 ? 1 : 0);
+	SDL_RWclose(file);
+
+	if (!read) {
+		free(text);
+		return false;
+	}
+	text[size] = '\0';
+
+	for (char* line = strtok(text, "\n"); line != NULL; line = strtok(NULL, "\n")) {
+		char name[64];
+		float value;
+		if (sscanf(line, "%63s %f", name, &value) != 2) {
+			continue;
+		}
+
+		for (int i = 0; i < SDL_arraysize(WEIGHT_NAMES); i++) {
+			if (strcmp(name, WEIGHT_NAMES[i].name) == 0) {
+				*(float*)((char*)weights + WEIGHT_NAMES[i].offset) = value;
+			}
+		}
+	}
+
+	free(text);
+	return true;
+}
+
+bool writeWeights(const char* path, const struct Weights* weights) {
+	SDL_RWops* file = SDL_RWFromFile(path, "wb");
+	if (file == NULL) {
+		printf("Failed to open %s: %s\n", path, SDL_GetError());
+		return false;
+	}
+
+	bool success = true;
+	for (int i = 0; i < SDL_arraysize(WEIGHT_NAMES); i++) {
+		char line[128];
+		int length = snprintf(line, sizeof(line), "%s %.6f\n",
+			WEIGHT_NAMES[i].name, *(const float*)((const char*)weights + WEIGHT_NAMES[i].offset));
+		success &= SDL_RWwrite(file, line, length, 1) == 1;
+	}
+
+	success &= SDL_RWclose(file) == 0;
+	return success;
+}
+
+static int countBits(Uint16 bits) {
+	int count = 0;
+	while (bits) {
+		bits &= bits - 1;
+		count++;
+	}
+	return count;
+}
+
+float evaluateBoard(const struct Bitboard* board, int linesCleared, const struct Weights* weights) {
+	int heights[BLOCKS_X] = { 0 };
+	int holes = 0;
+
+	// Walk down each column, counting empty cells below the first solid one
+	Uint16 seen = 0;
+	for (int y = 0; y < BLOCKS_Y; y++) {
+		Uint16 row = board->rows[y];
+		Uint16 covered = seen & ~row;
+		Uint16 first = row & ~seen;
+
+		holes += countBits(covered);
+		for (int x = 0; x < BLOCKS_X; x++) {
+			if (first & (1 << x)) {
+				heights[x] = BLOCKS_Y - y;
+			}
+		}
+
+		seen |= row;
+	}
+
+	int height = 0;
+	int bumpiness = 0;
+	int wells = 0;
+	for (int x = 0; x < BLOCKS_X; x++) {
+		height += heights[x];
+
+		if (x > 0) {
+			bumpiness += SDL_abs(heights[x] - heights[x - 1]);
+		}
+
+		int left = x > 0 ? heights[x - 1] : BLOCKS_Y;
+		int right = x < BLOCKS_X - 1 ? heights[x + 1] : BLOCKS_Y;
+		int depth = SDL_min(left, right) - heights[x];
+		if (depth > 0) {
+			wells += depth;
+		}
+	}
+
+	return weights->height * height +
+		weights->holes * holes +
+		weights->bumpiness * bumpiness +
+		weights->wells * wells +
+		weights->lines * linesCleared;
+}
+
+struct Search {
+	const struct Bitboard* board;
+	const struct Weights* weights;
+	enum PieceType type;
+	bool useHold;
+	struct BotMove* best;
+	bool found;
+};
+
+static void considerPlacement(void* data, int rotation, int x, int y) {
+	struct Search* search = data;
+
+	struct Bitboard after = *search->board;
+	int cleared = bitboardPlace(&after, search->type, rotation, x, y);
+	float score = evaluateBoard(&after, cleared, search->weights);
+
+	if (!search->found || score > search->best->score) {
+		search->found = true;
+		search->best->move.useHold = search->useHold;
+		search->best->move.rotation = rotation;
+		search->best->move.x = x;
+		search->best->move.y = y;
+		search->best->linesCleared = cleared;
+		search->best->score = score;
+	}
+}
+
+bool findBestMove(const struct SimGame* game, const struct Weights* weights, struct BotMove* best) {
+	struct Search search = {
+		.board = &game->board,
+		.weights = weights,
+		.best = best,
+		.found = false,
+	};
+
+	for (int useHold = 0; useHold <= (game->canHold ? 1 : 0); useHold++) {
+		search.useHold = useHold;
+		search.type = simMovePiece(game, useHold);
+
+		// Holding into the same piece can't do any better
+		if (useHold && search.type == game->current) {
+			continue;
+		}
+
+		forEachPlacement(&game->board, search.type, considerPlacement, &search);
+	}
+
+	return search.found;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "engine.h"
+
+// Linear evaluation weights for a board after a placement. Higher scores are better.
+struct Weights {
+	float height;
+	float holes;
+	float bumpiness;
+	float wells;
+	float lines;
+};
+
+extern const struct Weights DEFAULT_WEIGHTS;
+
+// Weights files are text, one "name value" line per weight. Anything missing
+// from the file keeps the value it had.
+bool loadWeights(const char* path, struct Weights* weights);
+bool writeWeights(const char* path, const struct Weights* weights);
+
+float evaluateBoard(const struct Bitboard* board, int linesCleared, const struct Weights* weights);
+
+struct BotMove {
+	struct Move move;
+	int linesCleared;
+	float score;
+};
+
+// Picks the best placement for the current piece, or for the hold piece if
+// holding is allowed. Returns false if there is nowhere to go.
+bool findBestMove(const struct SimGame* game, const struct Weights* weights, struct BotMove* best);
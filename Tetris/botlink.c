@@ -0,0 +1,282 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "botlink.h"
+#include "bot.h"
+#include "engine.h"
+#include "shm.h"
+#include "tetris.h"
+
+// Last, so exchanging moves with the bot each tick is counted
+#include "alloccount.h"
+
+SDL_COMPILE_TIME_ASSERT(botStateSize, sizeof(struct BotState) == 64);
+
+// How many times a reader copies the state before giving up on it settling
+#define BOT_READ_ATTEMPTS 1000
+
+static const char* linkChannel;
+static struct BotLinkHeader* botLink;
+
+// The game's end of the input ring
+static Uint32 inputRead;
+static Uint32 botButtons;
+
+bool startBotLink(const char* channel) {
+	void* memory = createSharedMemory(channel, sizeof(struct BotLinkHeader));
+	if (memory == NULL) {
+		return false;
+	}
+
+	botLink = memory;
+	linkChannel = channel;
+	inputRead = 0;
+	botButtons = 0;
+
+	memset(botLink, 0, sizeof(*botLink));
+	botLink->magic = BOT_LINK_MAGIC;
+	botLink->version = BOT_LINK_VERSION;
+	botLink->headerSize = sizeof(struct BotLinkHeader);
+	SDL_AtomicSet(&botLink->running, 1);
+
+	return true;
+}
+
+void stopBotLink() {
+	if (botLink != NULL) {
+		SDL_AtomicSet(&botLink->running, 0);
+		closeSharedMemory(linkChannel, botLink, sizeof(struct BotLinkHeader), true);
+		botLink = NULL;
+	}
+}
+
+Uint32 botLinkInput() {
+	if (botLink == NULL) {
+		return 0;
+	}
+
+	Uint32 written = SDL_AtomicGet(&botLink->inputWritten);
+	if (written != inputRead) {
+		// Anything further ahead than the ring holds was never valid, so skip to the newest
+		if (written - inputRead > BOT_INPUT_RING_SIZE) {
+			inputRead = written - 1;
+		}
+
+		botButtons = botLink->inputs[inputRead % BOT_INPUT_RING_SIZE] & BOT_BUTTONS;
+		inputRead++;
+		SDL_AtomicSet(&botLink->inputRead, inputRead);
+	}
+
+	return botButtons;
+}
+
+static void captureState(struct BotState* state) {
+	struct Bitboard bitboard;
+	readBoardRows(&bitboard, 0, BLOCKS_Y - 1);
+
+	state->tick = time / TICK_LENGTH;
+	memcpy(state->rows, bitboard.rows, sizeof(state->rows));
+
+	state->x = currentBlock.x;
+	state->y = currentBlock.y;
+	state->type = currentBlock.type;
+	state->rotation = currentBlock.rotation;
+
+	for (int i = 0; i < QUEUE_LENGTH; i++) {
+		state->queue[i] = pieceQueue[i];
+	}
+
+	state->heldPieceType = heldPieceType;
+	state->pieceHeld = pieceHeld;
+	state->canHold = canHold;
+	state->gameState = gameState;
+
+	state->lines = lines;
+	state->level = level;
+}
+
+void botLinkTick() {
+	if (botLink == NULL) {
+		return;
+	}
+
+	// Atomic adds are full barriers, so the state is written strictly between them
+	SDL_AtomicAdd(&botLink->sequence, 1);
+	captureState(&botLink->state);
+	SDL_AtomicAdd(&botLink->sequence, 1);
+}
+
+bool openBotClient(struct BotClient* client, const char* channel) {
+	memset(client, 0, sizeof(*client));
+
+	client->memory = openWritableSharedMemory(channel, &client->size);
+	if (client->memory == NULL) {
+		printf("No game is linked on %s\n", channel);
+		return false;
+	}
+
+	const struct BotLinkHeader* header = client->memory;
+	bool valid = client->size >= sizeof(*header) &&
+		header->magic == BOT_LINK_MAGIC &&
+		header->version == BOT_LINK_VERSION &&
+		header->headerSize == sizeof(*header);
+
+	if (!valid) {
+		printf("%s is not a valid bot link\n", channel);
+		closeSharedMemory(channel, client->memory, client->size, false);
+		return false;
+	}
+
+	client->channel = channel;
+	client->header = client->memory;
+	return true;
+}
+
+void closeBotClient(struct BotClient* client) {
+	if (client->memory != NULL) {
+		closeSharedMemory(client->channel, client->memory, client->size, false);
+	}
+	memset(client, 0, sizeof(*client));
+}
+
+bool readBotState(const struct BotClient* client, struct BotState* state) {
+	SDL_atomic_t* sequence = &client->header->sequence;
+
+	for (int i = 0; i < BOT_READ_ATTEMPTS; i++) {
+		int before = SDL_AtomicGet(sequence);
+		if (before & 1) {
+			continue;
+		}
+
+		memcpy(state, &client->header->state, sizeof(*state));
+
+		SDL_MemoryBarrierAcquire();
+		if (SDL_AtomicGet(sequence) == before) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool sendBotInput(struct BotClient* client, Uint32 buttons) {
+	struct BotLinkHeader* header = client->header;
+	Uint32 written = SDL_AtomicGet(&header->inputWritten);
+
+	if (written - (Uint32)SDL_AtomicGet(&header->inputRead) >= BOT_INPUT_RING_SIZE) {
+		return false;
+	}
+
+	header->inputs[written % BOT_INPUT_RING_SIZE] = buttons;
+	SDL_AtomicSet(&header->inputWritten, written + 1);
+	return true;
+}
+
+int botLinkMain(int argc, char* argv[]) {
+	if (argc < 1) {
+		printf("Usage: --bot-link <channel>\n");
+		return 1;
+	}
+
+	if (!startBotLink(argv[0])) {
+		return 1;
+	}
+
+	int result = runGame();
+	stopBotLink();
+	return result;
+}
+
+// Wait until the game has run every button sent so far, and get the state after them.
+// Returns false if the game has gone away.
+static bool waitForGame(struct BotClient* client, struct BotState* state) {
+	struct BotLinkHeader* header = client->header;
+
+	while (SDL_AtomicGet(&header->inputRead) != SDL_AtomicGet(&header->inputWritten)) {
+		if (!SDL_AtomicGet(&header->running)) {
+			return false;
+		}
+		SDL_Delay(1);
+	}
+
+	// The last button is taken at the start of a tick, and published at its end
+	struct BotState before;
+	if (!readBotState(client, &before)) {
+		return false;
+	}
+
+	do {
+		if (!SDL_AtomicGet(&header->running)) {
+			return false;
+		}
+		SDL_Delay(1);
+	} while (!readBotState(client, state) || state->tick == before.tick);
+
+	return true;
+}
+
+// Press and release a button, one tick each
+static void tapButton(struct BotClient* client, Uint32 button, int times) {
+	for (int i = 0; i < times; i++) {
+		sendBotInput(client, button);
+		sendBotInput(client, 0);
+	}
+}
+
+int botClientMain(int argc, char* argv[]) {
+	if (argc < 1) {
+		printf("Usage: --bot-client <channel>\n");
+		return 1;
+	}
+
+	struct BotClient client;
+	if (!openBotClient(&client, argv[0])) {
+		return 1;
+	}
+
+	int pieces = 0;
+	struct BotState state;
+
+	while (waitForGame(&client, &state) && state.gameState != GAME_OVER) {
+		if (state.gameState != GAME_RUN) {
+			continue;
+		}
+
+		struct SimGame game;
+		memset(&game, 0, sizeof(game));
+		memcpy(game.board.rows, state.rows, sizeof(game.board.rows));
+		game.current = state.type % NUM_BLOCKS;
+		for (int i = 0; i < QUEUE_LENGTH; i++) {
+			game.queue[i] = state.queue[i] % NUM_BLOCKS;
+		}
+		game.held = NO_PIECE;
+		game.canHold = false;
+
+		struct BotMove best;
+		if (!findBestMove(&game, &DEFAULT_WEIGHTS, &best)) {
+			break;
+		}
+
+		// Rotate first, then shift from wherever any kick left the piece
+		int turns = (best.move.rotation - state.rotation + 4) % 4;
+		if (turns == 3) {
+			tapButton(&client, BUTTON_ROTATE_LEFT, 1);
+		}
+		else {
+			tapButton(&client, BUTTON_ROTATE_RIGHT, turns);
+		}
+
+		if (turns != 0 && !waitForGame(&client, &state)) {
+			break;
+		}
+
+		int shift = best.move.x - state.x;
+		tapButton(&client, shift < 0 ? BUTTON_LEFT : BUTTON_RIGHT, SDL_abs(shift));
+		tapButton(&client, BUTTON_DROP, 1);
+		pieces++;
+	}
+
+	printf("Placed %d pieces, %u lines\n", pieces, state.lines);
+	closeBotClient(&client);
+	return 0;
+}
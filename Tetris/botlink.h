@@ -0,0 +1,99 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <SDL2/SDL.h>
+
+#include "tetris.h"
+
+#define BOT_LINK_MAGIC SDL_FOURCC('T', 'B', 'O', 'T')
+#define BOT_LINK_VERSION 1
+
+// A bot link lets a bot in another process watch and play the real game. The
+// game publishes its state into shared memory every tick, guarded by a
+// sequence lock so readers never hold it up: the count is odd while the state
+// is being written, and a reader that sees it change while copying just reads
+// again. The bot sends buttons back through a single producer, single consumer
+// ring, which is merged with the keyboard before the tick is recorded and run.
+#define BOT_INPUT_RING_SIZE 256
+
+// Buttons a bot can hold. Saving and loading touch files, so they're left out.
+#define BOT_BUTTONS (BUTTON_LEFT | BUTTON_RIGHT | BUTTON_DOWN | BUTTON_ROTATE_RIGHT | BUTTON_ROTATE_LEFT | \
+	BUTTON_DROP | BUTTON_HOLD | BUTTON_PAUSE | BUTTON_REWIND)
+
+struct BotState {
+	Uint32 tick;
+
+	// Bit x is set if cell x of board row y is solid
+	Uint16 rows[BLOCKS_Y];
+
+	Sint8 x;
+	Sint8 y;
+	Uint8 type;
+	Uint8 rotation;
+
+	Uint8 queue[QUEUE_LENGTH];
+
+	Uint8 heldPieceType;
+	Uint8 pieceHeld;
+	Uint8 canHold;
+	Uint8 gameState;
+
+	Uint32 lines;
+	Uint32 level;
+};
+
+struct BotLinkHeader {
+	Uint32 magic;
+	Uint16 version;
+	Uint16 headerSize;
+
+	// Cleared when the game stops publishing
+	SDL_atomic_t running;
+
+	SDL_atomic_t sequence;
+	struct BotState state;
+
+	// Buttons sent by the bot. Each entry replaces the buttons it holds and
+	// lasts at least one tick, so presses and releases are never merged.
+	SDL_atomic_t inputWritten;
+	SDL_atomic_t inputRead;
+	Uint32 inputs[BOT_INPUT_RING_SIZE];
+};
+
+// Start publishing the game to the named channel
+bool startBotLink(const char* channel);
+void stopBotLink();
+
+// The buttons the bot holds this tick, taking the next one it sent if there
+// is one. 0 unless a link is running.
+Uint32 botLinkInput();
+
+// Publish the game as it is after this tick. Does nothing unless a link is running.
+void botLinkTick();
+
+// The bot's end of a link
+struct BotClient {
+	const char* channel;
+	void* memory;
+	size_t size;
+
+	struct BotLinkHeader* header;
+};
+
+bool openBotClient(struct BotClient* client, const char* channel);
+void closeBotClient(struct BotClient* client);
+
+// Copy a consistent state out. Returns false if the game kept writing it the
+// whole time, which only happens if the game is stalled mid-tick.
+bool readBotState(const struct BotClient* client, struct BotState* state);
+
+// Returns false if the ring is full
+bool sendBotInput(struct BotClient* client, Uint32 buttons);
+
+// Play the game with a link open. Arguments: <channel>
+int botLinkMain(int argc, char* argv[]);
+
+// Play a linked game with the built-in bot from another process. Arguments: <channel>
+int botClientMain(int argc, char* argv[]);
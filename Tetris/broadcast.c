@@ -0,0 +1,452 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "broadcast.h"
+#include "shm.h"
+#include "tetris.h"
+
+// Last, so publishing each tick is counted
+#include "alloccount.h"
+
+SDL_COMPILE_TIME_ASSERT(broadcastRecordSize, sizeof(struct BroadcastRecord) == 8);
+
+#define RECORD_ALIGN 8
+#define ALIGN_RECORD(x) (((x) + RECORD_ALIGN - 1) & ~(RECORD_ALIGN - 1))
+
+// Comfortably more than a keyframe, which is the largest record. The ring is
+// followed by this much slack, so reading a record that is being overwritten
+// can't run off the end.
+#define MAX_RECORD_SIZE 256
+
+#define ALL_ROWS ((1u << BLOCKS_Y) - 1)
+#define ALL_FIELDS (FIELD_ROWS | FIELD_POSE | FIELD_QUEUE | FIELD_HOLD | FIELD_SCORE | FIELD_STATE)
+
+// The parts of the game a record can carry, other than the board
+struct BroadcastState {
+	Sint8 x;
+	Sint8 y;
+	Uint8 type;
+	Uint8 rotation;
+
+	Uint8 queue[QUEUE_LENGTH];
+
+	Uint8 heldPieceType;
+	Uint8 pieceHeld;
+
+	Uint32 lines;
+	Uint32 level;
+
+	Uint8 gameState;
+	Uint8 lineCount;
+	Uint8 linesToClear[4];
+	Uint8 clearTimer;
+	Uint8 unpausing;
+	Uint8 unpauseCounter;
+};
+
+// Bytes from one member of BroadcastState to another, both included, for the
+// fields that are copied straight into a record
+#define STATE_SPAN(first, last) \
+	(offsetof(struct BroadcastState, last) + sizeof(((struct BroadcastState*)0)->last) - offsetof(struct BroadcastState, first))
+
+#define POSE_SIZE STATE_SPAN(x, rotation)
+#define GAME_STATE_SIZE STATE_SPAN(gameState, unpauseCounter)
+
+// As spectators read them, see enum RecordField
+SDL_COMPILE_TIME_ASSERT(broadcastPoseSize, POSE_SIZE == 4);
+SDL_COMPILE_TIME_ASSERT(broadcastGameStateSize, GAME_STATE_SIZE == 9);
+
+static const char* writerChannel;
+static struct BroadcastHeader* writer;
+static Uint8* writerRing;
+static Uint32 writerTicks;
+
+// What the last record left the spectators with
+static struct BroadcastState sent;
+
+static void captureState(struct BroadcastState* state) {
+	memset(state, 0, sizeof(*state));
+
+	state->x = currentBlock.x;
+	state->y = currentBlock.y;
+	state->type = currentBlock.type;
+	state->rotation = currentBlock.rotation;
+
+	for (int i = 0; i < QUEUE_LENGTH; i++) {
+		state->queue[i] = pieceQueue[i];
+	}
+
+	state->heldPieceType = heldPieceType;
+	state->pieceHeld = pieceHeld;
+
+	state->lines = lines;
+	state->level = level;
+
+	state->gameState = gameState;
+	state->lineCount = lineCount;
+	for (int i = 0; i < lineCount && i < 4; i++) {
+		state->linesToClear[i] = linesToClear[i];
+	}
+	state->clearTimer = clearTimer;
+	state->unpausing = unpausing;
+	state->unpauseCounter = unpauseCounter;
+}
+
+bool startBroadcast(const char* channel) {
+	size_t size = sizeof(struct BroadcastHeader) + BROADCAST_RING_SIZE + MAX_RECORD_SIZE;
+
+	void* memory = createSharedMemory(channel, size);
+	if (memory == NULL) {
+		return false;
+	}
+
+	writer = memory;
+	writerRing = (Uint8*)memory + sizeof(struct BroadcastHeader);
+	writerChannel = channel;
+	writerTicks = 0;
+
+	writer->magic = BROADCAST_MAGIC;
+	writer->version = BROADCAST_VERSION;
+	writer->headerSize = sizeof(struct BroadcastHeader);
+	writer->ringSize = BROADCAST_RING_SIZE;
+	SDL_AtomicSet(&writer->writePos, 0);
+	SDL_AtomicSet(&writer->keyframePos, 0);
+
+	return true;
+}
+
+void stopBroadcast() {
+	if (writer != NULL) {
+		closeSharedMemory(writerChannel, writer, sizeof(struct BroadcastHeader) + BROADCAST_RING_SIZE + MAX_RECORD_SIZE, true);
+		writer = NULL;
+		writerRing = NULL;
+	}
+}
+
+// Room for the largest record where the next one goes, padding out the end of
+// the ring first if it doesn't fit there
+static Uint8* reserveRecord(Uint32* pos) {
+	*pos = SDL_AtomicGet(&writer->writePos);
+
+	Uint32 offset = *pos % BROADCAST_RING_SIZE;
+	Uint32 left = BROADCAST_RING_SIZE - offset;
+
+	if (left < MAX_RECORD_SIZE) {
+		struct BroadcastRecord* pad = (struct BroadcastRecord*)&writerRing[offset];
+		pad->size = left;
+		pad->kind = RECORD_PAD;
+		pad->fields = 0;
+		pad->tick = writerTicks;
+
+		*pos += left;
+		SDL_AtomicSet(&writer->writePos, *pos);
+		offset = 0;
+	}
+
+	return &writerRing[offset];
+}
+
+static Uint8* writeBytes(Uint8* out, const void* data, size_t size) {
+	memcpy(out, data, size);
+	return out + size;
+}
+
+void broadcastTick() {
+	if (writer == NULL) {
+		return;
+	}
+
+	bool keyframe = writerTicks % BROADCAST_KEYFRAME_INTERVAL == 0;
+
+	struct BroadcastState state;
+	captureState(&state);
+
+	Uint32 rows = keyframe ? ALL_ROWS : changedRows;
+	changedRows = 0;
+
+	Uint8 fields = keyframe ? ALL_FIELDS : 0;
+	if (!keyframe) {
+		if (rows != 0) {
+			fields |= FIELD_ROWS;
+		}
+		if (memcmp(&state.x, &sent.x, POSE_SIZE) != 0) {
+			fields |= FIELD_POSE;
+		}
+		if (memcmp(state.queue, sent.queue, sizeof(state.queue)) != 0) {
+			fields |= FIELD_QUEUE;
+		}
+		if (state.heldPieceType != sent.heldPieceType || state.pieceHeld != sent.pieceHeld) {
+			fields |= FIELD_HOLD;
+		}
+		if (state.lines != sent.lines || state.level != sent.level) {
+			fields |= FIELD_SCORE;
+		}
+		if (memcmp(&state.gameState, &sent.gameState, GAME_STATE_SIZE) != 0) {
+			fields |= FIELD_STATE;
+		}
+	}
+
+	if (fields == 0) {
+		writerTicks++;
+		return;
+	}
+
+	Uint32 pos;
+	Uint8* record = reserveRecord(&pos);
+	Uint8* out = record + sizeof(struct BroadcastRecord);
+
+	if (fields & FIELD_ROWS) {
+		out = writeBytes(out, &rows, sizeof(rows));
+		for (int y = 0; y < BLOCKS_Y; y++) {
+			if (rows & (1 << y)) {
+				Uint16 solid;
+				Uint32 pieces;
+				// Broadcasts only carry the standard pieces, which fit in 3 bits
+				packRow(y, &solid, &pieces, NULL);
+				out = writeBytes(out, &solid, sizeof(solid));
+				out = writeBytes(out, &pieces, sizeof(pieces));
+			}
+		}
+	}
+	if (fields & FIELD_POSE) {
+		out = writeBytes(out, &state.x, POSE_SIZE);
+	}
+	if (fields & FIELD_QUEUE) {
+		out = writeBytes(out, state.queue, sizeof(state.queue));
+	}
+	if (fields & FIELD_HOLD) {
+		*out++ = state.heldPieceType;
+		*out++ = state.pieceHeld;
+	}
+	if (fields & FIELD_SCORE) {
+		out = writeBytes(out, &state.lines, sizeof(state.lines));
+		out = writeBytes(out, &state.level, sizeof(state.level));
+	}
+	if (fields & FIELD_STATE) {
+		out = writeBytes(out, &state.gameState, GAME_STATE_SIZE);
+	}
+
+	struct BroadcastRecord header = {
+		.size = ALIGN_RECORD(out - record),
+		.kind = keyframe ? RECORD_KEYFRAME : RECORD_DELTA,
+		.fields = fields,
+		.tick = writerTicks,
+	};
+	memcpy(record, &header, sizeof(header));
+
+	// Publish the record before pointing anyone at it as a keyframe
+	SDL_AtomicSet(&writer->writePos, pos + header.size);
+	if (keyframe) {
+		SDL_AtomicSet(&writer->keyframePos, pos);
+	}
+
+	sent = state;
+	writerTicks++;
+}
+
+bool openSpectator(struct Spectator* spectator, const char* channel) {
+	memset(spectator, 0, sizeof(*spectator));
+
+	spectator->memory = openSharedMemory(channel, &spectator->size);
+	if (spectator->memory == NULL) {
+		printf("Nothing is broadcasting on %s\n", channel);
+		return false;
+	}
+
+	const struct BroadcastHeader* header = spectator->memory;
+	bool valid = spectator->size >= sizeof(*header) &&
+		header->magic == BROADCAST_MAGIC &&
+		header->ringSize >= MAX_RECORD_SIZE * 2 &&
+		header->headerSize + (size_t)header->ringSize + MAX_RECORD_SIZE <= spectator->size;
+
+	if (!valid) {
+		printf("%s is not a valid broadcast\n", channel);
+		closeSharedMemory(channel, spectator->memory, spectator->size, false);
+		return false;
+	}
+
+	spectator->channel = channel;
+	spectator->header = header;
+	spectator->ring = (const Uint8*)spectator->memory + header->headerSize;
+	return true;
+}
+
+void closeSpectator(struct Spectator* spectator) {
+	if (spectator->memory != NULL) {
+		closeSharedMemory(spectator->channel, spectator->memory, spectator->size, false);
+	}
+	memset(spectator, 0, sizeof(*spectator));
+}
+
+// Whether the writer may have started overwriting the bytes from pos onwards.
+// Records are read in place, so this is checked again after reading one.
+static bool overwritten(const struct Spectator* spectator, Uint32 pos) {
+	Uint32 written = SDL_AtomicGet((SDL_atomic_t*)&spectator->header->writePos) - pos;
+	return written > spectator->header->ringSize - MAX_RECORD_SIZE;
+}
+
+static const Uint8* readBytes(const Uint8* in, void* data, size_t size) {
+	memcpy(data, in, size);
+	return in + size;
+}
+
+static void applyRecord(const struct BroadcastRecord* record) {
+	const Uint8* in = (const Uint8*)record + sizeof(*record);
+
+	if (record->fields & FIELD_ROWS) {
+		Uint32 rows;
+		in = readBytes(in, &rows, sizeof(rows));
+		for (int y = 0; y < BLOCKS_Y; y++) {
+			if (rows & (1 << y)) {
+				Uint16 solid;
+				Uint32 pieces;
+				in = readBytes(in, &solid, sizeof(solid));
+				in = readBytes(in, &pieces, sizeof(pieces));
+				unpackRow(y, solid, pieces, 0);
+			}
+		}
+	}
+	if (record->fields & FIELD_POSE) {
+		currentBlock.x = (Sint8)in[0];
+		currentBlock.y = (Sint8)in[1];
+		currentBlock.type = in[2] % NUM_BLOCKS;
+		currentBlock.rotation = in[3] % 4;
+		in += POSE_SIZE;
+	}
+	if (record->fields & FIELD_QUEUE) {
+		for (int i = 0; i < QUEUE_LENGTH; i++) {
+			pieceQueue[i] = in[i] % NUM_BLOCKS;
+		}
+		in += QUEUE_LENGTH;
+	}
+	if (record->fields & FIELD_HOLD) {
+		heldPieceType = in[0] % NUM_BLOCKS;
+		pieceHeld = in[1];
+		in += 2;
+	}
+	if (record->fields & FIELD_SCORE) {
+		Uint32 value;
+		in = readBytes(in, &value, sizeof(value));
+		lines = value;
+		in = readBytes(in, &value, sizeof(value));
+		level = value;
+	}
+	if (record->fields & FIELD_STATE) {
+		gameState = SDL_min(in[0], GAME_OVER);
+		lineCount = SDL_min(in[1], 4);
+		for (int i = 0; i < lineCount; i++) {
+			linesToClear[i] = in[2 + i] % BLOCKS_Y;
+		}
+		clearTimer = in[6];
+		unpausing = in[7];
+		unpauseCounter = in[8];
+	}
+}
+
+bool spectatorUpdate(struct Spectator* spectator) {
+	const struct BroadcastHeader* header = spectator->header;
+	SDL_atomic_t* writePos = (SDL_atomic_t*)&header->writePos;
+
+	if (!spectator->synced) {
+		if (SDL_AtomicGet(writePos) == 0) {
+			return false;
+		}
+
+		// Start from the newest keyframe, unless it is already being overwritten
+		Uint32 keyframe = SDL_AtomicGet((SDL_atomic_t*)&header->keyframePos);
+		if (overwritten(spectator, keyframe)) {
+			return false;
+		}
+
+		spectator->cursor = keyframe;
+		spectator->synced = true;
+	}
+
+	bool changed = false;
+	while (spectator->cursor != (Uint32)SDL_AtomicGet(writePos)) {
+		if (overwritten(spectator, spectator->cursor)) {
+			spectator->synced = false;
+			spectator->resyncs++;
+			break;
+		}
+
+		const struct BroadcastRecord* record = (const struct BroadcastRecord*)&spectator->ring[spectator->cursor % header->ringSize];
+		Uint16 size = record->size;
+		Uint8 kind = record->kind;
+
+		if (kind != RECORD_PAD) {
+			applyRecord(record);
+			changed = true;
+		}
+
+		// If the writer got here while the record was being read, it may be
+		// garbage, and so may anything applied from it: start again from a keyframe
+		if (overwritten(spectator, spectator->cursor) || size < sizeof(*record) || size % RECORD_ALIGN != 0) {
+			spectator->synced = false;
+			spectator->resyncs++;
+			break;
+		}
+
+		spectator->cursor += size;
+	}
+
+	return changed;
+}
+
+int broadcastMain(int argc, char* argv[]) {
+	if (argc < 1) {
+		printf("Usage: --broadcast <channel>\n");
+		return 1;
+	}
+
+	if (!startBroadcast(argv[0])) {
+		return 1;
+	}
+
+	int result = runGame();
+	stopBroadcast();
+	return result;
+}
+
+int spectateMain(int argc, char* argv[]) {
+	if (argc < 1) {
+		printf("Usage: --spectate <channel>\n");
+		return 1;
+	}
+
+	struct Spectator spectator;
+	if (!openSpectator(&spectator, argv[0])) {
+		return 1;
+	}
+
+	char title[128];
+	snprintf(title, sizeof(title), "Tetris - watching %s", argv[0]);
+	openWindow(title);
+	loadDeferredFont();
+
+	// Only the board and pieces come from the stream; this fills in everything else
+	resetGame(0);
+
+	bool running = true;
+	while (running) {
+		SDL_Event e;
+		while (SDL_PollEvent(&e)) {
+			if (e.type == SDL_QUIT) {
+				running = false;
+			}
+		}
+
+		if (spectatorUpdate(&spectator)) {
+			publishRenderState();
+		}
+		else {
+			SDL_Delay(1);
+		}
+
+		drawFrame(acquireRenderState());
+	}
+
+	closeSpectator(&spectator);
+	return 0;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+#include "tetris.h"
+
+#define BROADCAST_MAGIC SDL_FOURCC('T', 'B', 'R', 'D')
+#define BROADCAST_VERSION 1
+
+// A broadcast is a shared memory ring of records, written once by the game and
+// read in place by any number of spectator processes. Each reader keeps its own
+// cursor, so the writer's work doesn't depend on how many are watching. Readers
+// that fall a whole ring behind skip ahead to the latest keyframe.
+#define BROADCAST_RING_SIZE (256 * 1024)
+
+// A full state every second, for viewers joining or catching up
+#define BROADCAST_KEYFRAME_INTERVAL (1000 / TICK_LENGTH)
+
+struct BroadcastHeader {
+	Uint32 magic;
+	Uint16 version;
+	Uint16 headerSize;
+	Uint32 ringSize;
+
+	// Bytes written since the broadcast started. Records below this are complete.
+	SDL_atomic_t writePos;
+
+	// Where the newest keyframe starts
+	SDL_atomic_t keyframePos;
+};
+
+enum RecordKind {
+	// Filler to the end of the ring, so no record wraps
+	RECORD_PAD,
+	RECORD_KEYFRAME,
+	RECORD_DELTA,
+};
+
+// Which parts of the state follow the record header, in this order
+enum RecordField {
+	// Uint32 row mask, then for each row in it a Uint16 solid mask and Uint32 pieces (see packRow)
+	FIELD_ROWS = 1 << 0,
+	// Sint8 x, Sint8 y, Uint8 type, Uint8 rotation
+	FIELD_POSE = 1 << 1,
+	// Uint8 per queued piece
+	FIELD_QUEUE = 1 << 2,
+	// Uint8 held piece type, Uint8 whether anything is held
+	FIELD_HOLD = 1 << 3,
+	// Uint32 lines, Uint32 level
+	FIELD_SCORE = 1 << 4,
+	// Uint8 game state, lineCount, linesToClear[4], clearTimer, unpausing, unpauseCounter
+	FIELD_STATE = 1 << 5,
+};
+
+// Records are 8 byte aligned, and size includes this header
+struct BroadcastRecord {
+	Uint16 size;
+	Uint8 kind;
+	Uint8 fields;
+	Uint32 tick;
+};
+
+// Start publishing the game to the named channel
+bool startBroadcast(const char* channel);
+void stopBroadcast();
+
+// Encode whatever changed in the game this tick. Does nothing unless broadcasting.
+void broadcastTick();
+
+struct Spectator {
+	const char* channel;
+	const void* memory;
+	size_t size;
+
+	const struct BroadcastHeader* header;
+	const Uint8* ring;
+
+	Uint32 cursor;
+	bool synced;
+
+	// Times the writer lapped this spectator and it had to skip to a keyframe
+	Uint32 resyncs;
+};
+
+bool openSpectator(struct Spectator* spectator, const char* channel);
+void closeSpectator(struct Spectator* spectator);
+
+// Apply every new record to the game globals. Returns false if nothing changed.
+bool spectatorUpdate(struct Spectator* spectator);
+
+// Play the game while broadcasting it. Arguments: <channel>
+int broadcastMain(int argc, char* argv[]);
+
+// Watch a broadcast in a window. Arguments: <channel>
+int spectateMain(int argc, char* argv[]);
@@ -0,0 +1,419 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "corpus.h"
+#include "mapfile.h"
+#include "replay.h"
+#include "tetris.h"
+
+SDL_COMPILE_TIME_ASSERT(corpusHeaderSize, sizeof(struct CorpusHeader) == 40);
+SDL_COMPILE_TIME_ASSERT(corpusGameSize, sizeof(struct CorpusGame) == 24);
+SDL_COMPILE_TIME_ASSERT(corpusPlacementSize, sizeof(struct CorpusPlacement) == 12);
+
+#define ALIGN8(x) (((x) + 7) & ~(Uint64)7)
+
+// Columns are collected in memory while the replays are played, then written out in one go
+struct CorpusBuilder {
+	struct CorpusGame* games;
+	Uint32 gameCount;
+	Uint32 gameCapacity;
+
+	struct CorpusPlacement* placements;
+	Uint8* pieces;
+	Uint32 placementCount;
+	Uint32 placementCapacity;
+
+	// Set when a column couldn't grow, after which nothing more is recorded
+	bool outOfMemory;
+};
+
+static struct CorpusBuilder builder;
+
+static bool reservePlacements(Uint32 capacity) {
+	struct CorpusPlacement* placements = realloc(builder.placements, capacity * sizeof(struct CorpusPlacement));
+	if (placements == NULL) {
+		return false;
+	}
+	builder.placements = placements;
+
+	Uint8* pieces = realloc(builder.pieces, capacity);
+	if (pieces == NULL) {
+		return false;
+	}
+	builder.pieces = pieces;
+
+	builder.placementCapacity = capacity;
+	return true;
+}
+
+static void recordPlacement(const struct Placement* placement) {
+	if (builder.outOfMemory) {
+		return;
+	}
+	if (builder.placementCount == builder.placementCapacity &&
+		!reservePlacements(builder.placementCapacity == 0 ? 65536 : builder.placementCapacity * 2)) {
+		builder.outOfMemory = true;
+		return;
+	}
+
+	struct CorpusPlacement* record = &builder.placements[builder.placementCount];
+	record->tick = placement->tick;
+	record->x = placement->x;
+	record->y = placement->y;
+	record->rotation = placement->rotation;
+	record->linesCleared = placement->linesCleared;
+	record->level = placement->level;
+	record->reserved = 0;
+
+	builder.pieces[builder.placementCount] = placement->type;
+	builder.placementCount++;
+}
+
+static bool addGame(const struct Replay* replay, Uint32 firstPlacement) {
+	if (builder.gameCount == builder.gameCapacity) {
+		Uint32 capacity = builder.gameCapacity == 0 ? 1024 : builder.gameCapacity * 2;
+		struct CorpusGame* games = realloc(builder.games, capacity * sizeof(struct CorpusGame));
+		if (games == NULL) {
+			return false;
+		}
+		builder.games = games;
+		builder.gameCapacity = capacity;
+	}
+
+	struct CorpusGame* game = &builder.games[builder.gameCount++];
+	game->firstPlacement = firstPlacement;
+	game->placementCount = builder.placementCount - firstPlacement;
+	game->seed = replay->seed;
+	game->ticks = replay->tickCount;
+	game->lines = lines;
+	game->level = level;
+	return true;
+}
+
+static bool writePadding(SDL_RWops* file, Uint64 to) {
+	static const Uint8 zeros[8] = { 0 };
+
+	Uint64 at = SDL_RWtell(file);
+	return at == to || SDL_RWwrite(file, zeros, 1, to - at) == to - at;
+}
+
+static bool writeCorpus(const char* path) {
+	struct CorpusHeader header = {
+		.magic = CORPUS_MAGIC,
+		.version = CORPUS_VERSION,
+		.headerSize = sizeof(header),
+		.gameCount = builder.gameCount,
+		.placementCount = builder.placementCount,
+	};
+	header.gamesOffset = ALIGN8(sizeof(header));
+	header.placementsOffset = ALIGN8(header.gamesOffset + (Uint64)builder.gameCount * sizeof(struct CorpusGame));
+	header.piecesOffset = ALIGN8(header.placementsOffset + (Uint64)builder.placementCount * sizeof(struct CorpusPlacement));
+
+	SDL_RWops* file = SDL_RWFromFile(path, "wb");
+	if (file == NULL) {
+		printf("Failed to open %s: %s\n", path, SDL_GetError());
+		return false;
+	}
+
+	bool success =
+		SDL_RWwrite(file, &header, sizeof(header), 1) == 1 &&
+		writePadding(file, header.gamesOffset) &&
+		SDL_RWwrite(file, builder.games, sizeof(struct CorpusGame), builder.gameCount) == builder.gameCount &&
+		writePadding(file, header.placementsOffset) &&
+		SDL_RWwrite(file, builder.placements, sizeof(struct CorpusPlacement), builder.placementCount) == builder.placementCount &&
+		writePadding(file, header.piecesOffset) &&
+		SDL_RWwrite(file, builder.pieces, 1, builder.placementCount) == builder.placementCount;
+
+	SDL_RWclose(file);
+	return success;
+}
+
+int buildCorpusMain(int argc, char* argv[]) {
+	if (argc < 2) {
+		printf("Usage: --build-corpus <corpus> <replay files>...\n");
+		return 1;
+	}
+
+	struct Replay replay = { 0 };
+	placementHook = recordPlacement;
+
+	for (int i = 1; i < argc; i++) {
+		SDL_RWops* file = SDL_RWFromFile(argv[i], "rb");
+		if (file == NULL) {
+			printf("Failed to open %s: %s\n", argv[i], SDL_GetError());
+			continue;
+		}
+
+		while (!builder.outOfMemory && readReplay(file, &replay)) {
+			Uint32 firstPlacement = builder.placementCount;
+			playReplay(&replay);
+			builder.outOfMemory |= !addGame(&replay, firstPlacement);
+		}
+
+		SDL_RWclose(file);
+	}
+
+	placementHook = NULL;
+	freeReplay(&replay);
+
+	if (builder.outOfMemory) {
+		printf("Out of memory after %u games, %u placements\n", builder.gameCount, builder.placementCount);
+		return 1;
+	}
+
+	if (!writeCorpus(argv[0])) {
+		printf("Failed to write %s\n", argv[0]);
+		return 1;
+	}
+
+	printf("Wrote %u games, %u placements to %s\n", builder.gameCount, builder.placementCount, argv[0]);
+	return 0;
+}
+
+bool openCorpus(struct Corpus* corpus, const char* path) {
+	memset(corpus, 0, sizeof(*corpus));
+
+	corpus->data = mapFile(path, &corpus->size);
+	if (corpus->data == NULL) {
+		return false;
+	}
+
+	const struct CorpusHeader* header = corpus->data;
+	const Uint8* base = corpus->data;
+
+	bool valid = corpus->size >= sizeof(*header) &&
+		header->magic == CORPUS_MAGIC &&
+		header->version == CORPUS_VERSION &&
+		header->headerSize == sizeof(*header) &&
+		header->gamesOffset + (Uint64)header->gameCount * sizeof(struct CorpusGame) <= corpus->size &&
+		header->placementsOffset + (Uint64)header->placementCount * sizeof(struct CorpusPlacement) <= corpus->size &&
+		header->piecesOffset + header->placementCount <= corpus->size;
+
+	if (!valid) {
+		printf("%s is not a valid corpus\n", path);
+		closeCorpus(corpus);
+		return false;
+	}
+
+	corpus->header = header;
+	corpus->games = (const struct CorpusGame*)(base + header->gamesOffset);
+	corpus->placements = (const struct CorpusPlacement*)(base + header->placementsOffset);
+	corpus->pieces = base + header->piecesOffset;
+
+	return true;
+}
+
+void closeCorpus(struct Corpus* corpus) {
+	if (corpus->data != NULL) {
+		unmapFile(corpus->data, corpus->size);
+	}
+	memset(corpus, 0, sizeof(*corpus));
+}
+
+// Pieces per second histogram: PPS_BINS bins of PPS_BIN_WIDTH, the last one open-ended
+#define PPS_BINS 16
+#define PPS_BIN_WIDTH 0.25
+
+#define MAX_LEVELS 32
+
+struct CorpusStats {
+	Uint64 games;
+	Uint64 placements;
+
+	// How often each cell was covered by a locked piece
+	Uint64 heatmap[BLOCKS_Y][BLOCKS_X];
+
+	// Placements by number of lines cleared
+	Uint64 clears[5];
+
+	Uint64 ppsBins[PPS_BINS];
+	double ppsTotal;
+
+	// Seconds taken to first reach each level, summed over the games that did
+	double levelSeconds[MAX_LEVELS];
+	Uint64 levelGames[MAX_LEVELS];
+};
+
+struct QueryJob {
+	const struct Corpus* corpus;
+	Uint32 firstGame;
+	Uint32 endGame;
+	struct CorpusStats stats;
+};
+
+static void scanGame(const struct Corpus* corpus, const struct CorpusGame* game, struct CorpusStats* stats) {
+	const struct CorpusPlacement* placements = &corpus->placements[game->firstPlacement];
+	const Uint8* pieces = &corpus->pieces[game->firstPlacement];
+
+	int reachedLevel = 1;
+
+	for (Uint32 i = 0; i < game->placementCount; i++) {
+		const struct CorpusPlacement* p = &placements[i];
+		const struct BlockRotation* br = &BLOCKS[pieces[i] % NUM_BLOCKS].rotations[p->rotation % 4];
+
+		for (int y = 0; y < 4; y++) {
+			for (int x = 0; x < 4; x++) {
+				int cx = p->x + x;
+				int cy = p->y + y;
+				if (br->vals[y][x] && cx >= 0 && cx < BLOCKS_X && cy >= 0 && cy < BLOCKS_Y) {
+					stats->heatmap[cy][cx]++;
+				}
+			}
+		}
+
+		stats->clears[SDL_min(p->linesCleared, 4)]++;
+
+		while (reachedLevel < p->level && reachedLevel + 1 < MAX_LEVELS) {
+			reachedLevel++;
+			stats->levelSeconds[reachedLevel] += p->tick * (TICK_LENGTH / 1000.0);
+			stats->levelGames[reachedLevel]++;
+		}
+	}
+
+	double seconds = game->ticks * (TICK_LENGTH / 1000.0);
+	if (seconds > 0) {
+		double pps = game->placementCount / seconds;
+		stats->ppsTotal += pps;
+		stats->ppsBins[SDL_min((int)(pps / PPS_BIN_WIDTH), PPS_BINS - 1)]++;
+	}
+
+	stats->games++;
+	stats->placements += game->placementCount;
+}
+
+static int queryWorker(void* data) {
+	struct QueryJob* job = data;
+
+	for (Uint32 i = job->firstGame; i < job->endGame; i++) {
+		const struct CorpusGame* game = &job->corpus->games[i];
+
+		// Skip games whose slice doesn't fit, rather than reading out of bounds
+		if ((Uint64)game->firstPlacement + game->placementCount > job->corpus->header->placementCount) {
+			continue;
+		}
+
+		scanGame(job->corpus, game, &job->stats);
+	}
+
+	return 0;
+}
+
+static void mergeStats(struct CorpusStats* into, const struct CorpusStats* from) {
+	into->games += from->games;
+	into->placements += from->placements;
+
+	for (int y = 0; y < BLOCKS_Y; y++) {
+		for (int x = 0; x < BLOCKS_X; x++) {
+			into->heatmap[y][x] += from->heatmap[y][x];
+		}
+	}
+
+	for (int i = 0; i < 5; i++) {
+		into->clears[i] += from->clears[i];
+	}
+
+	for (int i = 0; i < PPS_BINS; i++) {
+		into->ppsBins[i] += from->ppsBins[i];
+	}
+	into->ppsTotal += from->ppsTotal;
+
+	for (int i = 0; i < MAX_LEVELS; i++) {
+		into->levelSeconds[i] += from->levelSeconds[i];
+		into->levelGames[i] += from->levelGames[i];
+	}
+}
+
+static void printStats(const struct CorpusStats* stats) {
+	printf("%llu games, %llu placements\n\n", (unsigned long long)stats->games, (unsigned long long)stats->placements);
+
+	Uint64 hottest = 1;
+	for (int y = 0; y < BLOCKS_Y; y++) {
+		for (int x = 0; x < BLOCKS_X; x++) {
+			hottest = SDL_max(hottest, stats->heatmap[y][x]);
+		}
+	}
+
+	printf("Placement heatmap (%% of the most covered cell):\n");
+	for (int y = 0; y < BLOCKS_Y; y++) {
+		printf("  ");
+		for (int x = 0; x < BLOCKS_X; x++) {
+			printf("%4d", (int)(stats->heatmap[y][x] * 100 / hottest));
+		}
+		printf("\n");
+	}
+
+	printf("\nLine clears per placement:\n");
+	for (int i = 0; i < 5; i++) {
+		double share = stats->placements > 0 ? stats->clears[i] * 100.0 / stats->placements : 0;
+		printf("  %d: %llu (%.2f%%)\n", i, (unsigned long long)stats->clears[i], share);
+	}
+
+	printf("\nPieces per second (mean %.3f):\n", stats->games > 0 ? stats->ppsTotal / stats->games : 0);
+	for (int i = 0; i < PPS_BINS; i++) {
+		if (stats->ppsBins[i] == 0) {
+			continue;
+		}
+		if (i == PPS_BINS - 1) {
+			printf("  %.2f+      %llu\n", i * PPS_BIN_WIDTH, (unsigned long long)stats->ppsBins[i]);
+		}
+		else {
+			printf("  %.2f-%.2f  %llu\n", i * PPS_BIN_WIDTH, (i + 1) * PPS_BIN_WIDTH, (unsigned long long)stats->ppsBins[i]);
+		}
+	}
+
+	printf("\nLevel progression (games reaching the level, mean time to reach it):\n");
+	for (int i = 2; i < MAX_LEVELS; i++) {
+		if (stats->levelGames[i] == 0) {
+			break;
+		}
+		printf("  Level %2d: %llu games, %.1fs\n", i, (unsigned long long)stats->levelGames[i], stats->levelSeconds[i] / stats->levelGames[i]);
+	}
+}
+
+int queryCorpusMain(int argc, char* argv[]) {
+	if (argc < 1) {
+		printf("Usage: --query-corpus <corpus> [threads]\n");
+		return 1;
+	}
+
+	struct Corpus corpus;
+	if (!openCorpus(&corpus, argv[0])) {
+		return 1;
+	}
+
+	int threadCount = argc > 1 ? atoi(argv[1]) : SDL_GetCPUCount();
+	threadCount = SDL_max(threadCount, 1);
+
+	Uint64 start = SDL_GetPerformanceCounter();
+
+	// Each thread aggregates its own share of the games, then the totals are merged
+	struct QueryJob* jobs = calloc(threadCount, sizeof(struct QueryJob));
+	SDL_Thread** threads = calloc(threadCount, sizeof(SDL_Thread*));
+	Uint32 gameCount = corpus.header->gameCount;
+
+	for (int i = 0; i < threadCount; i++) {
+		jobs[i].corpus = &corpus;
+		jobs[i].firstGame = (Uint32)((Uint64)gameCount * i / threadCount);
+		jobs[i].endGame = (Uint32)((Uint64)gameCount * (i + 1) / threadCount);
+		threads[i] = SDL_CreateThread(queryWorker, "query", &jobs[i]);
+	}
+
+	struct CorpusStats* total = calloc(1, sizeof(struct CorpusStats));
+	for (int i = 0; i < threadCount; i++) {
+		SDL_WaitThread(threads[i], NULL);
+		mergeStats(total, &jobs[i].stats);
+	}
+
+	double ms = (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+
+	printStats(total);
+	printf("\nScanned in %.2fms on %d threads\n", ms, threadCount);
+
+	free(total);
+	free(threads);
+	free(jobs);
+	closeCorpus(&corpus);
+
+	return 0;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <SDL2/SDL.h>
+
+#define CORPUS_MAGIC SDL_FOURCC('T', 'C', 'R', 'P')
+#define CORPUS_VERSION 1
+
+// A corpus stores many games as fixed-width columns so it can be memory-mapped
+// and scanned in place without any parsing:
+//
+//   header | games[gameCount] | placements[placementCount] | pieces[placementCount]
+//
+// The games column is the index: each game owns the slice
+// [firstPlacement, firstPlacement + placementCount) of the other two columns.
+// Every column starts on an 8 byte boundary. Values are in native byte order.
+struct CorpusHeader {
+	Uint32 magic;
+	Uint16 version;
+	Uint16 headerSize;
+	Uint32 gameCount;
+	Uint32 placementCount;
+	Uint64 gamesOffset;
+	Uint64 placementsOffset;
+	Uint64 piecesOffset;
+};
+
+// Per-game summary
+struct CorpusGame {
+	Uint32 firstPlacement;
+	Uint32 placementCount;
+	Uint32 seed;
+	Uint32 ticks;
+	Uint32 lines;
+	Uint32 level;
+};
+
+// Where and when a piece was locked. The piece type is in the pieces column.
+struct CorpusPlacement {
+	Uint32 tick;
+	Sint8 x;
+	Sint8 y;
+	Uint8 rotation;
+	Uint8 linesCleared;
+	Uint16 level;
+	Uint16 reserved;
+};
+
+struct Corpus {
+	const void* data;
+	size_t size;
+
+	const struct CorpusHeader* header;
+	const struct CorpusGame* games;
+	const struct CorpusPlacement* placements;
+	const Uint8* pieces;
+};
+
+bool openCorpus(struct Corpus* corpus, const char* path);
+void closeCorpus(struct Corpus* corpus);
+
+// Replay every game in the replay files and write the results as a corpus.
+// Arguments: <corpus> <replay files>...
+int buildCorpusMain(int argc, char* argv[]);
+
+// Print placement heatmaps, line clear counts, speed and level progression
+// for a corpus, scanning it on several threads. Arguments: <corpus> [threads]
+int queryCorpusMain(int argc, char* argv[]);
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+// Counts what the draw code asks of SDL, so the render benchmark can tell when
+// a change makes frames do more work. main.c includes this after SDL and its
+// calls go through the wrappers below. renderbench.c defines them.
+struct DrawCounters {
+	// Clears, fills, outlines and copies
+	Uint64 drawCalls;
+
+	// Setting the draw colour, and how many of those set the colour it already was
+	Uint64 colourChanges;
+	Uint64 redundantColours;
+
+	Uint64 textureCreations;
+	Uint64 surfaceAllocations;
+};
+
+// Only touched from the thread that draws
+extern struct DrawCounters drawCounters;
+
+int countedSetRenderDrawColor(SDL_Renderer* renderer, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+int countedRenderClear(SDL_Renderer* renderer);
+int countedRenderFillRect(SDL_Renderer* renderer, const SDL_Rect* rect);
+int countedRenderDrawRect(SDL_Renderer* renderer, const SDL_Rect* rect);
+int countedRenderCopy(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dest);
+SDL_Texture* countedCreateTexture(SDL_Renderer* renderer, Uint32 format, int access, int w, int h);
+SDL_Texture* countedCreateTextureFromSurface(SDL_Renderer* renderer, SDL_Surface* surface);
+SDL_Surface* countedRenderUTF8_Blended(TTF_Font* font, const char* text, SDL_Color colour);
+
+#ifndef DRAW_COUNT_IMPLEMENTATION
+#define SDL_SetRenderDrawColor countedSetRenderDrawColor
+#define SDL_RenderClear countedRenderClear
+#define SDL_RenderFillRect countedRenderFillRect
+#define SDL_RenderDrawRect countedRenderDrawRect
+#define SDL_RenderCopy countedRenderCopy
+#define SDL_CreateTexture countedCreateTexture
+#define SDL_CreateTextureFromSurface countedCreateTextureFromSurface
+#define TTF_RenderUTF8_Blended countedRenderUTF8_Blended
+#endif
@@ -0,0 +1,394 @@
+#include <string.h>
+
+#include "engine.h"
+
+// Last, so anything the simulation allocates during a tick is counted
+#include "alloccount.h"
+
+struct PieceShape PIECE_SHAPES[NUM_BLOCKS][4];
+
+static void initSrsKicks();
+
+void initEngine() {
+	for (int type = 0; type < NUM_BLOCKS; type++) {
+		for (int rotation = 0; rotation < 4; rotation++) {
+			const struct BlockRotation* br = &BLOCKS[type].rotations[rotation];
+			struct PieceShape* shape = &PIECE_SHAPES[type][rotation];
+
+			shape->left = 4;
+			shape->right = -1;
+			shape->top = 4;
+			shape->bottom = -1;
+
+			for (int i = 0; i < 4; i++) {
+				shape->rows[i] = 0;
+
+				for (int j = 0; j < 4; j++) {
+					if (br->vals[i][j]) {
+						shape->rows[i] |= 1 << j;
+						shape->left = SDL_min(shape->left, j);
+						shape->right = SDL_max(shape->right, j);
+						shape->top = SDL_min(shape->top, i);
+						shape->bottom = SDL_max(shape->bottom, i);
+					}
+				}
+			}
+		}
+	}
+
+	initSrsKicks();
+}
+
+static Uint16 shiftRow(Uint16 row, int x) {
+	return x >= 0 ? row << x : row >> -x;
+}
+
+bool bitboardCollides(const struct Bitboard* board, enum PieceType type, int rotation, int x, int y) {
+	const struct PieceShape* shape = &PIECE_SHAPES[type][rotation];
+
+	if (x + shape->left < 0 || x + shape->right >= BLOCKS_X || y + shape->bottom >= BLOCKS_Y) {
+		return true;
+	}
+
+	for (int i = shape->top; i <= shape->bottom; i++) {
+		// Like the game, anything above the board counts as empty
+		if (y + i >= 0 && (board->rows[y + i] & shiftRow(shape->rows[i], x))) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int bitboardDropY(const struct Bitboard* board, enum PieceType type, int rotation, int x, int y) {
+	while (!bitboardCollides(board, type, rotation, x, y + 1)) {
+		y++;
+	}
+	return y;
+}
+
+int bitboardPlace(struct Bitboard* board, enum PieceType type, int rotation, int x, int y) {
+	const struct PieceShape* shape = &PIECE_SHAPES[type][rotation];
+
+	for (int i = shape->top; i <= shape->bottom; i++) {
+		if (y + i >= 0) {
+			board->rows[y + i] |= shiftRow(shape->rows[i], x);
+		}
+	}
+
+	// Compact the rows that aren't full towards the bottom
+	int cleared = 0;
+	for (int row = BLOCKS_Y - 1; row >= 0; row--) {
+		if (board->rows[row] == FULL_ROW) {
+			cleared++;
+		}
+		else if (cleared > 0) {
+			board->rows[row + cleared] = board->rows[row];
+		}
+	}
+	for (int row = 0; row < cleared; row++) {
+		board->rows[row] = 0;
+	}
+
+	return cleared;
+}
+
+// xorshift32 gets stuck on a zero state, so it's swapped for this
+#define NONZERO_BAG_STATE 0x9e3779b9
+
+void seedBag(struct PieceBag* bag, Uint32 seed) {
+	bag->rngState = seed != 0 ? seed : NONZERO_BAG_STATE;
+	bag->used = 0;
+}
+
+enum PieceType nextBagPiece(struct PieceBag* bag) {
+	if (bag->used == (1 << NUM_BLOCKS) - 1) {
+		bag->used = 0;
+	}
+
+	// Otherwise every draw is the same piece, and a second one never comes
+	if (bag->rngState == 0) {
+		bag->rngState = NONZERO_BAG_STATE;
+	}
+
+	int type;
+	do {
+		Uint32 x = bag->rngState;
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		bag->rngState = x;
+
+		type = x % NUM_BLOCKS;
+	} while (bag->used & (1 << type));
+
+	bag->used |= 1 << type;
+	return type;
+}
+
+// The index'th way of drawing count pieces from a full bag, counting in mixed
+// radix: the first piece picks from 7, the second from the 6 left and so on.
+void decodeBagPrefix(Uint32 index, enum PieceType* sequence, int count) {
+	bool used[NUM_BLOCKS] = { 0 };
+
+	Uint32 divisor = 1;
+	for (int i = 1; i < count; i++) {
+		divisor *= NUM_BLOCKS - i;
+	}
+
+	for (int i = 0; i < count; i++) {
+		int pick = index / divisor;
+		index %= divisor;
+		if (i + 1 < count) {
+			divisor /= NUM_BLOCKS - i - 1;
+		}
+
+		for (int type = 0; type < NUM_BLOCKS; type++) {
+			if (!used[type] && pick-- == 0) {
+				used[type] = true;
+				sequence[i] = type;
+				break;
+			}
+		}
+	}
+}
+
+static enum PieceType takeFromQueue(struct SimGame* game) {
+	enum PieceType type = game->queue[0];
+	memmove(&game->queue[0], &game->queue[1], (QUEUE_LENGTH - 1) * sizeof(enum PieceType));
+	game->queue[QUEUE_LENGTH - 1] = nextBagPiece(&game->bag);
+	return type;
+}
+
+static void spawn(struct SimGame* game) {
+	game->current = takeFromQueue(game);
+	game->canHold = true;
+
+	if (bitboardCollides(&game->board, game->current, 0, SPAWN_X, SPAWN_Y)) {
+		game->over = true;
+	}
+}
+
+void simReset(struct SimGame* game, Uint32 seed) {
+	memset(game, 0, sizeof(*game));
+
+	seedBag(&game->bag, seed);
+	for (int i = 0; i < QUEUE_LENGTH; i++) {
+		game->queue[i] = nextBagPiece(&game->bag);
+	}
+
+	game->held = NO_PIECE;
+	game->level = 1;
+
+	spawn(game);
+}
+
+enum PieceType simMovePiece(const struct SimGame* game, bool useHold) {
+	if (!useHold) {
+		return game->current;
+	}
+	return game->held != NO_PIECE ? game->held : game->queue[0];
+}
+
+int simPlay(struct SimGame* game, const struct Move* move) {
+	if (move->useHold && game->canHold) {
+		enum PieceType held = game->current;
+		game->current = game->held != NO_PIECE ? game->held : takeFromQueue(game);
+		game->held = held;
+	}
+
+	int cleared = bitboardPlace(&game->board, game->current, move->rotation, move->x, move->y);
+
+	game->lines += cleared;
+	game->level = 1 + game->lines / 10;
+	game->pieces++;
+
+	spawn(game);
+	return cleared;
+}
+
+void forEachPlacement(const struct Bitboard* board, enum PieceType type, PlacementCallback callback, void* data) {
+	for (int rotation = 0; rotation < 4; rotation++) {
+		const struct PieceShape* shape = &PIECE_SHAPES[type][rotation];
+
+		// Skip rotations that look the same as an earlier one
+		bool duplicate = false;
+		for (int other = 0; other < rotation; other++) {
+			if (memcmp(PIECE_SHAPES[type][other].rows, shape->rows, sizeof(shape->rows)) == 0) {
+				duplicate = true;
+				break;
+			}
+		}
+		if (duplicate) {
+			continue;
+		}
+
+		for (int x = -shape->left; x + shape->right < BLOCKS_X; x++) {
+			if (bitboardCollides(board, type, rotation, x, SPAWN_Y)) {
+				continue;
+			}
+
+			callback(data, rotation, x, bitboardDropY(board, type, rotation, x, SPAWN_Y));
+		}
+	}
+}
+
+struct MoveList {
+	struct Move* moves;
+	bool useHold;
+	int count;
+};
+
+static void addMove(void* data, int rotation, int x, int y) {
+	struct MoveList* list = data;
+	list->moves[list->count++] = (struct Move){ list->useHold, rotation, x, y };
+}
+
+int listMoves(const struct SimGame* game, struct Move* moves) {
+	struct MoveList list = { moves, false, 0 };
+
+	for (int useHold = 0; useHold <= (game->canHold ? 1 : 0); useHold++) {
+		enum PieceType type = simMovePiece(game, useHold);
+		if (useHold && type == game->current) {
+			continue;
+		}
+
+		list.useHold = useHold;
+		forEachPlacement(&game->board, type, addMove, &list);
+	}
+
+	return list.count;
+}
+
+// The original kicks: right 1 and 2, left 1 and 2, then up 1 and 2, for every piece and direction
+static const struct Kick LEGACY_KICKS[] = {
+	{ 0, 0 }, { 1, 0 }, { 2, 0 }, { -1, 0 }, { -2, 0 }, { 0, -1 }, { 0, -2 },
+};
+
+#define SRS_KICKS 5
+
+// The SRS tables for J, L, S, T and Z, by SRS state (spawn, right, flipped,
+// left) and direction (clockwise, then anticlockwise), with y flipped to point
+// down
+static const struct Kick SRS_JLSTZ_KICKS[4][2][SRS_KICKS] = {
+	{
+		{ { 0, 0 }, { -1, 0 }, { -1, -1 }, { 0, 2 }, { -1, 2 } },
+		{ { 0, 0 }, { 1, 0 }, { 1, -1 }, { 0, 2 }, { 1, 2 } },
+	},
+	{
+		{ { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, -2 }, { 1, -2 } },
+		{ { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, -2 }, { 1, -2 } },
+	},
+	{
+		{ { 0, 0 }, { 1, 0 }, { 1, -1 }, { 0, 2 }, { 1, 2 } },
+		{ { 0, 0 }, { -1, 0 }, { -1, -1 }, { 0, 2 }, { -1, 2 } },
+	},
+	{
+		{ { 0, 0 }, { -1, 0 }, { -1, 1 }, { 0, -2 }, { -1, -2 } },
+		{ { 0, 0 }, { -1, 0 }, { -1, 1 }, { 0, -2 }, { -1, -2 } },
+	},
+};
+
+// The I piece's SRS kicks, by SRS state
+static const struct Kick SRS_I_KICKS[4][2][SRS_KICKS] = {
+	{
+		{ { 0, 0 }, { -2, 0 }, { 1, 0 }, { -2, 1 }, { 1, -2 } },
+		{ { 0, 0 }, { -1, 0 }, { 2, 0 }, { -1, -2 }, { 2, 1 } },
+	},
+	{
+		{ { 0, 0 }, { -1, 0 }, { 2, 0 }, { -1, -2 }, { 2, 1 } },
+		{ { 0, 0 }, { 2, 0 }, { -1, 0 }, { 2, -1 }, { -1, 2 } },
+	},
+	{
+		{ { 0, 0 }, { 2, 0 }, { -1, 0 }, { 2, -1 }, { -1, 2 } },
+		{ { 0, 0 }, { 1, 0 }, { -2, 0 }, { 1, 2 }, { -2, -1 } },
+	},
+	{
+		{ { 0, 0 }, { 1, 0 }, { -2, 0 }, { 1, 2 }, { -2, -1 } },
+		{ { 0, 0 }, { -2, 0 }, { 1, 0 }, { -2, 1 }, { 1, -2 } },
+	},
+};
+
+// The SRS state of each of our rotations. The I, J and L start upright where
+// SRS has them flat, so theirs are shifted round.
+static const int SRS_STATES[NUM_BLOCKS][4] = {
+	[O_PIECE] = { 0, 1, 2, 3 },
+	[I_PIECE] = { 3, 0, 1, 2 },
+	[T_PIECE] = { 0, 1, 2, 3 },
+	[L_PIECE] = { 1, 2, 3, 0 },
+	[J_PIECE] = { 3, 0, 1, 2 },
+	[S_PIECE] = { 0, 1, 2, 3 },
+	[Z_PIECE] = { 0, 1, 2, 3 },
+};
+
+// Where a rotation's cells sit in its box compared to SRS's box for the same
+// state. The I, S and Z reuse one box for two states, so some of theirs are
+// shifted a cell, and a kick has to make up the difference to land where SRS
+// would.
+static const struct Kick SRS_BOX_OFFSETS[NUM_BLOCKS][4] = {
+	[I_PIECE] = { { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, -1 } },
+	[S_PIECE] = { { 0, 0 }, { -1, 0 }, { 0, -1 }, { 0, 0 } },
+	[Z_PIECE] = { { 0, 0 }, { 0, 0 }, { 0, -1 }, { 1, 0 } },
+};
+
+// The SRS kicks in terms of our rotations and boxes, by piece, rotation and
+// direction. Filled in by initEngine.
+static struct Kick SRS_PIECE_KICKS[NUM_BLOCKS][4][2][SRS_KICKS];
+
+static void initSrsKicks() {
+	for (int type = 0; type < NUM_BLOCKS; type++) {
+		for (int rotation = 0; rotation < 4; rotation++) {
+			for (int way = 0; way < 2; way++) {
+				int target = (rotation + (way == 0 ? 1 : 3)) & 3;
+				int state = SRS_STATES[type][rotation];
+
+				const struct Kick* from = &SRS_BOX_OFFSETS[type][rotation];
+				const struct Kick* to = &SRS_BOX_OFFSETS[type][target];
+				const struct Kick* kicks = type == I_PIECE ? SRS_I_KICKS[state][way] : SRS_JLSTZ_KICKS[state][way];
+
+				for (int i = 0; i < SRS_KICKS; i++) {
+					SRS_PIECE_KICKS[type][rotation][way][i] = (struct Kick){
+						kicks[i].x + from->x - to->x,
+						kicks[i].y + from->y - to->y,
+					};
+				}
+			}
+		}
+	}
+}
+
+static const struct Kick NO_KICKS[] = { { 0, 0 } };
+
+int rotationKicks(enum RotationSystem system, enum PieceType type, int rotation, int direction, const struct Kick** kicks) {
+	int way = direction > 0 ? 0 : 1;
+
+	if (system == ROTATION_LEGACY) {
+		*kicks = LEGACY_KICKS;
+		return SDL_arraysize(LEGACY_KICKS);
+	}
+
+	if (type == O_PIECE) {
+		*kicks = NO_KICKS;
+		return 1;
+	}
+
+	*kicks = SRS_PIECE_KICKS[type][rotation][way];
+	return SRS_KICKS;
+}
+
+int resolveRotation(const struct Bitboard* board, enum RotationSystem system, enum PieceType type, int rotation, int direction, int* x, int* y) {
+	int target = (rotation + (direction > 0 ? 1 : 3)) & 3;
+
+	const struct Kick* kicks;
+	int count = rotationKicks(system, type, rotation, direction, &kicks);
+
+	for (int i = 0; i < count; i++) {
+		if (!bitboardCollides(board, type, target, *x + kicks[i].x, *y + kicks[i].y)) {
+			*x += kicks[i].x;
+			*y += kicks[i].y;
+			return i;
+		}
+	}
+
+	return -1;
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+#include "tetris.h"
+
+// A self-contained, allocation-free version of the game rules for bots, search
+// and batch simulation. Unlike main.c it keeps no global state, so any number
+// of games can run at once on different threads.
+
+#define FULL_ROW ((1 << BLOCKS_X) - 1)
+
+// The board as one bitmask per row, bit x set if column x is solid. Row 0 is
+// the top, as in board.rows.
+struct Bitboard {
+	Uint16 rows[BLOCKS_Y];
+};
+
+// A piece rotation as row masks of its 4x4 box, plus the part of the box it
+// actually covers.
+struct PieceShape {
+	Uint16 rows[4];
+	int left;
+	int right;
+	int top;
+	int bottom;
+};
+
+extern struct PieceShape PIECE_SHAPES[NUM_BLOCKS][4];
+
+// Derive PIECE_SHAPES and the SRS kicks from BLOCKS. Must be called before
+// anything else here.
+void initEngine();
+
+#define SPAWN_X (BLOCKS_X / 2 - 1)
+#define SPAWN_Y 0
+
+bool bitboardCollides(const struct Bitboard* board, enum PieceType type, int rotation, int x, int y);
+
+// The lowest y the piece reaches falling straight down from y
+int bitboardDropY(const struct Bitboard* board, enum PieceType type, int rotation, int x, int y);
+
+// Lock a piece into the board and remove any full rows. Returns the number of lines cleared.
+int bitboardPlace(struct Bitboard* board, enum PieceType type, int rotation, int x, int y);
+
+// The same seeded 7-bag as the game: xorshift32, redrawing pieces already used in the bag
+struct PieceBag {
+	Uint32 rngState;
+	Uint8 used;
+};
+
+void seedBag(struct PieceBag* bag, Uint32 seed);
+enum PieceType nextBagPiece(struct PieceBag* bag);
+
+// The index'th way of drawing count pieces from a full bag, for enumerating
+// every way a bag can start
+void decodeBagPrefix(Uint32 index, enum PieceType* sequence, int count);
+
+#define NO_PIECE NUM_BLOCKS
+
+struct SimGame {
+	struct Bitboard board;
+
+	enum PieceType current;
+	enum PieceType queue[QUEUE_LENGTH];
+	struct PieceBag bag;
+
+	// NO_PIECE until something has been held
+	enum PieceType held;
+	bool canHold;
+
+	int lines;
+	int level;
+	int pieces;
+	bool over;
+};
+
+// Where to put the current piece. Placements are reached by rotating and
+// shifting at the spawn row, then dropping.
+struct Move {
+	bool useHold;
+	int rotation;
+	int x;
+	int y;
+};
+
+void simReset(struct SimGame* game, Uint32 seed);
+
+// The piece that would be placed by a move
+enum PieceType simMovePiece(const struct SimGame* game, bool useHold);
+
+// Play a move and spawn the next piece. Returns the number of lines cleared.
+int simPlay(struct SimGame* game, const struct Move* move);
+
+// Calls the callback for every distinct placement of a piece that can be
+// reached from the spawn row. Rotations with the same shape are only visited once.
+typedef void (*PlacementCallback)(void* data, int rotation, int x, int y);
+void forEachPlacement(const struct Bitboard* board, enum PieceType type, PlacementCallback callback, void* data);
+
+// Every move the game can make next: each placement of the current piece, then
+// each placement of the hold piece if holding is allowed and changes the piece.
+// Returns how many there are, at most MAX_MOVES.
+#define MAX_MOVES (2 * 4 * BLOCKS_X)
+int listMoves(const struct SimGame* game, struct Move* moves);
+
+// An offset to try a rotated piece at, in board cells. Positive y is down.
+struct Kick {
+	Sint8 x;
+	Sint8 y;
+};
+
+// The kicks to try, in order, when rotating from one rotation by direction (1
+// clockwise, -1 anticlockwise). Returns how many there are.
+int rotationKicks(enum RotationSystem system, enum PieceType type, int rotation, int direction, const struct Kick** kicks);
+
+// Rotate a piece at x, y by direction, trying each kick in turn with a single
+// collision check. On success x and y are moved by the kick that fit and its
+// index is returned. Returns -1 if every kick is blocked.
+int resolveRotation(const struct Bitboard* board, enum RotationSystem system, enum PieceType type, int rotation, int direction, int* x, int* y);
@@ -0,0 +1,227 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "events.h"
+#include "tetris.h"
+
+// Last, so emitting on the logic thread is counted, though it never should allocate
+#include "alloccount.h"
+
+SDL_COMPILE_TIME_ASSERT(gameEventSize, sizeof(struct GameEvent) == 16);
+SDL_COMPILE_TIME_ASSERT(eventRingSize, (EVENT_RING_SIZE & (EVENT_RING_SIZE - 1)) == 0);
+
+static const char* EVENT_NAMES[] = {
+	"spawn", "move", "rotate", "hold", "lock", "lines", "level", "pause", "resume", "game-over", "dropped",
+};
+
+static const char PIECE_LETTERS[] = "OITLJSZ";
+
+static struct GameEvent ring[EVENT_RING_SIZE];
+
+// Events written by the logic thread, and read by the drain thread. Each side
+// only ever writes its own.
+static Uint32 produced;
+static SDL_atomic_t published;
+static SDL_atomic_t consumed;
+
+static SDL_atomic_t dropped;
+static Uint32 droppedReported;
+
+static bool streaming = false;
+static enum EventFormat streamFormat;
+static SDL_RWops* streamFile;
+static SDL_Thread* drainer;
+static SDL_atomic_t stopping;
+
+// Output is gathered here so the file sees a few large writes
+#define OUTPUT_BUFFER_SIZE (64 * 1024)
+#define MAX_EVENT_OUTPUT 160
+
+static char output[OUTPUT_BUFFER_SIZE];
+static int outputLength;
+
+void emitGameEvent(enum GameEventType type, Sint32 value) {
+	if (!streaming) {
+		return;
+	}
+
+	if (produced - (Uint32)SDL_AtomicGet(&consumed) >= EVENT_RING_SIZE) {
+		SDL_AtomicAdd(&dropped, 1);
+		return;
+	}
+
+	struct GameEvent* event = &ring[produced % EVENT_RING_SIZE];
+	event->tick = time / TICK_LENGTH;
+	event->type = type;
+	event->piece = currentBlock.type;
+	event->rotation = currentBlock.rotation;
+	event->x = currentBlock.x;
+	event->y = currentBlock.y;
+	event->value = value;
+
+	// Setting an atomic is a full barrier, so the event is visible before the count is
+	produced++;
+	SDL_AtomicSet(&published, produced);
+}
+
+Uint32 droppedGameEvents() {
+	return SDL_AtomicGet(&dropped);
+}
+
+static void flushOutput() {
+	if (outputLength > 0) {
+		SDL_RWwrite(streamFile, output, outputLength, 1);
+		outputLength = 0;
+	}
+}
+
+static void writeEvent(const struct GameEvent* event) {
+	if (outputLength + MAX_EVENT_OUTPUT > OUTPUT_BUFFER_SIZE) {
+		flushOutput();
+	}
+
+	if (streamFormat == EVENT_FORMAT_BINARY) {
+		memcpy(&output[outputLength], event, sizeof(*event));
+		outputLength += sizeof(*event);
+		return;
+	}
+
+	char* out = &output[outputLength];
+	int length;
+
+	switch (event->type) {
+	case EVENT_DROPPED:
+		length = snprintf(out, MAX_EVENT_OUTPUT, "{\"tick\":%u,\"event\":\"dropped\",\"count\":%d}\n",
+			event->tick, event->value);
+		break;
+
+	case EVENT_LINES:
+	case EVENT_LEVEL_UP:
+		length = snprintf(out, MAX_EVENT_OUTPUT, "{\"tick\":%u,\"event\":\"%s\",\"%s\":%d}\n",
+			event->tick, EVENT_NAMES[event->type], event->type == EVENT_LINES ? "count" : "level", event->value);
+		break;
+
+	default:
+		length = snprintf(out, MAX_EVENT_OUTPUT, "{\"tick\":%u,\"event\":\"%s\",\"piece\":\"%c\",\"rotation\":%d,\"x\":%d,\"y\":%d",
+			event->tick, EVENT_NAMES[event->type], PIECE_LETTERS[event->piece], event->rotation, event->x, event->y);
+		if (event->type == EVENT_HOLD) {
+			length += snprintf(out + length, MAX_EVENT_OUTPUT - length, ",\"held\":\"%c\"", PIECE_LETTERS[event->value]);
+		}
+		length += snprintf(out + length, MAX_EVENT_OUTPUT - length, "}\n");
+		break;
+	}
+
+	outputLength += length;
+}
+
+// Write out everything published so far, followed by a note of any events lost since last time
+static void drainEvents() {
+	Uint32 read = SDL_AtomicGet(&consumed);
+	Uint32 end = SDL_AtomicGet(&published);
+	Uint32 lastTick = 0;
+
+	while (read != end) {
+		struct GameEvent event = ring[read % EVENT_RING_SIZE];
+		read++;
+		SDL_AtomicSet(&consumed, read);
+
+		writeEvent(&event);
+		lastTick = event.tick;
+	}
+
+	Uint32 lost = SDL_AtomicGet(&dropped);
+	if (lost != droppedReported) {
+		struct GameEvent event = {
+			.tick = lastTick,
+			.type = EVENT_DROPPED,
+			.value = lost - droppedReported,
+		};
+		writeEvent(&event);
+		droppedReported = lost;
+	}
+
+	flushOutput();
+}
+
+static int drainThread(void* data) {
+	while (!SDL_AtomicGet(&stopping)) {
+		drainEvents();
+		SDL_Delay(EVENT_DRAIN_INTERVAL);
+	}
+
+	drainEvents();
+	return 0;
+}
+
+bool startEventStream(const char* path, enum EventFormat format) {
+	streamFile = SDL_RWFromFile(path, "wb");
+	if (streamFile == NULL) {
+		printf("Failed to open %s: %s\n", path, SDL_GetError());
+		return false;
+	}
+
+	if (format == EVENT_FORMAT_BINARY) {
+		struct EventFileHeader header = {
+			.magic = EVENT_MAGIC,
+			.version = EVENT_VERSION,
+			.recordSize = sizeof(struct GameEvent),
+		};
+		SDL_RWwrite(streamFile, &header, sizeof(header), 1);
+	}
+
+	streamFormat = format;
+	outputLength = 0;
+	produced = 0;
+	SDL_AtomicSet(&published, 0);
+	SDL_AtomicSet(&consumed, 0);
+	SDL_AtomicSet(&dropped, 0);
+	droppedReported = 0;
+	SDL_AtomicSet(&stopping, 0);
+
+	drainer = SDL_CreateThread(drainThread, "events", NULL);
+	if (drainer == NULL) {
+		printf("Failed to start the event thread: %s\n", SDL_GetError());
+		SDL_RWclose(streamFile);
+		return false;
+	}
+
+	streaming = true;
+	return true;
+}
+
+void stopEventStream() {
+	if (!streaming) {
+		return;
+	}
+
+	streaming = false;
+	SDL_AtomicSet(&stopping, 1);
+	SDL_WaitThread(drainer, NULL);
+	SDL_RWclose(streamFile);
+}
+
+int eventStreamMain(int argc, char* argv[]) {
+	if (argc < 1) {
+		printf("Expected an output file\n");
+		return 1;
+	}
+
+	enum EventFormat format = EVENT_FORMAT_JSON;
+	if (argc > 1 && strcmp(argv[1], "binary") == 0) {
+		format = EVENT_FORMAT_BINARY;
+	}
+
+	if (!startEventStream(argv[0], format)) {
+		return 1;
+	}
+
+	int result = runGame();
+	stopEventStream();
+
+	Uint32 lost = droppedGameEvents();
+	if (lost > 0) {
+		printf("%u events were dropped\n", lost);
+	}
+
+	return result;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+#include "tetris.h"
+
+#define EVENT_MAGIC SDL_FOURCC('T', 'E', 'V', 'T')
+#define EVENT_VERSION 1
+
+// Game events are handed from the logic thread to a drain thread through a
+// single producer, single consumer ring, and written out from there. Emitting
+// is a handful of stores: it never blocks, allocates or touches the file. If
+// the drain thread falls a whole ring behind, events are dropped and counted,
+// and a dropped event records how many went missing at that point in the stream.
+#define EVENT_RING_SIZE 4096
+
+// How often the drain thread wakes to write out what has built up
+#define EVENT_DRAIN_INTERVAL 20
+
+enum GameEventType {
+	EVENT_SPAWN,
+	EVENT_MOVE,
+	EVENT_ROTATE,
+	// piece came out of the hold, value is the piece that went in
+	EVENT_HOLD,
+	EVENT_LOCK,
+	// value is the number of lines
+	EVENT_LINES,
+	// value is the new level
+	EVENT_LEVEL_UP,
+	EVENT_PAUSE,
+	EVENT_RESUME,
+	EVENT_GAME_OVER,
+	// Only written by the drain thread, value is how many events were lost
+	EVENT_DROPPED,
+};
+
+// Also the binary file's record, in native byte order. Events without a piece
+// carry the current one.
+struct GameEvent {
+	Uint32 tick;
+	Uint8 type;
+	Uint8 piece;
+	Uint8 rotation;
+	Sint8 x;
+	Sint8 y;
+	Uint8 reserved[3];
+	Sint32 value;
+};
+
+enum EventFormat {
+	// One JSON object per line
+	EVENT_FORMAT_JSON,
+	// An EventFileHeader followed by GameEvent records
+	EVENT_FORMAT_BINARY,
+};
+
+struct EventFileHeader {
+	Uint32 magic;
+	Uint16 version;
+	Uint16 recordSize;
+};
+
+// Start writing events to the file, and the thread that does it
+bool startEventStream(const char* path, enum EventFormat format);
+
+// Write out whatever is left and close the file
+void stopEventStream();
+
+// Does nothing unless a stream is running
+void emitGameEvent(enum GameEventType type, Sint32 value);
+
+// Events the ring had no room for since the stream started
+Uint32 droppedGameEvents();
+
+// Play the game while streaming its events. Arguments: <file> [json|binary]
+int eventStreamMain(int argc, char* argv[]);
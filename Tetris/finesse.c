@@ -0,0 +1,394 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "finesse.h"
+
+// Last, so the finesse check run as each piece locks is counted
+#include "alloccount.h"
+
+const char* FINESSE_KEY_NAMES[FINESSE_KEY_COUNT] = {
+	"left", "right", "das-left", "das-right", "cw", "ccw", "soft-drop", "drop",
+};
+
+static const char PIECE_LETTERS[] = "OITLJSZ";
+
+// A piece's box can hang up to 3 columns off the left of the board, and kicks
+// can lift it a few rows above the spawn row
+#define STATE_X_OFFSET 3
+#define STATE_Y_OFFSET 4
+#define STATE_WIDTH (BLOCKS_X + STATE_X_OFFSET)
+#define STATE_HEIGHT (BLOCKS_Y + STATE_Y_OFFSET)
+#define STATE_COUNT (4 * STATE_WIDTH * STATE_HEIGHT)
+
+#define ROTATION_SYSTEMS 2
+
+static struct FinessePath finesseTable[ROTATION_SYSTEMS][NUM_BLOCKS][4][STATE_WIDTH];
+static bool finesseReady = false;
+
+struct PieceState {
+	int rotation;
+	int x;
+	int y;
+};
+
+int finesseMoves(const struct FinessePath* path) {
+	int moves = 0;
+	for (int i = 0; i < path->length; i++) {
+		moves += path->keys[i] != FINESSE_SOFT_DROP && path->keys[i] != FINESSE_HARD_DROP;
+	}
+	return moves;
+}
+
+// The cells a piece covers, as its top row and the masks of the rows from there down
+static Uint64 footprint(enum PieceType type, int rotation, int x, int y) {
+	const struct PieceShape* shape = &PIECE_SHAPES[type][rotation];
+
+	Uint64 key = (Uint64)(y + shape->top + STATE_Y_OFFSET) << 48;
+	for (int i = shape->top; i <= shape->bottom; i++) {
+		Uint16 row = x >= 0 ? shape->rows[i] << x : shape->rows[i] >> -x;
+		key |= (Uint64)row << ((i - shape->top) * 12);
+	}
+	return key;
+}
+
+// Press a key other than hard drop. Returns false if the piece doesn't move.
+static bool applyKey(const struct Bitboard* board, enum RotationSystem system, enum PieceType type, enum FinesseKey key, struct PieceState* state) {
+	int dx = 0;
+	switch (key) {
+	case FINESSE_LEFT:
+	case FINESSE_DAS_LEFT:
+		dx = -1;
+		break;
+	case FINESSE_RIGHT:
+	case FINESSE_DAS_RIGHT:
+		dx = 1;
+		break;
+
+	case FINESSE_ROTATE_RIGHT:
+	case FINESSE_ROTATE_LEFT: {
+		int direction = key == FINESSE_ROTATE_RIGHT ? 1 : -1;
+		if (resolveRotation(board, system, type, state->rotation, direction, &state->x, &state->y) < 0) {
+			return false;
+		}
+		state->rotation = (state->rotation + direction + 4) % 4;
+		return true;
+	}
+
+	case FINESSE_SOFT_DROP: {
+		int y = bitboardDropY(board, type, state->rotation, state->x, state->y);
+		bool moved = y != state->y;
+		state->y = y;
+		return moved;
+	}
+
+	default:
+		return false;
+	}
+
+	bool repeat = key == FINESSE_DAS_LEFT || key == FINESSE_DAS_RIGHT;
+	int start = state->x;
+	while (!bitboardCollides(board, type, state->rotation, state->x + dx, state->y)) {
+		state->x += dx;
+		if (!repeat) {
+			break;
+		}
+	}
+	return state->x != start;
+}
+
+static int stateIndex(const struct PieceState* state) {
+	int x = state->x + STATE_X_OFFSET;
+	int y = state->y + STATE_Y_OFFSET;
+	if (x < 0 || x >= STATE_WIDTH || y < 0 || y >= STATE_HEIGHT) {
+		return -1;
+	}
+	return (state->rotation * STATE_HEIGHT + y) * STATE_WIDTH + x;
+}
+
+static bool landsOn(const struct Bitboard* board, enum PieceType type, const struct PieceState* state, Uint64 target) {
+	int y = bitboardDropY(board, type, state->rotation, state->x, state->y);
+	return footprint(type, state->rotation, state->x, y) == target;
+}
+
+struct SearchNode {
+	struct PieceState state;
+	Sint16 parent;
+	Uint8 key;
+	Uint8 depth;
+};
+
+// Breadth first over every pose reachable from spawn, so the first one found
+// that drops onto the target is reached with the fewest keys
+static bool searchPath(const struct Bitboard* board, enum RotationSystem system, enum PieceType type, Uint64 target, struct FinessePath* path) {
+	struct SearchNode nodes[STATE_COUNT];
+	bool seen[STATE_COUNT];
+	memset(seen, 0, sizeof(seen));
+
+	struct PieceState spawn = { 0, SPAWN_X, SPAWN_Y };
+	if (bitboardCollides(board, type, 0, SPAWN_X, SPAWN_Y)) {
+		return false;
+	}
+
+	int count = 0;
+	nodes[count++] = (struct SearchNode){ spawn, -1, 0, 0 };
+	seen[stateIndex(&spawn)] = true;
+
+	for (int head = 0; head < count; head++) {
+		const struct SearchNode* node = &nodes[head];
+
+		if (landsOn(board, type, &node->state, target)) {
+			path->length = node->depth + 1;
+			path->keys[node->depth] = FINESSE_HARD_DROP;
+			for (int i = head; nodes[i].parent >= 0; i = nodes[i].parent) {
+				path->keys[nodes[i].depth - 1] = nodes[i].key;
+			}
+			return true;
+		}
+
+		// Leave room for the hard drop
+		if (node->depth + 1 >= MAX_FINESSE_KEYS) {
+			continue;
+		}
+
+		for (int key = 0; key < FINESSE_HARD_DROP; key++) {
+			struct PieceState next = node->state;
+			if (!applyKey(board, system, type, key, &next)) {
+				continue;
+			}
+
+			int index = stateIndex(&next);
+			if (index < 0 || seen[index]) {
+				continue;
+			}
+
+			seen[index] = true;
+			nodes[count++] = (struct SearchNode){ next, head, key, node->depth + 1 };
+		}
+	}
+
+	return false;
+}
+
+// Whether a path works on this board, which a table path may not if the stack is in the way
+static bool followPath(const struct Bitboard* board, enum RotationSystem system, enum PieceType type, const struct FinessePath* path, Uint64 target) {
+	struct PieceState state = { 0, SPAWN_X, SPAWN_Y };
+	if (bitboardCollides(board, type, 0, SPAWN_X, SPAWN_Y)) {
+		return false;
+	}
+
+	for (int i = 0; i < path->length - 1; i++) {
+		if (!applyKey(board, system, type, path->keys[i], &state)) {
+			return false;
+		}
+	}
+
+	return landsOn(board, type, &state, target);
+}
+
+void initFinesse() {
+	struct Bitboard empty;
+	memset(&empty, 0, sizeof(empty));
+
+	for (int system = 0; system < ROTATION_SYSTEMS; system++) {
+		for (int type = 0; type < NUM_BLOCKS; type++) {
+			for (int rotation = 0; rotation < 4; rotation++) {
+				for (int column = 0; column < STATE_WIDTH; column++) {
+					struct FinessePath* path = &finesseTable[system][type][rotation][column];
+					int x = column - STATE_X_OFFSET;
+					path->length = 0;
+
+					if (bitboardCollides(&empty, type, rotation, x, SPAWN_Y)) {
+						continue;
+					}
+
+					int y = bitboardDropY(&empty, type, rotation, x, SPAWN_Y);
+					searchPath(&empty, system, type, footprint(type, rotation, x, y), path);
+				}
+			}
+		}
+	}
+
+	finesseReady = true;
+}
+
+const struct FinessePath* finesseTablePath(enum RotationSystem system, enum PieceType type, int rotation, int x) {
+	int column = x + STATE_X_OFFSET;
+	if (!finesseReady || column < 0 || column >= STATE_WIDTH) {
+		return NULL;
+	}
+
+	const struct FinessePath* path = &finesseTable[system][type][rotation][column];
+	return path->length > 0 ? path : NULL;
+}
+
+bool findFinessePath(const struct Bitboard* board, enum RotationSystem system, enum PieceType type, int rotation, int x, int y, struct FinessePath* path) {
+	Uint64 target = footprint(type, rotation, x, y);
+
+	// A stack rarely opens up a shorter way than an empty board has, so a table
+	// path that still works is taken as it is
+	const struct FinessePath* table = finesseTablePath(system, type, rotation, x);
+	if (table != NULL && followPath(board, system, type, table, target)) {
+		*path = *table;
+		return true;
+	}
+
+	return searchPath(board, system, type, target, path);
+}
+
+int finesseTableMain(int argc, char* argv[]) {
+	const char* pieces = argc > 0 ? argv[0] : PIECE_LETTERS;
+	enum RotationSystem system = argc > 1 && strcmp(argv[1], "srs") == 0 ? ROTATION_SRS : ROTATION_LEGACY;
+
+	initFinesse();
+
+	for (const char* c = pieces; *c != '\0'; c++) {
+		const char* letter = strchr(PIECE_LETTERS, SDL_toupper(*c));
+		if (letter == NULL) {
+			printf("Unknown piece %c\n", *c);
+			return 1;
+		}
+		enum PieceType type = letter - PIECE_LETTERS;
+
+		for (int rotation = 0; rotation < 4; rotation++) {
+			for (int x = -STATE_X_OFFSET; x < BLOCKS_X; x++) {
+				const struct FinessePath* path = finesseTablePath(system, type, rotation, x);
+				if (path == NULL) {
+					continue;
+				}
+
+				printf("%c rotation %d column %2d:", *letter, rotation, x);
+				for (int i = 0; i < path->length; i++) {
+					printf(" %s", FINESSE_KEY_NAMES[path->keys[i]]);
+				}
+				printf("\n");
+			}
+		}
+	}
+
+	return 0;
+}
+
+// The J and L in SRS's own boxes, by SRS state, to check the kicks against
+// shapes that don't come from BLOCKS
+static const char* SRS_SHAPES[2][4][3] = {
+	{
+		{ "X..", "XXX", "..." },
+		{ ".XX", ".X.", ".X." },
+		{ "...", "XXX", "..X" },
+		{ ".X.", ".X.", "XX." },
+	},
+	{
+		{ "..X", "XXX", "..." },
+		{ ".X.", ".X.", ".XX" },
+		{ "...", "XXX", "X.." },
+		{ "XX.", ".X.", ".X." },
+	},
+};
+
+// Known SRS rotations, in SRS's boxes and states: a piece rotated from a state
+// at a box position, with some cells filled, should land in the next state at
+// the given box position using the given test from the SRS table
+struct SrsCase {
+	const char* name;
+	enum PieceType type;
+	int state;
+	int direction;
+	int x;
+	int y;
+
+	int filledCount;
+	struct Kick filled[4];
+
+	int test;
+	int expectedX;
+	int expectedY;
+};
+
+static const struct SrsCase SRS_CASES[] = {
+	{ "J right to spawn off the left wall", J_PIECE, 1, -1, -1, 10, 0, { { 0 } }, 2, 0, 10 },
+	{ "L left to spawn off the right wall", L_PIECE, 3, 1, BLOCKS_X - 2, 10, 0, { { 0 } }, 2, BLOCKS_X - 3, 10 },
+	{ "L spawn to right up off the floor", L_PIECE, 0, 1, 4, BLOCKS_Y - 2, 0, { { 0 } }, 3, 3, BLOCKS_Y - 3 },
+	{ "J flipped to right down two", J_PIECE, 2, -1, 4, 5, 2, { { 5, 5 }, { 4, 4 } }, 4, 4, 7 },
+};
+
+static void srsCells(enum PieceType type, int state, int x, int y, struct Bitboard* cells) {
+	memset(cells, 0, sizeof(*cells));
+	const char** rows = SRS_SHAPES[type == J_PIECE ? 0 : 1][state];
+
+	for (int i = 0; i < 3; i++) {
+		for (int j = 0; j < 3; j++) {
+			if (rows[i][j] == 'X') {
+				cells->rows[y + i] |= 1 << (x + j);
+			}
+		}
+	}
+}
+
+static bool pieceCells(enum PieceType type, int rotation, int x, int y, struct Bitboard* cells) {
+	memset(cells, 0, sizeof(*cells));
+	if (bitboardCollides(cells, type, rotation, x, y)) {
+		return false;
+	}
+	bitboardPlace(cells, type, rotation, x, y);
+	return true;
+}
+
+// Our rotation and box position covering the same cells as an SRS state and box
+static bool findRotation(enum PieceType type, const struct Bitboard* srs, int x, int y, struct PieceState* state) {
+	struct Bitboard cells;
+
+	for (int rotation = 0; rotation < 4; rotation++) {
+		for (int dy = -3; dy <= 3; dy++) {
+			for (int dx = -3; dx <= 3; dx++) {
+				if (pieceCells(type, rotation, x + dx, y + dy, &cells) && memcmp(&cells, srs, sizeof(cells)) == 0) {
+					*state = (struct PieceState){ rotation, x + dx, y + dy };
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+int checkSrsMain(int argc, char* argv[]) {
+	int failures = 0;
+
+	for (int i = 0; i < SDL_arraysize(SRS_CASES); i++) {
+		const struct SrsCase* c = &SRS_CASES[i];
+
+		struct Bitboard board;
+		memset(&board, 0, sizeof(board));
+		for (int j = 0; j < c->filledCount; j++) {
+			board.rows[c->filled[j].y] |= 1 << c->filled[j].x;
+		}
+
+		struct Bitboard start;
+		struct PieceState state;
+		srsCells(c->type, c->state, c->x, c->y, &start);
+		if (!findRotation(c->type, &start, c->x, c->y, &state)) {
+			printf("%s: no rotation matches the SRS state\n", c->name);
+			failures++;
+			continue;
+		}
+
+		int test = resolveRotation(&board, ROTATION_SRS, c->type, state.rotation, c->direction, &state.x, &state.y) + 1;
+		int rotation = (state.rotation + c->direction + 4) % 4;
+
+		struct Bitboard expected;
+		struct Bitboard landed;
+		srsCells(c->type, (c->state + c->direction + 4) % 4, c->expectedX, c->expectedY, &expected);
+		bool matches = test > 0 && pieceCells(c->type, rotation, state.x, state.y, &landed) && memcmp(&landed, &expected, sizeof(landed)) == 0;
+
+		if (test != c->test || !matches) {
+			printf("%s: expected test %d, got %d%s\n", c->name, c->test, test, matches ? "" : " landing on the wrong cells");
+			failures++;
+		}
+	}
+
+	if (failures > 0) {
+		printf("%d of %d SRS rotations wrong\n", failures, (int)SDL_arraysize(SRS_CASES));
+		return 1;
+	}
+	printf("All %d SRS rotations match the table\n", (int)SDL_arraysize(SRS_CASES));
+	return 0;
+}
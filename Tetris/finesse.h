@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+#include "engine.h"
+
+// The fewest keys that take a piece from spawn to a placement, using the
+// game's own controls and kicks. Holding left or right until the piece stops
+// counts as a single key, as does holding soft drop until it lands. Gravity
+// is ignored.
+enum FinesseKey {
+	FINESSE_LEFT,
+	FINESSE_RIGHT,
+	FINESSE_DAS_LEFT,
+	FINESSE_DAS_RIGHT,
+	FINESSE_ROTATE_RIGHT,
+	FINESSE_ROTATE_LEFT,
+	FINESSE_SOFT_DROP,
+	FINESSE_HARD_DROP,
+	FINESSE_KEY_COUNT,
+};
+
+extern const char* FINESSE_KEY_NAMES[FINESSE_KEY_COUNT];
+
+#define MAX_FINESSE_KEYS 15
+
+// Always ends in a hard drop
+struct FinessePath {
+	Uint8 length;
+	Uint8 keys[MAX_FINESSE_KEYS];
+};
+
+// Keys other than the drops, which is what a player is judged on
+int finesseMoves(const struct FinessePath* path);
+
+// Search the paths for every hard drop from spawn onto an empty board. Must be
+// called before the tables are used, and needs initEngine.
+void initFinesse();
+
+// The table path for hard dropping a piece in the given rotation with its box
+// at column x, or NULL if there's no such placement or initFinesse hasn't run
+const struct FinessePath* finesseTablePath(enum RotationSystem system, enum PieceType type, int rotation, int x);
+
+// The fewest keys to put a piece where it covers the same cells as it would at
+// rotation, x, y. Uses the table when its path works on this board, and
+// searches otherwise, which finds tucks and spins. Returns false if the
+// placement can't be reached.
+bool findFinessePath(const struct Bitboard* board, enum RotationSystem system, enum PieceType type, int rotation, int x, int y, struct FinessePath* path);
+
+// Print the table for some pieces. Arguments: [pieces] [srs]
+int finesseTableMain(int argc, char* argv[]);
+
+// Check the SRS kicks against known wall and floor kicks from the SRS table,
+// with shapes in SRS's own states and boxes. Returns 1 if any are wrong.
+int checkSrsMain(int argc, char* argv[]);
@@ -0,0 +1,4568 @@
+// Generated by tools/embed_font.py from resources/Blinker/Blinker-Regular.ttf, do not edit.
+#pragma once
+
+const unsigned char FONT_DATA[73000] = {
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x47, 0x50, 0x4f, 0x53,
+	0x33, 0xab, 0x6e, 0xbb, 0x00, 0x00, 0xc3, 0x0c, 0x00, 0x00, 0x54, 0x86, 0x47, 0x53, 0x55, 0x42,
+	0xc9, 0x77, 0xd1, 0x04, 0x00, 0x01, 0x17, 0x94, 0x00, 0x00, 0x05, 0x94, 0x4f, 0x53, 0x2f, 0x32,
+	0xa8, 0x30, 0x5a, 0xaa, 0x00, 0x00, 0xa0, 0xd8, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70,
+	0x85, 0x1d, 0xca, 0xce, 0x00, 0x00, 0xa1, 0x38, 0x00, 0x00, 0x04, 0xb6, 0x63, 0x76, 0x74, 0x20,
+	0x14, 0x2f, 0x09, 0xe0, 0x00, 0x00, 0xb4, 0xc8, 0x00, 0x00, 0x00, 0x6c, 0x66, 0x70, 0x67, 0x6d,
+	0x9e, 0x36, 0x13, 0xce, 0x00, 0x00, 0xa5, 0xf0, 0x00, 0x00, 0x0e, 0x15, 0x67, 0x61, 0x73, 0x70,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xc3, 0x04, 0x00, 0x00, 0x00, 0x08, 0x67, 0x6c, 0x79, 0x66,
+	0x8e, 0x14, 0xc9, 0xc9, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x94, 0x98, 0x68, 0x65, 0x61, 0x64,
+	0x14, 0x25, 0x9e, 0x37, 0x00, 0x00, 0x99, 0x58, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
+	0x07, 0x29, 0x04, 0x5e, 0x00, 0x00, 0xa0, 0xb4, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
+	0x5a, 0x2b, 0x42, 0x39, 0x00, 0x00, 0x99, 0x90, 0x00, 0x00, 0x07, 0x24, 0x6c, 0x6f, 0x63, 0x61,
+	0xd5, 0xc8, 0xfa, 0x83, 0x00, 0x00, 0x95, 0xc4, 0x00, 0x00, 0x03, 0x94, 0x6d, 0x61, 0x78, 0x70,
+	0x03, 0x13, 0x0f, 0x04, 0x00, 0x00, 0x95, 0xa4, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+	0x4e, 0x2e, 0x73, 0x3f, 0x00, 0x00, 0xb5, 0x34, 0x00, 0x00, 0x03, 0x36, 0x70, 0x6f, 0x73, 0x74,
+	0xcd, 0xe7, 0x88, 0x39, 0x00, 0x00, 0xb8, 0x6c, 0x00, 0x00, 0x0a, 0x97, 0x70, 0x72, 0x65, 0x70,
+	0x5a, 0xb1, 0xdf, 0x3b, 0x00, 0x00, 0xb4, 0x08, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x02, 0x00, 0x32,
+	0x00, 0x00, 0x01, 0x4c, 0x02, 0x73, 0x00, 0x03, 0x00, 0x07, 0x00, 0x28, 0x40, 0x25, 0x00, 0x01,
+	0x04, 0x01, 0x03, 0x02, 0x01, 0x03, 0x67, 0x00, 0x02, 0x00, 0x00, 0x02, 0x57, 0x00, 0x02, 0x02,
+	0x00, 0x5f, 0x00, 0x00, 0x02, 0x00, 0x4f, 0x04, 0x04, 0x04, 0x07, 0x04, 0x07, 0x12, 0x11, 0x10,
+	0x05, 0x06, 0x19, 0x2b, 0x21, 0x21, 0x11, 0x21, 0x07, 0x11, 0x33, 0x11, 0x01, 0x4c, 0xfe, 0xe6,
+	0x01, 0x1a, 0xca, 0x7a, 0x02, 0x73, 0x50, 0xfe, 0x2d, 0x01, 0xd3, 0x00, 0x00, 0x02, 0x00, 0x08,
+	0x00, 0x00, 0x02, 0x4d, 0x02, 0x73, 0x00, 0x07, 0x00, 0x10, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x04,
+	0x00, 0x03, 0x00, 0x04, 0x03, 0x68, 0x00, 0x01, 0x01, 0x22, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x23,
+	0x00, 0x4e, 0x15, 0x11, 0x11, 0x11, 0x10, 0x05, 0x08, 0x1b, 0x2b, 0x33, 0x23, 0x13, 0x33, 0x13,
+	0x23, 0x27, 0x21, 0x13, 0x06, 0x06, 0x07, 0x07, 0x33, 0x27, 0x26, 0x26, 0x62, 0x5a, 0xf8, 0x58,
+	0xf5, 0x5a, 0x39, 0xfe, 0xe1, 0x8f, 0x0a, 0x1b, 0x0e, 0x40, 0xe7, 0x40, 0x14, 0x17, 0x02, 0x73,
+	0xfd, 0x8d, 0x97, 0x01, 0x8e, 0x23, 0x4e, 0x27, 0xab, 0xab, 0x37, 0x44, 0xff, 0xff, 0x00, 0x08,
+	0x00, 0x00, 0x02, 0x4d, 0x03, 0x17, 0x02, 0x26, 0x00, 0x03, 0x00, 0x00, 0x01, 0x07, 0x00, 0x87,
+	0x00, 0xb2, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff,
+	0x00, 0x08, 0x00, 0x00, 0x02, 0x4d, 0x03, 0x17, 0x02, 0x26, 0x00, 0x03, 0x00, 0x00, 0x01, 0x06,
+	0x00, 0x88, 0x6c, 0x73, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff,
+	0x00, 0x08, 0x00, 0x00, 0x02, 0x4d, 0x03, 0x17, 0x02, 0x26, 0x00, 0x03, 0x00, 0x00, 0x01, 0x06,
+	0x00, 0x8a, 0x58, 0x73, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff,
+	0x00, 0x08, 0x00, 0x00, 0x02, 0x4d, 0x02, 0xef, 0x02, 0x26, 0x00, 0x03, 0x00, 0x00, 0x01, 0x06,
+	0x00, 0x8b, 0x77, 0x73, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0x00, 0x02,
+	0x00, 0x08, 0x00, 0x00, 0x02, 0xc1, 0x02, 0x73, 0x00, 0x0f, 0x00, 0x18, 0x00, 0x35, 0x40, 0x32,
+	0x00, 0x03, 0x00, 0x04, 0x08, 0x03, 0x04, 0x67, 0x00, 0x08, 0x00, 0x07, 0x05, 0x08, 0x07, 0x67,
+	0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x22, 0x4d, 0x00, 0x05, 0x05, 0x00, 0x5f, 0x06,
+	0x01, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x09,
+	0x08, 0x1f, 0x2b, 0x33, 0x23, 0x13, 0x21, 0x15, 0x21, 0x17, 0x33, 0x15, 0x23, 0x17, 0x33, 0x15,
+	0x23, 0x27, 0x21, 0x13, 0x06, 0x06, 0x07, 0x07, 0x33, 0x27, 0x26, 0x26, 0x62, 0x5a, 0xee, 0x01,
+	0xc2, 0xfe, 0xb4, 0x46, 0xe1, 0xc6, 0x4a, 0xaa, 0xe2, 0x38, 0xfe, 0xf3, 0x86, 0x09, 0x16, 0x0d,
+	0x3f, 0xd7, 0x3f, 0x0b, 0x18, 0x02, 0x73, 0x4d, 0xc0, 0x4b, 0xcb, 0x50, 0x97, 0x01, 0x88, 0x20,
+	0x49, 0x29, 0xac, 0xac, 0x1f, 0x4d, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x02, 0xc1, 0x03, 0x17,
+	0x02, 0x26, 0x00, 0x08, 0x00, 0x00, 0x01, 0x07, 0x00, 0x87, 0x01, 0x4e, 0x00, 0x73, 0x00, 0x08,
+	0xb1, 0x02, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x02, 0x4d,
+	0x03, 0x17, 0x02, 0x26, 0x00, 0x03, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8d, 0x71, 0x73, 0x00, 0x08,
+	0xb1, 0x02, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x02, 0x4d,
+	0x02, 0xe7, 0x02, 0x26, 0x00, 0x03, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8f, 0x7e, 0x73, 0x00, 0x08,
+	0xb1, 0x02, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0x00, 0x02, 0x00, 0x08, 0xff, 0x34, 0x02, 0x4d,
+	0x02, 0x73, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x39, 0x40, 0x36, 0x18, 0x01, 0x00, 0x04, 0x0e, 0x01,
+	0x02, 0x00, 0x0f, 0x01, 0x03, 0x02, 0x03, 0x4c, 0x04, 0x01, 0x00, 0x01, 0x4b, 0x00, 0x05, 0x00,
+	0x04, 0x00, 0x05, 0x04, 0x68, 0x00, 0x02, 0x00, 0x03, 0x02, 0x03, 0x65, 0x00, 0x01, 0x01, 0x22,
+	0x4d, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x15, 0x16, 0x25, 0x27, 0x11, 0x10, 0x06, 0x08, 0x1c,
+	0x2b, 0x33, 0x23, 0x13, 0x33, 0x13, 0x23, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37,
+	0x15, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x27, 0x21, 0x13, 0x06, 0x06, 0x07,
+	0x07, 0x33, 0x27, 0x26, 0x26, 0x62, 0x5a, 0xf8, 0x58, 0xf5, 0x02, 0x3c, 0x4d, 0x1d, 0x1d, 0x0e,
+	0x21, 0x0c, 0x20, 0x21, 0x0f, 0x33, 0x37, 0x3b, 0x38, 0x36, 0xfe, 0xe1, 0x8f, 0x0a, 0x1b, 0x0e,
+	0x40, 0xe7, 0x40, 0x14, 0x17, 0x02, 0x73, 0xfd, 0x8d, 0x0c, 0x35, 0x21, 0x16, 0x16, 0x05, 0x03,
+	0x3b, 0x07, 0x04, 0x2f, 0x2c, 0x29, 0x3d, 0x12, 0x90, 0x01, 0x8e, 0x23, 0x4e, 0x27, 0xab, 0xab,
+	0x37, 0x44, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x02, 0x4d, 0x03, 0x46, 0x02, 0x26, 0x00, 0x03,
+	0x00, 0x00, 0x01, 0x07, 0x00, 0x90, 0x00, 0x88, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0,
+	0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x02, 0x4d, 0x03, 0x10, 0x02, 0x26,
+	0x00, 0x03, 0x00, 0x00, 0x01, 0x06, 0x00, 0x91, 0x65, 0x73, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0,
+	0x73, 0xb0, 0x35, 0x2b, 0x00, 0x03, 0x00, 0x48, 0x00, 0x00, 0x02, 0x0a, 0x02, 0x73, 0x00, 0x0e,
+	0x00, 0x17, 0x00, 0x20, 0x00, 0x2f, 0x40, 0x2c, 0x0c, 0x01, 0x04, 0x03, 0x01, 0x4c, 0x00, 0x03,
+	0x00, 0x04, 0x05, 0x03, 0x04, 0x67, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x22, 0x4d,
+	0x00, 0x05, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x21, 0x24, 0x21, 0x2a, 0x21,
+	0x22, 0x06, 0x08, 0x1c, 0x2b, 0x25, 0x14, 0x06, 0x23, 0x23, 0x11, 0x33, 0x32, 0x16, 0x15, 0x14,
+	0x06, 0x07, 0x16, 0x16, 0x27, 0x34, 0x26, 0x23, 0x23, 0x15, 0x33, 0x32, 0x36, 0x17, 0x34, 0x26,
+	0x23, 0x23, 0x15, 0x33, 0x32, 0x36, 0x02, 0x0a, 0x68, 0x73, 0xe7, 0xe6, 0x68, 0x58, 0x2b, 0x33,
+	0x3d, 0x3d, 0x6b, 0x32, 0x3e, 0x92, 0x92, 0x3c, 0x34, 0x19, 0x3e, 0x4b, 0x92, 0x92, 0x4b, 0x3e,
+	0xb4, 0x60, 0x54, 0x02, 0x73, 0x46, 0x55, 0x3d, 0x42, 0x0c, 0x08, 0x4c, 0xd3, 0x34, 0x29, 0xc4,
+	0x30, 0xdc, 0x38, 0x2c, 0xd1, 0x30, 0x00, 0x01, 0x00, 0x2c, 0xff, 0xf8, 0x01, 0xec, 0x02, 0x7d,
+	0x00, 0x19, 0x00, 0x37, 0x40, 0x34, 0x10, 0x01, 0x03, 0x02, 0x11, 0x03, 0x02, 0x00, 0x03, 0x04,
+	0x01, 0x01, 0x00, 0x03, 0x4c, 0x00, 0x03, 0x03, 0x02, 0x61, 0x00, 0x02, 0x02, 0x28, 0x4d, 0x04,
+	0x01, 0x00, 0x00, 0x01, 0x61, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x01, 0x00, 0x15, 0x12, 0x0f,
+	0x0c, 0x08, 0x06, 0x00, 0x19, 0x01, 0x19, 0x05, 0x08, 0x16, 0x2b, 0x25, 0x32, 0x36, 0x37, 0x15,
+	0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23,
+	0x22, 0x06, 0x15, 0x14, 0x16, 0x01, 0x41, 0x29, 0x5b, 0x27, 0x37, 0x55, 0x2e, 0x90, 0x76, 0x89,
+	0x96, 0x2e, 0x48, 0x1d, 0x23, 0x47, 0x29, 0x70, 0x58, 0x50, 0x48, 0x13, 0x10, 0x4c, 0x16, 0x11,
+	0x95, 0xae, 0xa7, 0x9b, 0x04, 0x05, 0x4b, 0x04, 0x03, 0x6f, 0x86, 0x88, 0x6b, 0x00, 0xff, 0xff,
+	0x00, 0x2c, 0xff, 0xf8, 0x01, 0xec, 0x03, 0x21, 0x02, 0x26, 0x00, 0x10, 0x00, 0x00, 0x01, 0x07,
+	0x00, 0x87, 0x00, 0xbf, 0x00, 0x7d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x7d, 0xb0, 0x35, 0x2b,
+	0xff, 0xff, 0x00, 0x2c, 0xff, 0xf8, 0x01, 0xec, 0x03, 0x21, 0x02, 0x26, 0x00, 0x10, 0x00, 0x00,
+	0x01, 0x06, 0x00, 0x89, 0x64, 0x7d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x7d, 0xb0, 0x35, 0x2b,
+	0x00, 0x01, 0x00, 0x2c, 0xff, 0x3d, 0x01, 0xec, 0x02, 0x7d, 0x00, 0x31, 0x00, 0x4a, 0x40, 0x47,
+	0x1d, 0x01, 0x04, 0x03, 0x2a, 0x1e, 0x02, 0x05, 0x04, 0x2b, 0x14, 0x02, 0x06, 0x05, 0x07, 0x01,
+	0x01, 0x02, 0x06, 0x01, 0x00, 0x01, 0x05, 0x4c, 0x00, 0x07, 0x00, 0x02, 0x01, 0x07, 0x02, 0x69,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x65, 0x00, 0x04, 0x04, 0x03, 0x61, 0x00, 0x03, 0x03, 0x28,
+	0x4d, 0x00, 0x05, 0x05, 0x06, 0x61, 0x00, 0x06, 0x06, 0x29, 0x06, 0x4e, 0x11, 0x15, 0x24, 0x33,
+	0x37, 0x34, 0x25, 0x22, 0x08, 0x08, 0x1e, 0x2b, 0x05, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35,
+	0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x23, 0x37, 0x26, 0x26, 0x35,
+	0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33,
+	0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x07, 0x07, 0x36, 0x16, 0x01, 0xab, 0x35, 0x3b, 0x21, 0x3e,
+	0x0b, 0x0b, 0x37, 0x1b, 0x1d, 0x17, 0x1c, 0x20, 0x0c, 0x24, 0x01, 0x10, 0x75, 0x64, 0x89, 0x96,
+	0x2e, 0x48, 0x1d, 0x23, 0x47, 0x29, 0x70, 0x58, 0x50, 0x6e, 0x29, 0x5b, 0x27, 0x2f, 0x4e, 0x2a,
+	0x08, 0x36, 0x38, 0x73, 0x29, 0x27, 0x07, 0x05, 0x33, 0x04, 0x07, 0x0d, 0x11, 0x0e, 0x0d, 0x02,
+	0x52, 0x0a, 0x96, 0xa1, 0xa7, 0x9b, 0x04, 0x05, 0x4b, 0x04, 0x03, 0x6f, 0x86, 0x88, 0x6b, 0x13,
+	0x10, 0x4c, 0x13, 0x12, 0x02, 0x27, 0x02, 0x23, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xf8, 0x01, 0xec,
+	0x03, 0x21, 0x02, 0x26, 0x00, 0x10, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8a, 0x65, 0x7d, 0x00, 0x08,
+	0xb1, 0x01, 0x01, 0xb0, 0x7d, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x2c, 0xff, 0xf8, 0x01, 0xec,
+	0x02, 0xf9, 0x02, 0x26, 0x00, 0x10, 0x00, 0x00, 0x01, 0x07, 0x00, 0x8c, 0x00, 0xd3, 0x00, 0x7d,
+	0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x7d, 0xb0, 0x35, 0x2b, 0x00, 0x02, 0x00, 0x48, 0x00, 0x00,
+	0x02, 0x32, 0x02, 0x73, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x28, 0x40, 0x25, 0x00, 0x02, 0x02, 0x01,
+	0x5f, 0x00, 0x01, 0x01, 0x22, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x04, 0x01, 0x00, 0x00, 0x23,
+	0x00, 0x4e, 0x01, 0x00, 0x13, 0x11, 0x10, 0x0e, 0x04, 0x02, 0x00, 0x0b, 0x01, 0x0b, 0x05, 0x08,
+	0x16, 0x2b, 0x33, 0x23, 0x11, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x13, 0x26,
+	0x26, 0x23, 0x23, 0x11, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0xfe, 0xb6, 0xb6, 0x60, 0x71, 0x22,
+	0x22, 0x1f, 0x92, 0x11, 0x17, 0x52, 0x4a, 0x61, 0x61, 0x7c, 0x61, 0x14, 0x02, 0x73, 0x20, 0x23,
+	0x23, 0x77, 0x5c, 0xa3, 0x97, 0x01, 0xf3, 0x1b, 0x18, 0xfe, 0x2a, 0x6a, 0x80, 0x47, 0x58, 0x00,
+	0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x02, 0x32, 0x03, 0x17, 0x02, 0x26, 0x00, 0x16, 0x00, 0x00,
+	0x01, 0x06, 0x00, 0x89, 0x4c, 0x73, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b,
+	0x00, 0x02, 0x00, 0x14, 0x00, 0x00, 0x02, 0x44, 0x02, 0x73, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x3c,
+	0x40, 0x39, 0x09, 0x07, 0x02, 0x00, 0x04, 0x08, 0x02, 0x03, 0x05, 0x00, 0x03, 0x67, 0x00, 0x06,
+	0x06, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x22, 0x4d, 0x00, 0x05, 0x05, 0x02, 0x5f, 0x00, 0x02, 0x02,
+	0x23, 0x02, 0x4e, 0x10, 0x10, 0x00, 0x00, 0x10, 0x1f, 0x10, 0x1f, 0x1e, 0x1c, 0x15, 0x13, 0x12,
+	0x11, 0x00, 0x0f, 0x00, 0x0f, 0x27, 0x21, 0x11, 0x0a, 0x08, 0x19, 0x2b, 0x13, 0x35, 0x33, 0x11,
+	0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x11, 0x37, 0x15, 0x23, 0x15,
+	0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x23, 0x23, 0x15, 0x14, 0x46, 0xb6, 0x60,
+	0x71, 0x22, 0x22, 0x1f, 0x92, 0xa2, 0xb6, 0xf9, 0xa4, 0x61, 0x7c, 0x61, 0x14, 0x16, 0x17, 0x52,
+	0x4a, 0x61, 0x01, 0x23, 0x3c, 0x01, 0x14, 0x20, 0x23, 0x23, 0x77, 0x5c, 0xa3, 0x97, 0x01, 0x23,
+	0x3c, 0x3c, 0xd3, 0x6a, 0x80, 0x47, 0x58, 0x1a, 0x1b, 0x18, 0xc7, 0x00, 0x00, 0x02, 0x00, 0x14,
+	0x00, 0x00, 0x02, 0x44, 0x02, 0x73, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x3c, 0x40, 0x39, 0x09, 0x07,
+	0x02, 0x00, 0x04, 0x08, 0x02, 0x03, 0x05, 0x00, 0x03, 0x67, 0x00, 0x06, 0x06, 0x01, 0x5f, 0x00,
+	0x01, 0x01, 0x22, 0x4d, 0x00, 0x05, 0x05, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x23, 0x02, 0x4e, 0x10,
+	0x10, 0x00, 0x00, 0x10, 0x1f, 0x10, 0x1f, 0x1e, 0x1c, 0x15, 0x13, 0x12, 0x11, 0x00, 0x0f, 0x00,
+	0x0f, 0x27, 0x21, 0x11, 0x0a, 0x08, 0x19, 0x2b, 0x13, 0x35, 0x33, 0x11, 0x33, 0x32, 0x16, 0x17,
+	0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x11, 0x37, 0x15, 0x23, 0x15, 0x33, 0x32, 0x36, 0x35,
+	0x34, 0x26, 0x27, 0x26, 0x26, 0x23, 0x23, 0x15, 0x14, 0x46, 0xb6, 0x60, 0x71, 0x22, 0x22, 0x1f,
+	0x92, 0xa2, 0xb6, 0xf9, 0xa4, 0x61, 0x7c, 0x61, 0x14, 0x16, 0x17, 0x52, 0x4a, 0x61, 0x01, 0x23,
+	0x3c, 0x01, 0x14, 0x20, 0x23, 0x23, 0x77, 0x5c, 0xa3, 0x97, 0x01, 0x23, 0x3c, 0x3c, 0xd3, 0x6a,
+	0x80, 0x47, 0x58, 0x1a, 0x1b, 0x18, 0xc7, 0x00, 0x00, 0x01, 0x00, 0x48, 0x00, 0x00, 0x01, 0xe8,
+	0x02, 0x73, 0x00, 0x0b, 0x00, 0x2f, 0x40, 0x2c, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04, 0x67,
+	0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x22, 0x4d, 0x06, 0x01, 0x05, 0x05, 0x00, 0x5f,
+	0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x07, 0x08, 0x1b, 0x2b, 0x25, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
+	0x15, 0x01, 0xe8, 0xfe, 0x60, 0x01, 0x97, 0xfe, 0xbe, 0x01, 0x1d, 0xfe, 0xe3, 0x50, 0x50, 0x02,
+	0x73, 0x4d, 0xc0, 0x4b, 0xcb, 0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x01, 0xe8, 0x03, 0x17,
+	0x02, 0x26, 0x00, 0x1a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x87, 0x00, 0xa4, 0x00, 0x73, 0x00, 0x08,
+	0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x01, 0xe8,
+	0x03, 0x17, 0x02, 0x26, 0x00, 0x1a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x88, 0x5e, 0x73, 0x00, 0x08,
+	0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x01, 0xe8,
+	0x03, 0x17, 0x02, 0x26, 0x00, 0x1a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x89, 0x49, 0x73, 0x00, 0x08,
+	0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x01, 0xe8,
+	0x03, 0x17, 0x02, 0x26, 0x00, 0x1a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8a, 0x4a, 0x73, 0x00, 0x08,
+	0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x01, 0xe8,
+	0x02, 0xef, 0x02, 0x26, 0x00, 0x1a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8b, 0x69, 0x73, 0x00, 0x08,
+	0xb1, 0x01, 0x02, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x01, 0xe8,
+	0x02, 0xef, 0x02, 0x26, 0x00, 0x1a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x8c, 0x00, 0xb8, 0x00, 0x73,
+	0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00,
+	0x01, 0xe8, 0x03, 0x17, 0x02, 0x26, 0x00, 0x1a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8d, 0x63, 0x73,
+	0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00,
+	0x01, 0xe8, 0x02, 0xe7, 0x02, 0x26, 0x00, 0x1a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8f, 0x70, 0x73,
+	0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0x00, 0x01, 0x00, 0x48, 0xff, 0x34,
+	0x01, 0xe8, 0x02, 0x73, 0x00, 0x1f, 0x00, 0x3e, 0x40, 0x3b, 0x0a, 0x01, 0x01, 0x00, 0x0b, 0x01,
+	0x02, 0x01, 0x02, 0x4c, 0x00, 0x06, 0x00, 0x07, 0x08, 0x06, 0x07, 0x67, 0x00, 0x01, 0x00, 0x02,
+	0x01, 0x02, 0x65, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x22, 0x4d, 0x00, 0x08, 0x08,
+	0x00, 0x5f, 0x03, 0x01, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x25,
+	0x25, 0x10, 0x09, 0x08, 0x1f, 0x2b, 0x21, 0x23, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36,
+	0x37, 0x15, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x23, 0x11, 0x21, 0x15, 0x21,
+	0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x01, 0xe8, 0x35, 0x3c, 0x4d, 0x1d, 0x1d, 0x0e, 0x21, 0x0c,
+	0x20, 0x21, 0x0f, 0x33, 0x37, 0x2f, 0x2f, 0xfb, 0x01, 0x97, 0xfe, 0xbe, 0x01, 0x1d, 0xfe, 0xe3,
+	0x01, 0x4b, 0x0c, 0x35, 0x21, 0x16, 0x16, 0x05, 0x03, 0x3b, 0x07, 0x04, 0x2f, 0x2c, 0x25, 0x39,
+	0x13, 0x02, 0x73, 0x4d, 0xc0, 0x4b, 0xcb, 0x00, 0x00, 0x02, 0x00, 0x26, 0xff, 0xf8, 0x02, 0x26,
+	0x02, 0x7d, 0x00, 0x16, 0x00, 0x20, 0x00, 0x3e, 0x40, 0x3b, 0x14, 0x01, 0x03, 0x00, 0x13, 0x01,
+	0x02, 0x03, 0x02, 0x4c, 0x00, 0x02, 0x00, 0x05, 0x04, 0x02, 0x05, 0x67, 0x00, 0x03, 0x03, 0x00,
+	0x61, 0x06, 0x01, 0x00, 0x00, 0x28, 0x4d, 0x00, 0x04, 0x04, 0x01, 0x61, 0x00, 0x01, 0x01, 0x29,
+	0x01, 0x4e, 0x01, 0x00, 0x1e, 0x1d, 0x1b, 0x19, 0x11, 0x0f, 0x0d, 0x0c, 0x07, 0x05, 0x00, 0x16,
+	0x01, 0x16, 0x07, 0x08, 0x16, 0x2b, 0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35,
+	0x34, 0x36, 0x37, 0x21, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x03, 0x14, 0x16,
+	0x33, 0x32, 0x36, 0x37, 0x21, 0x06, 0x06, 0x01, 0x0a, 0x99, 0x83, 0x7d, 0x8e, 0x7c, 0x79, 0x02,
+	0x04, 0x01, 0xa2, 0x06, 0x5b, 0x6c, 0x28, 0x4d, 0x2b, 0x23, 0x56, 0x60, 0x51, 0x53, 0x5d, 0x4f,
+	0x04, 0xfe, 0xae, 0x01, 0x01, 0x02, 0x7d, 0x94, 0xaf, 0xaa, 0x98, 0x7c, 0x7f, 0x18, 0x2c, 0x2c,
+	0x72, 0x5b, 0x0a, 0x0c, 0x4b, 0x0c, 0x0c, 0xfe, 0x6b, 0x53, 0x50, 0x60, 0x73, 0x13, 0x12, 0x00,
+	0x00, 0x01, 0x00, 0x48, 0x00, 0x00, 0x01, 0xda, 0x02, 0x73, 0x00, 0x09, 0x00, 0x29, 0x40, 0x26,
+	0x00, 0x03, 0x05, 0x01, 0x04, 0x00, 0x03, 0x04, 0x67, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01,
+	0x01, 0x22, 0x4d, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x11,
+	0x11, 0x11, 0x11, 0x06, 0x08, 0x1a, 0x2b, 0x13, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21,
+	0x15, 0x9d, 0x55, 0x01, 0x92, 0xfe, 0xc3, 0x01, 0x18, 0x01, 0x02, 0xfe, 0xfe, 0x02, 0x73, 0x4d,
+	0xd9, 0x4b, 0x00, 0x01, 0x00, 0x2d, 0xff, 0xf8, 0x02, 0x26, 0x02, 0x7d, 0x00, 0x20, 0x00, 0x3b,
+	0x40, 0x38, 0x10, 0x01, 0x04, 0x03, 0x11, 0x01, 0x01, 0x04, 0x20, 0x01, 0x05, 0x00, 0x04, 0x01,
+	0x02, 0x05, 0x04, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00, 0x67, 0x00, 0x04, 0x04, 0x03,
+	0x61, 0x00, 0x03, 0x03, 0x28, 0x4d, 0x00, 0x05, 0x05, 0x02, 0x61, 0x00, 0x02, 0x02, 0x29, 0x02,
+	0x4e, 0x27, 0x33, 0x34, 0x23, 0x11, 0x10, 0x06, 0x08, 0x1c, 0x2b, 0x01, 0x23, 0x35, 0x33, 0x11,
+	0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23,
+	0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x01, 0xd6, 0xa3, 0xf3,
+	0x1c, 0x90, 0x3b, 0x9b, 0x77, 0x8e, 0x98, 0x34, 0x5f, 0x1e, 0x28, 0x5d, 0x2c, 0x72, 0x5d, 0x0f,
+	0x11, 0x14, 0x4a, 0x47, 0x1c, 0x4c, 0x25, 0x01, 0x01, 0x4b, 0xfe, 0xd2, 0x0d, 0x19, 0x92, 0xb0,
+	0xa6, 0x9d, 0x05, 0x05, 0x4b, 0x04, 0x04, 0x70, 0x86, 0x42, 0x59, 0x1b, 0x22, 0x1d, 0x09, 0x08,
+	0xff, 0xff, 0x00, 0x2d, 0xff, 0xf8, 0x02, 0x26, 0x03, 0x21, 0x02, 0x26, 0x00, 0x26, 0x00, 0x00,
+	0x01, 0x07, 0x00, 0x88, 0x00, 0x8e, 0x00, 0x7d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x7d, 0xb0,
+	0x35, 0x2b, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xf8, 0x02, 0x26, 0x03, 0x21, 0x02, 0x26, 0x00, 0x26,
+	0x00, 0x00, 0x01, 0x06, 0x00, 0x8a, 0x7a, 0x7d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x7d, 0xb0,
+	0x35, 0x2b, 0xff, 0xff, 0x00, 0x2d, 0xff, 0x21, 0x02, 0x26, 0x02, 0x7d, 0x02, 0x26, 0x00, 0x26,
+	0x00, 0x00, 0x00, 0x07, 0x01, 0x22, 0x00, 0xe6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xf8,
+	0x02, 0x26, 0x02, 0xf9, 0x02, 0x26, 0x00, 0x26, 0x00, 0x00, 0x01, 0x07, 0x00, 0x8c, 0x00, 0xe8,
+	0x00, 0x7d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x7d, 0xb0, 0x35, 0x2b, 0x00, 0x01, 0x00, 0x48,
+	0x00, 0x00, 0x02, 0x3a, 0x02, 0x73, 0x00, 0x0b, 0x00, 0x21, 0x40, 0x1e, 0x00, 0x02, 0x00, 0x05,
+	0x00, 0x02, 0x05, 0x67, 0x03, 0x01, 0x01, 0x01, 0x22, 0x4d, 0x04, 0x01, 0x00, 0x00, 0x23, 0x00,
+	0x4e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1c, 0x2b, 0x33, 0x23, 0x11, 0x33, 0x11,
+	0x21, 0x11, 0x33, 0x11, 0x23, 0x11, 0x21, 0x9d, 0x55, 0x55, 0x01, 0x48, 0x55, 0x55, 0xfe, 0xb8,
+	0x02, 0x73, 0xfe, 0xf2, 0x01, 0x0e, 0xfd, 0x8d, 0x01, 0x17, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x00,
+	0x02, 0x8c, 0x02, 0x73, 0x00, 0x13, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x38, 0x06, 0x04, 0x02, 0x02,
+	0x0c, 0x0b, 0x07, 0x03, 0x01, 0x0a, 0x02, 0x01, 0x67, 0x00, 0x0a, 0x00, 0x09, 0x00, 0x0a, 0x09,
+	0x67, 0x05, 0x01, 0x03, 0x03, 0x22, 0x4d, 0x08, 0x01, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x14, 0x14,
+	0x14, 0x17, 0x14, 0x17, 0x16, 0x15, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x10, 0x0d, 0x08, 0x1f, 0x2b, 0x33, 0x23, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x21, 0x35,
+	0x33, 0x15, 0x33, 0x15, 0x23, 0x11, 0x23, 0x11, 0x21, 0x35, 0x15, 0x21, 0x35, 0xaf, 0x55, 0x40,
+	0x40, 0x55, 0x01, 0x48, 0x55, 0x40, 0x40, 0x55, 0xfe, 0xb8, 0x01, 0x48, 0x01, 0xd4, 0x39, 0x66,
+	0x66, 0x66, 0x66, 0x39, 0xfe, 0x2c, 0x01, 0x17, 0xbd, 0x6f, 0x6f, 0x00, 0xff, 0xff, 0x00, 0x48,
+	0x00, 0x00, 0x02, 0x3a, 0x03, 0x17, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8a,
+	0x6e, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0x00, 0x01, 0x00, 0x48,
+	0x00, 0x00, 0x00, 0x9d, 0x02, 0x73, 0x00, 0x03, 0x00, 0x19, 0x40, 0x16, 0x02, 0x01, 0x01, 0x01,
+	0x22, 0x4d, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x03,
+	0x08, 0x17, 0x2b, 0x13, 0x11, 0x23, 0x11, 0x9d, 0x55, 0x02, 0x73, 0xfd, 0x8d, 0x02, 0x73, 0x00,
+	0xff, 0xff, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xf9, 0x03, 0x17, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00,
+	0x01, 0x06, 0x00, 0x87, 0xfa, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b,
+	0xff, 0xff, 0xff, 0xe6, 0x00, 0x00, 0x00, 0xff, 0x03, 0x17, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00,
+	0x01, 0x06, 0x00, 0x88, 0xb4, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b,
+	0xff, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x01, 0x15, 0x03, 0x17, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00,
+	0x01, 0x06, 0x00, 0x8a, 0xa0, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b,
+	0xff, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x00, 0xf5, 0x02, 0xef, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00,
+	0x01, 0x06, 0x00, 0x8b, 0xbf, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x73, 0xb0, 0x35, 0x2b,
+	0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x00, 0x9d, 0x02, 0xef, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00,
+	0x01, 0x06, 0x00, 0x8c, 0x0e, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b,
+	0xff, 0xff, 0xff, 0xed, 0x00, 0x00, 0x00, 0xba, 0x03, 0x17, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00,
+	0x01, 0x06, 0x00, 0x8d, 0xb9, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b,
+	0xff, 0xff, 0x00, 0x48, 0xff, 0xf8, 0x02, 0x57, 0x02, 0x73, 0x00, 0x26, 0x00, 0x2e, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0x39, 0x00, 0xed, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0xed,
+	0x02, 0xe7, 0x02, 0x26, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8f, 0xc6, 0x73, 0x00, 0x08,
+	0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0x00, 0x01, 0xff, 0xcf, 0xff, 0x34, 0x00, 0x9e,
+	0x02, 0x73, 0x00, 0x16, 0x00, 0x22, 0x40, 0x1f, 0x14, 0x0a, 0x00, 0x03, 0x00, 0x02, 0x0b, 0x01,
+	0x01, 0x00, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x65, 0x00, 0x02, 0x02, 0x22, 0x02,
+	0x4e, 0x16, 0x25, 0x26, 0x03, 0x08, 0x19, 0x2b, 0x33, 0x23, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33,
+	0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x11, 0x33, 0x9e,
+	0x01, 0x3c, 0x4d, 0x1d, 0x1d, 0x0e, 0x21, 0x0c, 0x20, 0x21, 0x0f, 0x33, 0x37, 0x3e, 0x3c, 0x55,
+	0x0c, 0x35, 0x21, 0x16, 0x16, 0x05, 0x03, 0x3b, 0x07, 0x04, 0x2f, 0x2c, 0x2b, 0x3e, 0x12, 0x02,
+	0x69, 0x00, 0xff, 0xff, 0xff, 0xdf, 0x00, 0x00, 0x01, 0x06, 0x03, 0x10, 0x02, 0x26, 0x00, 0x2e,
+	0x00, 0x00, 0x01, 0x06, 0x00, 0x91, 0xad, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0,
+	0x35, 0x2b, 0x00, 0x01, 0x00, 0x11, 0xff, 0xf8, 0x01, 0x6a, 0x02, 0x73, 0x00, 0x0f, 0x00, 0x23,
+	0x40, 0x20, 0x0a, 0x01, 0x02, 0x00, 0x09, 0x01, 0x01, 0x02, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x22,
+	0x4d, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x25, 0x23, 0x11, 0x03,
+	0x08, 0x19, 0x2b, 0x25, 0x11, 0x33, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16,
+	0x33, 0x32, 0x36, 0x01, 0x15, 0x55, 0x6c, 0x79, 0x22, 0x3a, 0x18, 0x1c, 0x31, 0x1c, 0x57, 0x44,
+	0xea, 0x01, 0x89, 0xfe, 0x72, 0x7c, 0x71, 0x06, 0x07, 0x4e, 0x06, 0x05, 0x48, 0x00, 0xff, 0xff,
+	0x00, 0x11, 0xff, 0xf8, 0x01, 0xe2, 0x03, 0x17, 0x02, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x06,
+	0x00, 0x8a, 0x6d, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0x00, 0x01,
+	0x00, 0x48, 0x00, 0x00, 0x02, 0x42, 0x02, 0x73, 0x00, 0x0c, 0x00, 0x21, 0x40, 0x1e, 0x00, 0x04,
+	0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x05, 0x01, 0x03, 0x03, 0x22, 0x4d, 0x02, 0x01, 0x00, 0x00,
+	0x23, 0x00, 0x4e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x06, 0x08, 0x1c, 0x2b, 0x01, 0x01, 0x23,
+	0x03, 0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x33, 0x13, 0x33, 0x01, 0x38, 0x01, 0x0a, 0x6e, 0xe5,
+	0x52, 0x55, 0x55, 0x52, 0xe1, 0x68, 0x01, 0x41, 0xfe, 0xbf, 0x01, 0x19, 0xfe, 0xe7, 0x02, 0x73,
+	0xfe, 0xf1, 0x01, 0x0f, 0xff, 0xff, 0x00, 0x48, 0xff, 0x21, 0x02, 0x42, 0x02, 0x73, 0x02, 0x26,
+	0x00, 0x3b, 0x00, 0x00, 0x00, 0x07, 0x01, 0x22, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x01, 0x00, 0x48,
+	0x00, 0x00, 0x01, 0xc8, 0x02, 0x73, 0x00, 0x05, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x01, 0x01, 0x22,
+	0x4d, 0x03, 0x01, 0x02, 0x02, 0x00, 0x60, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x05, 0x11, 0x11, 0x04, 0x08, 0x18, 0x2b, 0x25, 0x15, 0x21, 0x11, 0x33, 0x11, 0x01,
+	0xc8, 0xfe, 0x80, 0x55, 0x50, 0x50, 0x02, 0x73, 0xfd, 0xdd, 0xff, 0xff, 0x00, 0x2c, 0x00, 0x00,
+	0x01, 0xc8, 0x03, 0x17, 0x02, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x87, 0xfa, 0x73,
+	0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00,
+	0x01, 0xc8, 0x02, 0x73, 0x00, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x07, 0x01, 0x1f, 0x01, 0x2a,
+	0xff, 0xda, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xda, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff,
+	0x00, 0x48, 0xff, 0x21, 0x01, 0xc8, 0x02, 0x73, 0x02, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x07,
+	0x01, 0x22, 0x00, 0xb2, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x01, 0xc8, 0x02, 0x73,
+	0x00, 0x26, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x07, 0x01, 0x35, 0x00, 0xf3, 0x00, 0x29, 0x00, 0x08,
+	0xb1, 0x01, 0x01, 0xb0, 0x29, 0xb0, 0x35, 0x2b, 0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0x01, 0xe6,
+	0x02, 0x73, 0x00, 0x0d, 0x00, 0x2c, 0x40, 0x29, 0x0c, 0x0b, 0x0a, 0x09, 0x06, 0x05, 0x04, 0x03,
+	0x08, 0x02, 0x01, 0x01, 0x4c, 0x00, 0x01, 0x01, 0x22, 0x4d, 0x03, 0x01, 0x02, 0x02, 0x00, 0x60,
+	0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0d, 0x15, 0x11, 0x04, 0x08,
+	0x18, 0x2b, 0x25, 0x15, 0x21, 0x11, 0x07, 0x35, 0x37, 0x11, 0x33, 0x11, 0x37, 0x15, 0x07, 0x15,
+	0x01, 0xe6, 0xfe, 0x80, 0x46, 0x46, 0x55, 0xb5, 0xb5, 0x50, 0x50, 0x01, 0x17, 0x14, 0x3d, 0x14,
+	0x01, 0x1f, 0xfe, 0xf9, 0x34, 0x3d, 0x34, 0xdf, 0x00, 0x01, 0x00, 0x48, 0x00, 0x00, 0x02, 0x97,
+	0x02, 0x73, 0x00, 0x0c, 0x00, 0x2e, 0x40, 0x2b, 0x0b, 0x06, 0x03, 0x03, 0x01, 0x03, 0x01, 0x4c,
+	0x00, 0x01, 0x03, 0x00, 0x03, 0x01, 0x00, 0x80, 0x05, 0x04, 0x02, 0x03, 0x03, 0x22, 0x4d, 0x02,
+	0x01, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x11, 0x12, 0x12, 0x11,
+	0x06, 0x08, 0x1a, 0x2b, 0x01, 0x11, 0x23, 0x11, 0x03, 0x23, 0x03, 0x11, 0x23, 0x11, 0x33, 0x13,
+	0x13, 0x02, 0x97, 0x50, 0xb3, 0x49, 0xb3, 0x50, 0x6b, 0xbe, 0xbf, 0x02, 0x73, 0xfd, 0x8d, 0x01,
+	0xee, 0xfe, 0x8f, 0x01, 0x72, 0xfe, 0x11, 0x02, 0x73, 0xfe, 0x71, 0x01, 0x8f, 0x00, 0x00, 0x01,
+	0x00, 0x48, 0x00, 0x00, 0x02, 0x49, 0x02, 0x73, 0x00, 0x09, 0x00, 0x24, 0x40, 0x21, 0x08, 0x03,
+	0x02, 0x00, 0x02, 0x01, 0x4c, 0x04, 0x03, 0x02, 0x02, 0x02, 0x22, 0x4d, 0x01, 0x01, 0x00, 0x00,
+	0x23, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x11, 0x12, 0x11, 0x05, 0x08, 0x19, 0x2b,
+	0x01, 0x11, 0x23, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x02, 0x49, 0x56, 0xfe, 0xa5, 0x50,
+	0x56, 0x01, 0x5b, 0x02, 0x73, 0xfd, 0x8d, 0x01, 0xe8, 0xfe, 0x18, 0x02, 0x73, 0xfe, 0x11, 0x01,
+	0xef, 0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x02, 0x49, 0x03, 0x17, 0x02, 0x26, 0x00, 0x44,
+	0x00, 0x00, 0x01, 0x07, 0x00, 0x87, 0x00, 0xd5, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
+	0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x02, 0x49, 0x03, 0x17, 0x02, 0x26,
+	0x00, 0x44, 0x00, 0x00, 0x01, 0x06, 0x00, 0x89, 0x7a, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
+	0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x48, 0xff, 0x21, 0x02, 0x49, 0x02, 0x73, 0x02, 0x26,
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x07, 0x01, 0x22, 0x00, 0xea, 0x00, 0x00, 0xff, 0xff, 0x00, 0x48,
+	0x00, 0x00, 0x02, 0x49, 0x03, 0x10, 0x02, 0x26, 0x00, 0x44, 0x00, 0x00, 0x01, 0x07, 0x00, 0x91,
+	0x00, 0x88, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0x00, 0x01,
+	0x00, 0x48, 0xff, 0x5c, 0x02, 0x49, 0x02, 0x73, 0x00, 0x15, 0x00, 0x37, 0x40, 0x34, 0x14, 0x0f,
+	0x0e, 0x03, 0x02, 0x03, 0x08, 0x01, 0x01, 0x02, 0x07, 0x01, 0x00, 0x01, 0x03, 0x4c, 0x05, 0x04,
+	0x02, 0x03, 0x03, 0x22, 0x4d, 0x00, 0x02, 0x02, 0x23, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x61, 0x00,
+	0x00, 0x00, 0x2d, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x11, 0x14, 0x24, 0x33, 0x06,
+	0x08, 0x1a, 0x2b, 0x01, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32,
+	0x36, 0x37, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x02, 0x49, 0x51, 0x49, 0x12, 0x1e, 0x1b,
+	0x0c, 0x17, 0x0e, 0x32, 0x2e, 0x02, 0xfe, 0xa1, 0x50, 0x56, 0x01, 0x5b, 0x02, 0x73, 0xfd, 0x96,
+	0x52, 0x5b, 0x02, 0x04, 0x47, 0x02, 0x02, 0x2c, 0x32, 0x01, 0xe5, 0xfe, 0x18, 0x02, 0x73, 0xfe,
+	0x1a, 0x01, 0xe6, 0x00, 0x00, 0x02, 0x00, 0x2d, 0xff, 0xf8, 0x02, 0x5c, 0x02, 0x7d, 0x00, 0x0b,
+	0x00, 0x1d, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x28, 0x4d,
+	0x00, 0x02, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x27, 0x24, 0x24, 0x22, 0x04,
+	0x08, 0x1a, 0x2b, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x01,
+	0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14,
+	0x16, 0x02, 0x5c, 0x83, 0x94, 0x9f, 0x79, 0x84, 0x94, 0x9f, 0x78, 0xfe, 0x45, 0x13, 0x4a, 0x47,
+	0x6f, 0x52, 0x0e, 0x0f, 0x13, 0x49, 0x48, 0x70, 0x52, 0x0e, 0x01, 0x3b, 0xab, 0x98, 0x8d, 0xb6,
+	0xaa, 0x98, 0x8d, 0xfe, 0x96, 0x22, 0x1c, 0x6b, 0x88, 0x44, 0x57, 0x1b, 0x22, 0x1d, 0x6c, 0x89,
+	0x44, 0x57, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xf8, 0x02, 0x5c, 0x03, 0x21, 0x02, 0x26, 0x00, 0x4a,
+	0x00, 0x00, 0x01, 0x07, 0x00, 0x8d, 0x00, 0x8b, 0x00, 0x7d, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0,
+	0x7d, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xf8, 0x02, 0x5c, 0x03, 0x21, 0x02, 0x26,
+	0x00, 0x4a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x87, 0x00, 0xcc, 0x00, 0x7d, 0x00, 0x08, 0xb1, 0x02,
+	0x01, 0xb0, 0x7d, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xf8, 0x02, 0x5c, 0x03, 0x2b,
+	0x02, 0x26, 0x00, 0x4a, 0x00, 0x00, 0x01, 0x07, 0x01, 0x1d, 0x00, 0x86, 0x00, 0x7d, 0x00, 0x08,
+	0xb1, 0x02, 0x01, 0xb0, 0x7d, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xf8, 0x02, 0x5c,
+	0x03, 0x21, 0x02, 0x26, 0x00, 0x4a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8a, 0x72, 0x7d, 0x00, 0x08,
+	0xb1, 0x02, 0x01, 0xb0, 0x7d, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xf8, 0x02, 0x5c,
+	0x02, 0xf9, 0x02, 0x26, 0x00, 0x4a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x8b, 0x00, 0x91, 0x00, 0x7d,
+	0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x7d, 0xb0, 0x35, 0x2b, 0x00, 0x02, 0x00, 0x2d, 0xff, 0xf8,
+	0x03, 0x4c, 0x02, 0x7d, 0x00, 0x1a, 0x00, 0x2c, 0x00, 0xb0, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40,
+	0x22, 0x00, 0x04, 0x00, 0x05, 0x06, 0x04, 0x05, 0x67, 0x09, 0x01, 0x03, 0x03, 0x01, 0x61, 0x02,
+	0x01, 0x01, 0x01, 0x28, 0x4d, 0x08, 0x01, 0x06, 0x06, 0x00, 0x61, 0x07, 0x0a, 0x02, 0x00, 0x00,
+	0x29, 0x00, 0x4e, 0x1b, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x2a, 0x00, 0x04, 0x00, 0x05, 0x06,
+	0x04, 0x05, 0x67, 0x00, 0x09, 0x09, 0x01, 0x61, 0x00, 0x01, 0x01, 0x28, 0x4d, 0x00, 0x03, 0x03,
+	0x02, 0x5f, 0x00, 0x02, 0x02, 0x22, 0x4d, 0x08, 0x01, 0x06, 0x06, 0x00, 0x61, 0x07, 0x0a, 0x02,
+	0x00, 0x00, 0x29, 0x00, 0x4e, 0x1b, 0x40, 0x32, 0x00, 0x04, 0x00, 0x05, 0x06, 0x04, 0x05, 0x67,
+	0x00, 0x09, 0x09, 0x01, 0x61, 0x00, 0x01, 0x01, 0x28, 0x4d, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00,
+	0x02, 0x02, 0x22, 0x4d, 0x00, 0x06, 0x06, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x23, 0x4d, 0x00, 0x08,
+	0x08, 0x00, 0x61, 0x0a, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x59, 0x59, 0x40, 0x1b, 0x01, 0x00,
+	0x28, 0x26, 0x1f, 0x1d, 0x18, 0x17, 0x16, 0x15, 0x12, 0x11, 0x10, 0x0f, 0x0c, 0x0b, 0x0a, 0x09,
+	0x07, 0x05, 0x00, 0x1a, 0x01, 0x1a, 0x0b, 0x08, 0x16, 0x2b, 0x05, 0x22, 0x26, 0x35, 0x34, 0x36,
+	0x33, 0x32, 0x16, 0x17, 0x21, 0x15, 0x21, 0x16, 0x16, 0x17, 0x33, 0x15, 0x23, 0x06, 0x06, 0x07,
+	0x21, 0x15, 0x21, 0x06, 0x06, 0x27, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26,
+	0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x01, 0x37, 0x99, 0x71, 0x7b, 0x8f, 0x20, 0x34, 0x16,
+	0x01, 0xa2, 0xfe, 0xd1, 0x14, 0x15, 0x02, 0xdf, 0xde, 0x02, 0x1a, 0x18, 0x01, 0x40, 0xfe, 0x41,
+	0x15, 0x2b, 0xb2, 0x11, 0x45, 0x46, 0x68, 0x4b, 0x0b, 0x0d, 0x10, 0x45, 0x46, 0x69, 0x4b, 0x0c,
+	0x08, 0x8a, 0xb9, 0xad, 0x95, 0x05, 0x05, 0x4d, 0x1f, 0x5f, 0x43, 0x49, 0x44, 0x65, 0x23, 0x50,
+	0x04, 0x04, 0x91, 0x23, 0x1e, 0x68, 0x8b, 0x44, 0x55, 0x1a, 0x24, 0x1e, 0x69, 0x8c, 0x43, 0x55,
+	0xff, 0xff, 0x00, 0x2d, 0xff, 0xf8, 0x02, 0x5c, 0x03, 0x21, 0x02, 0x26, 0x00, 0x4a, 0x00, 0x00,
+	0x01, 0x06, 0x00, 0x8e, 0x73, 0x7d, 0x00, 0x08, 0xb1, 0x02, 0x02, 0xb0, 0x7d, 0xb0, 0x35, 0x2b,
+	0xff, 0xff, 0x00, 0x2d, 0xff, 0xf8, 0x02, 0x5c, 0x02, 0xf1, 0x02, 0x26, 0x00, 0x4a, 0x00, 0x00,
+	0x01, 0x07, 0x00, 0x8f, 0x00, 0x98, 0x00, 0x7d, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x7d, 0xb0,
+	0x35, 0x2b, 0x00, 0x03, 0x00, 0x2d, 0xff, 0xc9, 0x02, 0x5c, 0x02, 0xb6, 0x00, 0x17, 0x00, 0x21,
+	0x00, 0x2b, 0x00, 0x47, 0x40, 0x44, 0x0e, 0x0b, 0x02, 0x02, 0x00, 0x29, 0x28, 0x1f, 0x1e, 0x04,
+	0x03, 0x02, 0x17, 0x02, 0x02, 0x01, 0x03, 0x03, 0x4c, 0x0d, 0x0c, 0x02, 0x00, 0x4a, 0x01, 0x01,
+	0x01, 0x49, 0x04, 0x01, 0x02, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00, 0x28, 0x4d, 0x05, 0x01, 0x03,
+	0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x23, 0x22, 0x19, 0x18, 0x22, 0x2b, 0x23,
+	0x2b, 0x18, 0x21, 0x19, 0x21, 0x2a, 0x27, 0x06, 0x08, 0x18, 0x2b, 0x17, 0x27, 0x37, 0x26, 0x26,
+	0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x37, 0x17, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23,
+	0x22, 0x26, 0x27, 0x13, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x01, 0x26, 0x26, 0x03, 0x32, 0x36,
+	0x35, 0x34, 0x26, 0x27, 0x01, 0x16, 0x16, 0x64, 0x31, 0x38, 0x20, 0x1e, 0x84, 0x94, 0x33, 0x4e,
+	0x1e, 0x39, 0x31, 0x3a, 0x26, 0x22, 0x83, 0x94, 0x3a, 0x53, 0x1e, 0xab, 0x70, 0x52, 0x0d, 0x0f,
+	0x01, 0x17, 0x14, 0x36, 0x27, 0x6f, 0x52, 0x11, 0x12, 0xfe, 0xe6, 0x14, 0x3b, 0x37, 0x20, 0x53,
+	0x25, 0x7a, 0x60, 0xaa, 0x98, 0x0d, 0x0d, 0x53, 0x1f, 0x54, 0x24, 0x7e, 0x66, 0xab, 0x98, 0x10,
+	0x10, 0x02, 0x18, 0x6c, 0x89, 0x42, 0x56, 0x1b, 0x01, 0x98, 0x08, 0x08, 0xfe, 0x18, 0x6b, 0x88,
+	0x4a, 0x5b, 0x1b, 0xfe, 0x63, 0x0c, 0x0a, 0x00, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xc9, 0x02, 0x5c,
+	0x03, 0x21, 0x02, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0x87, 0x00, 0xcc, 0x00, 0x7d,
+	0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x7d, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xf8,
+	0x02, 0x5c, 0x03, 0x1a, 0x02, 0x26, 0x00, 0x4a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x91, 0x7f, 0x7d,
+	0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x7d, 0xb0, 0x35, 0x2b, 0x00, 0x02, 0x00, 0x48, 0x00, 0x00,
+	0x02, 0x15, 0x02, 0x73, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x2b, 0x40, 0x28, 0x00, 0x04, 0x05, 0x01,
+	0x02, 0x00, 0x04, 0x02, 0x67, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x22, 0x4d, 0x00,
+	0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x12, 0x10, 0x0f, 0x0d, 0x00, 0x0a, 0x00, 0x09, 0x21,
+	0x11, 0x06, 0x08, 0x18, 0x2b, 0x37, 0x15, 0x23, 0x11, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+	0x37, 0x34, 0x26, 0x23, 0x23, 0x11, 0x33, 0x32, 0x36, 0x9d, 0x55, 0xd5, 0x85, 0x73, 0x78, 0x7d,
+	0x9f, 0x4b, 0x57, 0x80, 0x80, 0x57, 0x4b, 0xcb, 0xcb, 0x02, 0x73, 0x60, 0x6d, 0x6f, 0x6c, 0xdb,
+	0x45, 0x3b, 0xfe, 0xf0, 0x44, 0x00, 0x00, 0x02, 0x00, 0x48, 0x00, 0x00, 0x02, 0x15, 0x02, 0x73,
+	0x00, 0x0c, 0x00, 0x15, 0x00, 0x2f, 0x40, 0x2c, 0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67,
+	0x00, 0x05, 0x06, 0x01, 0x03, 0x00, 0x05, 0x03, 0x67, 0x00, 0x01, 0x01, 0x22, 0x4d, 0x00, 0x00,
+	0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x14, 0x12, 0x11, 0x0f, 0x00, 0x0c, 0x00, 0x0b, 0x21, 0x11,
+	0x11, 0x07, 0x08, 0x19, 0x2b, 0x37, 0x15, 0x23, 0x11, 0x33, 0x15, 0x33, 0x32, 0x16, 0x15, 0x14,
+	0x06, 0x23, 0x37, 0x34, 0x26, 0x23, 0x23, 0x11, 0x33, 0x32, 0x36, 0x9d, 0x55, 0x55, 0x80, 0x85,
+	0x73, 0x78, 0x7d, 0x9f, 0x4a, 0x58, 0x80, 0x80, 0x56, 0x4c, 0x69, 0x69, 0x02, 0x73, 0x63, 0x60,
+	0x6d, 0x6f, 0x6b, 0xda, 0x45, 0x3b, 0xfe, 0xf1, 0x44, 0x00, 0x00, 0x02, 0x00, 0x2d, 0xff, 0x80,
+	0x02, 0x5c, 0x02, 0x7d, 0x00, 0x11, 0x00, 0x23, 0x00, 0x5c, 0xb5, 0x0c, 0x01, 0x00, 0x03, 0x01,
+	0x4c, 0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x04, 0x04, 0x01, 0x61, 0x00, 0x01, 0x01,
+	0x28, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x61, 0x05, 0x01, 0x00, 0x00, 0x29, 0x4d, 0x00, 0x02, 0x02,
+	0x27, 0x02, 0x4e, 0x1b, 0x40, 0x1b, 0x00, 0x02, 0x00, 0x02, 0x86, 0x00, 0x04, 0x04, 0x01, 0x61,
+	0x00, 0x01, 0x01, 0x28, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x61, 0x05, 0x01, 0x00, 0x00, 0x29, 0x00,
+	0x4e, 0x59, 0x40, 0x11, 0x01, 0x00, 0x1f, 0x1d, 0x16, 0x14, 0x0e, 0x0d, 0x07, 0x05, 0x00, 0x11,
+	0x01, 0x10, 0x06, 0x08, 0x16, 0x2b, 0x05, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+	0x14, 0x06, 0x07, 0x17, 0x23, 0x27, 0x06, 0x06, 0x27, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34,
+	0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x01, 0x45, 0x9f, 0x79, 0x84, 0x94,
+	0x9f, 0x78, 0x41, 0x44, 0x72, 0x65, 0x5e, 0x0e, 0x1f, 0xb8, 0x13, 0x4a, 0x47, 0x6f, 0x52, 0x0e,
+	0x0f, 0x13, 0x49, 0x48, 0x70, 0x52, 0x0e, 0x08, 0x8d, 0xb6, 0xaa, 0x98, 0x8d, 0xb5, 0x7a, 0x90,
+	0x1f, 0x92, 0x7c, 0x02, 0x02, 0x8e, 0x22, 0x1c, 0x6b, 0x88, 0x44, 0x57, 0x1b, 0x22, 0x1d, 0x6c,
+	0x89, 0x44, 0x57, 0x00, 0x00, 0x02, 0x00, 0x48, 0x00, 0x00, 0x02, 0x26, 0x02, 0x73, 0x00, 0x0d,
+	0x00, 0x16, 0x00, 0x33, 0x40, 0x30, 0x0a, 0x01, 0x03, 0x05, 0x01, 0x4c, 0x00, 0x05, 0x06, 0x01,
+	0x03, 0x00, 0x05, 0x03, 0x67, 0x00, 0x04, 0x04, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x22, 0x4d, 0x02,
+	0x01, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x15, 0x13, 0x12, 0x10, 0x00, 0x0d, 0x00, 0x0d,
+	0x16, 0x21, 0x11, 0x07, 0x08, 0x19, 0x2b, 0x37, 0x15, 0x23, 0x11, 0x33, 0x32, 0x16, 0x15, 0x14,
+	0x06, 0x07, 0x17, 0x23, 0x27, 0x37, 0x34, 0x26, 0x23, 0x23, 0x15, 0x33, 0x32, 0x36, 0x9d, 0x55,
+	0xd5, 0x85, 0x73, 0x49, 0x4a, 0xa4, 0x66, 0x98, 0x97, 0x4a, 0x58, 0x80, 0x80, 0x56, 0x4c, 0xe1,
+	0xe1, 0x02, 0x73, 0x5b, 0x69, 0x52, 0x61, 0x11, 0xeb, 0xe1, 0xce, 0x40, 0x37, 0xfa, 0x3e, 0x00,
+	0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x02, 0x26, 0x03, 0x17, 0x02, 0x26, 0x00, 0x59, 0x00, 0x00,
+	0x01, 0x07, 0x00, 0x87, 0x00, 0xa2, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x73, 0xb0,
+	0x35, 0x2b, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x02, 0x26, 0x03, 0x17, 0x02, 0x26, 0x00, 0x59,
+	0x00, 0x00, 0x01, 0x06, 0x00, 0x89, 0x47, 0x73, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x73, 0xb0,
+	0x35, 0x2b, 0xff, 0xff, 0x00, 0x48, 0xff, 0x21, 0x02, 0x26, 0x02, 0x73, 0x02, 0x26, 0x00, 0x59,
+	0x00, 0x00, 0x00, 0x07, 0x01, 0x22, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2b, 0xff, 0xf8,
+	0x01, 0xd9, 0x02, 0x7d, 0x00, 0x27, 0x00, 0x2e, 0x40, 0x2b, 0x0a, 0x01, 0x01, 0x00, 0x1f, 0x0b,
+	0x02, 0x03, 0x01, 0x1e, 0x01, 0x02, 0x03, 0x03, 0x4c, 0x00, 0x01, 0x01, 0x00, 0x61, 0x00, 0x00,
+	0x00, 0x28, 0x4d, 0x00, 0x03, 0x03, 0x02, 0x61, 0x00, 0x02, 0x02, 0x29, 0x02, 0x4e, 0x25, 0x2b,
+	0x25, 0x26, 0x04, 0x08, 0x1a, 0x2b, 0x01, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
+	0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x17, 0x16, 0x16, 0x15, 0x14,
+	0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x01, 0x3a,
+	0x98, 0x3f, 0x38, 0x6d, 0x73, 0x30, 0x4d, 0x21, 0x2a, 0x4c, 0x29, 0x4d, 0x3e, 0x1d, 0x21, 0x97,
+	0x50, 0x35, 0x6b, 0x74, 0x3d, 0x71, 0x21, 0x2f, 0x6a, 0x36, 0x4b, 0x3c, 0x1d, 0x01, 0x07, 0x24,
+	0x0f, 0x49, 0x41, 0x5f, 0x5a, 0x09, 0x09, 0x4d, 0x0a, 0x08, 0x2d, 0x39, 0x24, 0x25, 0x08, 0x24,
+	0x13, 0x45, 0x48, 0x67, 0x56, 0x10, 0x0d, 0x50, 0x0e, 0x0f, 0x2c, 0x3f, 0x27, 0x23, 0xff, 0xff,
+	0x00, 0x2b, 0xff, 0xf8, 0x01, 0xd9, 0x03, 0x21, 0x02, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x07,
+	0x00, 0x87, 0x00, 0x87, 0x00, 0x7d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x7d, 0xb0, 0x35, 0x2b,
+	0xff, 0xff, 0x00, 0x2b, 0xff, 0xf8, 0x01, 0xd9, 0x03, 0x21, 0x02, 0x26, 0x00, 0x5d, 0x00, 0x00,
+	0x01, 0x06, 0x00, 0x89, 0x2c, 0x7d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x7d, 0xb0, 0x35, 0x2b,
+	0x00, 0x01, 0x00, 0x2b, 0xff, 0x3d, 0x01, 0xd9, 0x02, 0x7d, 0x00, 0x3f, 0x00, 0x4b, 0x40, 0x48,
+	0x0a, 0x01, 0x01, 0x00, 0x37, 0x0b, 0x02, 0x08, 0x01, 0x36, 0x01, 0x02, 0x08, 0x26, 0x01, 0x05,
+	0x06, 0x25, 0x01, 0x04, 0x05, 0x05, 0x4c, 0x00, 0x03, 0x00, 0x06, 0x05, 0x03, 0x06, 0x69, 0x00,
+	0x05, 0x00, 0x04, 0x05, 0x04, 0x65, 0x00, 0x01, 0x01, 0x00, 0x61, 0x00, 0x00, 0x00, 0x28, 0x4d,
+	0x00, 0x08, 0x08, 0x02, 0x61, 0x07, 0x01, 0x02, 0x02, 0x29, 0x02, 0x4e, 0x25, 0x12, 0x34, 0x25,
+	0x24, 0x11, 0x1b, 0x25, 0x26, 0x09, 0x08, 0x1f, 0x2b, 0x01, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36,
+	0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x17, 0x16,
+	0x16, 0x15, 0x14, 0x06, 0x07, 0x07, 0x36, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35,
+	0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x23, 0x37, 0x26, 0x26, 0x27,
+	0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x01, 0x3a, 0x98, 0x3f, 0x38, 0x6d, 0x73,
+	0x30, 0x4d, 0x21, 0x2a, 0x4c, 0x29, 0x4d, 0x3e, 0x1d, 0x21, 0x97, 0x50, 0x35, 0x63, 0x6b, 0x08,
+	0x36, 0x38, 0x35, 0x3b, 0x21, 0x3e, 0x0b, 0x0b, 0x37, 0x1b, 0x1d, 0x17, 0x1c, 0x20, 0x0c, 0x24,
+	0x01, 0x10, 0x30, 0x56, 0x1a, 0x2f, 0x6a, 0x36, 0x4b, 0x3c, 0x1d, 0x01, 0x07, 0x24, 0x0f, 0x49,
+	0x41, 0x5f, 0x5a, 0x09, 0x09, 0x4d, 0x0a, 0x08, 0x2d, 0x39, 0x24, 0x25, 0x08, 0x24, 0x13, 0x45,
+	0x48, 0x63, 0x57, 0x03, 0x27, 0x02, 0x23, 0x23, 0x29, 0x27, 0x07, 0x05, 0x33, 0x04, 0x07, 0x0d,
+	0x11, 0x0e, 0x0d, 0x02, 0x51, 0x03, 0x0f, 0x0a, 0x50, 0x0e, 0x0f, 0x2c, 0x3f, 0x27, 0x23, 0x00,
+	0xff, 0xff, 0x00, 0x2b, 0xff, 0xf8, 0x01, 0xd9, 0x03, 0x2b, 0x02, 0x26, 0x00, 0x5d, 0x00, 0x00,
+	0x01, 0x06, 0x01, 0x21, 0x2d, 0x7d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x7d, 0xb0, 0x35, 0x2b,
+	0xff, 0xff, 0x00, 0x2b, 0xff, 0x21, 0x01, 0xd9, 0x02, 0x7d, 0x02, 0x26, 0x00, 0x5d, 0x00, 0x00,
+	0x00, 0x07, 0x01, 0x22, 0x00, 0x91, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xf8, 0x03, 0xcf,
+	0x02, 0x7d, 0x00, 0x26, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x5d, 0x01, 0xf6, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x43, 0xff, 0xf6, 0x02, 0x66, 0x02, 0x7d, 0x00, 0x25, 0x00, 0x7e, 0x4b, 0xb0,
+	0x18, 0x50, 0x58, 0x40, 0x11, 0x03, 0x01, 0x03, 0x00, 0x1a, 0x19, 0x0f, 0x04, 0x04, 0x02, 0x03,
+	0x0e, 0x01, 0x01, 0x02, 0x03, 0x4c, 0x1b, 0x40, 0x11, 0x03, 0x01, 0x03, 0x00, 0x1a, 0x19, 0x0f,
+	0x04, 0x04, 0x02, 0x03, 0x0e, 0x01, 0x04, 0x02, 0x03, 0x4c, 0x59, 0x4b, 0xb0, 0x18, 0x50, 0x58,
+	0x40, 0x17, 0x00, 0x03, 0x03, 0x00, 0x61, 0x05, 0x01, 0x00, 0x00, 0x28, 0x4d, 0x00, 0x02, 0x02,
+	0x01, 0x61, 0x04, 0x01, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x1b, 0x40, 0x1b, 0x00, 0x03, 0x03, 0x00,
+	0x61, 0x05, 0x01, 0x00, 0x00, 0x28, 0x4d, 0x00, 0x04, 0x04, 0x23, 0x4d, 0x00, 0x02, 0x02, 0x01,
+	0x61, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x59, 0x40, 0x11, 0x01, 0x00, 0x22, 0x21, 0x1e, 0x1c,
+	0x13, 0x11, 0x0c, 0x0a, 0x00, 0x25, 0x01, 0x25, 0x06, 0x08, 0x16, 0x2b, 0x01, 0x32, 0x16, 0x17,
+	0x03, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32,
+	0x36, 0x35, 0x34, 0x26, 0x27, 0x27, 0x37, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x23, 0x11,
+	0x34, 0x36, 0x01, 0x3c, 0x43, 0x76, 0x27, 0x4a, 0x3a, 0x33, 0x27, 0x57, 0x5a, 0x29, 0x47, 0x1a,
+	0x21, 0x38, 0x20, 0x3a, 0x34, 0x17, 0x1f, 0x67, 0x48, 0x10, 0x52, 0x25, 0x54, 0x4a, 0x55, 0x7a,
+	0x02, 0x7d, 0x0f, 0x0e, 0xff, 0x00, 0x11, 0x0f, 0x41, 0x42, 0x65, 0x62, 0x07, 0x06, 0x4a, 0x06,
+	0x05, 0x3a, 0x3f, 0x28, 0x24, 0x09, 0x1c, 0xfc, 0x04, 0x06, 0x45, 0x4e, 0xfe, 0x61, 0x01, 0xa0,
+	0x71, 0x6c, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x02, 0x04, 0x02, 0x73, 0x00, 0x07, 0x00, 0x21,
+	0x40, 0x1e, 0x02, 0x01, 0x00, 0x00, 0x03, 0x5f, 0x04, 0x01, 0x03, 0x03, 0x22, 0x4d, 0x00, 0x01,
+	0x01, 0x23, 0x01, 0x4e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x11, 0x11, 0x11, 0x05, 0x08, 0x19,
+	0x2b, 0x01, 0x15, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35, 0x02, 0x04, 0xd0, 0x55, 0xd0, 0x02, 0x73,
+	0x4d, 0xfd, 0xda, 0x02, 0x26, 0x4d, 0x00, 0x01, 0x00, 0x17, 0x00, 0x00, 0x02, 0x0c, 0x02, 0x73,
+	0x00, 0x0f, 0x00, 0x2f, 0x40, 0x2c, 0x08, 0x07, 0x02, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00,
+	0x67, 0x06, 0x01, 0x04, 0x04, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x22, 0x4d, 0x00, 0x01, 0x01, 0x23,
+	0x01, 0x4e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x09,
+	0x08, 0x1d, 0x2b, 0x01, 0x15, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x21,
+	0x15, 0x23, 0x15, 0x01, 0xdc, 0xa0, 0x55, 0xa0, 0xa0, 0xd0, 0x01, 0xf5, 0xd0, 0x01, 0x54, 0x3b,
+	0xfe, 0xe7, 0x01, 0x19, 0x3b, 0xd2, 0x4d, 0x4d, 0xd2, 0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x00,
+	0x02, 0x04, 0x03, 0x17, 0x02, 0x26, 0x00, 0x65, 0x00, 0x00, 0x01, 0x06, 0x00, 0x89, 0x36, 0x73,
+	0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x0f, 0xff, 0x21,
+	0x02, 0x04, 0x02, 0x73, 0x02, 0x26, 0x00, 0x65, 0x00, 0x00, 0x00, 0x07, 0x01, 0x22, 0x00, 0xaa,
+	0x00, 0x00, 0xff, 0xff, 0x00, 0x0f, 0xff, 0x21, 0x02, 0x04, 0x02, 0x73, 0x02, 0x26, 0x00, 0x65,
+	0x00, 0x00, 0x00, 0x07, 0x01, 0x22, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x01, 0x00, 0x42, 0xff, 0xf8,
+	0x02, 0x37, 0x02, 0x73, 0x00, 0x11, 0x00, 0x1b, 0x40, 0x18, 0x02, 0x01, 0x00, 0x00, 0x22, 0x4d,
+	0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x23, 0x13, 0x23, 0x11, 0x04,
+	0x08, 0x1a, 0x2b, 0x25, 0x11, 0x33, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x11, 0x33, 0x11,
+	0x14, 0x16, 0x33, 0x32, 0x36, 0x01, 0xe2, 0x55, 0x7b, 0x81, 0x82, 0x77, 0x55, 0x49, 0x5b, 0x5c,
+	0x4b, 0xfa, 0x01, 0x79, 0xfe, 0x87, 0x84, 0x7e, 0x7b, 0x87, 0x01, 0x79, 0xfe, 0x87, 0x63, 0x4f,
+	0x4f, 0x00, 0xff, 0xff, 0x00, 0x42, 0xff, 0xf8, 0x02, 0x37, 0x03, 0x17, 0x02, 0x26, 0x00, 0x6a,
+	0x00, 0x00, 0x01, 0x07, 0x00, 0x87, 0x00, 0xc1, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
+	0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x42, 0xff, 0xf8, 0x02, 0x37, 0x03, 0x17, 0x02, 0x26,
+	0x00, 0x6a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x88, 0x7b, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
+	0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x42, 0xff, 0xf8, 0x02, 0x37, 0x03, 0x17, 0x02, 0x26,
+	0x00, 0x6a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8a, 0x67, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
+	0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x42, 0xff, 0xf8, 0x02, 0x37, 0x02, 0xef, 0x02, 0x26,
+	0x00, 0x6a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x8b, 0x00, 0x86, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x01,
+	0x02, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x42, 0xff, 0xf8, 0x02, 0x37, 0x03, 0x17,
+	0x02, 0x26, 0x00, 0x6a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x8d, 0x00, 0x80, 0x00, 0x73, 0x00, 0x08,
+	0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x42, 0xff, 0xf8, 0x02, 0x37,
+	0x03, 0x17, 0x02, 0x26, 0x00, 0x6a, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8e, 0x68, 0x73, 0x00, 0x08,
+	0xb1, 0x01, 0x02, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x42, 0xff, 0xf8, 0x02, 0x37,
+	0x02, 0xe7, 0x02, 0x26, 0x00, 0x6a, 0x00, 0x00, 0x01, 0x07, 0x00, 0x8f, 0x00, 0x8d, 0x00, 0x73,
+	0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0x00, 0x01, 0x00, 0x42, 0xff, 0x2f,
+	0x02, 0x37, 0x02, 0x73, 0x00, 0x27, 0x00, 0x32, 0x40, 0x2f, 0x19, 0x01, 0x03, 0x05, 0x0f, 0x01,
+	0x01, 0x03, 0x10, 0x01, 0x02, 0x01, 0x03, 0x4c, 0x00, 0x01, 0x00, 0x02, 0x01, 0x02, 0x65, 0x04,
+	0x01, 0x00, 0x00, 0x22, 0x4d, 0x00, 0x05, 0x05, 0x03, 0x61, 0x00, 0x03, 0x03, 0x29, 0x03, 0x4e,
+	0x23, 0x13, 0x27, 0x25, 0x29, 0x11, 0x06, 0x08, 0x1c, 0x2b, 0x25, 0x11, 0x33, 0x11, 0x14, 0x06,
+	0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22, 0x26,
+	0x35, 0x34, 0x36, 0x37, 0x06, 0x22, 0x23, 0x22, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x33,
+	0x32, 0x36, 0x01, 0xe2, 0x55, 0x3b, 0x3c, 0x40, 0x32, 0x1f, 0x1c, 0x0d, 0x22, 0x0f, 0x12, 0x2a,
+	0x13, 0x32, 0x36, 0x21, 0x21, 0x04, 0x09, 0x0a, 0x82, 0x77, 0x55, 0x49, 0x5b, 0x5c, 0x4b, 0xfa,
+	0x01, 0x79, 0xfe, 0x87, 0x5c, 0x74, 0x1a, 0x22, 0x39, 0x20, 0x16, 0x18, 0x05, 0x04, 0x36, 0x05,
+	0x06, 0x2f, 0x2a, 0x1f, 0x39, 0x19, 0x01, 0x7b, 0x87, 0x01, 0x79, 0xfe, 0x87, 0x63, 0x4f, 0x4f,
+	0xff, 0xff, 0x00, 0x42, 0xff, 0xf8, 0x02, 0x37, 0x03, 0x46, 0x02, 0x26, 0x00, 0x6a, 0x00, 0x00,
+	0x01, 0x07, 0x00, 0x90, 0x00, 0x97, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x73, 0xb0,
+	0x35, 0x2b, 0xff, 0xff, 0x00, 0x42, 0xff, 0xf8, 0x02, 0x37, 0x03, 0x10, 0x02, 0x26, 0x00, 0x6a,
+	0x00, 0x00, 0x01, 0x06, 0x00, 0x91, 0x74, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0,
+	0x35, 0x2b, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x02, 0x42, 0x02, 0x73, 0x00, 0x0c, 0x00, 0x21,
+	0x40, 0x1e, 0x06, 0x01, 0x02, 0x00, 0x01, 0x4c, 0x01, 0x01, 0x00, 0x00, 0x22, 0x4d, 0x03, 0x01,
+	0x02, 0x02, 0x23, 0x02, 0x4e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x18, 0x11, 0x04, 0x08, 0x18,
+	0x2b, 0x33, 0x03, 0x33, 0x13, 0x16, 0x16, 0x17, 0x36, 0x36, 0x37, 0x13, 0x33, 0x03, 0xf3, 0xeb,
+	0x5e, 0x90, 0x08, 0x18, 0x11, 0x0d, 0x19, 0x0a, 0x8f, 0x5c, 0xeb, 0x02, 0x73, 0xfe, 0x73, 0x19,
+	0x4d, 0x3d, 0x30, 0x56, 0x1d, 0x01, 0x8d, 0xfd, 0x8d, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x00,
+	0x03, 0x49, 0x02, 0x73, 0x00, 0x1e, 0x00, 0x27, 0x40, 0x24, 0x1a, 0x0f, 0x06, 0x03, 0x03, 0x00,
+	0x01, 0x4c, 0x02, 0x01, 0x02, 0x00, 0x00, 0x22, 0x4d, 0x05, 0x04, 0x02, 0x03, 0x03, 0x23, 0x03,
+	0x4e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x1e, 0x11, 0x18, 0x18, 0x11, 0x06, 0x08, 0x1a, 0x2b, 0x33,
+	0x03, 0x33, 0x13, 0x16, 0x16, 0x17, 0x36, 0x36, 0x37, 0x13, 0x33, 0x13, 0x16, 0x16, 0x17, 0x36,
+	0x36, 0x37, 0x13, 0x33, 0x03, 0x23, 0x03, 0x26, 0x26, 0x27, 0x06, 0x06, 0x07, 0x03, 0xbb, 0xae,
+	0x5c, 0x68, 0x04, 0x09, 0x10, 0x12, 0x0a, 0x04, 0x72, 0x59, 0x73, 0x04, 0x0a, 0x12, 0x0b, 0x0f,
+	0x03, 0x67, 0x59, 0xae, 0x60, 0x65, 0x0b, 0x14, 0x0c, 0x0c, 0x14, 0x0b, 0x64, 0x02, 0x73, 0xfe,
+	0x73, 0x10, 0x2b, 0x59, 0x5b, 0x2a, 0x0f, 0x01, 0x8d, 0xfe, 0x73, 0x0f, 0x28, 0x5b, 0x3d, 0x49,
+	0x0c, 0x01, 0x8d, 0xfd, 0x8d, 0x01, 0x50, 0x25, 0x54, 0x3a, 0x3a, 0x54, 0x25, 0xfe, 0xb0, 0x00,
+	0xff, 0xff, 0x00, 0x0d, 0x00, 0x00, 0x03, 0x49, 0x03, 0x17, 0x02, 0x26, 0x00, 0x76, 0x00, 0x00,
+	0x01, 0x07, 0x00, 0x87, 0x01, 0x33, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0,
+	0x35, 0x2b, 0xff, 0xff, 0x00, 0x0d, 0x00, 0x00, 0x03, 0x49, 0x03, 0x17, 0x02, 0x26, 0x00, 0x76,
+	0x00, 0x00, 0x01, 0x07, 0x00, 0x8a, 0x00, 0xd9, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
+	0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x0d, 0x00, 0x00, 0x03, 0x49, 0x02, 0xef, 0x02, 0x26,
+	0x00, 0x76, 0x00, 0x00, 0x01, 0x07, 0x00, 0x8b, 0x00, 0xf8, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x01,
+	0x02, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x0d, 0x00, 0x00, 0x03, 0x49, 0x03, 0x17,
+	0x02, 0x26, 0x00, 0x76, 0x00, 0x00, 0x01, 0x07, 0x00, 0x8d, 0x00, 0xf2, 0x00, 0x73, 0x00, 0x08,
+	0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x02, 0x23,
+	0x02, 0x73, 0x00, 0x0b, 0x00, 0x1f, 0x40, 0x1c, 0x09, 0x06, 0x03, 0x03, 0x00, 0x02, 0x01, 0x4c,
+	0x03, 0x01, 0x02, 0x02, 0x22, 0x4d, 0x01, 0x01, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x12, 0x12, 0x12,
+	0x11, 0x04, 0x08, 0x1a, 0x2b, 0x01, 0x13, 0x23, 0x03, 0x03, 0x23, 0x13, 0x03, 0x33, 0x17, 0x37,
+	0x33, 0x01, 0x42, 0xe1, 0x68, 0xaf, 0xaa, 0x5e, 0xd9, 0xd0, 0x67, 0x9c, 0xa2, 0x5c, 0x01, 0x45,
+	0xfe, 0xbb, 0x01, 0x02, 0xfe, 0xfe, 0x01, 0x42, 0x01, 0x31, 0xf2, 0xf2, 0xff, 0xff, 0x00, 0x04,
+	0x00, 0x00, 0x02, 0x23, 0x02, 0xef, 0x02, 0x26, 0x00, 0x7b, 0x00, 0x00, 0x01, 0x07, 0x00, 0x8c,
+	0x00, 0xad, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0x00, 0x01,
+	0x00, 0x07, 0x00, 0x00, 0x02, 0x34, 0x02, 0x73, 0x00, 0x08, 0x00, 0x1d, 0x40, 0x1a, 0x08, 0x05,
+	0x02, 0x03, 0x01, 0x00, 0x01, 0x4c, 0x02, 0x01, 0x00, 0x00, 0x22, 0x4d, 0x00, 0x01, 0x01, 0x23,
+	0x01, 0x4e, 0x12, 0x12, 0x10, 0x03, 0x08, 0x19, 0x2b, 0x01, 0x33, 0x03, 0x15, 0x23, 0x35, 0x03,
+	0x33, 0x13, 0x01, 0xdc, 0x58, 0xe9, 0x55, 0xef, 0x60, 0xbb, 0x02, 0x73, 0xfe, 0x7b, 0xee, 0xee,
+	0x01, 0x85, 0xfe, 0xc7, 0xff, 0xff, 0x00, 0x07, 0x00, 0x00, 0x02, 0x34, 0x03, 0x17, 0x02, 0x26,
+	0x00, 0x7d, 0x00, 0x00, 0x01, 0x07, 0x00, 0x87, 0x00, 0xa9, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x01,
+	0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x07, 0x00, 0x00, 0x02, 0x34, 0x03, 0x17,
+	0x02, 0x26, 0x00, 0x7d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8a, 0x4f, 0x73, 0x00, 0x08, 0xb1, 0x01,
+	0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x07, 0x00, 0x00, 0x02, 0x34, 0x02, 0xef,
+	0x02, 0x26, 0x00, 0x7d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8b, 0x6e, 0x73, 0x00, 0x08, 0xb1, 0x01,
+	0x02, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x07, 0x00, 0x00, 0x02, 0x34, 0x03, 0x17,
+	0x02, 0x26, 0x00, 0x7d, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8d, 0x68, 0x73, 0x00, 0x08, 0xb1, 0x01,
+	0x01, 0xb0, 0x73, 0xb0, 0x35, 0x2b, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x01, 0xe5, 0x02, 0x73,
+	0x00, 0x09, 0x00, 0x2d, 0x40, 0x2a, 0x08, 0x01, 0x01, 0x03, 0x01, 0x03, 0x02, 0x4b, 0x00, 0x01,
+	0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x22, 0x4d, 0x04, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00,
+	0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x11, 0x12, 0x11, 0x05, 0x08, 0x19,
+	0x2b, 0x25, 0x15, 0x21, 0x35, 0x01, 0x21, 0x35, 0x21, 0x15, 0x01, 0x01, 0xe5, 0xfe, 0x33, 0x01,
+	0x5a, 0xfe, 0xc3, 0x01, 0x9d, 0xfe, 0xa7, 0x50, 0x50, 0x50, 0x01, 0xd6, 0x4d, 0x4d, 0xfe, 0x2a,
+	0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x01, 0xe5, 0x03, 0x17, 0x02, 0x26, 0x00, 0x82, 0x00, 0x00,
+	0x01, 0x07, 0x00, 0x87, 0x00, 0x8c, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0,
+	0x35, 0x2b, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x01, 0xe5, 0x03, 0x17, 0x02, 0x26, 0x00, 0x82,
+	0x00, 0x00, 0x01, 0x06, 0x00, 0x89, 0x31, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x73, 0xb0,
+	0x35, 0x2b, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x01, 0xe5, 0x02, 0xef, 0x02, 0x26, 0x00, 0x82,
+	0x00, 0x00, 0x01, 0x07, 0x00, 0x8c, 0x00, 0xa0, 0x00, 0x73, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
+	0x73, 0xb0, 0x35, 0x2b, 0x00, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xec, 0x02, 0x73, 0x00, 0x11,
+	0x00, 0x3b, 0x40, 0x38, 0x0c, 0x01, 0x03, 0x03, 0x01, 0x07, 0x02, 0x4b, 0x05, 0x01, 0x02, 0x06,
+	0x01, 0x01, 0x07, 0x02, 0x01, 0x67, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x22, 0x4d,
+	0x08, 0x01, 0x07, 0x07, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x11,
+	0x00, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x09, 0x08, 0x1d, 0x2b, 0x25, 0x15, 0x21,
+	0x35, 0x37, 0x23, 0x35, 0x33, 0x37, 0x21, 0x35, 0x21, 0x15, 0x07, 0x33, 0x15, 0x23, 0x07, 0x01,
+	0xec, 0xfe, 0x33, 0x9d, 0x86, 0xb2, 0x91, 0xfe, 0xc3, 0x01, 0x9d, 0x91, 0x8f, 0xbb, 0x9c, 0x50,
+	0x50, 0x50, 0xd5, 0x3c, 0xc5, 0x4d, 0x4d, 0xc5, 0x3c, 0xd5, 0x00, 0x01, 0x00, 0x32, 0x02, 0x34,
+	0x00, 0xff, 0x02, 0xa4, 0x00, 0x03, 0x00, 0x11, 0x40, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x85, 0x00,
+	0x01, 0x01, 0x76, 0x11, 0x10, 0x02, 0x06, 0x18, 0x2b, 0x13, 0x33, 0x07, 0x23, 0x97, 0x68, 0x81,
+	0x4c, 0x02, 0xa4, 0x70, 0x00, 0x01, 0x00, 0x32, 0x02, 0x2d, 0x01, 0x4b, 0x02, 0xa4, 0x00, 0x0d,
+	0x00, 0x20, 0x40, 0x1d, 0x02, 0x01, 0x00, 0x03, 0x00, 0x85, 0x00, 0x03, 0x01, 0x01, 0x03, 0x59,
+	0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x03, 0x01, 0x51, 0x22, 0x12, 0x22, 0x10, 0x04, 0x06,
+	0x1a, 0x2b, 0x01, 0x33, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36,
+	0x01, 0x11, 0x3a, 0x4b, 0x41, 0x42, 0x4b, 0x3a, 0x2c, 0x27, 0x26, 0x2c, 0x02, 0xa4, 0x37, 0x40,
+	0x40, 0x37, 0x1e, 0x22, 0x23, 0x00, 0x00, 0x01, 0x00, 0x32, 0x02, 0x34, 0x01, 0x75, 0x02, 0xa4,
+	0x00, 0x06, 0x00, 0x19, 0x40, 0x16, 0x02, 0x01, 0x02, 0x00, 0x01, 0x4c, 0x01, 0x01, 0x00, 0x02,
+	0x00, 0x85, 0x00, 0x02, 0x02, 0x76, 0x11, 0x12, 0x10, 0x03, 0x06, 0x19, 0x2b, 0x13, 0x33, 0x17,
+	0x37, 0x33, 0x07, 0x23, 0x32, 0x4a, 0x58, 0x56, 0x4b, 0x77, 0x55, 0x02, 0xa4, 0x3f, 0x3f, 0x70,
+	0x00, 0x01, 0x00, 0x32, 0x02, 0x34, 0x01, 0x75, 0x02, 0xa4, 0x00, 0x06, 0x00, 0x19, 0x40, 0x16,
+	0x02, 0x01, 0x00, 0x02, 0x01, 0x4c, 0x00, 0x02, 0x00, 0x02, 0x85, 0x01, 0x01, 0x00, 0x00, 0x76,
+	0x11, 0x12, 0x10, 0x03, 0x06, 0x19, 0x2b, 0x01, 0x23, 0x27, 0x07, 0x23, 0x37, 0x33, 0x01, 0x75,
+	0x4a, 0x58, 0x56, 0x4b, 0x77, 0x55, 0x02, 0x34, 0x3f, 0x3f, 0x70, 0x00, 0x00, 0x02, 0x00, 0x32,
+	0x02, 0x34, 0x01, 0x36, 0x02, 0x7c, 0x00, 0x03, 0x00, 0x07, 0x00, 0x2c, 0x40, 0x29, 0x05, 0x03,
+	0x04, 0x03, 0x01, 0x00, 0x00, 0x01, 0x57, 0x05, 0x03, 0x04, 0x03, 0x01, 0x01, 0x00, 0x5f, 0x02,
+	0x01, 0x00, 0x01, 0x00, 0x4f, 0x04, 0x04, 0x00, 0x00, 0x04, 0x07, 0x04, 0x07, 0x06, 0x05, 0x00,
+	0x03, 0x00, 0x03, 0x11, 0x06, 0x06, 0x17, 0x2b, 0x01, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35,
+	0x01, 0x36, 0x52, 0x5f, 0x53, 0x02, 0x7c, 0x48, 0x48, 0x48, 0x48, 0x00, 0x00, 0x01, 0x00, 0x3c,
+	0x02, 0x34, 0x00, 0x8c, 0x02, 0x7c, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x11, 0x10, 0x02, 0x06,
+	0x18, 0x2b, 0x13, 0x23, 0x35, 0x33, 0x8c, 0x50, 0x50, 0x02, 0x34, 0x48, 0x00, 0x01, 0x00, 0x34,
+	0x02, 0x34, 0x01, 0x01, 0x02, 0xa4, 0x00, 0x03, 0x00, 0x17, 0x40, 0x14, 0x00, 0x00, 0x01, 0x00,
+	0x85, 0x02, 0x01, 0x01, 0x01, 0x76, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x03, 0x06, 0x17,
+	0x2b, 0x13, 0x27, 0x33, 0x17, 0xb5, 0x81, 0x68, 0x65, 0x02, 0x34, 0x70, 0x70, 0x00, 0x00, 0x02,
+	0x00, 0x37, 0x02, 0x34, 0x01, 0xac, 0x02, 0xa4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1d, 0x40, 0x1a,
+	0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x03, 0x01, 0x01,
+	0x00, 0x01, 0x4f, 0x11, 0x11, 0x11, 0x10, 0x04, 0x06, 0x1a, 0x2b, 0x13, 0x33, 0x07, 0x23, 0x25,
+	0x33, 0x07, 0x23, 0x9b, 0x60, 0x7c, 0x48, 0x01, 0x16, 0x5f, 0x7b, 0x49, 0x02, 0xa4, 0x70, 0x70,
+	0x70, 0x00, 0x00, 0x01, 0x00, 0x32, 0x02, 0x39, 0x01, 0x27, 0x02, 0x74, 0x00, 0x03, 0x00, 0x1f,
+	0x40, 0x1c, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x57, 0x02, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00,
+	0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x03, 0x06, 0x17, 0x2b, 0x01,
+	0x15, 0x23, 0x35, 0x01, 0x27, 0xf5, 0x02, 0x74, 0x3b, 0x3b, 0x00, 0x02, 0x00, 0x33, 0x02, 0x2e,
+	0x01, 0x14, 0x02, 0xd3, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x22, 0x40, 0x1f, 0x00, 0x01, 0x00, 0x03,
+	0x02, 0x01, 0x03, 0x69, 0x00, 0x02, 0x00, 0x00, 0x02, 0x59, 0x00, 0x02, 0x02, 0x00, 0x61, 0x00,
+	0x00, 0x02, 0x00, 0x51, 0x24, 0x24, 0x24, 0x22, 0x04, 0x06, 0x1a, 0x2b, 0x01, 0x14, 0x06, 0x23,
+	0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x07, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34,
+	0x26, 0x23, 0x22, 0x06, 0x01, 0x14, 0x3d, 0x34, 0x33, 0x3d, 0x3d, 0x33, 0x34, 0x3d, 0xae, 0x21,
+	0x1c, 0x1d, 0x22, 0x22, 0x1d, 0x1d, 0x20, 0x02, 0x82, 0x26, 0x2e, 0x2e, 0x26, 0x25, 0x2c, 0x2c,
+	0x25, 0x13, 0x15, 0x16, 0x12, 0x12, 0x14, 0x14, 0x00, 0x01, 0x00, 0x32, 0x02, 0x30, 0x01, 0x59,
+	0x02, 0x9d, 0x00, 0x19, 0x00, 0xb7, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x40, 0x26, 0x00, 0x00, 0x04,
+	0x05, 0x05, 0x00, 0x72, 0x00, 0x03, 0x02, 0x01, 0x02, 0x03, 0x72, 0x00, 0x05, 0x02, 0x01, 0x05,
+	0x59, 0x00, 0x04, 0x00, 0x02, 0x03, 0x04, 0x02, 0x69, 0x00, 0x05, 0x05, 0x01, 0x62, 0x00, 0x01,
+	0x05, 0x01, 0x52, 0x1b, 0x4b, 0xb0, 0x0b, 0x50, 0x58, 0x40, 0x1a, 0x00, 0x05, 0x02, 0x01, 0x05,
+	0x59, 0x04, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x69, 0x00, 0x05, 0x05, 0x01, 0x62, 0x03,
+	0x01, 0x01, 0x05, 0x01, 0x52, 0x1b, 0x4b, 0xb0, 0x1a, 0x50, 0x58, 0x40, 0x26, 0x00, 0x00, 0x04,
+	0x05, 0x05, 0x00, 0x72, 0x00, 0x03, 0x02, 0x01, 0x02, 0x03, 0x72, 0x00, 0x05, 0x02, 0x01, 0x05,
+	0x59, 0x00, 0x04, 0x00, 0x02, 0x03, 0x04, 0x02, 0x69, 0x00, 0x05, 0x05, 0x01, 0x62, 0x00, 0x01,
+	0x05, 0x01, 0x52, 0x1b, 0x40, 0x28, 0x00, 0x00, 0x04, 0x05, 0x04, 0x00, 0x05, 0x80, 0x00, 0x03,
+	0x02, 0x01, 0x02, 0x03, 0x01, 0x80, 0x00, 0x05, 0x02, 0x01, 0x05, 0x59, 0x00, 0x04, 0x00, 0x02,
+	0x03, 0x04, 0x02, 0x69, 0x00, 0x05, 0x05, 0x01, 0x62, 0x00, 0x01, 0x05, 0x01, 0x52, 0x59, 0x59,
+	0x59, 0x40, 0x09, 0x24, 0x22, 0x12, 0x24, 0x22, 0x10, 0x06, 0x06, 0x1c, 0x2b, 0x01, 0x33, 0x14,
+	0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36, 0x33, 0x32,
+	0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x01, 0x21, 0x38, 0x29, 0x27, 0x12, 0x23, 0x1b, 0x13,
+	0x12, 0x08, 0x10, 0x12, 0x38, 0x2a, 0x27, 0x12, 0x23, 0x1c, 0x13, 0x11, 0x08, 0x10, 0x11, 0x02,
+	0x99, 0x31, 0x38, 0x0d, 0x13, 0x0d, 0x08, 0x1a, 0x17, 0x31, 0x38, 0x0d, 0x13, 0x0d, 0x08, 0x1a,
+	0x00, 0x02, 0x00, 0x1f, 0xff, 0xf8, 0x01, 0xaf, 0x01, 0xf8, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0xa4,
+	0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x17, 0x11, 0x01, 0x02, 0x03, 0x10, 0x01, 0x01, 0x02, 0x09,
+	0x01, 0x05, 0x01, 0x28, 0x27, 0x02, 0x06, 0x05, 0x1a, 0x01, 0x00, 0x06, 0x05, 0x4c, 0x1b, 0x40,
+	0x17, 0x11, 0x01, 0x02, 0x03, 0x10, 0x01, 0x01, 0x02, 0x09, 0x01, 0x05, 0x01, 0x28, 0x27, 0x02,
+	0x06, 0x05, 0x1a, 0x01, 0x04, 0x06, 0x05, 0x4c, 0x59, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x20,
+	0x00, 0x01, 0x08, 0x01, 0x05, 0x06, 0x01, 0x05, 0x69, 0x00, 0x02, 0x02, 0x03, 0x61, 0x00, 0x03,
+	0x03, 0x2b, 0x4d, 0x00, 0x06, 0x06, 0x00, 0x61, 0x04, 0x07, 0x02, 0x00, 0x00, 0x29, 0x00, 0x4e,
+	0x1b, 0x40, 0x24, 0x00, 0x01, 0x08, 0x01, 0x05, 0x06, 0x01, 0x05, 0x69, 0x00, 0x02, 0x02, 0x03,
+	0x61, 0x00, 0x03, 0x03, 0x2b, 0x4d, 0x00, 0x04, 0x04, 0x23, 0x4d, 0x00, 0x06, 0x06, 0x00, 0x61,
+	0x07, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x59, 0x40, 0x19, 0x1f, 0x1e, 0x01, 0x00, 0x25, 0x23,
+	0x1e, 0x2a, 0x1f, 0x2a, 0x19, 0x18, 0x15, 0x13, 0x0e, 0x0c, 0x07, 0x05, 0x00, 0x1d, 0x01, 0x1d,
+	0x09, 0x08, 0x16, 0x2b, 0x17, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x35, 0x34,
+	0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x11, 0x23, 0x27, 0x23,
+	0x06, 0x06, 0x37, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x35, 0x26, 0x26, 0xb2,
+	0x4c, 0x47, 0x56, 0x67, 0x22, 0x42, 0x1d, 0x38, 0x3e, 0x2e, 0x46, 0x23, 0x28, 0x53, 0x35, 0x59,
+	0x56, 0x4b, 0x04, 0x02, 0x1e, 0x5f, 0x04, 0x44, 0x35, 0x2c, 0x32, 0x27, 0x52, 0x1a, 0x21, 0x39,
+	0x08, 0x49, 0x4f, 0x50, 0x43, 0x06, 0x06, 0x30, 0x37, 0x30, 0x07, 0x08, 0x47, 0x0a, 0x08, 0x53,
+	0x57, 0xfe, 0xb2, 0x2e, 0x18, 0x1e, 0xe8, 0x21, 0x2a, 0x2c, 0x27, 0x18, 0x12, 0x6a, 0x05, 0x05,
+	0xff, 0xff, 0x00, 0x1f, 0xff, 0xf8, 0x01, 0xaf, 0x02, 0xae, 0x02, 0x26, 0x00, 0x92, 0x00, 0x00,
+	0x00, 0x06, 0x01, 0x1c, 0x7d, 0x00, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xf8, 0x01, 0xaf, 0x02, 0xae,
+	0x02, 0x26, 0x00, 0x92, 0x00, 0x00, 0x00, 0x06, 0x01, 0x1d, 0x37, 0x00, 0xff, 0xff, 0x00, 0x1f,
+	0xff, 0xf8, 0x01, 0xaf, 0x02, 0xae, 0x02, 0x26, 0x00, 0x92, 0x00, 0x00, 0x00, 0x06, 0x01, 0x21,
+	0x23, 0x00, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xf8, 0x01, 0xaf, 0x02, 0x82, 0x02, 0x26, 0x00, 0x92,
+	0x00, 0x00, 0x00, 0x06, 0x01, 0x24, 0x42, 0x00, 0x00, 0x03, 0x00, 0x1f, 0xff, 0xf8, 0x02, 0xd5,
+	0x01, 0xf8, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x45, 0x00, 0x5b, 0x40, 0x58, 0x15, 0x0f, 0x02, 0x02,
+	0x03, 0x0e, 0x01, 0x01, 0x02, 0x3f, 0x25, 0x02, 0x06, 0x05, 0x2c, 0x26, 0x02, 0x00, 0x06, 0x04,
+	0x4c, 0x09, 0x01, 0x01, 0x0b, 0x01, 0x05, 0x06, 0x01, 0x05, 0x67, 0x08, 0x01, 0x02, 0x02, 0x03,
+	0x61, 0x04, 0x01, 0x03, 0x03, 0x2b, 0x4d, 0x0a, 0x01, 0x06, 0x06, 0x00, 0x61, 0x07, 0x0c, 0x02,
+	0x00, 0x00, 0x29, 0x00, 0x4e, 0x01, 0x00, 0x44, 0x42, 0x3d, 0x3b, 0x36, 0x35, 0x33, 0x31, 0x2a,
+	0x28, 0x23, 0x21, 0x1f, 0x1e, 0x19, 0x17, 0x13, 0x11, 0x0c, 0x0a, 0x07, 0x05, 0x00, 0x2e, 0x01,
+	0x2e, 0x0d, 0x08, 0x16, 0x2b, 0x17, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x35, 0x34, 0x26,
+	0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x36, 0x36, 0x33, 0x32, 0x16,
+	0x15, 0x14, 0x06, 0x07, 0x21, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22,
+	0x26, 0x27, 0x06, 0x06, 0x01, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x33, 0x36, 0x34, 0x05, 0x14,
+	0x16, 0x33, 0x32, 0x36, 0x37, 0x26, 0x26, 0x27, 0x23, 0x22, 0x06, 0xb2, 0x4b, 0x48, 0x54, 0x66,
+	0x73, 0x33, 0x39, 0x2c, 0x44, 0x20, 0x28, 0x4e, 0x33, 0x32, 0x41, 0x11, 0x1a, 0x4e, 0x35, 0x64,
+	0x57, 0x02, 0x02, 0xfe, 0xcb, 0x01, 0x3d, 0x4b, 0x28, 0x58, 0x1b, 0x19, 0x60, 0x30, 0x3b, 0x50,
+	0x18, 0x25, 0x65, 0x01, 0xa0, 0x01, 0x33, 0x3c, 0x45, 0x39, 0xed, 0x01, 0xfd, 0xe3, 0x2a, 0x31,
+	0x28, 0x4f, 0x1d, 0x07, 0x07, 0x01, 0x6f, 0x41, 0x30, 0x08, 0x49, 0x4c, 0x4f, 0x42, 0x29, 0x37,
+	0x30, 0x07, 0x08, 0x47, 0x0a, 0x08, 0x21, 0x22, 0x21, 0x22, 0x60, 0x6e, 0x19, 0x23, 0x12, 0x52,
+	0x46, 0x11, 0x0b, 0x45, 0x0e, 0x15, 0x22, 0x24, 0x21, 0x25, 0x01, 0x3d, 0x42, 0x37, 0x41, 0x4f,
+	0x03, 0x0a, 0x9a, 0x2b, 0x24, 0x1c, 0x17, 0x15, 0x34, 0x1e, 0x20, 0x00, 0xff, 0xff, 0x00, 0x1f,
+	0xff, 0xf8, 0x02, 0xd5, 0x02, 0xae, 0x02, 0x26, 0x00, 0x97, 0x00, 0x00, 0x00, 0x07, 0x01, 0x1c,
+	0x01, 0x08, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xf8, 0x01, 0xaf, 0x02, 0xae, 0x02, 0x26,
+	0x00, 0x92, 0x00, 0x00, 0x00, 0x06, 0x01, 0x26, 0x3c, 0x00, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xf8,
+	0x01, 0xaf, 0x02, 0x79, 0x02, 0x26, 0x00, 0x92, 0x00, 0x00, 0x00, 0x06, 0x01, 0x28, 0x49, 0x00,
+	0x00, 0x02, 0x00, 0x1f, 0xff, 0x34, 0x01, 0xaf, 0x01, 0xf8, 0x00, 0x2f, 0x00, 0x3c, 0x00, 0x64,
+	0x40, 0x61, 0x11, 0x01, 0x02, 0x03, 0x10, 0x01, 0x01, 0x02, 0x09, 0x01, 0x06, 0x01, 0x3a, 0x39,
+	0x02, 0x07, 0x06, 0x2c, 0x18, 0x02, 0x00, 0x07, 0x21, 0x01, 0x04, 0x00, 0x22, 0x01, 0x05, 0x04,
+	0x07, 0x4c, 0x00, 0x01, 0x09, 0x01, 0x06, 0x07, 0x01, 0x06, 0x69, 0x00, 0x04, 0x00, 0x05, 0x04,
+	0x05, 0x65, 0x00, 0x02, 0x02, 0x03, 0x61, 0x00, 0x03, 0x03, 0x2b, 0x4d, 0x00, 0x07, 0x07, 0x00,
+	0x61, 0x08, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x31, 0x30, 0x01, 0x00, 0x37, 0x35, 0x30, 0x3c,
+	0x31, 0x3c, 0x26, 0x24, 0x1f, 0x1d, 0x15, 0x13, 0x0e, 0x0c, 0x07, 0x05, 0x00, 0x2f, 0x01, 0x2f,
+	0x0a, 0x08, 0x16, 0x2b, 0x17, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x35, 0x34,
+	0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x11, 0x06, 0x06, 0x15,
+	0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37,
+	0x27, 0x23, 0x06, 0x06, 0x37, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x35, 0x26,
+	0x26, 0xb2, 0x4c, 0x47, 0x56, 0x67, 0x22, 0x42, 0x1d, 0x38, 0x3e, 0x2e, 0x46, 0x23, 0x28, 0x53,
+	0x35, 0x59, 0x56, 0x3c, 0x4d, 0x1d, 0x1d, 0x0e, 0x21, 0x0c, 0x20, 0x21, 0x0f, 0x33, 0x37, 0x42,
+	0x40, 0x03, 0x02, 0x1e, 0x5f, 0x04, 0x44, 0x35, 0x2c, 0x32, 0x27, 0x52, 0x1a, 0x21, 0x39, 0x08,
+	0x49, 0x4f, 0x50, 0x43, 0x06, 0x06, 0x30, 0x37, 0x30, 0x07, 0x08, 0x47, 0x0a, 0x08, 0x53, 0x57,
+	0xfe, 0xb2, 0x0c, 0x35, 0x21, 0x16, 0x16, 0x05, 0x03, 0x3b, 0x07, 0x04, 0x2f, 0x2c, 0x2c, 0x3f,
+	0x12, 0x22, 0x18, 0x1e, 0xe8, 0x21, 0x2a, 0x2c, 0x27, 0x18, 0x12, 0x6a, 0x05, 0x05, 0xff, 0xff,
+	0x00, 0x1f, 0xff, 0xf8, 0x01, 0xaf, 0x02, 0xdb, 0x02, 0x26, 0x00, 0x92, 0x00, 0x00, 0x00, 0x06,
+	0x01, 0x2a, 0x53, 0x00, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xf8, 0x01, 0xaf, 0x02, 0xb0, 0x02, 0x26,
+	0x00, 0x92, 0x00, 0x00, 0x00, 0x06, 0x01, 0x2b, 0x30, 0x00, 0x00, 0x02, 0x00, 0x41, 0xff, 0xf8,
+	0x01, 0xf2, 0x02, 0x99, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x3e, 0x40, 0x3b, 0x0c, 0x01, 0x03, 0x00,
+	0x16, 0x15, 0x02, 0x04, 0x03, 0x09, 0x01, 0x01, 0x04, 0x03, 0x4c, 0x00, 0x02, 0x02, 0x24, 0x4d,
+	0x00, 0x03, 0x03, 0x00, 0x61, 0x05, 0x01, 0x00, 0x00, 0x2b, 0x4d, 0x00, 0x04, 0x04, 0x01, 0x61,
+	0x00, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x01, 0x00, 0x1a, 0x18, 0x13, 0x11, 0x0b, 0x0a, 0x07, 0x05,
+	0x00, 0x0e, 0x01, 0x0e, 0x06, 0x08, 0x16, 0x2b, 0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
+	0x26, 0x27, 0x11, 0x33, 0x15, 0x36, 0x36, 0x17, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x11, 0x16,
+	0x16, 0x33, 0x32, 0x36, 0x01, 0x36, 0x65, 0x57, 0x6c, 0x7f, 0x39, 0x64, 0x29, 0x52, 0x23, 0x54,
+	0x96, 0x39, 0x4e, 0x24, 0x46, 0x1c, 0x16, 0x38, 0x21, 0x5d, 0x41, 0x01, 0xf8, 0x77, 0x87, 0x8a,
+	0x78, 0x0d, 0x0d, 0x02, 0x87, 0xcd, 0x15, 0x17, 0xfe, 0x65, 0x4f, 0x13, 0x11, 0xfe, 0xc7, 0x06,
+	0x07, 0x4e, 0x00, 0x01, 0x00, 0x2b, 0xff, 0xf8, 0x01, 0x9b, 0x01, 0xf8, 0x00, 0x19, 0x00, 0x2e,
+	0x40, 0x2b, 0x0d, 0x01, 0x02, 0x01, 0x0e, 0x00, 0x02, 0x03, 0x02, 0x01, 0x01, 0x00, 0x03, 0x03,
+	0x4c, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01, 0x2b, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x61,
+	0x00, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x24, 0x33, 0x34, 0x23, 0x04, 0x08, 0x1a, 0x2b, 0x25, 0x15,
+	0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23,
+	0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x01, 0x9b, 0x19, 0x63, 0x36, 0x69, 0x55, 0x6e,
+	0x84, 0x1d, 0x2f, 0x25, 0x25, 0x2f, 0x1d, 0x5e, 0x42, 0x34, 0x4a, 0x29, 0x58, 0x62, 0x45, 0x10,
+	0x15, 0x72, 0x8e, 0x8b, 0x75, 0x03, 0x05, 0x49, 0x05, 0x02, 0x4d, 0x69, 0x69, 0x4b, 0x11, 0x00,
+	0xff, 0xff, 0x00, 0x2b, 0xff, 0xf8, 0x01, 0x9b, 0x02, 0xae, 0x02, 0x26, 0x00, 0x9f, 0x00, 0x00,
+	0x00, 0x07, 0x01, 0x1c, 0x00, 0x8f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xf8, 0x01, 0xa9,
+	0x02, 0xae, 0x02, 0x26, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x06, 0x01, 0x1e, 0x34, 0x00, 0x00, 0x01,
+	0x00, 0x2b, 0xff, 0x3d, 0x01, 0x9b, 0x01, 0xf8, 0x00, 0x31, 0x00, 0x49, 0x40, 0x46, 0x1d, 0x01,
+	0x05, 0x04, 0x2a, 0x1e, 0x02, 0x06, 0x05, 0x2b, 0x01, 0x03, 0x06, 0x07, 0x01, 0x01, 0x02, 0x06,
+	0x01, 0x00, 0x01, 0x05, 0x4c, 0x00, 0x07, 0x00, 0x02, 0x01, 0x07, 0x02, 0x69, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x65, 0x00, 0x05, 0x05, 0x04, 0x61, 0x00, 0x04, 0x04, 0x2b, 0x4d, 0x00, 0x06,
+	0x06, 0x03, 0x61, 0x00, 0x03, 0x03, 0x23, 0x03, 0x4e, 0x17, 0x24, 0x33, 0x34, 0x12, 0x34, 0x25,
+	0x22, 0x08, 0x08, 0x1e, 0x2b, 0x05, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33,
+	0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x23, 0x37, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33,
+	0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37,
+	0x15, 0x06, 0x06, 0x07, 0x07, 0x36, 0x16, 0x01, 0x76, 0x35, 0x3b, 0x21, 0x3e, 0x0b, 0x0b, 0x37,
+	0x1b, 0x1d, 0x17, 0x1c, 0x20, 0x0c, 0x24, 0x01, 0x10, 0x5a, 0x4b, 0x6e, 0x84, 0x1d, 0x2f, 0x25,
+	0x25, 0x2f, 0x1d, 0x5e, 0x42, 0x34, 0x4a, 0x29, 0x58, 0x1f, 0x15, 0x4b, 0x2a, 0x09, 0x36, 0x38,
+	0x73, 0x29, 0x27, 0x07, 0x05, 0x33, 0x04, 0x07, 0x0d, 0x11, 0x0e, 0x0d, 0x02, 0x51, 0x06, 0x73,
+	0x86, 0x8b, 0x75, 0x03, 0x05, 0x49, 0x05, 0x02, 0x4d, 0x69, 0x69, 0x4b, 0x11, 0x0d, 0x45, 0x0c,
+	0x14, 0x03, 0x29, 0x02, 0x23, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xf8, 0x01, 0xaa, 0x02, 0xae,
+	0x02, 0x26, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x06, 0x01, 0x21, 0x35, 0x00, 0xff, 0xff, 0x00, 0x2b,
+	0xff, 0xf8, 0x01, 0x9b, 0x02, 0x82, 0x02, 0x26, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x07, 0x01, 0x25,
+	0x00, 0xa3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2a, 0xff, 0xf8, 0x01, 0xdb, 0x02, 0x99, 0x00, 0x11,
+	0x00, 0x1e, 0x00, 0x6a, 0x40, 0x0f, 0x11, 0x01, 0x04, 0x03, 0x1c, 0x1b, 0x02, 0x05, 0x04, 0x04,
+	0x01, 0x01, 0x05, 0x03, 0x4c, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x1c, 0x00, 0x00, 0x00, 0x24,
+	0x4d, 0x06, 0x01, 0x04, 0x04, 0x03, 0x61, 0x00, 0x03, 0x03, 0x2b, 0x4d, 0x00, 0x05, 0x05, 0x01,
+	0x61, 0x02, 0x01, 0x01, 0x01, 0x23, 0x01, 0x4e, 0x1b, 0x40, 0x20, 0x00, 0x00, 0x00, 0x24, 0x4d,
+	0x06, 0x01, 0x04, 0x04, 0x03, 0x61, 0x00, 0x03, 0x03, 0x2b, 0x4d, 0x00, 0x01, 0x01, 0x23, 0x4d,
+	0x00, 0x05, 0x05, 0x02, 0x61, 0x00, 0x02, 0x02, 0x29, 0x02, 0x4e, 0x59, 0x40, 0x0f, 0x13, 0x12,
+	0x19, 0x17, 0x12, 0x1e, 0x13, 0x1e, 0x24, 0x24, 0x11, 0x10, 0x07, 0x08, 0x1a, 0x2b, 0x01, 0x33,
+	0x11, 0x23, 0x27, 0x23, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17,
+	0x07, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x11, 0x26, 0x26, 0x01, 0x89, 0x52,
+	0x47, 0x06, 0x02, 0x1d, 0x53, 0x36, 0x65, 0x57, 0x6a, 0x7c, 0x23, 0x3d, 0x19, 0x6f, 0x5d, 0x41,
+	0x39, 0x4e, 0x25, 0x44, 0x1d, 0x18, 0x36, 0x02, 0x99, 0xfd, 0x67, 0x2e, 0x1b, 0x1b, 0x78, 0x88,
+	0x88, 0x78, 0x0b, 0x0a, 0x35, 0x4e, 0x68, 0x65, 0x4f, 0x13, 0x13, 0x01, 0x30, 0x0a, 0x0a, 0x00,
+	0xff, 0xff, 0x00, 0x2a, 0xff, 0xf8, 0x02, 0x73, 0x02, 0x99, 0x00, 0x26, 0x00, 0xa5, 0x00, 0x00,
+	0x00, 0x07, 0x01, 0x1f, 0x01, 0xf7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2a, 0xff, 0xf8, 0x02, 0x22,
+	0x02, 0x99, 0x00, 0x19, 0x00, 0x26, 0x00, 0xc1, 0x40, 0x0f, 0x12, 0x01, 0x08, 0x03, 0x24, 0x23,
+	0x02, 0x09, 0x08, 0x05, 0x01, 0x01, 0x09, 0x03, 0x4c, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x29,
+	0x00, 0x06, 0x06, 0x24, 0x4d, 0x04, 0x01, 0x00, 0x00, 0x05, 0x5f, 0x0a, 0x07, 0x02, 0x05, 0x05,
+	0x22, 0x4d, 0x0b, 0x01, 0x08, 0x08, 0x03, 0x61, 0x00, 0x03, 0x03, 0x25, 0x4d, 0x00, 0x09, 0x09,
+	0x01, 0x61, 0x02, 0x01, 0x01, 0x01, 0x23, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x27, 0x50, 0x58, 0x40,
+	0x2d, 0x00, 0x06, 0x06, 0x24, 0x4d, 0x04, 0x01, 0x00, 0x00, 0x05, 0x5f, 0x0a, 0x07, 0x02, 0x05,
+	0x05, 0x22, 0x4d, 0x0b, 0x01, 0x08, 0x08, 0x03, 0x61, 0x00, 0x03, 0x03, 0x25, 0x4d, 0x00, 0x01,
+	0x01, 0x23, 0x4d, 0x00, 0x09, 0x09, 0x02, 0x61, 0x00, 0x02, 0x02, 0x29, 0x02, 0x4e, 0x1b, 0x40,
+	0x2b, 0x0a, 0x07, 0x02, 0x05, 0x04, 0x01, 0x00, 0x03, 0x05, 0x00, 0x67, 0x00, 0x06, 0x06, 0x24,
+	0x4d, 0x0b, 0x01, 0x08, 0x08, 0x03, 0x61, 0x00, 0x03, 0x03, 0x25, 0x4d, 0x00, 0x01, 0x01, 0x23,
+	0x4d, 0x00, 0x09, 0x09, 0x02, 0x61, 0x00, 0x02, 0x02, 0x29, 0x02, 0x4e, 0x59, 0x59, 0x40, 0x18,
+	0x1b, 0x1a, 0x00, 0x00, 0x21, 0x1f, 0x1a, 0x26, 0x1b, 0x26, 0x00, 0x19, 0x00, 0x19, 0x11, 0x11,
+	0x13, 0x24, 0x24, 0x11, 0x11, 0x0c, 0x08, 0x1d, 0x2b, 0x01, 0x15, 0x23, 0x11, 0x23, 0x27, 0x23,
+	0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x35, 0x23, 0x35, 0x33,
+	0x35, 0x33, 0x15, 0x07, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x11, 0x26, 0x26,
+	0x02, 0x22, 0x46, 0x48, 0x06, 0x02, 0x1d, 0x52, 0x37, 0x65, 0x57, 0x6a, 0x7c, 0x26, 0x3d, 0x17,
+	0xb1, 0xb1, 0x52, 0xc2, 0x5d, 0x41, 0x39, 0x4e, 0x25, 0x44, 0x1e, 0x18, 0x36, 0x02, 0x66, 0x31,
+	0xfd, 0xcb, 0x30, 0x1c, 0x1c, 0x76, 0x85, 0x86, 0x75, 0x0a, 0x0a, 0x5b, 0x31, 0x33, 0x33, 0xc2,
+	0x4c, 0x65, 0x62, 0x4d, 0x13, 0x14, 0x01, 0x24, 0x0b, 0x0a, 0x00, 0x02, 0x00, 0x2b, 0xff, 0xf8,
+	0x01, 0xf4, 0x02, 0x99, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x36, 0x40, 0x33, 0x1c, 0x1b, 0x1a, 0x19,
+	0x12, 0x11, 0x10, 0x0f, 0x08, 0x01, 0x02, 0x0c, 0x01, 0x04, 0x01, 0x02, 0x4c, 0x00, 0x02, 0x02,
+	0x24, 0x4d, 0x00, 0x04, 0x04, 0x01, 0x61, 0x00, 0x01, 0x01, 0x25, 0x4d, 0x00, 0x03, 0x03, 0x00,
+	0x61, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x29, 0x2b, 0x1b, 0x24, 0x22, 0x05, 0x08, 0x1b, 0x2b,
+	0x25, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x26, 0x26, 0x27,
+	0x07, 0x35, 0x37, 0x26, 0x26, 0x27, 0x33, 0x16, 0x16, 0x17, 0x37, 0x15, 0x07, 0x16, 0x16, 0x05,
+	0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x34, 0x27, 0x23, 0x35, 0x26, 0x26, 0x23, 0x22, 0x06,
+	0x01, 0xf4, 0x67, 0x7d, 0x81, 0x64, 0x67, 0x7e, 0x22, 0x3a, 0x18, 0x09, 0x17, 0x0f, 0xb6, 0x98,
+	0x0c, 0x1a, 0x0e, 0x5c, 0x07, 0x0e, 0x0e, 0x66, 0x47, 0x2c, 0x27, 0xfe, 0x89, 0x3a, 0x59, 0x56,
+	0x3c, 0x01, 0x01, 0x06, 0x3b, 0x4f, 0x57, 0x3c, 0xf1, 0x89, 0x70, 0x6c, 0x8d, 0x89, 0x70, 0x09,
+	0x09, 0x17, 0x2f, 0x17, 0x2a, 0x31, 0x23, 0x0f, 0x1d, 0x0e, 0x07, 0x11, 0x11, 0x18, 0x32, 0x10,
+	0x44, 0xa2, 0x6e, 0x6a, 0x44, 0x48, 0x66, 0x15, 0x13, 0x07, 0x06, 0x46, 0x33, 0x47, 0x00, 0x02,
+	0x00, 0x2a, 0xff, 0xf8, 0x01, 0xca, 0x01, 0xf8, 0x00, 0x16, 0x00, 0x20, 0x00, 0x33, 0x40, 0x30,
+	0x00, 0x01, 0x03, 0x02, 0x01, 0x01, 0x00, 0x03, 0x02, 0x4c, 0x00, 0x05, 0x00, 0x02, 0x03, 0x05,
+	0x02, 0x67, 0x00, 0x04, 0x04, 0x01, 0x61, 0x00, 0x01, 0x01, 0x2b, 0x4d, 0x00, 0x03, 0x03, 0x00,
+	0x61, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x12, 0x24, 0x22, 0x15, 0x24, 0x23, 0x06, 0x08, 0x1c,
+	0x2b, 0x25, 0x15, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+	0x06, 0x07, 0x21, 0x16, 0x16, 0x33, 0x32, 0x36, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x21,
+	0x34, 0x36, 0x01, 0xb5, 0x1a, 0x65, 0x34, 0x74, 0x64, 0x68, 0x72, 0x6a, 0x5c, 0x02, 0x03, 0xfe,
+	0xb8, 0x01, 0x41, 0x50, 0x2b, 0x5e, 0x19, 0x01, 0x38, 0x42, 0x4a, 0x3d, 0x01, 0x01, 0x01, 0x60,
+	0x45, 0x0e, 0x15, 0x78, 0x8a, 0x85, 0x79, 0x5f, 0x6f, 0x14, 0x22, 0x18, 0x52, 0x46, 0x10, 0xe1,
+	0x42, 0x37, 0x3f, 0x4f, 0x02, 0x0f, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xf8, 0x01, 0xca, 0x02, 0xae,
+	0x02, 0x26, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x07, 0x01, 0x1c, 0x00, 0x8c, 0x00, 0x00, 0xff, 0xff,
+	0x00, 0x2a, 0xff, 0xf8, 0x01, 0xca, 0x02, 0xae, 0x02, 0x26, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x06,
+	0x01, 0x1d, 0x46, 0x00, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xf8, 0x01, 0xca, 0x02, 0xae, 0x02, 0x26,
+	0x00, 0xa9, 0x00, 0x00, 0x00, 0x06, 0x01, 0x1e, 0x31, 0x00, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xf8,
+	0x01, 0xca, 0x02, 0xae, 0x02, 0x26, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x06, 0x01, 0x21, 0x32, 0x00,
+	0xff, 0xff, 0x00, 0x2a, 0xff, 0xf8, 0x01, 0xca, 0x02, 0x82, 0x02, 0x26, 0x00, 0xa9, 0x00, 0x00,
+	0x00, 0x06, 0x01, 0x24, 0x51, 0x00, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xf8, 0x01, 0xca, 0x02, 0x82,
+	0x02, 0x26, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x07, 0x01, 0x25, 0x00, 0xa0, 0x00, 0x00, 0xff, 0xff,
+	0x00, 0x2a, 0xff, 0xf8, 0x01, 0xca, 0x02, 0xae, 0x02, 0x26, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x06,
+	0x01, 0x26, 0x4b, 0x00, 0xff, 0xff, 0x00, 0x2a, 0xff, 0xf8, 0x01, 0xca, 0x02, 0x79, 0x02, 0x26,
+	0x00, 0xa9, 0x00, 0x00, 0x00, 0x06, 0x01, 0x28, 0x58, 0x00, 0x00, 0x02, 0x00, 0x2a, 0xff, 0x24,
+	0x01, 0xca, 0x01, 0xf8, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x44, 0x40, 0x41, 0x00, 0x01, 0x05, 0x04,
+	0x01, 0x01, 0x02, 0x05, 0x0d, 0x01, 0x00, 0x02, 0x0e, 0x01, 0x01, 0x00, 0x04, 0x4c, 0x00, 0x07,
+	0x00, 0x04, 0x05, 0x07, 0x04, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x65, 0x00, 0x06, 0x06,
+	0x03, 0x61, 0x00, 0x03, 0x03, 0x2b, 0x4d, 0x00, 0x05, 0x05, 0x02, 0x61, 0x00, 0x02, 0x02, 0x29,
+	0x02, 0x4e, 0x12, 0x24, 0x22, 0x15, 0x24, 0x45, 0x25, 0x29, 0x08, 0x08, 0x1e, 0x2b, 0x25, 0x15,
+	0x06, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23,
+	0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x06, 0x22, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+	0x16, 0x15, 0x14, 0x06, 0x07, 0x21, 0x16, 0x16, 0x33, 0x32, 0x36, 0x27, 0x26, 0x26, 0x23, 0x22,
+	0x06, 0x15, 0x21, 0x34, 0x36, 0x01, 0xb5, 0x08, 0x16, 0x0d, 0x48, 0x35, 0x1f, 0x1c, 0x0d, 0x22,
+	0x0f, 0x12, 0x2a, 0x13, 0x32, 0x36, 0x2b, 0x28, 0x06, 0x0d, 0x0d, 0x74, 0x64, 0x68, 0x72, 0x6a,
+	0x5c, 0x02, 0x03, 0xfe, 0xb8, 0x01, 0x41, 0x50, 0x2b, 0x5e, 0x19, 0x01, 0x38, 0x42, 0x4a, 0x3d,
+	0x01, 0x01, 0x01, 0x60, 0x45, 0x04, 0x09, 0x03, 0x26, 0x3a, 0x21, 0x16, 0x18, 0x05, 0x04, 0x36,
+	0x05, 0x06, 0x2f, 0x2a, 0x22, 0x40, 0x1a, 0x01, 0x78, 0x8a, 0x85, 0x79, 0x5f, 0x6f, 0x14, 0x22,
+	0x18, 0x52, 0x46, 0x10, 0xe1, 0x42, 0x37, 0x3f, 0x4f, 0x02, 0x0f, 0x00, 0x00, 0x02, 0x00, 0x29,
+	0xff, 0xf8, 0x01, 0xc9, 0x01, 0xf8, 0x00, 0x16, 0x00, 0x20, 0x00, 0x33, 0x40, 0x30, 0x01, 0x01,
+	0x03, 0x00, 0x00, 0x01, 0x02, 0x03, 0x02, 0x4c, 0x00, 0x02, 0x00, 0x05, 0x04, 0x02, 0x05, 0x67,
+	0x00, 0x03, 0x03, 0x00, 0x61, 0x00, 0x00, 0x00, 0x2b, 0x4d, 0x00, 0x04, 0x04, 0x01, 0x61, 0x00,
+	0x01, 0x01, 0x29, 0x01, 0x4e, 0x12, 0x24, 0x22, 0x15, 0x24, 0x23, 0x06, 0x08, 0x1c, 0x2b, 0x13,
+	0x35, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37,
+	0x21, 0x26, 0x26, 0x23, 0x22, 0x06, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x21, 0x06, 0x14,
+	0x3e, 0x1a, 0x65, 0x34, 0x72, 0x66, 0x68, 0x72, 0x6a, 0x5c, 0x02, 0x03, 0x01, 0x48, 0x01, 0x42,
+	0x4f, 0x2c, 0x5e, 0x1b, 0x01, 0x38, 0x41, 0x4a, 0x3d, 0xff, 0x00, 0x01, 0x01, 0x93, 0x42, 0x0e,
+	0x15, 0x76, 0x84, 0x89, 0x7d, 0x60, 0x6f, 0x16, 0x27, 0x1e, 0x4b, 0x41, 0x10, 0xe2, 0x42, 0x36,
+	0x45, 0x55, 0x04, 0x0e, 0x00, 0x01, 0x00, 0x15, 0x00, 0x00, 0x01, 0x5f, 0x02, 0xa3, 0x00, 0x17,
+	0x00, 0x5a, 0x40, 0x0a, 0x0a, 0x01, 0x03, 0x02, 0x0b, 0x01, 0x01, 0x03, 0x02, 0x4c, 0x4b, 0xb0,
+	0x31, 0x50, 0x58, 0x40, 0x1c, 0x00, 0x03, 0x03, 0x02, 0x61, 0x00, 0x02, 0x02, 0x24, 0x4d, 0x05,
+	0x01, 0x00, 0x00, 0x01, 0x5f, 0x04, 0x01, 0x01, 0x01, 0x25, 0x4d, 0x00, 0x06, 0x06, 0x23, 0x06,
+	0x4e, 0x1b, 0x40, 0x1a, 0x00, 0x02, 0x00, 0x03, 0x01, 0x02, 0x03, 0x69, 0x05, 0x01, 0x00, 0x00,
+	0x01, 0x5f, 0x04, 0x01, 0x01, 0x01, 0x25, 0x4d, 0x00, 0x06, 0x06, 0x23, 0x06, 0x4e, 0x59, 0x40,
+	0x0a, 0x11, 0x11, 0x13, 0x25, 0x23, 0x11, 0x10, 0x07, 0x08, 0x1d, 0x2b, 0x13, 0x23, 0x35, 0x33,
+	0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x15, 0x33,
+	0x15, 0x23, 0x11, 0x23, 0x5f, 0x4a, 0x4a, 0x54, 0x57, 0x16, 0x2c, 0x13, 0x0c, 0x29, 0x14, 0x39,
+	0x2c, 0x9f, 0x9f, 0x52, 0x01, 0xa8, 0x46, 0x0c, 0x56, 0x53, 0x04, 0x04, 0x46, 0x03, 0x03, 0x29,
+	0x36, 0x0e, 0x46, 0xfe, 0x58, 0x00, 0x00, 0x01, 0x00, 0x15, 0x00, 0x00, 0x01, 0x40, 0x02, 0xa3,
+	0x00, 0x17, 0x00, 0x5a, 0x40, 0x0a, 0x0a, 0x01, 0x03, 0x02, 0x0b, 0x01, 0x01, 0x03, 0x02, 0x4c,
+	0x4b, 0xb0, 0x31, 0x50, 0x58, 0x40, 0x1c, 0x00, 0x03, 0x03, 0x02, 0x61, 0x00, 0x02, 0x02, 0x24,
+	0x4d, 0x05, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x04, 0x01, 0x01, 0x01, 0x25, 0x4d, 0x00, 0x06, 0x06,
+	0x23, 0x06, 0x4e, 0x1b, 0x40, 0x1a, 0x00, 0x02, 0x00, 0x03, 0x01, 0x02, 0x03, 0x69, 0x05, 0x01,
+	0x00, 0x00, 0x01, 0x5f, 0x04, 0x01, 0x01, 0x01, 0x25, 0x4d, 0x00, 0x06, 0x06, 0x23, 0x06, 0x4e,
+	0x59, 0x40, 0x0a, 0x11, 0x11, 0x13, 0x25, 0x23, 0x11, 0x10, 0x07, 0x08, 0x1d, 0x2b, 0x13, 0x23,
+	0x35, 0x33, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15,
+	0x15, 0x33, 0x15, 0x23, 0x11, 0x23, 0x5f, 0x4a, 0x4a, 0x4c, 0x4d, 0x12, 0x21, 0x15, 0x0b, 0x1f,
+	0x0f, 0x2f, 0x27, 0x80, 0x80, 0x52, 0x01, 0xa8, 0x46, 0x0c, 0x56, 0x53, 0x03, 0x05, 0x46, 0x03,
+	0x03, 0x2a, 0x35, 0x0e, 0x46, 0xfe, 0x58, 0x00, 0xff, 0xff, 0x00, 0x15, 0x00, 0x00, 0x01, 0xef,
+	0x02, 0xa3, 0x02, 0x06, 0x00, 0xb7, 0x00, 0x00, 0xff, 0xff, 0x00, 0x15, 0x00, 0x00, 0x01, 0xef,
+	0x02, 0xa3, 0x00, 0x26, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x07, 0x00, 0xc2, 0x01, 0x58, 0x00, 0x00,
+	0xff, 0xff, 0x00, 0x15, 0x00, 0x00, 0x01, 0xea, 0x02, 0xa3, 0x02, 0x06, 0x00, 0xb9, 0x00, 0x00,
+	0xff, 0xff, 0x00, 0x15, 0x00, 0x00, 0x01, 0xea, 0x02, 0xa3, 0x00, 0x26, 0x00, 0xb5, 0x00, 0x00,
+	0x00, 0x07, 0x00, 0xd2, 0x01, 0x56, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2b, 0xff, 0x5e, 0x01, 0xd9,
+	0x01, 0xf8, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x50, 0x40, 0x4d, 0x17, 0x01, 0x04, 0x03, 0x25, 0x24,
+	0x02, 0x05, 0x04, 0x0b, 0x01, 0x02, 0x05, 0x04, 0x01, 0x01, 0x02, 0x03, 0x01, 0x00, 0x01, 0x05,
+	0x4c, 0x00, 0x05, 0x00, 0x02, 0x01, 0x05, 0x02, 0x69, 0x07, 0x01, 0x04, 0x04, 0x03, 0x61, 0x00,
+	0x03, 0x03, 0x2b, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x61, 0x06, 0x01, 0x00, 0x00, 0x2d, 0x00, 0x4e,
+	0x1c, 0x1b, 0x01, 0x00, 0x22, 0x20, 0x1b, 0x27, 0x1c, 0x27, 0x15, 0x13, 0x0f, 0x0d, 0x08, 0x06,
+	0x00, 0x1a, 0x01, 0x1a, 0x08, 0x08, 0x16, 0x2b, 0x05, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33,
+	0x32, 0x36, 0x35, 0x35, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17,
+	0x11, 0x14, 0x06, 0x03, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x11, 0x26, 0x26,
+	0x01, 0x0b, 0x32, 0x57, 0x1c, 0x17, 0x59, 0x2c, 0x4b, 0x3a, 0x25, 0x54, 0x2b, 0x63, 0x55, 0x6d,
+	0x83, 0x2f, 0x6c, 0x23, 0x5c, 0x62, 0x60, 0x3e, 0x35, 0x4c, 0x21, 0x47, 0x21, 0x18, 0x37, 0xa2,
+	0x0d, 0x0b, 0x49, 0x09, 0x0c, 0x3b, 0x4b, 0x1f, 0x16, 0x17, 0x6e, 0x7d, 0x7f, 0x6c, 0x0b, 0x08,
+	0xfe, 0x62, 0x82, 0x67, 0x02, 0x50, 0x42, 0x5f, 0x5a, 0x45, 0x13, 0x11, 0x01, 0x11, 0x05, 0x06,
+	0xff, 0xff, 0x00, 0x2b, 0xff, 0x5e, 0x01, 0xd9, 0x02, 0xae, 0x02, 0x26, 0x00, 0xba, 0x00, 0x00,
+	0x00, 0x06, 0x01, 0x1d, 0x53, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xff, 0x5e, 0x01, 0xd9, 0x02, 0xae,
+	0x02, 0x26, 0x00, 0xba, 0x00, 0x00, 0x00, 0x06, 0x01, 0x21, 0x3f, 0x00, 0xff, 0xff, 0x00, 0x2b,
+	0xff, 0x5e, 0x01, 0xd9, 0x02, 0xd4, 0x02, 0x26, 0x00, 0xba, 0x00, 0x00, 0x00, 0x07, 0x01, 0x23,
+	0x00, 0xb8, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xff, 0x5e, 0x01, 0xd9, 0x02, 0x82, 0x02, 0x26,
+	0x00, 0xba, 0x00, 0x00, 0x00, 0x07, 0x01, 0x25, 0x00, 0xad, 0x00, 0x00, 0x00, 0x01, 0x00, 0x42,
+	0x00, 0x00, 0x01, 0xeb, 0x02, 0x99, 0x00, 0x13, 0x00, 0x2b, 0x40, 0x28, 0x04, 0x01, 0x04, 0x02,
+	0x13, 0x01, 0x00, 0x04, 0x02, 0x4c, 0x00, 0x01, 0x01, 0x24, 0x4d, 0x00, 0x04, 0x04, 0x02, 0x61,
+	0x00, 0x02, 0x02, 0x2b, 0x4d, 0x03, 0x01, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x23, 0x13, 0x23, 0x11,
+	0x10, 0x05, 0x08, 0x1b, 0x2b, 0x33, 0x23, 0x11, 0x33, 0x15, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15,
+	0x11, 0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x94, 0x52, 0x52, 0x2d, 0x59, 0x2c, 0x52,
+	0x53, 0x52, 0x35, 0x38, 0x25, 0x4f, 0x24, 0x02, 0x99, 0xd3, 0x19, 0x19, 0x52, 0x50, 0xfe, 0xaa,
+	0x01, 0x4c, 0x33, 0x2f, 0x14, 0x12, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x01, 0xeb, 0x02, 0x99,
+	0x00, 0x1b, 0x00, 0x68, 0x40, 0x0a, 0x0c, 0x01, 0x08, 0x06, 0x1b, 0x01, 0x00, 0x08, 0x02, 0x4c,
+	0x4b, 0xb0, 0x27, 0x50, 0x58, 0x40, 0x22, 0x00, 0x03, 0x03, 0x24, 0x4d, 0x05, 0x01, 0x01, 0x01,
+	0x02, 0x5f, 0x04, 0x01, 0x02, 0x02, 0x22, 0x4d, 0x00, 0x08, 0x08, 0x06, 0x61, 0x00, 0x06, 0x06,
+	0x2b, 0x4d, 0x07, 0x01, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x1b, 0x40, 0x20, 0x04, 0x01, 0x02, 0x05,
+	0x01, 0x01, 0x06, 0x02, 0x01, 0x67, 0x00, 0x03, 0x03, 0x24, 0x4d, 0x00, 0x08, 0x08, 0x06, 0x61,
+	0x00, 0x06, 0x06, 0x2b, 0x4d, 0x07, 0x01, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x59, 0x40, 0x0c, 0x23,
+	0x13, 0x23, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x09, 0x08, 0x1f, 0x2b, 0x33, 0x23, 0x11, 0x23,
+	0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x11,
+	0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x94, 0x52, 0x46, 0x46, 0x52, 0xb1, 0xb1, 0x2d,
+	0x59, 0x2c, 0x52, 0x53, 0x52, 0x35, 0x38, 0x25, 0x4f, 0x24, 0x02, 0x35, 0x31, 0x33, 0x33, 0x31,
+	0x6f, 0x19, 0x19, 0x52, 0x50, 0xfe, 0xaa, 0x01, 0x4c, 0x33, 0x2f, 0x14, 0x12, 0x00, 0xff, 0xff,
+	0xff, 0xca, 0x00, 0x00, 0x01, 0xeb, 0x03, 0x3b, 0x02, 0x26, 0x00, 0xbf, 0x00, 0x00, 0x01, 0x07,
+	0x00, 0x8a, 0xff, 0x98, 0x00, 0x97, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x97, 0xb0, 0x35, 0x2b,
+	0x00, 0x02, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x97, 0x02, 0x99, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1f,
+	0x40, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x24, 0x4d, 0x00, 0x03, 0x03, 0x25,
+	0x4d, 0x00, 0x02, 0x02, 0x23, 0x02, 0x4e, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x1a, 0x2b, 0x13,
+	0x23, 0x35, 0x33, 0x03, 0x23, 0x11, 0x33, 0x97, 0x58, 0x58, 0x03, 0x52, 0x52, 0x02, 0x44, 0x55,
+	0xfd, 0x67, 0x01, 0xee, 0xff, 0xff, 0x00, 0x24, 0x00, 0x00, 0x00, 0xf3, 0x02, 0xa4, 0x02, 0x26,
+	0x00, 0xcc, 0x00, 0x00, 0x01, 0x06, 0x01, 0x1c, 0xf2, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
+	0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xde, 0x00, 0x00, 0x00, 0xf7, 0x02, 0xa4,
+	0x02, 0x26, 0x00, 0xcc, 0x00, 0x00, 0x01, 0x06, 0x01, 0x1d, 0xac, 0xf6, 0x00, 0x09, 0xb1, 0x01,
+	0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xca, 0x00, 0x00, 0x01, 0x0d,
+	0x02, 0xa4, 0x02, 0x26, 0x00, 0xcc, 0x00, 0x00, 0x01, 0x06, 0x01, 0x21, 0x98, 0xf6, 0x00, 0x09,
+	0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe9, 0x00, 0x00,
+	0x00, 0xed, 0x02, 0x78, 0x02, 0x26, 0x00, 0xcc, 0x00, 0x00, 0x01, 0x06, 0x01, 0x24, 0xb7, 0xf6,
+	0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0xff, 0xe3,
+	0x00, 0x00, 0x00, 0xb2, 0x02, 0xa4, 0x02, 0x26, 0x00, 0xcc, 0x00, 0x00, 0x01, 0x06, 0x01, 0x26,
+	0xb1, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff,
+	0x00, 0x3f, 0xff, 0x5e, 0x01, 0x91, 0x02, 0x99, 0x00, 0x26, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0xcd, 0x00, 0xf1, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0xe5, 0x02, 0x6f,
+	0x02, 0x26, 0x00, 0xcc, 0x00, 0x00, 0x01, 0x06, 0x01, 0x28, 0xbe, 0xf6, 0x00, 0x09, 0xb1, 0x01,
+	0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0x00, 0x02, 0xff, 0xc8, 0xff, 0x34, 0x00, 0x99,
+	0x02, 0x99, 0x00, 0x03, 0x00, 0x19, 0x00, 0x34, 0x40, 0x31, 0x18, 0x0e, 0x05, 0x03, 0x02, 0x04,
+	0x0f, 0x01, 0x03, 0x02, 0x02, 0x4c, 0x00, 0x02, 0x00, 0x03, 0x02, 0x03, 0x65, 0x00, 0x00, 0x00,
+	0x01, 0x5f, 0x00, 0x01, 0x01, 0x24, 0x4d, 0x05, 0x01, 0x04, 0x04, 0x25, 0x04, 0x4e, 0x04, 0x04,
+	0x04, 0x19, 0x04, 0x19, 0x25, 0x27, 0x11, 0x10, 0x06, 0x08, 0x1a, 0x2b, 0x13, 0x23, 0x35, 0x33,
+	0x07, 0x11, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22,
+	0x26, 0x35, 0x34, 0x36, 0x37, 0x11, 0x99, 0x58, 0x58, 0x03, 0x3c, 0x4d, 0x1d, 0x1d, 0x0e, 0x21,
+	0x0c, 0x20, 0x21, 0x0f, 0x33, 0x37, 0x40, 0x3c, 0x02, 0x44, 0x55, 0xab, 0xfe, 0x12, 0x0c, 0x35,
+	0x21, 0x16, 0x16, 0x05, 0x03, 0x3b, 0x07, 0x04, 0x2f, 0x2c, 0x2b, 0x3f, 0x11, 0x01, 0xe4, 0x00,
+	0xff, 0xff, 0xff, 0xd7, 0x00, 0x00, 0x00, 0xfe, 0x02, 0xa6, 0x02, 0x26, 0x00, 0xcc, 0x00, 0x00,
+	0x01, 0x06, 0x01, 0x2b, 0xa5, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35,
+	0x2b, 0x00, 0x00, 0x01, 0x00, 0x42, 0x00, 0x00, 0x00, 0x94, 0x01, 0xee, 0x00, 0x03, 0x00, 0x13,
+	0x40, 0x10, 0x00, 0x01, 0x01, 0x25, 0x4d, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x11, 0x10, 0x02,
+	0x08, 0x18, 0x2b, 0x33, 0x23, 0x11, 0x33, 0x94, 0x52, 0x52, 0x01, 0xee, 0x00, 0x02, 0xff, 0xb8,
+	0xff, 0x5e, 0x00, 0xa0, 0x02, 0x99, 0x00, 0x03, 0x00, 0x13, 0x00, 0x37, 0x40, 0x34, 0x08, 0x01,
+	0x03, 0x04, 0x07, 0x01, 0x02, 0x03, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01,
+	0x24, 0x4d, 0x00, 0x04, 0x04, 0x25, 0x4d, 0x00, 0x03, 0x03, 0x02, 0x62, 0x05, 0x01, 0x02, 0x02,
+	0x2d, 0x02, 0x4e, 0x06, 0x04, 0x10, 0x0f, 0x0c, 0x09, 0x04, 0x13, 0x06, 0x13, 0x11, 0x10, 0x06,
+	0x08, 0x18, 0x2b, 0x13, 0x23, 0x35, 0x33, 0x03, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32,
+	0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06, 0xa0, 0x58, 0x58, 0xa0, 0x13, 0x1f, 0x16, 0x15, 0x13,
+	0x08, 0x36, 0x2d, 0x52, 0x4f, 0x02, 0x44, 0x55, 0xfc, 0xc5, 0x02, 0x04, 0x48, 0x03, 0x01, 0x2e,
+	0x38, 0x01, 0xe0, 0xfe, 0x17, 0x53, 0x54, 0x00, 0xff, 0xff, 0xff, 0xb8, 0xff, 0x5e, 0x01, 0x16,
+	0x02, 0xa4, 0x02, 0x26, 0x00, 0xcf, 0x00, 0x00, 0x01, 0x06, 0x01, 0x21, 0xa1, 0xf6, 0x00, 0x09,
+	0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0x00, 0x01, 0xff, 0xb8, 0xff, 0x5e,
+	0x00, 0x9d, 0x01, 0xee, 0x00, 0x0f, 0x00, 0x2b, 0x40, 0x28, 0x04, 0x01, 0x01, 0x02, 0x03, 0x01,
+	0x00, 0x01, 0x02, 0x4c, 0x00, 0x02, 0x02, 0x25, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x62, 0x03, 0x01,
+	0x00, 0x00, 0x2d, 0x00, 0x4e, 0x02, 0x00, 0x0c, 0x0b, 0x08, 0x05, 0x00, 0x0f, 0x02, 0x0f, 0x04,
+	0x08, 0x16, 0x2b, 0x15, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x33,
+	0x11, 0x14, 0x06, 0x13, 0x1f, 0x16, 0x15, 0x13, 0x08, 0x36, 0x2d, 0x52, 0x4f, 0xa2, 0x02, 0x04,
+	0x48, 0x03, 0x01, 0x2e, 0x38, 0x01, 0xe0, 0xfe, 0x17, 0x53, 0x54, 0x00, 0x00, 0x01, 0x00, 0x42,
+	0x00, 0x00, 0x01, 0xe9, 0x02, 0x99, 0x00, 0x0c, 0x00, 0x31, 0x40, 0x2e, 0x09, 0x01, 0x05, 0x02,
+	0x01, 0x4c, 0x00, 0x02, 0x06, 0x01, 0x05, 0x00, 0x02, 0x05, 0x67, 0x00, 0x01, 0x01, 0x24, 0x4d,
+	0x00, 0x03, 0x03, 0x25, 0x4d, 0x04, 0x01, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0c,
+	0x00, 0x0c, 0x12, 0x11, 0x11, 0x11, 0x11, 0x07, 0x08, 0x1b, 0x2b, 0x37, 0x15, 0x23, 0x11, 0x33,
+	0x11, 0x33, 0x37, 0x33, 0x07, 0x17, 0x23, 0x27, 0x94, 0x52, 0x52, 0x3b, 0xad, 0x63, 0xcd, 0xd7,
+	0x67, 0xb0, 0xd6, 0xd6, 0x02, 0x99, 0xfe, 0x84, 0xd1, 0xf0, 0xfe, 0xd6, 0xff, 0xff, 0x00, 0x42,
+	0xff, 0x21, 0x01, 0xe9, 0x02, 0x99, 0x02, 0x26, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x07, 0x01, 0x22,
+	0x00, 0x9f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x42, 0x00, 0x00, 0x00, 0x94, 0x02, 0x99, 0x00, 0x03,
+	0x00, 0x19, 0x40, 0x16, 0x02, 0x01, 0x01, 0x01, 0x24, 0x4d, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x13, 0x11, 0x23, 0x11, 0x94,
+	0x52, 0x02, 0x99, 0xfd, 0x67, 0x02, 0x99, 0x00, 0xff, 0xff, 0x00, 0x24, 0x00, 0x00, 0x00, 0xf1,
+	0x03, 0x3b, 0x02, 0x26, 0x00, 0xd2, 0x00, 0x00, 0x01, 0x07, 0x00, 0x87, 0xff, 0xf2, 0x00, 0x97,
+	0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x97, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x42, 0x00, 0x00,
+	0x01, 0x2c, 0x02, 0x99, 0x00, 0x26, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x07, 0x01, 0x1f, 0x00, 0xb0,
+	0x00, 0x00, 0xff, 0xff, 0x00, 0x3c, 0xff, 0x21, 0x00, 0x94, 0x02, 0x99, 0x02, 0x26, 0x00, 0xd2,
+	0x00, 0x00, 0x00, 0x06, 0x01, 0x22, 0x0b, 0x00, 0xff, 0xff, 0x00, 0x42, 0x00, 0x00, 0x01, 0x31,
+	0x02, 0x99, 0x00, 0x26, 0x00, 0xd2, 0x00, 0x00, 0x01, 0x07, 0x01, 0x35, 0x00, 0xa7, 0x00, 0x1a,
+	0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x1a, 0xb0, 0x35, 0x2b, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00,
+	0x01, 0x08, 0x02, 0x99, 0x00, 0x0b, 0x00, 0x20, 0x40, 0x1d, 0x0b, 0x0a, 0x09, 0x06, 0x05, 0x04,
+	0x03, 0x00, 0x08, 0x00, 0x01, 0x01, 0x4c, 0x00, 0x01, 0x01, 0x24, 0x4d, 0x00, 0x00, 0x00, 0x23,
+	0x00, 0x4e, 0x15, 0x11, 0x02, 0x08, 0x18, 0x2b, 0x13, 0x11, 0x23, 0x11, 0x07, 0x35, 0x37, 0x11,
+	0x33, 0x11, 0x37, 0x15, 0xb0, 0x52, 0x40, 0x40, 0x52, 0x58, 0x01, 0x33, 0xfe, 0xcd, 0x01, 0x1a,
+	0x13, 0x3c, 0x13, 0x01, 0x43, 0xfe, 0xd6, 0x1b, 0x3c, 0x00, 0x00, 0x01, 0x00, 0x42, 0x00, 0x00,
+	0x02, 0xe4, 0x01, 0xf8, 0x00, 0x27, 0x00, 0x54, 0x40, 0x0b, 0x0b, 0x04, 0x02, 0x05, 0x01, 0x27,
+	0x01, 0x00, 0x05, 0x02, 0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x15, 0x07, 0x01, 0x05, 0x05,
+	0x01, 0x61, 0x03, 0x02, 0x02, 0x01, 0x01, 0x25, 0x4d, 0x06, 0x04, 0x02, 0x00, 0x00, 0x23, 0x00,
+	0x4e, 0x1b, 0x40, 0x19, 0x00, 0x01, 0x01, 0x25, 0x4d, 0x07, 0x01, 0x05, 0x05, 0x02, 0x61, 0x03,
+	0x01, 0x02, 0x02, 0x2b, 0x4d, 0x06, 0x04, 0x02, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x59, 0x40, 0x0b,
+	0x23, 0x16, 0x23, 0x13, 0x25, 0x24, 0x11, 0x10, 0x08, 0x08, 0x1e, 0x2b, 0x33, 0x23, 0x11, 0x33,
+	0x17, 0x33, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x33, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x11,
+	0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26,
+	0x23, 0x22, 0x06, 0x07, 0x94, 0x52, 0x4b, 0x04, 0x03, 0x2c, 0x48, 0x24, 0x2a, 0x3c, 0x11, 0x03,
+	0x28, 0x59, 0x2d, 0x47, 0x49, 0x52, 0x2e, 0x32, 0x1c, 0x3e, 0x1f, 0x02, 0x01, 0x52, 0x2e, 0x32,
+	0x19, 0x38, 0x25, 0x01, 0xee, 0x26, 0x19, 0x17, 0x1a, 0x1a, 0x19, 0x1b, 0x4b, 0x49, 0xfe, 0x9c,
+	0x01, 0x5a, 0x2b, 0x29, 0x11, 0x10, 0x0a, 0x14, 0x0b, 0xfe, 0x9c, 0x01, 0x5a, 0x2b, 0x29, 0x11,
+	0x14, 0x00, 0x00, 0x01, 0x00, 0x42, 0x00, 0x00, 0x01, 0xec, 0x01, 0xf8, 0x00, 0x14, 0x00, 0x49,
+	0x40, 0x0a, 0x04, 0x01, 0x04, 0x01, 0x14, 0x01, 0x00, 0x04, 0x02, 0x4c, 0x4b, 0xb0, 0x18, 0x50,
+	0x58, 0x40, 0x12, 0x00, 0x04, 0x04, 0x01, 0x61, 0x02, 0x01, 0x01, 0x01, 0x25, 0x4d, 0x03, 0x01,
+	0x00, 0x00, 0x23, 0x00, 0x4e, 0x1b, 0x40, 0x16, 0x00, 0x01, 0x01, 0x25, 0x4d, 0x00, 0x04, 0x04,
+	0x02, 0x61, 0x00, 0x02, 0x02, 0x2b, 0x4d, 0x03, 0x01, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x59, 0xb7,
+	0x23, 0x13, 0x24, 0x11, 0x10, 0x05, 0x08, 0x1b, 0x2b, 0x33, 0x23, 0x11, 0x33, 0x17, 0x33, 0x36,
+	0x36, 0x33, 0x32, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x94, 0x52,
+	0x47, 0x04, 0x03, 0x28, 0x57, 0x36, 0x52, 0x55, 0x52, 0x38, 0x3a, 0x24, 0x4b, 0x25, 0x01, 0xee,
+	0x30, 0x1e, 0x1c, 0x52, 0x50, 0xfe, 0xaa, 0x01, 0x4c, 0x32, 0x30, 0x17, 0x16, 0x00, 0xff, 0xff,
+	0x00, 0x42, 0x00, 0x00, 0x01, 0xec, 0x02, 0xae, 0x02, 0x26, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x07,
+	0x01, 0x1c, 0x00, 0x9e, 0x00, 0x00, 0xff, 0xff, 0xff, 0xdf, 0x00, 0x00, 0x01, 0xec, 0x02, 0x99,
+	0x02, 0x26, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x06, 0x01, 0x1f, 0xb9, 0x00, 0xff, 0xff, 0x00, 0x42,
+	0x00, 0x00, 0x01, 0xec, 0x02, 0xae, 0x02, 0x26, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x06, 0x01, 0x1e,
+	0x43, 0x00, 0xff, 0xff, 0x00, 0x42, 0xff, 0x21, 0x01, 0xec, 0x01, 0xf8, 0x02, 0x26, 0x00, 0xd9,
+	0x00, 0x00, 0x00, 0x07, 0x01, 0x22, 0x00, 0xb6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x42, 0x00, 0x00,
+	0x01, 0xec, 0x02, 0xb0, 0x02, 0x26, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x06, 0x01, 0x2b, 0x51, 0x00,
+	0x00, 0x01, 0x00, 0x42, 0xff, 0x5e, 0x01, 0xec, 0x01, 0xf8, 0x00, 0x20, 0x00, 0x65, 0x40, 0x12,
+	0x04, 0x01, 0x05, 0x01, 0x20, 0x01, 0x00, 0x05, 0x13, 0x01, 0x04, 0x00, 0x12, 0x01, 0x03, 0x04,
+	0x04, 0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x05, 0x05, 0x01, 0x61, 0x02, 0x01,
+	0x01, 0x01, 0x25, 0x4d, 0x00, 0x00, 0x00, 0x23, 0x4d, 0x00, 0x04, 0x04, 0x03, 0x61, 0x00, 0x03,
+	0x03, 0x2d, 0x03, 0x4e, 0x1b, 0x40, 0x1f, 0x00, 0x01, 0x01, 0x25, 0x4d, 0x00, 0x05, 0x05, 0x02,
+	0x61, 0x00, 0x02, 0x02, 0x2b, 0x4d, 0x00, 0x00, 0x00, 0x23, 0x4d, 0x00, 0x04, 0x04, 0x03, 0x61,
+	0x00, 0x03, 0x03, 0x2d, 0x03, 0x4e, 0x59, 0x40, 0x09, 0x25, 0x33, 0x35, 0x24, 0x11, 0x10, 0x06,
+	0x08, 0x1c, 0x2b, 0x33, 0x23, 0x11, 0x33, 0x17, 0x33, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x11,
+	0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x34, 0x26,
+	0x23, 0x22, 0x06, 0x07, 0x94, 0x52, 0x47, 0x04, 0x03, 0x27, 0x56, 0x38, 0x52, 0x55, 0x4f, 0x4e,
+	0x13, 0x1f, 0x16, 0x15, 0x13, 0x08, 0x35, 0x2e, 0x38, 0x3a, 0x23, 0x4a, 0x27, 0x01, 0xee, 0x2e,
+	0x1d, 0x1b, 0x52, 0x50, 0xfe, 0xaf, 0x53, 0x54, 0x02, 0x04, 0x48, 0x03, 0x01, 0x2f, 0x37, 0x01,
+	0x3e, 0x32, 0x30, 0x17, 0x17, 0x00, 0x00, 0x02, 0x00, 0x2b, 0xff, 0xf8, 0x01, 0xf4, 0x01, 0xf8,
+	0x00, 0x0b, 0x00, 0x17, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01,
+	0x2b, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x24, 0x24, 0x24,
+	0x22, 0x04, 0x08, 0x1a, 0x2b, 0x25, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+	0x16, 0x05, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0xf4, 0x67,
+	0x7d, 0x81, 0x64, 0x67, 0x7e, 0x81, 0x63, 0xfe, 0x89, 0x3a, 0x59, 0x56, 0x3c, 0x39, 0x59, 0x57,
+	0x3c, 0xf8, 0x8c, 0x74, 0x70, 0x90, 0x8d, 0x73, 0x70, 0x8f, 0x6e, 0x47, 0x4b, 0x6a, 0x6e, 0x47,
+	0x4a, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xf8, 0x01, 0xf4, 0x02, 0xae, 0x02, 0x26, 0x00, 0xe0,
+	0x00, 0x00, 0x00, 0x07, 0x01, 0x1c, 0x00, 0x97, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xf8,
+	0x01, 0xf4, 0x02, 0xae, 0x02, 0x26, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x06, 0x01, 0x1d, 0x51, 0x00,
+	0xff, 0xff, 0x00, 0x2b, 0xff, 0xf8, 0x01, 0xf4, 0x02, 0xae, 0x02, 0x26, 0x00, 0xe0, 0x00, 0x00,
+	0x00, 0x06, 0x01, 0x21, 0x3d, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xf8, 0x01, 0xf4, 0x02, 0x82,
+	0x02, 0x26, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x06, 0x01, 0x24, 0x5c, 0x00, 0x00, 0x03, 0x00, 0x2b,
+	0xff, 0xf8, 0x03, 0x1f, 0x01, 0xf8, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x40, 0x40, 0x3d,
+	0x0c, 0x01, 0x09, 0x07, 0x1c, 0x01, 0x04, 0x03, 0x1d, 0x01, 0x00, 0x04, 0x03, 0x4c, 0x00, 0x09,
+	0x00, 0x03, 0x04, 0x09, 0x03, 0x67, 0x08, 0x01, 0x07, 0x07, 0x01, 0x61, 0x02, 0x01, 0x01, 0x01,
+	0x2b, 0x4d, 0x06, 0x01, 0x04, 0x04, 0x00, 0x61, 0x05, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x36,
+	0x35, 0x24, 0x24, 0x24, 0x25, 0x22, 0x15, 0x24, 0x24, 0x22, 0x0a, 0x08, 0x1f, 0x2b, 0x25, 0x06,
+	0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x36, 0x36, 0x33, 0x32, 0x16,
+	0x15, 0x14, 0x06, 0x07, 0x21, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22,
+	0x26, 0x25, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x05, 0x26, 0x26,
+	0x23, 0x22, 0x06, 0x15, 0x33, 0x36, 0x34, 0x01, 0xbd, 0x16, 0x56, 0x48, 0x7d, 0x61, 0x64, 0x7a,
+	0x4c, 0x56, 0x14, 0x15, 0x51, 0x3f, 0x65, 0x56, 0x02, 0x02, 0xfe, 0xcb, 0x01, 0x3d, 0x4b, 0x28,
+	0x58, 0x1b, 0x18, 0x60, 0x31, 0x40, 0x50, 0xfe, 0xac, 0x37, 0x55, 0x52, 0x39, 0x37, 0x54, 0x53,
+	0x39, 0x02, 0x57, 0x01, 0x33, 0x3c, 0x45, 0x39, 0xed, 0x01, 0x54, 0x30, 0x2c, 0x6f, 0x91, 0x8c,
+	0x74, 0x2b, 0x30, 0x2e, 0x2d, 0x5f, 0x6f, 0x19, 0x23, 0x12, 0x52, 0x46, 0x11, 0x0b, 0x45, 0x0e,
+	0x15, 0x2d, 0xd4, 0x6e, 0x47, 0x4a, 0x6b, 0x6e, 0x47, 0x4b, 0x2e, 0x42, 0x37, 0x40, 0x4e, 0x03,
+	0x09, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xf8, 0x01, 0xf4, 0x02, 0xae, 0x02, 0x26, 0x00, 0xe0,
+	0x00, 0x00, 0x00, 0x06, 0x01, 0x26, 0x56, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xf8, 0x01, 0xf4,
+	0x02, 0xae, 0x02, 0x26, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x06, 0x01, 0x27, 0x3e, 0x00, 0xff, 0xff,
+	0x00, 0x2b, 0xff, 0xf8, 0x01, 0xf4, 0x02, 0x79, 0x02, 0x26, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x06,
+	0x01, 0x28, 0x63, 0x00, 0x00, 0x03, 0x00, 0x2b, 0xff, 0xbe, 0x01, 0xf4, 0x02, 0x2e, 0x00, 0x17,
+	0x00, 0x21, 0x00, 0x2b, 0x00, 0x47, 0x40, 0x44, 0x0e, 0x0b, 0x02, 0x02, 0x00, 0x29, 0x28, 0x1f,
+	0x1e, 0x04, 0x03, 0x02, 0x17, 0x02, 0x02, 0x01, 0x03, 0x03, 0x4c, 0x0d, 0x0c, 0x02, 0x00, 0x4a,
+	0x01, 0x01, 0x01, 0x49, 0x04, 0x01, 0x02, 0x02, 0x00, 0x61, 0x00, 0x00, 0x00, 0x2b, 0x4d, 0x05,
+	0x01, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x23, 0x22, 0x19, 0x18, 0x22,
+	0x2b, 0x23, 0x2b, 0x18, 0x21, 0x19, 0x21, 0x2a, 0x27, 0x06, 0x08, 0x18, 0x2b, 0x17, 0x27, 0x37,
+	0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x37, 0x17, 0x07, 0x16, 0x16, 0x15, 0x14,
+	0x06, 0x23, 0x22, 0x26, 0x27, 0x13, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x13, 0x26, 0x26, 0x03,
+	0x32, 0x36, 0x35, 0x34, 0x26, 0x27, 0x03, 0x16, 0x16, 0x5c, 0x2f, 0x34, 0x1c, 0x1a, 0x67, 0x7e,
+	0x2b, 0x3e, 0x18, 0x34, 0x2f, 0x34, 0x1b, 0x19, 0x67, 0x7d, 0x28, 0x3e, 0x18, 0x7e, 0x57, 0x3c,
+	0x0b, 0x0c, 0xd2, 0x0f, 0x29, 0x1e, 0x56, 0x3c, 0x0a, 0x0a, 0xd0, 0x0e, 0x28, 0x42, 0x21, 0x4c,
+	0x1d, 0x62, 0x4e, 0x8d, 0x73, 0x0a, 0x0b, 0x4b, 0x21, 0x4b, 0x1c, 0x62, 0x4c, 0x8c, 0x74, 0x09,
+	0x0a, 0x01, 0xa3, 0x4a, 0x6b, 0x34, 0x41, 0x14, 0x01, 0x32, 0x06, 0x06, 0xfe, 0x96, 0x4b, 0x6a,
+	0x33, 0x3e, 0x13, 0xfe, 0xd2, 0x06, 0x05, 0x00, 0xff, 0xff, 0x00, 0x2b, 0xff, 0xbe, 0x01, 0xf4,
+	0x02, 0xae, 0x02, 0x26, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x07, 0x01, 0x1c, 0x00, 0x97, 0x00, 0x00,
+	0xff, 0xff, 0x00, 0x2b, 0xff, 0xf8, 0x01, 0xf4, 0x02, 0xb0, 0x02, 0x26, 0x00, 0xe0, 0x00, 0x00,
+	0x00, 0x06, 0x01, 0x2b, 0x4a, 0x00, 0x00, 0x02, 0x00, 0x42, 0xff, 0x68, 0x01, 0xf3, 0x01, 0xf8,
+	0x00, 0x11, 0x00, 0x1e, 0x00, 0x62, 0x40, 0x0f, 0x04, 0x01, 0x04, 0x01, 0x19, 0x18, 0x02, 0x05,
+	0x04, 0x11, 0x01, 0x03, 0x05, 0x03, 0x4c, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40, 0x1b, 0x00, 0x04,
+	0x04, 0x01, 0x61, 0x02, 0x01, 0x01, 0x01, 0x25, 0x4d, 0x00, 0x05, 0x05, 0x03, 0x61, 0x00, 0x03,
+	0x03, 0x29, 0x4d, 0x00, 0x00, 0x00, 0x27, 0x00, 0x4e, 0x1b, 0x40, 0x1f, 0x00, 0x01, 0x01, 0x25,
+	0x4d, 0x00, 0x04, 0x04, 0x02, 0x61, 0x00, 0x02, 0x02, 0x2b, 0x4d, 0x00, 0x05, 0x05, 0x03, 0x61,
+	0x00, 0x03, 0x03, 0x29, 0x4d, 0x00, 0x00, 0x00, 0x27, 0x00, 0x4e, 0x59, 0x40, 0x09, 0x25, 0x25,
+	0x24, 0x24, 0x11, 0x10, 0x06, 0x08, 0x1c, 0x2b, 0x17, 0x23, 0x11, 0x33, 0x17, 0x33, 0x36, 0x36,
+	0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x25, 0x34, 0x26, 0x23, 0x22, 0x06,
+	0x07, 0x11, 0x16, 0x16, 0x33, 0x32, 0x36, 0x94, 0x52, 0x47, 0x05, 0x03, 0x1f, 0x56, 0x31, 0x65,
+	0x57, 0x6a, 0x7c, 0x25, 0x3d, 0x17, 0x01, 0x0d, 0x39, 0x4e, 0x25, 0x43, 0x1e, 0x19, 0x35, 0x21,
+	0x5d, 0x41, 0x98, 0x02, 0x86, 0x2c, 0x1a, 0x1c, 0x78, 0x88, 0x88, 0x78, 0x0a, 0x0a, 0xec, 0x66,
+	0x50, 0x15, 0x14, 0xfe, 0xd3, 0x0a, 0x0a, 0x4d, 0x00, 0x02, 0x00, 0x42, 0xff, 0x68, 0x01, 0xf3,
+	0x02, 0x99, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x3a, 0x40, 0x37, 0x04, 0x01, 0x04, 0x02, 0x18, 0x17,
+	0x02, 0x05, 0x04, 0x10, 0x01, 0x03, 0x05, 0x03, 0x4c, 0x00, 0x01, 0x01, 0x24, 0x4d, 0x00, 0x04,
+	0x04, 0x02, 0x61, 0x00, 0x02, 0x02, 0x2b, 0x4d, 0x00, 0x05, 0x05, 0x03, 0x61, 0x00, 0x03, 0x03,
+	0x29, 0x4d, 0x00, 0x00, 0x00, 0x27, 0x00, 0x4e, 0x25, 0x25, 0x24, 0x23, 0x11, 0x10, 0x06, 0x08,
+	0x1c, 0x2b, 0x17, 0x23, 0x11, 0x33, 0x15, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+	0x22, 0x26, 0x27, 0x25, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x11, 0x16, 0x16, 0x33, 0x32, 0x36,
+	0x94, 0x52, 0x52, 0x1e, 0x53, 0x32, 0x65, 0x57, 0x6a, 0x7c, 0x25, 0x3d, 0x17, 0x01, 0x0d, 0x39,
+	0x4e, 0x25, 0x44, 0x1d, 0x19, 0x35, 0x21, 0x5d, 0x41, 0x98, 0x03, 0x31, 0xd1, 0x18, 0x18, 0x78,
+	0x88, 0x88, 0x78, 0x0a, 0x0a, 0xec, 0x66, 0x50, 0x13, 0x13, 0xfe, 0xd0, 0x0a, 0x0a, 0x4d, 0x00,
+	0x00, 0x02, 0x00, 0x2a, 0xff, 0x68, 0x01, 0xdc, 0x01, 0xf8, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x3b,
+	0x40, 0x38, 0x00, 0x01, 0x03, 0x02, 0x19, 0x18, 0x02, 0x04, 0x03, 0x03, 0x01, 0x01, 0x04, 0x03,
+	0x4c, 0x05, 0x01, 0x03, 0x03, 0x02, 0x61, 0x00, 0x02, 0x02, 0x2b, 0x4d, 0x00, 0x04, 0x04, 0x01,
+	0x61, 0x00, 0x01, 0x01, 0x29, 0x4d, 0x00, 0x00, 0x00, 0x27, 0x00, 0x4e, 0x10, 0x0f, 0x16, 0x14,
+	0x0f, 0x1b, 0x10, 0x1b, 0x24, 0x23, 0x11, 0x06, 0x08, 0x19, 0x2b, 0x01, 0x11, 0x23, 0x35, 0x06,
+	0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x07, 0x22, 0x06, 0x15, 0x14, 0x16,
+	0x33, 0x32, 0x36, 0x37, 0x11, 0x26, 0x26, 0x01, 0xdc, 0x52, 0x23, 0x57, 0x2d, 0x64, 0x55, 0x6e,
+	0x84, 0x32, 0x6c, 0x9e, 0x61, 0x3f, 0x36, 0x4d, 0x23, 0x49, 0x1f, 0x18, 0x39, 0x01, 0xe5, 0xfd,
+	0x83, 0xbc, 0x15, 0x17, 0x77, 0x89, 0x8a, 0x76, 0x0b, 0x3f, 0x4b, 0x6b, 0x66, 0x4e, 0x12, 0x10,
+	0x01, 0x3d, 0x05, 0x06, 0x00, 0x01, 0x00, 0x42, 0x00, 0x00, 0x01, 0x4e, 0x01, 0xf2, 0x00, 0x12,
+	0x00, 0x26, 0x40, 0x23, 0x04, 0x01, 0x03, 0x01, 0x12, 0x0c, 0x02, 0x00, 0x03, 0x02, 0x4c, 0x00,
+	0x03, 0x03, 0x01, 0x61, 0x02, 0x01, 0x01, 0x01, 0x25, 0x4d, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e,
+	0x33, 0x34, 0x11, 0x10, 0x04, 0x08, 0x1a, 0x2b, 0x33, 0x23, 0x11, 0x33, 0x17, 0x33, 0x36, 0x36,
+	0x33, 0x32, 0x32, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x94, 0x52, 0x4b, 0x04, 0x04,
+	0x27, 0x4e, 0x26, 0x10, 0x0b, 0x03, 0x07, 0x15, 0x16, 0x24, 0x45, 0x1f, 0x01, 0xee, 0x2a, 0x17,
+	0x17, 0x01, 0x4f, 0x02, 0x01, 0x11, 0x11, 0x00, 0xff, 0xff, 0x00, 0x42, 0x00, 0x00, 0x01, 0x50,
+	0x02, 0xa9, 0x02, 0x26, 0x00, 0xef, 0x00, 0x00, 0x01, 0x06, 0x01, 0x1c, 0x4f, 0xfb, 0x00, 0x09,
+	0xb1, 0x01, 0x01, 0xb8, 0xff, 0xfb, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x26, 0x00, 0x00,
+	0x01, 0x69, 0x02, 0xa9, 0x02, 0x26, 0x00, 0xef, 0x00, 0x00, 0x01, 0x06, 0x01, 0x1e, 0xf4, 0xfb,
+	0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xfb, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3b,
+	0xff, 0x21, 0x01, 0x4e, 0x01, 0xf2, 0x02, 0x26, 0x00, 0xef, 0x00, 0x00, 0x00, 0x06, 0x01, 0x22,
+	0x0a, 0x00, 0x00, 0x01, 0x00, 0x29, 0xff, 0xf8, 0x01, 0x96, 0x01, 0xf8, 0x00, 0x27, 0x00, 0x37,
+	0x40, 0x34, 0x24, 0x01, 0x00, 0x03, 0x25, 0x11, 0x02, 0x02, 0x00, 0x10, 0x01, 0x01, 0x02, 0x03,
+	0x4c, 0x04, 0x01, 0x00, 0x00, 0x03, 0x61, 0x00, 0x03, 0x03, 0x2b, 0x4d, 0x00, 0x02, 0x02, 0x01,
+	0x61, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x01, 0x00, 0x23, 0x20, 0x15, 0x13, 0x0e, 0x0c, 0x00,
+	0x27, 0x01, 0x27, 0x05, 0x08, 0x16, 0x2b, 0x13, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x17, 0x16,
+	0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34,
+	0x26, 0x27, 0x27, 0x26, 0x26, 0x27, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0xec,
+	0x40, 0x31, 0x17, 0x19, 0x7f, 0x3c, 0x30, 0x52, 0x5f, 0x39, 0x62, 0x20, 0x20, 0x5d, 0x31, 0x3e,
+	0x2e, 0x1a, 0x22, 0x7f, 0x30, 0x2f, 0x01, 0x5d, 0x61, 0x28, 0x41, 0x24, 0x1a, 0x46, 0x01, 0xae,
+	0x1e, 0x2e, 0x18, 0x19, 0x04, 0x13, 0x09, 0x39, 0x3d, 0x56, 0x4d, 0x0c, 0x0a, 0x4d, 0x0a, 0x0d,
+	0x24, 0x2e, 0x1d, 0x1b, 0x05, 0x13, 0x07, 0x3c, 0x39, 0x4e, 0x48, 0x04, 0x06, 0x49, 0x04, 0x05,
+	0xff, 0xff, 0x00, 0x29, 0xff, 0xf8, 0x01, 0x96, 0x02, 0xae, 0x02, 0x26, 0x00, 0xf3, 0x00, 0x00,
+	0x00, 0x06, 0x01, 0x1c, 0x67, 0x00, 0xff, 0xff, 0x00, 0x29, 0xff, 0xf8, 0x01, 0x96, 0x02, 0xae,
+	0x02, 0x26, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x06, 0x01, 0x1e, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x29,
+	0xff, 0x3d, 0x01, 0x96, 0x01, 0xf8, 0x00, 0x3f, 0x00, 0x4e, 0x40, 0x4b, 0x2b, 0x01, 0x05, 0x04,
+	0x2c, 0x18, 0x02, 0x03, 0x05, 0x17, 0x01, 0x06, 0x03, 0x07, 0x01, 0x01, 0x02, 0x06, 0x01, 0x00,
+	0x01, 0x05, 0x4c, 0x14, 0x01, 0x06, 0x01, 0x4b, 0x00, 0x07, 0x00, 0x02, 0x01, 0x07, 0x02, 0x69,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x65, 0x00, 0x05, 0x05, 0x04, 0x61, 0x00, 0x04, 0x04, 0x2b,
+	0x4d, 0x00, 0x03, 0x03, 0x06, 0x61, 0x00, 0x06, 0x06, 0x29, 0x06, 0x4e, 0x11, 0x1b, 0x24, 0x3b,
+	0x28, 0x34, 0x25, 0x22, 0x08, 0x08, 0x1e, 0x2b, 0x05, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35,
+	0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x23, 0x37, 0x26, 0x26, 0x27,
+	0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x27, 0x27, 0x26, 0x26, 0x27, 0x34, 0x36,
+	0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x17, 0x16,
+	0x16, 0x15, 0x14, 0x06, 0x07, 0x07, 0x36, 0x16, 0x01, 0x56, 0x35, 0x3b, 0x21, 0x3e, 0x0b, 0x0b,
+	0x37, 0x1b, 0x1d, 0x17, 0x1c, 0x20, 0x0c, 0x24, 0x01, 0x10, 0x29, 0x46, 0x17, 0x20, 0x5d, 0x31,
+	0x3e, 0x2e, 0x1a, 0x22, 0x7f, 0x30, 0x2f, 0x01, 0x5d, 0x61, 0x28, 0x41, 0x24, 0x1a, 0x46, 0x28,
+	0x40, 0x31, 0x17, 0x19, 0x7f, 0x3c, 0x30, 0x4d, 0x59, 0x08, 0x36, 0x38, 0x73, 0x29, 0x27, 0x07,
+	0x05, 0x33, 0x04, 0x07, 0x0d, 0x11, 0x0e, 0x0d, 0x02, 0x51, 0x03, 0x0b, 0x07, 0x4d, 0x0a, 0x0d,
+	0x24, 0x2e, 0x1d, 0x1b, 0x05, 0x13, 0x07, 0x3c, 0x39, 0x4e, 0x48, 0x04, 0x06, 0x49, 0x04, 0x05,
+	0x1e, 0x2e, 0x18, 0x19, 0x04, 0x13, 0x09, 0x39, 0x3d, 0x53, 0x4d, 0x03, 0x27, 0x02, 0x23, 0x00,
+	0xff, 0xff, 0x00, 0x29, 0xff, 0xf8, 0x01, 0x96, 0x02, 0xae, 0x02, 0x26, 0x00, 0xf3, 0x00, 0x00,
+	0x00, 0x06, 0x01, 0x21, 0x0d, 0x00, 0xff, 0xff, 0x00, 0x29, 0xff, 0x21, 0x01, 0x96, 0x01, 0xf8,
+	0x02, 0x26, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x06, 0x01, 0x22, 0x76, 0x00, 0x00, 0x01, 0x00, 0x42,
+	0xff, 0xf6, 0x02, 0x23, 0x02, 0xa5, 0x00, 0x2b, 0x00, 0x96, 0x4b, 0xb0, 0x18, 0x50, 0x58, 0x40,
+	0x0c, 0x1c, 0x12, 0x07, 0x03, 0x02, 0x03, 0x11, 0x01, 0x01, 0x02, 0x02, 0x4c, 0x1b, 0x40, 0x0c,
+	0x1c, 0x12, 0x07, 0x03, 0x02, 0x03, 0x11, 0x01, 0x04, 0x02, 0x02, 0x4c, 0x59, 0x4b, 0xb0, 0x18,
+	0x50, 0x58, 0x40, 0x17, 0x00, 0x03, 0x03, 0x00, 0x61, 0x05, 0x01, 0x00, 0x00, 0x24, 0x4d, 0x00,
+	0x02, 0x02, 0x01, 0x61, 0x04, 0x01, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x29, 0x50,
+	0x58, 0x40, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x61, 0x05, 0x01, 0x00, 0x00, 0x24, 0x4d, 0x00, 0x04,
+	0x04, 0x23, 0x4d, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x1b, 0x40,
+	0x19, 0x05, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x03, 0x69, 0x00, 0x04, 0x04, 0x23, 0x4d, 0x00,
+	0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x59, 0x59, 0x40, 0x11, 0x01, 0x00,
+	0x28, 0x27, 0x24, 0x22, 0x16, 0x14, 0x0f, 0x0d, 0x00, 0x2b, 0x01, 0x2b, 0x06, 0x08, 0x16, 0x2b,
+	0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x07, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
+	0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x27, 0x27, 0x37, 0x36, 0x36,
+	0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x23, 0x11, 0x34, 0x36, 0x01, 0x08, 0x60, 0x5b,
+	0x08, 0x08, 0x1f, 0x37, 0x33, 0x25, 0x52, 0x5a, 0x23, 0x3c, 0x16, 0x18, 0x34, 0x1e, 0x3a, 0x2f,
+	0x16, 0x1f, 0x65, 0x29, 0x09, 0x04, 0x33, 0x36, 0x3f, 0x35, 0x52, 0x5f, 0x02, 0xa5, 0x42, 0x47,
+	0x13, 0x2e, 0x1a, 0x6f, 0x11, 0x10, 0x41, 0x41, 0x5f, 0x5a, 0x07, 0x06, 0x4b, 0x06, 0x06, 0x32,
+	0x3b, 0x26, 0x24, 0x09, 0x1d, 0xa6, 0x20, 0x1a, 0x0c, 0x29, 0x27, 0x33, 0x3f, 0xfe, 0x17, 0x01,
+	0xea, 0x61, 0x5a, 0x00, 0x00, 0x01, 0x00, 0x13, 0xff, 0xf8, 0x01, 0x64, 0x02, 0x66, 0x00, 0x17,
+	0x00, 0x5c, 0x40, 0x0a, 0x00, 0x01, 0x06, 0x01, 0x01, 0x01, 0x00, 0x06, 0x02, 0x4c, 0x4b, 0xb0,
+	0x27, 0x50, 0x58, 0x40, 0x1c, 0x00, 0x03, 0x03, 0x22, 0x4d, 0x05, 0x01, 0x01, 0x01, 0x02, 0x5f,
+	0x04, 0x01, 0x02, 0x02, 0x25, 0x4d, 0x00, 0x06, 0x06, 0x00, 0x62, 0x00, 0x00, 0x00, 0x29, 0x00,
+	0x4e, 0x1b, 0x40, 0x1c, 0x00, 0x03, 0x02, 0x03, 0x85, 0x05, 0x01, 0x01, 0x01, 0x02, 0x5f, 0x04,
+	0x01, 0x02, 0x02, 0x25, 0x4d, 0x00, 0x06, 0x06, 0x00, 0x62, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4e,
+	0x59, 0x40, 0x0a, 0x23, 0x11, 0x11, 0x11, 0x11, 0x13, 0x23, 0x07, 0x08, 0x1d, 0x2b, 0x25, 0x15,
+	0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x23, 0x35, 0x33, 0x37, 0x33, 0x15, 0x33, 0x15, 0x23,
+	0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x01, 0x64, 0x10, 0x37, 0x19, 0x5a, 0x4d, 0x4a, 0x4b, 0x0d,
+	0x44, 0xb0, 0xb0, 0x2d, 0x39, 0x12, 0x2f, 0x4d, 0x45, 0x07, 0x09, 0x50, 0x62, 0xfe, 0x46, 0x78,
+	0x78, 0x46, 0xfb, 0x3d, 0x2c, 0x06, 0x00, 0x01, 0x00, 0x1a, 0xff, 0xf8, 0x01, 0x6b, 0x02, 0x66,
+	0x00, 0x1f, 0x00, 0x76, 0x40, 0x0a, 0x00, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x00, 0x0a, 0x02, 0x4c,
+	0x4b, 0xb0, 0x27, 0x50, 0x58, 0x40, 0x26, 0x08, 0x01, 0x02, 0x09, 0x01, 0x01, 0x0a, 0x02, 0x01,
+	0x67, 0x00, 0x05, 0x05, 0x22, 0x4d, 0x07, 0x01, 0x03, 0x03, 0x04, 0x5f, 0x06, 0x01, 0x04, 0x04,
+	0x25, 0x4d, 0x00, 0x0a, 0x0a, 0x00, 0x62, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x1b, 0x40, 0x26,
+	0x00, 0x05, 0x04, 0x05, 0x85, 0x08, 0x01, 0x02, 0x09, 0x01, 0x01, 0x0a, 0x02, 0x01, 0x67, 0x07,
+	0x01, 0x03, 0x03, 0x04, 0x5f, 0x06, 0x01, 0x04, 0x04, 0x25, 0x4d, 0x00, 0x0a, 0x0a, 0x00, 0x62,
+	0x00, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x59, 0x40, 0x10, 0x1e, 0x1c, 0x19, 0x18, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x13, 0x23, 0x0b, 0x08, 0x1f, 0x2b, 0x25, 0x15, 0x06, 0x06, 0x23, 0x22,
+	0x26, 0x35, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x37, 0x33, 0x15, 0x33, 0x15, 0x23,
+	0x15, 0x33, 0x15, 0x23, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x01, 0x6b, 0x10, 0x37, 0x19, 0x5a,
+	0x4d, 0x49, 0x49, 0x4a, 0x4b, 0x0d, 0x44, 0xb0, 0xb0, 0xb0, 0xb0, 0x2d, 0x39, 0x12, 0x2f, 0x4d,
+	0x45, 0x07, 0x09, 0x50, 0x62, 0x4c, 0x3b, 0x77, 0x46, 0x78, 0x78, 0x46, 0x77, 0x3b, 0x49, 0x3d,
+	0x2c, 0x06, 0xff, 0xff, 0x00, 0x13, 0xff, 0xf8, 0x01, 0x64, 0x02, 0xd0, 0x02, 0x26, 0x00, 0xfa,
+	0x00, 0x00, 0x01, 0x07, 0x01, 0x1f, 0x00, 0xcb, 0x00, 0x37, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
+	0x37, 0xb0, 0x35, 0x2b, 0xff, 0xff, 0x00, 0x13, 0xff, 0x21, 0x01, 0x64, 0x02, 0x66, 0x02, 0x26,
+	0x00, 0xfa, 0x00, 0x00, 0x00, 0x07, 0x01, 0x22, 0x00, 0x89, 0x00, 0x00, 0xff, 0xff, 0x00, 0x13,
+	0xff, 0x21, 0x01, 0x64, 0x02, 0x66, 0x02, 0x26, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x07, 0x01, 0x22,
+	0x00, 0x89, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3e, 0xff, 0xf8, 0x01, 0xd8, 0x01, 0xee, 0x00, 0x14,
+	0x00, 0x68, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x0a, 0x0c, 0x01, 0x02, 0x01, 0x11, 0x01, 0x00,
+	0x02, 0x02, 0x4c, 0x1b, 0x40, 0x0a, 0x0c, 0x01, 0x02, 0x01, 0x11, 0x01, 0x04, 0x02, 0x02, 0x4c,
+	0x59, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x13, 0x03, 0x01, 0x01, 0x01, 0x25, 0x4d, 0x00, 0x02,
+	0x02, 0x00, 0x61, 0x04, 0x05, 0x02, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x1b, 0x40, 0x17, 0x03, 0x01,
+	0x01, 0x01, 0x25, 0x4d, 0x00, 0x04, 0x04, 0x23, 0x4d, 0x00, 0x02, 0x02, 0x00, 0x61, 0x05, 0x01,
+	0x00, 0x00, 0x29, 0x00, 0x4e, 0x59, 0x40, 0x11, 0x01, 0x00, 0x10, 0x0f, 0x0e, 0x0d, 0x0a, 0x08,
+	0x05, 0x04, 0x00, 0x14, 0x01, 0x14, 0x06, 0x08, 0x16, 0x2b, 0x17, 0x22, 0x26, 0x35, 0x11, 0x33,
+	0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x11, 0x33, 0x11, 0x23, 0x27, 0x23, 0x06, 0x06, 0xe2,
+	0x52, 0x52, 0x52, 0x34, 0x38, 0x22, 0x45, 0x23, 0x52, 0x4b, 0x04, 0x02, 0x34, 0x4c, 0x08, 0x52,
+	0x52, 0x01, 0x52, 0xfe, 0xb8, 0x33, 0x2e, 0x11, 0x12, 0x01, 0x86, 0xfe, 0x12, 0x29, 0x1b, 0x16,
+	0xff, 0xff, 0x00, 0x3e, 0xff, 0xf8, 0x01, 0xd8, 0x02, 0xa4, 0x02, 0x26, 0x00, 0xff, 0x00, 0x00,
+	0x01, 0x07, 0x01, 0x1c, 0x00, 0x94, 0xff, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf6,
+	0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xf8, 0x01, 0xd8, 0x02, 0xa4, 0x02, 0x26,
+	0x00, 0xff, 0x00, 0x00, 0x01, 0x06, 0x01, 0x1d, 0x4e, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
+	0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xf8, 0x01, 0xd8, 0x02, 0xa4,
+	0x02, 0x26, 0x00, 0xff, 0x00, 0x00, 0x01, 0x06, 0x01, 0x21, 0x3a, 0xf6, 0x00, 0x09, 0xb1, 0x01,
+	0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xf8, 0x01, 0xd8,
+	0x02, 0x78, 0x02, 0x26, 0x00, 0xff, 0x00, 0x00, 0x01, 0x06, 0x01, 0x24, 0x59, 0xf6, 0x00, 0x09,
+	0xb1, 0x01, 0x02, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xf8,
+	0x01, 0xd8, 0x02, 0xa4, 0x02, 0x26, 0x00, 0xff, 0x00, 0x00, 0x01, 0x06, 0x01, 0x26, 0x53, 0xf6,
+	0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3e,
+	0xff, 0xf8, 0x01, 0xea, 0x02, 0xa4, 0x02, 0x26, 0x00, 0xff, 0x00, 0x00, 0x01, 0x06, 0x01, 0x27,
+	0x3b, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff,
+	0x00, 0x3e, 0xff, 0xf8, 0x01, 0xd8, 0x02, 0x6f, 0x02, 0x26, 0x00, 0xff, 0x00, 0x00, 0x01, 0x06,
+	0x01, 0x28, 0x60, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00,
+	0x00, 0x01, 0x00, 0x3e, 0xff, 0x34, 0x01, 0xd8, 0x01, 0xee, 0x00, 0x26, 0x00, 0x42, 0x40, 0x3f,
+	0x0c, 0x01, 0x02, 0x01, 0x23, 0x0f, 0x02, 0x00, 0x02, 0x18, 0x01, 0x04, 0x00, 0x19, 0x01, 0x05,
+	0x04, 0x04, 0x4c, 0x00, 0x04, 0x00, 0x05, 0x04, 0x05, 0x65, 0x03, 0x01, 0x01, 0x01, 0x25, 0x4d,
+	0x00, 0x02, 0x02, 0x00, 0x61, 0x06, 0x01, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x01, 0x00, 0x1d, 0x1b,
+	0x16, 0x14, 0x0e, 0x0d, 0x0a, 0x08, 0x05, 0x04, 0x00, 0x26, 0x01, 0x26, 0x07, 0x08, 0x16, 0x2b,
+	0x17, 0x22, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x11, 0x33, 0x11,
+	0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35,
+	0x34, 0x36, 0x37, 0x27, 0x23, 0x06, 0x06, 0xe2, 0x52, 0x52, 0x52, 0x34, 0x38, 0x22, 0x45, 0x23,
+	0x52, 0x3c, 0x4d, 0x1d, 0x1d, 0x0e, 0x21, 0x0c, 0x20, 0x21, 0x0f, 0x33, 0x37, 0x42, 0x40, 0x03,
+	0x02, 0x34, 0x4c, 0x08, 0x52, 0x52, 0x01, 0x52, 0xfe, 0xb8, 0x33, 0x2e, 0x11, 0x12, 0x01, 0x86,
+	0xfe, 0x12, 0x0c, 0x35, 0x21, 0x16, 0x16, 0x05, 0x03, 0x3b, 0x07, 0x04, 0x2f, 0x2c, 0x2c, 0x3f,
+	0x12, 0x1d, 0x1b, 0x16, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xf8, 0x01, 0xd8, 0x02, 0xd1, 0x02, 0x26,
+	0x00, 0xff, 0x00, 0x00, 0x01, 0x06, 0x01, 0x2a, 0x6a, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8,
+	0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xff, 0xf8, 0x01, 0xd8, 0x02, 0xa6,
+	0x02, 0x26, 0x00, 0xff, 0x00, 0x00, 0x01, 0x06, 0x01, 0x2b, 0x47, 0xf6, 0x00, 0x09, 0xb1, 0x01,
+	0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x01, 0xe4,
+	0x01, 0xee, 0x00, 0x06, 0x00, 0x1b, 0x40, 0x18, 0x06, 0x01, 0x01, 0x00, 0x01, 0x4c, 0x02, 0x01,
+	0x00, 0x00, 0x25, 0x4d, 0x00, 0x01, 0x01, 0x23, 0x01, 0x4e, 0x11, 0x11, 0x10, 0x03, 0x08, 0x19,
+	0x2b, 0x01, 0x33, 0x03, 0x23, 0x03, 0x33, 0x13, 0x01, 0x8a, 0x5a, 0xbe, 0x5e, 0xbe, 0x5b, 0x93,
+	0x01, 0xee, 0xfe, 0x12, 0x01, 0xee, 0xfe, 0x5d, 0x00, 0x01, 0x00, 0x11, 0x00, 0x00, 0x02, 0xb4,
+	0x01, 0xee, 0x00, 0x0c, 0x00, 0x21, 0x40, 0x1e, 0x0c, 0x09, 0x04, 0x03, 0x01, 0x00, 0x01, 0x4c,
+	0x04, 0x03, 0x02, 0x00, 0x00, 0x25, 0x4d, 0x02, 0x01, 0x01, 0x01, 0x23, 0x01, 0x4e, 0x12, 0x11,
+	0x12, 0x11, 0x10, 0x05, 0x08, 0x1b, 0x2b, 0x01, 0x33, 0x03, 0x23, 0x03, 0x03, 0x23, 0x03, 0x33,
+	0x13, 0x13, 0x33, 0x13, 0x02, 0x5b, 0x59, 0x89, 0x60, 0x6c, 0x65, 0x60, 0x89, 0x5a, 0x60, 0x6b,
+	0x52, 0x72, 0x01, 0xee, 0xfe, 0x12, 0x01, 0x81, 0xfe, 0x7f, 0x01, 0xee, 0xfe, 0x5f, 0x01, 0xa1,
+	0xfe, 0x5f, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x02, 0xb4, 0x02, 0xa4, 0x02, 0x26, 0x01, 0x0b,
+	0x00, 0x00, 0x01, 0x07, 0x01, 0x1c, 0x00, 0xe5, 0xff, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
+	0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x02, 0xb4, 0x02, 0xa4,
+	0x02, 0x26, 0x01, 0x0b, 0x00, 0x00, 0x01, 0x07, 0x01, 0x21, 0x00, 0x8b, 0xff, 0xf6, 0x00, 0x09,
+	0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00,
+	0x02, 0xb4, 0x02, 0x78, 0x02, 0x26, 0x01, 0x0b, 0x00, 0x00, 0x01, 0x07, 0x01, 0x24, 0x00, 0xaa,
+	0xff, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff,
+	0x00, 0x11, 0x00, 0x00, 0x02, 0xb4, 0x02, 0xa4, 0x02, 0x26, 0x01, 0x0b, 0x00, 0x00, 0x01, 0x07,
+	0x01, 0x26, 0x00, 0xa4, 0xff, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35,
+	0x2b, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x01, 0xb4, 0x01, 0xee, 0x00, 0x0b, 0x00, 0x1f,
+	0x40, 0x1c, 0x09, 0x06, 0x03, 0x03, 0x00, 0x02, 0x01, 0x4c, 0x03, 0x01, 0x02, 0x02, 0x25, 0x4d,
+	0x01, 0x01, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x12, 0x12, 0x12, 0x11, 0x04, 0x08, 0x1a, 0x2b, 0x01,
+	0x13, 0x23, 0x27, 0x07, 0x23, 0x13, 0x27, 0x33, 0x17, 0x37, 0x33, 0x01, 0x0f, 0xa5, 0x5b, 0x7d,
+	0x7c, 0x56, 0xa5, 0x9e, 0x61, 0x6f, 0x75, 0x57, 0x01, 0x01, 0xfe, 0xff, 0xc8, 0xc8, 0x01, 0x00,
+	0xee, 0xb7, 0xb7, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x00, 0x00, 0x01, 0xb4, 0x02, 0x72, 0x02, 0x26,
+	0x01, 0x10, 0x00, 0x00, 0x01, 0x06, 0x00, 0x8c, 0x7e, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
+	0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x08, 0xff, 0x5e, 0x01, 0xe4, 0x01, 0xee,
+	0x00, 0x12, 0x00, 0x30, 0x40, 0x2d, 0x10, 0x06, 0x03, 0x03, 0x00, 0x01, 0x0f, 0x01, 0x03, 0x00,
+	0x02, 0x4c, 0x02, 0x01, 0x01, 0x01, 0x25, 0x4d, 0x04, 0x01, 0x00, 0x00, 0x03, 0x61, 0x00, 0x03,
+	0x03, 0x2d, 0x03, 0x4e, 0x01, 0x00, 0x0d, 0x0b, 0x08, 0x07, 0x05, 0x04, 0x00, 0x12, 0x01, 0x12,
+	0x05, 0x08, 0x16, 0x2b, 0x17, 0x32, 0x36, 0x37, 0x03, 0x33, 0x13, 0x13, 0x33, 0x03, 0x06, 0x06,
+	0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x6f, 0x26, 0x27, 0x16, 0xca, 0x5c, 0x98, 0x90, 0x58,
+	0xca, 0x1b, 0x48, 0x39, 0x11, 0x25, 0x12, 0x0b, 0x1b, 0x58, 0x21, 0x3e, 0x01, 0xe7, 0xfe, 0x6b,
+	0x01, 0x95, 0xfd, 0xf1, 0x48, 0x39, 0x04, 0x03, 0x48, 0x03, 0x02, 0x00, 0xff, 0xff, 0x00, 0x08,
+	0xff, 0x5e, 0x01, 0xe4, 0x02, 0xa4, 0x02, 0x26, 0x01, 0x12, 0x00, 0x00, 0x01, 0x07, 0x01, 0x1c,
+	0x00, 0x84, 0xff, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00,
+	0xff, 0xff, 0x00, 0x08, 0xff, 0x5e, 0x01, 0xe4, 0x02, 0xa4, 0x02, 0x26, 0x01, 0x12, 0x00, 0x00,
+	0x01, 0x06, 0x01, 0x21, 0x2a, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35,
+	0x2b, 0x00, 0xff, 0xff, 0x00, 0x08, 0xff, 0x5e, 0x01, 0xe4, 0x02, 0x78, 0x02, 0x26, 0x01, 0x12,
+	0x00, 0x00, 0x01, 0x06, 0x01, 0x24, 0x49, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x02, 0xb8, 0xff, 0xf6,
+	0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x08, 0xff, 0x5e, 0x01, 0xe4, 0x02, 0xa4, 0x02, 0x26,
+	0x01, 0x12, 0x00, 0x00, 0x01, 0x06, 0x01, 0x26, 0x43, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
+	0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x90, 0x01, 0xee,
+	0x00, 0x09, 0x00, 0x2d, 0x40, 0x2a, 0x08, 0x01, 0x01, 0x03, 0x01, 0x03, 0x02, 0x4b, 0x00, 0x01,
+	0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x25, 0x4d, 0x04, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00,
+	0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x11, 0x12, 0x11, 0x05, 0x08, 0x19,
+	0x2b, 0x25, 0x15, 0x21, 0x35, 0x01, 0x23, 0x35, 0x21, 0x15, 0x01, 0x01, 0x90, 0xfe, 0x8d, 0x01,
+	0x05, 0xf3, 0x01, 0x50, 0xfe, 0xfb, 0x48, 0x48, 0x48, 0x01, 0x60, 0x46, 0x46, 0xfe, 0xa0, 0x00,
+	0xff, 0xff, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x90, 0x02, 0xa4, 0x02, 0x26, 0x01, 0x17, 0x00, 0x00,
+	0x01, 0x06, 0x01, 0x1c, 0x5f, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf6, 0xb0, 0x35,
+	0x2b, 0x00, 0xff, 0xff, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x90, 0x02, 0xa4, 0x02, 0x26, 0x01, 0x17,
+	0x00, 0x00, 0x01, 0x06, 0x01, 0x1e, 0x04, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0xff, 0xf6,
+	0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x90, 0x02, 0x78, 0x02, 0x26,
+	0x01, 0x17, 0x00, 0x00, 0x01, 0x06, 0x01, 0x25, 0x73, 0xf6, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8,
+	0xff, 0xf6, 0xb0, 0x35, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x22, 0x00, 0x00, 0x01, 0x95, 0x01, 0xee,
+	0x00, 0x11, 0x00, 0x3b, 0x40, 0x38, 0x0c, 0x01, 0x03, 0x03, 0x01, 0x07, 0x02, 0x4b, 0x05, 0x01,
+	0x02, 0x06, 0x01, 0x01, 0x07, 0x02, 0x01, 0x67, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x00, 0x04, 0x04,
+	0x25, 0x4d, 0x08, 0x01, 0x07, 0x07, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x00,
+	0x00, 0x11, 0x00, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x09, 0x08, 0x1d, 0x2b, 0x25,
+	0x15, 0x21, 0x35, 0x37, 0x23, 0x35, 0x33, 0x37, 0x23, 0x35, 0x21, 0x15, 0x07, 0x33, 0x15, 0x23,
+	0x07, 0x01, 0x95, 0xfe, 0x8d, 0x75, 0x62, 0x8e, 0x64, 0xf3, 0x01, 0x50, 0x64, 0x63, 0x8f, 0x75,
+	0x48, 0x48, 0x48, 0x9e, 0x3b, 0x87, 0x46, 0x46, 0x87, 0x3b, 0x9e, 0x00, 0x00, 0x01, 0x00, 0x32,
+	0x02, 0x34, 0x01, 0x01, 0x02, 0xae, 0x00, 0x03, 0x00, 0x19, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0e,
+	0x00, 0x00, 0x01, 0x00, 0x85, 0x00, 0x01, 0x01, 0x76, 0x11, 0x10, 0x02, 0x08, 0x18, 0x2b, 0xb1,
+	0x06, 0x00, 0x44, 0x13, 0x33, 0x07, 0x23, 0x99, 0x68, 0x83, 0x4c, 0x02, 0xae, 0x7a, 0x00, 0x01,
+	0x00, 0x32, 0x02, 0x2d, 0x01, 0x4b, 0x02, 0xae, 0x00, 0x0d, 0x00, 0x28, 0xb1, 0x06, 0x64, 0x44,
+	0x40, 0x1d, 0x02, 0x01, 0x00, 0x03, 0x00, 0x85, 0x00, 0x03, 0x01, 0x01, 0x03, 0x59, 0x00, 0x03,
+	0x03, 0x01, 0x61, 0x00, 0x01, 0x03, 0x01, 0x51, 0x22, 0x12, 0x22, 0x10, 0x04, 0x08, 0x1a, 0x2b,
+	0xb1, 0x06, 0x00, 0x44, 0x01, 0x33, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33,
+	0x32, 0x36, 0x01, 0x11, 0x3a, 0x4b, 0x41, 0x42, 0x4b, 0x3a, 0x2c, 0x27, 0x26, 0x2c, 0x02, 0xae,
+	0x3b, 0x46, 0x46, 0x3b, 0x22, 0x27, 0x28, 0x00, 0x00, 0x01, 0x00, 0x32, 0x02, 0x34, 0x01, 0x75,
+	0x02, 0xae, 0x00, 0x06, 0x00, 0x21, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x16, 0x02, 0x01, 0x02, 0x00,
+	0x01, 0x4c, 0x01, 0x01, 0x00, 0x02, 0x00, 0x85, 0x00, 0x02, 0x02, 0x76, 0x11, 0x12, 0x10, 0x03,
+	0x08, 0x19, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x33, 0x17, 0x37, 0x33, 0x07, 0x23, 0x32, 0x4a,
+	0x58, 0x56, 0x4b, 0x77, 0x55, 0x02, 0xae, 0x49, 0x49, 0x7a, 0x00, 0x01, 0x00, 0x26, 0x01, 0xed,
+	0x00, 0x7c, 0x02, 0x99, 0x00, 0x06, 0x00, 0x19, 0x40, 0x16, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02,
+	0x01, 0x01, 0x01, 0x24, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x23, 0x03, 0x08, 0x17,
+	0x2b, 0x13, 0x07, 0x06, 0x06, 0x23, 0x23, 0x37, 0x7c, 0x14, 0x02, 0x16, 0x11, 0x19, 0x04, 0x02,
+	0x99, 0x89, 0x10, 0x13, 0xac, 0x00, 0x00, 0x01, 0x00, 0x3c, 0xff, 0x3d, 0x01, 0x16, 0x00, 0x0f,
+	0x00, 0x18, 0x00, 0x39, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x2e, 0x07, 0x01, 0x01, 0x02, 0x06, 0x01,
+	0x00, 0x01, 0x02, 0x4c, 0x15, 0x14, 0x02, 0x03, 0x4a, 0x00, 0x03, 0x00, 0x02, 0x01, 0x03, 0x02,
+	0x69, 0x00, 0x01, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x00, 0x61, 0x00, 0x00, 0x01, 0x00,
+	0x51, 0x14, 0x34, 0x25, 0x22, 0x04, 0x08, 0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x05, 0x14, 0x06,
+	0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+	0x23, 0x37, 0x17, 0x07, 0x36, 0x16, 0x01, 0x16, 0x35, 0x3b, 0x21, 0x3e, 0x0b, 0x0b, 0x37, 0x1b,
+	0x1d, 0x17, 0x1c, 0x20, 0x0c, 0x24, 0x01, 0x14, 0x40, 0x0c, 0x36, 0x38, 0x73, 0x29, 0x27, 0x07,
+	0x05, 0x33, 0x04, 0x07, 0x0d, 0x11, 0x0e, 0x0d, 0x02, 0x67, 0x06, 0x38, 0x02, 0x23, 0x00, 0x01,
+	0x00, 0x32, 0x02, 0x34, 0x01, 0x75, 0x02, 0xae, 0x00, 0x06, 0x00, 0x21, 0xb1, 0x06, 0x64, 0x44,
+	0x40, 0x16, 0x02, 0x01, 0x00, 0x02, 0x01, 0x4c, 0x00, 0x02, 0x00, 0x02, 0x85, 0x01, 0x01, 0x00,
+	0x00, 0x76, 0x11, 0x12, 0x10, 0x03, 0x08, 0x19, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x23, 0x27,
+	0x07, 0x23, 0x37, 0x33, 0x01, 0x75, 0x4a, 0x58, 0x56, 0x4b, 0x77, 0x55, 0x02, 0x34, 0x49, 0x49,
+	0x7a, 0x00, 0x00, 0x01, 0x00, 0x31, 0xff, 0x21, 0x00, 0x87, 0xff, 0xc1, 0x00, 0x06, 0x00, 0x27,
+	0xb1, 0x06, 0x64, 0x44, 0x40, 0x1c, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x57, 0x02, 0x01, 0x01,
+	0x01, 0x00, 0x61, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x23, 0x03,
+	0x08, 0x17, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x17, 0x07, 0x06, 0x06, 0x23, 0x23, 0x37, 0x87, 0x14,
+	0x03, 0x14, 0x11, 0x1a, 0x04, 0x3f, 0x7d, 0x11, 0x12, 0xa0, 0x00, 0x01, 0x00, 0x32, 0x02, 0x34,
+	0x00, 0x88, 0x02, 0xd4, 0x00, 0x06, 0x00, 0x26, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1b, 0x00, 0x00,
+	0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x00, 0x01, 0x4f, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x06, 0x23, 0x03, 0x08, 0x17, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x37,
+	0x36, 0x36, 0x33, 0x33, 0x07, 0x32, 0x14, 0x02, 0x15, 0x11, 0x1a, 0x04, 0x02, 0x34, 0x7d, 0x11,
+	0x12, 0xa0, 0x00, 0x02, 0x00, 0x32, 0x02, 0x34, 0x01, 0x36, 0x02, 0x82, 0x00, 0x03, 0x00, 0x07,
+	0x00, 0x34, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x29, 0x05, 0x03, 0x04, 0x03, 0x01, 0x00, 0x00, 0x01,
+	0x57, 0x05, 0x03, 0x04, 0x03, 0x01, 0x01, 0x00, 0x5f, 0x02, 0x01, 0x00, 0x01, 0x00, 0x4f, 0x04,
+	0x04, 0x00, 0x00, 0x04, 0x07, 0x04, 0x07, 0x06, 0x05, 0x00, 0x03, 0x00, 0x03, 0x11, 0x06, 0x08,
+	0x17, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x01, 0x36,
+	0x52, 0x5f, 0x53, 0x02, 0x82, 0x4e, 0x4e, 0x4e, 0x4e, 0x00, 0x00, 0x01, 0x00, 0x32, 0x02, 0x34,
+	0x00, 0x96, 0x02, 0x82, 0x00, 0x03, 0x00, 0x20, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x15, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x11, 0x10,
+	0x02, 0x08, 0x18, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x23, 0x35, 0x33, 0x96, 0x64, 0x64, 0x02,
+	0x34, 0x4e, 0x00, 0x01, 0x00, 0x32, 0x02, 0x34, 0x01, 0x01, 0x02, 0xae, 0x00, 0x03, 0x00, 0x1f,
+	0xb1, 0x06, 0x64, 0x44, 0x40, 0x14, 0x00, 0x00, 0x01, 0x00, 0x85, 0x02, 0x01, 0x01, 0x01, 0x76,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x03, 0x08, 0x17, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13,
+	0x27, 0x33, 0x17, 0xb5, 0x83, 0x68, 0x67, 0x02, 0x34, 0x7a, 0x7a, 0x00, 0x00, 0x02, 0x00, 0x37,
+	0x02, 0x34, 0x01, 0xaf, 0x02, 0xae, 0x00, 0x03, 0x00, 0x07, 0x00, 0x25, 0xb1, 0x06, 0x64, 0x44,
+	0x40, 0x1a, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x03,
+	0x01, 0x01, 0x00, 0x01, 0x4f, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x1a, 0x2b, 0xb1, 0x06, 0x00,
+	0x44, 0x13, 0x33, 0x07, 0x23, 0x25, 0x33, 0x07, 0x23, 0x9d, 0x60, 0x7e, 0x48, 0x01, 0x19, 0x5f,
+	0x7d, 0x49, 0x02, 0xae, 0x7a, 0x7a, 0x7a, 0x00, 0x00, 0x01, 0x00, 0x32, 0x02, 0x39, 0x01, 0x27,
+	0x02, 0x79, 0x00, 0x03, 0x00, 0x27, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1c, 0x02, 0x01, 0x01, 0x00,
+	0x00, 0x01, 0x57, 0x02, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x03, 0x11, 0x03, 0x08, 0x17, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x15, 0x23,
+	0x35, 0x01, 0x27, 0xf5, 0x02, 0x79, 0x40, 0x40, 0x00, 0x01, 0x00, 0x39, 0xff, 0x3d, 0x01, 0x07,
+	0x00, 0x1d, 0x00, 0x13, 0x00, 0x2b, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x20, 0x0b, 0x01, 0x01, 0x00,
+	0x01, 0x4c, 0x0a, 0x01, 0x02, 0x00, 0x4a, 0x00, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00,
+	0x01, 0x61, 0x00, 0x01, 0x00, 0x01, 0x51, 0x25, 0x26, 0x02, 0x08, 0x18, 0x2b, 0xb1, 0x06, 0x00,
+	0x44, 0x37, 0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23,
+	0x22, 0x26, 0x35, 0x34, 0x36, 0xdf, 0x28, 0x3c, 0x4d, 0x1d, 0x1d, 0x0e, 0x21, 0x0c, 0x20, 0x21,
+	0x0f, 0x33, 0x37, 0x54, 0x1d, 0x14, 0x0c, 0x35, 0x21, 0x16, 0x16, 0x05, 0x03, 0x3b, 0x07, 0x04,
+	0x2f, 0x2c, 0x32, 0x43, 0x00, 0x02, 0x00, 0x33, 0x02, 0x1f, 0x01, 0x14, 0x02, 0xdb, 0x00, 0x0b,
+	0x00, 0x17, 0x00, 0x2a, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1f, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01,
+	0x03, 0x69, 0x00, 0x02, 0x00, 0x00, 0x02, 0x59, 0x00, 0x02, 0x02, 0x00, 0x61, 0x00, 0x00, 0x02,
+	0x00, 0x51, 0x24, 0x24, 0x24, 0x22, 0x04, 0x08, 0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x14,
+	0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x07, 0x14, 0x16, 0x33, 0x32, 0x36,
+	0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0x14, 0x3d, 0x34, 0x34, 0x3c, 0x3d, 0x33, 0x34, 0x3d,
+	0xae, 0x20, 0x1d, 0x1e, 0x21, 0x22, 0x1d, 0x1d, 0x20, 0x02, 0x7f, 0x2c, 0x34, 0x34, 0x2c, 0x2a,
+	0x32, 0x32, 0x2a, 0x17, 0x19, 0x19, 0x17, 0x15, 0x19, 0x19, 0x00, 0x01, 0x00, 0x32, 0x02, 0x30,
+	0x01, 0x59, 0x02, 0xb0, 0x00, 0x19, 0x00, 0x2e, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x23, 0x04, 0x01,
+	0x00, 0x00, 0x02, 0x05, 0x00, 0x02, 0x69, 0x00, 0x05, 0x01, 0x01, 0x05, 0x59, 0x00, 0x05, 0x05,
+	0x01, 0x62, 0x03, 0x01, 0x01, 0x05, 0x01, 0x52, 0x24, 0x22, 0x12, 0x24, 0x22, 0x10, 0x06, 0x08,
+	0x1c, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x33, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26,
+	0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+	0x01, 0x21, 0x38, 0x29, 0x27, 0x12, 0x24, 0x1c, 0x13, 0x12, 0x08, 0x10, 0x10, 0x38, 0x2a, 0x27,
+	0x12, 0x24, 0x1c, 0x14, 0x12, 0x08, 0x0f, 0x0f, 0x02, 0xac, 0x3a, 0x42, 0x11, 0x19, 0x12, 0x0a,
+	0x20, 0x22, 0x3a, 0x42, 0x11, 0x19, 0x12, 0x0a, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x46, 0xff, 0xb0,
+	0x00, 0x89, 0x02, 0xc3, 0x00, 0x03, 0x00, 0x1f, 0x40, 0x1c, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01,
+	0x57, 0x02, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x03, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x13, 0x11, 0x23, 0x11, 0x89, 0x43, 0x02, 0xc3, 0xfc,
+	0xed, 0x03, 0x13, 0x00, 0x00, 0x02, 0x00, 0x46, 0xff, 0xb0, 0x00, 0x89, 0x02, 0xc3, 0x00, 0x03,
+	0x00, 0x07, 0x00, 0x30, 0x40, 0x2d, 0x04, 0x01, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x67, 0x05,
+	0x01, 0x03, 0x02, 0x02, 0x03, 0x57, 0x05, 0x01, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x03, 0x02,
+	0x4f, 0x04, 0x04, 0x00, 0x00, 0x04, 0x07, 0x04, 0x07, 0x06, 0x05, 0x00, 0x03, 0x00, 0x03, 0x11,
+	0x06, 0x08, 0x17, 0x2b, 0x13, 0x11, 0x23, 0x11, 0x13, 0x11, 0x23, 0x11, 0x89, 0x43, 0x43, 0x43,
+	0x02, 0xc3, 0xfe, 0xb9, 0x01, 0x47, 0xfe, 0x34, 0xfe, 0xb9, 0x01, 0x47, 0x00, 0x01, 0x00, 0x12,
+	0xff, 0xb0, 0x01, 0x23, 0x02, 0xc3, 0x00, 0x03, 0x00, 0x17, 0x40, 0x14, 0x02, 0x01, 0x01, 0x00,
+	0x01, 0x85, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x03, 0x08, 0x17,
+	0x2b, 0x01, 0x03, 0x23, 0x13, 0x01, 0x23, 0xcc, 0x45, 0xcd, 0x02, 0xc3, 0xfc, 0xed, 0x03, 0x13,
+	0x00, 0x01, 0x00, 0x11, 0xff, 0xb0, 0x01, 0x22, 0x02, 0xc3, 0x00, 0x03, 0x00, 0x17, 0x40, 0x14,
+	0x02, 0x01, 0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03,
+	0x11, 0x03, 0x08, 0x17, 0x2b, 0x13, 0x13, 0x23, 0x03, 0x56, 0xcc, 0x44, 0xcd, 0x02, 0xc3, 0xfc,
+	0xed, 0x03, 0x13, 0x00, 0x00, 0x01, 0x00, 0x29, 0xff, 0x9c, 0x00, 0x80, 0x00, 0x56, 0x00, 0x06,
+	0x00, 0x1f, 0x40, 0x1c, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x57, 0x02, 0x01, 0x01, 0x01, 0x00,
+	0x61, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x23, 0x03, 0x08, 0x17,
+	0x2b, 0x37, 0x07, 0x06, 0x06, 0x23, 0x23, 0x37, 0x80, 0x19, 0x02, 0x13, 0x0f, 0x1a, 0x05, 0x56,
+	0x9b, 0x0f, 0x10, 0xba, 0x00, 0x01, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x53, 0x00, 0x03,
+	0x00, 0x13, 0x40, 0x10, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x11,
+	0x10, 0x02, 0x08, 0x18, 0x2b, 0x33, 0x23, 0x35, 0x33, 0x80, 0x52, 0x52, 0x53, 0x00, 0xff, 0xff,
+	0x00, 0x39, 0xff, 0x9c, 0x00, 0x90, 0x01, 0xee, 0x00, 0x26, 0x01, 0x30, 0x10, 0x00, 0x01, 0x07,
+	0x01, 0x31, 0x00, 0x10, 0x01, 0x9b, 0x00, 0x09, 0xb1, 0x01, 0x01, 0xb8, 0x01, 0x9b, 0xb0, 0x35,
+	0x2b, 0x00, 0xff, 0xff, 0x00, 0x38, 0x00, 0x00, 0x00, 0x8a, 0x01, 0xee, 0x00, 0x27, 0x01, 0x31,
+	0x00, 0x0a, 0x01, 0x9b, 0x01, 0x06, 0x01, 0x31, 0x0a, 0x00, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8,
+	0x01, 0x9b, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x38, 0x01, 0x14, 0x00, 0x8a, 0x01, 0x67,
+	0x01, 0x07, 0x01, 0x31, 0x00, 0x0a, 0x01, 0x14, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0x01, 0x14,
+	0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x38, 0x01, 0x14, 0x00, 0x8a, 0x01, 0x67, 0x02, 0x06,
+	0x01, 0x35, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2e, 0x00, 0x00, 0x01, 0xbb, 0x00, 0x53, 0x00, 0x03,
+	0x00, 0x07, 0x00, 0x0b, 0x00, 0x1b, 0x40, 0x18, 0x05, 0x03, 0x02, 0x01, 0x01, 0x00, 0x5f, 0x04,
+	0x02, 0x02, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x08, 0x1c,
+	0x2b, 0x21, 0x23, 0x35, 0x33, 0x07, 0x23, 0x35, 0x33, 0x05, 0x23, 0x35, 0x33, 0x01, 0x18, 0x48,
+	0x48, 0xa2, 0x48, 0x48, 0x01, 0x45, 0x48, 0x48, 0x53, 0x53, 0x53, 0x53, 0x53, 0x00, 0x00, 0x02,
+	0x00, 0x3f, 0x00, 0x00, 0x00, 0x9c, 0x02, 0x73, 0x00, 0x03, 0x00, 0x07, 0x00, 0x25, 0x40, 0x22,
+	0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x22, 0x4d, 0x04, 0x01, 0x03, 0x03, 0x02, 0x5f,
+	0x00, 0x02, 0x02, 0x23, 0x02, 0x4e, 0x04, 0x04, 0x04, 0x07, 0x04, 0x07, 0x12, 0x11, 0x10, 0x05,
+	0x08, 0x19, 0x2b, 0x13, 0x33, 0x03, 0x23, 0x17, 0x15, 0x23, 0x35, 0x3f, 0x5d, 0x0b, 0x47, 0x4f,
+	0x56, 0x02, 0x73, 0xfe, 0x39, 0x5b, 0x51, 0x51, 0x00, 0x02, 0x00, 0x3c, 0xff, 0x7b, 0x00, 0x99,
+	0x01, 0xee, 0x00, 0x03, 0x00, 0x07, 0x00, 0x43, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x16, 0x00,
+	0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x25, 0x4d, 0x04, 0x01, 0x03, 0x03, 0x02, 0x5f, 0x00,
+	0x02, 0x02, 0x27, 0x02, 0x4e, 0x1b, 0x40, 0x13, 0x04, 0x01, 0x03, 0x00, 0x02, 0x03, 0x02, 0x63,
+	0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x25, 0x01, 0x4e, 0x59, 0x40, 0x0c, 0x04, 0x04,
+	0x04, 0x07, 0x04, 0x07, 0x12, 0x11, 0x10, 0x05, 0x08, 0x19, 0x2b, 0x13, 0x33, 0x15, 0x23, 0x17,
+	0x13, 0x23, 0x13, 0x40, 0x56, 0x56, 0x4e, 0x0b, 0x5d, 0x0b, 0x01, 0xee, 0x51, 0x5b, 0xfe, 0x39,
+	0x01, 0xc7, 0x00, 0x02, 0x00, 0x16, 0x00, 0x00, 0x01, 0x64, 0x02, 0x7d, 0x00, 0x15, 0x00, 0x19,
+	0x00, 0x43, 0x40, 0x40, 0x13, 0x01, 0x02, 0x00, 0x12, 0x09, 0x06, 0x03, 0x01, 0x02, 0x02, 0x4c,
+	0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x04, 0x80, 0x00, 0x02, 0x02, 0x00, 0x61, 0x05, 0x01, 0x00,
+	0x00, 0x28, 0x4d, 0x06, 0x01, 0x04, 0x04, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x23, 0x03, 0x4e, 0x16,
+	0x16, 0x01, 0x00, 0x16, 0x19, 0x16, 0x19, 0x18, 0x17, 0x10, 0x0e, 0x08, 0x07, 0x00, 0x15, 0x01,
+	0x15, 0x07, 0x08, 0x16, 0x2b, 0x13, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x15, 0x23, 0x35, 0x36,
+	0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x13, 0x15, 0x23, 0x35, 0xb9,
+	0x51, 0x5a, 0x4c, 0x52, 0x4b, 0x53, 0x46, 0x35, 0x32, 0x25, 0x53, 0x1f, 0x26, 0x4f, 0x40, 0x57,
+	0x02, 0x7d, 0x46, 0x41, 0x3b, 0x65, 0x2f, 0x7a, 0x9d, 0x2a, 0x48, 0x28, 0x25, 0x27, 0x0f, 0x0c,
+	0x4c, 0x0e, 0x0e, 0xfd, 0xd4, 0x51, 0x51, 0x00, 0x00, 0x02, 0x00, 0x16, 0xff, 0x71, 0x01, 0x64,
+	0x01, 0xee, 0x00, 0x03, 0x00, 0x19, 0x00, 0x42, 0x40, 0x3f, 0x16, 0x0d, 0x0a, 0x03, 0x04, 0x03,
+	0x17, 0x01, 0x02, 0x04, 0x02, 0x4c, 0x00, 0x03, 0x01, 0x04, 0x01, 0x03, 0x04, 0x80, 0x05, 0x01,
+	0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x25, 0x4d, 0x00, 0x04, 0x04, 0x02, 0x62, 0x06, 0x01,
+	0x02, 0x02, 0x27, 0x02, 0x4e, 0x05, 0x04, 0x00, 0x00, 0x14, 0x12, 0x0c, 0x0b, 0x04, 0x19, 0x05,
+	0x19, 0x00, 0x03, 0x00, 0x03, 0x11, 0x07, 0x08, 0x17, 0x2b, 0x13, 0x35, 0x33, 0x15, 0x03, 0x22,
+	0x26, 0x35, 0x34, 0x36, 0x37, 0x35, 0x33, 0x15, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36,
+	0x37, 0x15, 0x06, 0x06, 0xaf, 0x57, 0x45, 0x51, 0x5a, 0x4c, 0x52, 0x4b, 0x53, 0x46, 0x35, 0x32,
+	0x25, 0x53, 0x1f, 0x26, 0x4f, 0x01, 0x9d, 0x51, 0x51, 0xfd, 0xd4, 0x46, 0x41, 0x3b, 0x65, 0x2f,
+	0x7a, 0x9d, 0x2a, 0x48, 0x28, 0x25, 0x27, 0x0f, 0x0c, 0x4c, 0x0e, 0x0e, 0x00, 0x03, 0x00, 0x2b,
+	0xff, 0xf8, 0x02, 0xaf, 0x02, 0x7d, 0x00, 0x12, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x55, 0x40, 0x52,
+	0x21, 0x01, 0x05, 0x02, 0x20, 0x01, 0x06, 0x07, 0x01, 0x01, 0x00, 0x06, 0x03, 0x4c, 0x00, 0x02,
+	0x08, 0x01, 0x03, 0x07, 0x02, 0x03, 0x67, 0x00, 0x05, 0x00, 0x07, 0x06, 0x05, 0x07, 0x69, 0x09,
+	0x01, 0x04, 0x04, 0x01, 0x61, 0x00, 0x01, 0x01, 0x28, 0x4d, 0x0a, 0x01, 0x06, 0x06, 0x00, 0x61,
+	0x00, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x1e, 0x1d, 0x14, 0x13, 0x00, 0x00, 0x24, 0x23, 0x1d, 0x26,
+	0x1e, 0x26, 0x18, 0x16, 0x13, 0x1c, 0x14, 0x1c, 0x00, 0x12, 0x00, 0x12, 0x15, 0x24, 0x23, 0x0b,
+	0x08, 0x19, 0x2b, 0x01, 0x15, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
+	0x15, 0x14, 0x06, 0x07, 0x33, 0x15, 0x01, 0x22, 0x06, 0x15, 0x15, 0x36, 0x36, 0x35, 0x34, 0x26,
+	0x03, 0x32, 0x36, 0x37, 0x35, 0x06, 0x06, 0x07, 0x16, 0x16, 0x02, 0x1c, 0x24, 0x6f, 0x46, 0x91,
+	0x87, 0x86, 0x87, 0x5f, 0x6a, 0x12, 0x13, 0xd3, 0xfe, 0x84, 0x5f, 0x53, 0xa4, 0x8b, 0x41, 0x2b,
+	0x2f, 0x47, 0x12, 0x29, 0xa0, 0x7e, 0x0b, 0x59, 0x01, 0x16, 0xe7, 0x1b, 0x1c, 0xa1, 0xae, 0x9c,
+	0x9a, 0x59, 0x50, 0x25, 0x3c, 0x17, 0x46, 0x01, 0x1a, 0x69, 0x79, 0x07, 0x02, 0x3c, 0x4a, 0x2e,
+	0x33, 0xfe, 0x18, 0x0c, 0x0b, 0xec, 0x25, 0x24, 0x02, 0x62, 0x56, 0x00, 0x00, 0x02, 0x00, 0x2a,
+	0xff, 0xb4, 0x02, 0x65, 0x02, 0x2d, 0x00, 0x3f, 0x00, 0x4c, 0x00, 0x79, 0x40, 0x76, 0x11, 0x01,
+	0x02, 0x03, 0x10, 0x01, 0x01, 0x02, 0x09, 0x01, 0x0a, 0x01, 0x4a, 0x49, 0x02, 0x04, 0x0a, 0x3d,
+	0x01, 0x00, 0x04, 0x2a, 0x01, 0x06, 0x00, 0x2b, 0x01, 0x07, 0x06, 0x07, 0x4c, 0x00, 0x08, 0x00,
+	0x05, 0x03, 0x08, 0x05, 0x69, 0x00, 0x03, 0x00, 0x02, 0x01, 0x03, 0x02, 0x69, 0x00, 0x01, 0x0d,
+	0x01, 0x0a, 0x04, 0x01, 0x0a, 0x69, 0x0b, 0x01, 0x04, 0x09, 0x0c, 0x02, 0x00, 0x06, 0x04, 0x00,
+	0x69, 0x00, 0x06, 0x07, 0x07, 0x06, 0x59, 0x00, 0x06, 0x06, 0x07, 0x61, 0x00, 0x07, 0x06, 0x07,
+	0x51, 0x41, 0x40, 0x01, 0x00, 0x47, 0x45, 0x40, 0x4c, 0x41, 0x4c, 0x3b, 0x39, 0x35, 0x33, 0x2f,
+	0x2d, 0x28, 0x26, 0x22, 0x20, 0x1c, 0x1a, 0x15, 0x13, 0x0e, 0x0c, 0x07, 0x05, 0x00, 0x3f, 0x01,
+	0x3f, 0x0e, 0x08, 0x16, 0x2b, 0x25, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x35,
+	0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x14, 0x16,
+	0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37,
+	0x15, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+	0x22, 0x26, 0x27, 0x06, 0x06, 0x37, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x35,
+	0x26, 0x26, 0x01, 0x2a, 0x2f, 0x2f, 0x37, 0x42, 0x15, 0x2a, 0x0e, 0x22, 0x24, 0x1c, 0x2f, 0x16,
+	0x18, 0x34, 0x23, 0x3b, 0x38, 0x0b, 0x0b, 0x1e, 0x25, 0x68, 0x66, 0x7f, 0x6b, 0x77, 0x85, 0x2f,
+	0x57, 0x23, 0x23, 0x5e, 0x37, 0x9b, 0x96, 0x97, 0x97, 0x83, 0x8a, 0x4b, 0x41, 0x17, 0x1e, 0x06,
+	0x15, 0x3d, 0x01, 0x29, 0x1d, 0x19, 0x1c, 0x19, 0x2f, 0x0e, 0x1b, 0x1b, 0x4b, 0x32, 0x33, 0x33,
+	0x2c, 0x04, 0x03, 0x19, 0x21, 0x1e, 0x05, 0x06, 0x38, 0x06, 0x06, 0x36, 0x3a, 0x86, 0x10, 0x0f,
+	0x54, 0x45, 0x68, 0x6b, 0x78, 0x8c, 0x82, 0x77, 0x14, 0x13, 0x3e, 0x14, 0x14, 0x9a, 0x9e, 0xa1,
+	0xa0, 0x89, 0x80, 0x64, 0x75, 0x14, 0x14, 0x13, 0x15, 0x96, 0x13, 0x1a, 0x1b, 0x17, 0x0e, 0x0c,
+	0x40, 0x03, 0x02, 0x00, 0x00, 0x01, 0x00, 0x18, 0x01, 0x3a, 0x01, 0x60, 0x02, 0x73, 0x00, 0x0e,
+	0x00, 0x1c, 0x40, 0x19, 0x0e, 0x0d, 0x0c, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01,
+	0x0c, 0x00, 0x49, 0x00, 0x00, 0x00, 0x22, 0x00, 0x4e, 0x1a, 0x01, 0x08, 0x17, 0x2b, 0x13, 0x17,
+	0x07, 0x27, 0x07, 0x27, 0x37, 0x27, 0x37, 0x17, 0x27, 0x33, 0x07, 0x37, 0x17, 0xe5, 0x4e, 0x32,
+	0x46, 0x48, 0x31, 0x50, 0x7a, 0x14, 0x76, 0x05, 0x3d, 0x05, 0x78, 0x13, 0x01, 0xc4, 0x66, 0x24,
+	0x6b, 0x69, 0x24, 0x63, 0x26, 0x39, 0x2d, 0x7e, 0x7e, 0x2b, 0x3a, 0x00, 0x00, 0x02, 0x00, 0x1c,
+	0xff, 0xf6, 0x01, 0xb7, 0x02, 0x7d, 0x00, 0x33, 0x00, 0x45, 0x00, 0x3b, 0x40, 0x38, 0x30, 0x01,
+	0x00, 0x03, 0x3d, 0x35, 0x31, 0x27, 0x17, 0x0d, 0x06, 0x02, 0x00, 0x16, 0x01, 0x01, 0x02, 0x03,
+	0x4c, 0x04, 0x01, 0x00, 0x00, 0x03, 0x61, 0x00, 0x03, 0x03, 0x28, 0x4d, 0x00, 0x02, 0x02, 0x01,
+	0x61, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x01, 0x00, 0x2e, 0x2c, 0x1b, 0x19, 0x14, 0x12, 0x00,
+	0x33, 0x01, 0x33, 0x05, 0x08, 0x16, 0x2b, 0x13, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x17, 0x16,
+	0x16, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16,
+	0x16, 0x37, 0x32, 0x36, 0x35, 0x34, 0x26, 0x27, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x26,
+	0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x03, 0x17, 0x17, 0x36, 0x36,
+	0x35, 0x34, 0x26, 0x27, 0x27, 0x30, 0x26, 0x23, 0x06, 0x06, 0x15, 0x14, 0x16, 0xf6, 0x37, 0x32,
+	0x1a, 0x23, 0x9e, 0x2a, 0x25, 0x23, 0x1f, 0x10, 0x0e, 0x56, 0x53, 0x2e, 0x4e, 0x23, 0x23, 0x48,
+	0x25, 0x39, 0x32, 0x1a, 0x24, 0x95, 0x2e, 0x29, 0x22, 0x20, 0x0f, 0x0f, 0x57, 0x51, 0x30, 0x4e,
+	0x21, 0x21, 0x4a, 0x85, 0xa7, 0x03, 0x16, 0x19, 0x15, 0x20, 0xa7, 0x01, 0x01, 0x16, 0x19, 0x15,
+	0x02, 0x3e, 0x19, 0x1c, 0x12, 0x19, 0x0d, 0x3d, 0x10, 0x30, 0x25, 0x23, 0x40, 0x16, 0x0e, 0x24,
+	0x19, 0x39, 0x3c, 0x0a, 0x0a, 0x40, 0x0b, 0x0b, 0x01, 0x19, 0x1c, 0x12, 0x19, 0x0d, 0x38, 0x11,
+	0x32, 0x27, 0x23, 0x40, 0x17, 0x0d, 0x24, 0x19, 0x38, 0x3d, 0x09, 0x0a, 0x40, 0x0a, 0x0b, 0xfe,
+	0xd5, 0x40, 0x01, 0x10, 0x29, 0x14, 0x19, 0x1b, 0x0c, 0x40, 0x01, 0x12, 0x28, 0x14, 0x19, 0x1b,
+	0x00, 0x01, 0x00, 0x19, 0x00, 0xdd, 0x01, 0x4a, 0x02, 0x73, 0x00, 0x0b, 0x00, 0x4a, 0x4b, 0xb0,
+	0x2d, 0x50, 0x58, 0x40, 0x18, 0x00, 0x00, 0x01, 0x00, 0x86, 0x00, 0x03, 0x03, 0x22, 0x4d, 0x06,
+	0x05, 0x02, 0x01, 0x01, 0x02, 0x5f, 0x04, 0x01, 0x02, 0x02, 0x25, 0x01, 0x4e, 0x1b, 0x40, 0x16,
+	0x00, 0x00, 0x01, 0x00, 0x86, 0x04, 0x01, 0x02, 0x06, 0x05, 0x02, 0x01, 0x00, 0x02, 0x01, 0x68,
+	0x00, 0x03, 0x03, 0x22, 0x03, 0x4e, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x07, 0x08, 0x1b, 0x2b, 0x13, 0x17, 0x23, 0x37, 0x07, 0x35, 0x17, 0x27,
+	0x33, 0x07, 0x37, 0x15, 0xcb, 0x07, 0x43, 0x08, 0x7e, 0x7d, 0x06, 0x41, 0x06, 0x7f, 0x01, 0xc5,
+	0xe8, 0xe7, 0x05, 0x3d, 0x06, 0x7d, 0x7d, 0x06, 0x3d, 0x00, 0x00, 0x01, 0x00, 0x2a, 0x00, 0x76,
+	0x01, 0x5b, 0x02, 0x73, 0x00, 0x13, 0x00, 0x8e, 0x4b, 0xb0, 0x0b, 0x50, 0x58, 0x40, 0x23, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x71, 0x0a, 0x09, 0x02, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00, 0x67,
+	0x00, 0x06, 0x06, 0x22, 0x4d, 0x08, 0x01, 0x04, 0x04, 0x05, 0x5f, 0x07, 0x01, 0x05, 0x05, 0x25,
+	0x04, 0x4e, 0x1b, 0x4b, 0xb0, 0x2d, 0x50, 0x58, 0x40, 0x22, 0x00, 0x01, 0x00, 0x01, 0x86, 0x0a,
+	0x09, 0x02, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00, 0x67, 0x00, 0x06, 0x06, 0x22, 0x4d, 0x08,
+	0x01, 0x04, 0x04, 0x05, 0x5f, 0x07, 0x01, 0x05, 0x05, 0x25, 0x04, 0x4e, 0x1b, 0x40, 0x20, 0x00,
+	0x01, 0x00, 0x01, 0x86, 0x07, 0x01, 0x05, 0x08, 0x01, 0x04, 0x03, 0x05, 0x04, 0x68, 0x0a, 0x09,
+	0x02, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00, 0x67, 0x00, 0x06, 0x06, 0x22, 0x06, 0x4e, 0x59,
+	0x59, 0x40, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x0b, 0x08, 0x1f, 0x2b, 0x01, 0x15, 0x27, 0x17, 0x23, 0x37, 0x07, 0x35, 0x17, 0x35,
+	0x07, 0x35, 0x17, 0x27, 0x33, 0x07, 0x37, 0x15, 0x27, 0x15, 0x01, 0x5b, 0x7f, 0x06, 0x41, 0x06,
+	0x7d, 0x7f, 0x7f, 0x7d, 0x06, 0x41, 0x06, 0x7f, 0x80, 0x01, 0x2a, 0x3d, 0x06, 0x7d, 0x7d, 0x06,
+	0x3d, 0x06, 0xa1, 0x06, 0x3d, 0x06, 0x7d, 0x7d, 0x06, 0x3d, 0x06, 0xa1, 0x00, 0x02, 0x00, 0x1c,
+	0xff, 0x5e, 0x01, 0x9e, 0x02, 0x7f, 0x00, 0x1a, 0x00, 0x27, 0x00, 0x47, 0x40, 0x44, 0x00, 0x01,
+	0x04, 0x03, 0x25, 0x24, 0x02, 0x05, 0x04, 0x0f, 0x01, 0x02, 0x05, 0x08, 0x01, 0x01, 0x02, 0x07,
+	0x01, 0x00, 0x01, 0x05, 0x4c, 0x00, 0x05, 0x00, 0x02, 0x01, 0x05, 0x02, 0x69, 0x06, 0x01, 0x04,
+	0x04, 0x03, 0x61, 0x00, 0x03, 0x03, 0x28, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x61, 0x00, 0x00, 0x00,
+	0x2d, 0x00, 0x4e, 0x1c, 0x1b, 0x22, 0x20, 0x1b, 0x27, 0x1c, 0x26, 0x24, 0x25, 0x33, 0x33, 0x07,
+	0x08, 0x1a, 0x2b, 0x01, 0x11, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32,
+	0x36, 0x35, 0x35, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x07, 0x22,
+	0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x11, 0x26, 0x26, 0x01, 0x9e, 0x51, 0x4a, 0x17,
+	0x21, 0x12, 0x19, 0x10, 0x07, 0x36, 0x2d, 0x1d, 0x39, 0x1c, 0x69, 0x55, 0x6e, 0x84, 0x24, 0x43,
+	0x67, 0x5e, 0x42, 0x34, 0x4a, 0x16, 0x32, 0x18, 0x0d, 0x21, 0x02, 0x73, 0xfd, 0x96, 0x51, 0x5a,
+	0x02, 0x03, 0x49, 0x03, 0x01, 0x2c, 0x35, 0x83, 0x06, 0x07, 0x72, 0x8e, 0x8b, 0x75, 0x05, 0x4a,
+	0x4a, 0x67, 0x69, 0x4a, 0x05, 0x05, 0x01, 0x58, 0x01, 0x01, 0x00, 0x03, 0x00, 0x2a, 0xff, 0xf6,
+	0x02, 0x94, 0x02, 0x7d, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x31, 0x00, 0x56, 0xb1, 0x06, 0x64, 0x44,
+	0x40, 0x4b, 0x28, 0x01, 0x07, 0x06, 0x29, 0x1b, 0x02, 0x04, 0x07, 0x1c, 0x01, 0x05, 0x04, 0x03,
+	0x4c, 0x00, 0x01, 0x00, 0x02, 0x06, 0x01, 0x02, 0x69, 0x00, 0x06, 0x00, 0x07, 0x04, 0x06, 0x07,
+	0x69, 0x08, 0x01, 0x04, 0x00, 0x05, 0x03, 0x04, 0x05, 0x69, 0x00, 0x03, 0x00, 0x00, 0x03, 0x59,
+	0x00, 0x03, 0x03, 0x00, 0x61, 0x00, 0x00, 0x03, 0x00, 0x51, 0x19, 0x18, 0x2d, 0x2b, 0x26, 0x24,
+	0x20, 0x1e, 0x18, 0x31, 0x19, 0x31, 0x24, 0x24, 0x24, 0x22, 0x09, 0x08, 0x1a, 0x2b, 0xb1, 0x06,
+	0x00, 0x44, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x07, 0x34,
+	0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x27, 0x32, 0x36, 0x37, 0x15, 0x06,
+	0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22,
+	0x06, 0x15, 0x14, 0x16, 0x02, 0x94, 0x9d, 0x97, 0x9a, 0x9c, 0x9e, 0x98, 0x99, 0x9b, 0x3c, 0x7a,
+	0x7d, 0x7e, 0x7c, 0x7b, 0x7f, 0x7d, 0x7a, 0xe4, 0x16, 0x31, 0x17, 0x15, 0x37, 0x1e, 0x5d, 0x50,
+	0x59, 0x5d, 0x16, 0x28, 0x1a, 0x16, 0x26, 0x1b, 0x39, 0x30, 0x30, 0x01, 0x3a, 0x9e, 0xa6, 0xa3,
+	0xa1, 0x9f, 0xa4, 0xa2, 0xa1, 0x86, 0x84, 0x84, 0x86, 0x85, 0x82, 0x82, 0x14, 0x0a, 0x0a, 0x3f,
+	0x0a, 0x0b, 0x54, 0x5f, 0x5b, 0x57, 0x04, 0x06, 0x3d, 0x04, 0x04, 0x36, 0x3d, 0x3f, 0x34, 0x00,
+	0x00, 0x02, 0x00, 0x31, 0x01, 0x0c, 0x02, 0xc6, 0x02, 0x7b, 0x00, 0x27, 0x00, 0x34, 0x00, 0x5c,
+	0x40, 0x59, 0x0a, 0x01, 0x01, 0x07, 0x33, 0x2e, 0x2b, 0x0b, 0x04, 0x05, 0x01, 0x1f, 0x01, 0x03,
+	0x05, 0x1e, 0x01, 0x04, 0x03, 0x04, 0x4c, 0x09, 0x08, 0x02, 0x07, 0x00, 0x01, 0x00, 0x07, 0x01,
+	0x80, 0x00, 0x05, 0x01, 0x03, 0x01, 0x05, 0x03, 0x80, 0x06, 0x01, 0x04, 0x03, 0x02, 0x03, 0x04,
+	0x02, 0x80, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x01, 0x69, 0x00, 0x03, 0x04, 0x02, 0x03, 0x59,
+	0x00, 0x03, 0x03, 0x02, 0x61, 0x00, 0x02, 0x03, 0x02, 0x51, 0x28, 0x28, 0x28, 0x34, 0x28, 0x34,
+	0x11, 0x12, 0x12, 0x16, 0x25, 0x2b, 0x25, 0x26, 0x0a, 0x06, 0x1e, 0x2b, 0x13, 0x27, 0x26, 0x26,
+	0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16,
+	0x17, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32,
+	0x36, 0x35, 0x34, 0x26, 0x25, 0x11, 0x23, 0x35, 0x07, 0x23, 0x27, 0x15, 0x23, 0x11, 0x33, 0x17,
+	0x37, 0xcc, 0x53, 0x27, 0x21, 0x40, 0x46, 0x1d, 0x2e, 0x12, 0x1f, 0x28, 0x17, 0x29, 0x21, 0x0f,
+	0x13, 0x53, 0x31, 0x1f, 0x40, 0x46, 0x25, 0x44, 0x11, 0x1c, 0x3e, 0x20, 0x29, 0x20, 0x10, 0x01,
+	0xe2, 0x3b, 0x5f, 0x32, 0x60, 0x3a, 0x4d, 0x67, 0x67, 0x01, 0xa3, 0x13, 0x09, 0x29, 0x23, 0x3a,
+	0x36, 0x05, 0x05, 0x35, 0x06, 0x04, 0x18, 0x1f, 0x10, 0x11, 0x05, 0x12, 0x0b, 0x28, 0x2a, 0x3c,
+	0x32, 0x09, 0x07, 0x37, 0x08, 0x08, 0x17, 0x20, 0x13, 0x11, 0xd5, 0xfe, 0xa1, 0xff, 0xba, 0xba,
+	0xff, 0x01, 0x5f, 0xcf, 0xcf, 0x00, 0x00, 0x04, 0x00, 0x26, 0x01, 0x0e, 0x01, 0x8d, 0x02, 0x7d,
+	0x00, 0x0b, 0x00, 0x17, 0x00, 0x25, 0x00, 0x2e, 0x00, 0x57, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x4c,
+	0x22, 0x01, 0x07, 0x09, 0x01, 0x4c, 0x06, 0x01, 0x04, 0x07, 0x03, 0x07, 0x04, 0x03, 0x80, 0x00,
+	0x01, 0x00, 0x02, 0x05, 0x01, 0x02, 0x69, 0x00, 0x05, 0x00, 0x08, 0x09, 0x05, 0x08, 0x69, 0x00,
+	0x09, 0x0a, 0x01, 0x07, 0x04, 0x09, 0x07, 0x67, 0x00, 0x03, 0x00, 0x00, 0x03, 0x59, 0x00, 0x03,
+	0x03, 0x00, 0x61, 0x00, 0x00, 0x03, 0x00, 0x51, 0x18, 0x18, 0x2d, 0x2b, 0x2a, 0x28, 0x18, 0x25,
+	0x18, 0x25, 0x16, 0x21, 0x13, 0x24, 0x24, 0x24, 0x22, 0x0b, 0x08, 0x1d, 0x2b, 0xb1, 0x06, 0x00,
+	0x44, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x07, 0x34, 0x26,
+	0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x27, 0x15, 0x23, 0x35, 0x33, 0x32, 0x16,
+	0x15, 0x14, 0x06, 0x07, 0x17, 0x23, 0x27, 0x37, 0x34, 0x26, 0x23, 0x23, 0x15, 0x33, 0x32, 0x36,
+	0x01, 0x8d, 0x5b, 0x58, 0x5a, 0x5a, 0x5c, 0x59, 0x59, 0x59, 0x2e, 0x41, 0x43, 0x44, 0x41, 0x41,
+	0x44, 0x43, 0x41, 0xa3, 0x2b, 0x48, 0x2f, 0x25, 0x16, 0x16, 0x31, 0x36, 0x29, 0x2e, 0x12, 0x16,
+	0x1d, 0x1d, 0x16, 0x12, 0x01, 0xc6, 0x5b, 0x5d, 0x5c, 0x5c, 0x5a, 0x5d, 0x5b, 0x5c, 0x48, 0x45,
+	0x45, 0x48, 0x47, 0x44, 0x44, 0x27, 0x44, 0xca, 0x21, 0x22, 0x19, 0x1f, 0x06, 0x49, 0x44, 0x43,
+	0x0e, 0x0e, 0x3b, 0x0f, 0x00, 0x02, 0x00, 0x14, 0x01, 0x14, 0x02, 0xc8, 0x02, 0x73, 0x00, 0x07,
+	0x00, 0x14, 0x00, 0x4c, 0x40, 0x49, 0x13, 0x0e, 0x0b, 0x03, 0x05, 0x00, 0x01, 0x4c, 0x00, 0x05,
+	0x00, 0x01, 0x00, 0x05, 0x01, 0x80, 0x06, 0x04, 0x02, 0x01, 0x01, 0x84, 0x0a, 0x08, 0x07, 0x09,
+	0x04, 0x03, 0x00, 0x00, 0x03, 0x57, 0x0a, 0x08, 0x07, 0x09, 0x04, 0x03, 0x03, 0x00, 0x5f, 0x02,
+	0x01, 0x00, 0x03, 0x00, 0x4f, 0x08, 0x08, 0x00, 0x00, 0x08, 0x14, 0x08, 0x14, 0x12, 0x11, 0x10,
+	0x0f, 0x0d, 0x0c, 0x0a, 0x09, 0x00, 0x07, 0x00, 0x07, 0x11, 0x11, 0x11, 0x0b, 0x06, 0x19, 0x2b,
+	0x01, 0x15, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35, 0x21, 0x11, 0x23, 0x35, 0x07, 0x23, 0x27, 0x15,
+	0x23, 0x11, 0x33, 0x17, 0x37, 0x01, 0x3d, 0x75, 0x3e, 0x76, 0x02, 0xb4, 0x3a, 0x5f, 0x32, 0x60,
+	0x3a, 0x4d, 0x67, 0x67, 0x02, 0x73, 0x38, 0xfe, 0xd9, 0x01, 0x27, 0x38, 0xfe, 0xa1, 0xff, 0xba,
+	0xba, 0xff, 0x01, 0x5f, 0xcf, 0xcf, 0x00, 0x03, 0x00, 0x32, 0x00, 0xff, 0x01, 0x24, 0x02, 0x7d,
+	0x00, 0x1d, 0x00, 0x2a, 0x00, 0x2e, 0x00, 0xba, 0x40, 0x17, 0x17, 0x01, 0x03, 0x04, 0x16, 0x01,
+	0x02, 0x03, 0x0f, 0x01, 0x05, 0x02, 0x28, 0x27, 0x02, 0x06, 0x05, 0x02, 0x01, 0x00, 0x06, 0x05,
+	0x4c, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x27, 0x00, 0x02, 0x09, 0x01, 0x05, 0x06, 0x02, 0x05,
+	0x69, 0x00, 0x06, 0x01, 0x01, 0x00, 0x08, 0x06, 0x00, 0x69, 0x00, 0x03, 0x03, 0x04, 0x61, 0x00,
+	0x04, 0x04, 0x34, 0x4d, 0x00, 0x08, 0x08, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x33, 0x07, 0x4e, 0x1b,
+	0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40, 0x24, 0x00, 0x02, 0x09, 0x01, 0x05, 0x06, 0x02, 0x05, 0x69,
+	0x00, 0x06, 0x01, 0x01, 0x00, 0x08, 0x06, 0x00, 0x69, 0x00, 0x08, 0x00, 0x07, 0x08, 0x07, 0x63,
+	0x00, 0x03, 0x03, 0x04, 0x61, 0x00, 0x04, 0x04, 0x34, 0x03, 0x4e, 0x1b, 0x40, 0x2b, 0x00, 0x00,
+	0x06, 0x01, 0x06, 0x00, 0x01, 0x80, 0x00, 0x02, 0x09, 0x01, 0x05, 0x06, 0x02, 0x05, 0x69, 0x00,
+	0x06, 0x00, 0x01, 0x08, 0x06, 0x01, 0x69, 0x00, 0x08, 0x00, 0x07, 0x08, 0x07, 0x63, 0x00, 0x03,
+	0x03, 0x04, 0x61, 0x00, 0x04, 0x04, 0x34, 0x03, 0x4e, 0x59, 0x59, 0x40, 0x14, 0x1f, 0x1e, 0x2e,
+	0x2d, 0x2c, 0x2b, 0x25, 0x23, 0x1e, 0x2a, 0x1f, 0x29, 0x25, 0x25, 0x24, 0x24, 0x10, 0x0a, 0x09,
+	0x1b, 0x2b, 0x01, 0x23, 0x27, 0x23, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+	0x16, 0x17, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15,
+	0x07, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x35, 0x26, 0x26, 0x17, 0x23, 0x35,
+	0x33, 0x01, 0x21, 0x34, 0x02, 0x02, 0x17, 0x31, 0x17, 0x2c, 0x2c, 0x33, 0x3c, 0x13, 0x26, 0x0f,
+	0x20, 0x23, 0x1d, 0x29, 0x12, 0x17, 0x30, 0x21, 0x36, 0x35, 0x7a, 0x23, 0x1c, 0x18, 0x1a, 0x15,
+	0x2c, 0x0e, 0x0d, 0x21, 0x69, 0xf1, 0xf1, 0x01, 0x63, 0x1a, 0x0f, 0x10, 0x2b, 0x2b, 0x2c, 0x27,
+	0x03, 0x03, 0x16, 0x1b, 0x18, 0x04, 0x04, 0x31, 0x05, 0x05, 0x2f, 0x2f, 0x41, 0x12, 0x15, 0x15,
+	0x14, 0x0d, 0x09, 0x35, 0x03, 0x02, 0xdf, 0x32, 0x00, 0x03, 0x00, 0x33, 0x00, 0xff, 0x01, 0x44,
+	0x02, 0x7d, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x4e, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40,
+	0x1d, 0x00, 0x02, 0x00, 0x00, 0x05, 0x02, 0x00, 0x69, 0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01,
+	0x01, 0x34, 0x4d, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x33, 0x04, 0x4e, 0x1b, 0x40,
+	0x1a, 0x00, 0x02, 0x00, 0x00, 0x05, 0x02, 0x00, 0x69, 0x00, 0x05, 0x00, 0x04, 0x05, 0x04, 0x63,
+	0x00, 0x03, 0x03, 0x01, 0x61, 0x00, 0x01, 0x01, 0x34, 0x03, 0x4e, 0x59, 0x40, 0x09, 0x11, 0x12,
+	0x24, 0x24, 0x24, 0x22, 0x06, 0x09, 0x1c, 0x2b, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34,
+	0x36, 0x33, 0x32, 0x16, 0x07, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+	0x13, 0x21, 0x35, 0x21, 0x01, 0x44, 0x42, 0x46, 0x49, 0x40, 0x42, 0x47, 0x48, 0x40, 0xd8, 0x23,
+	0x2d, 0x2b, 0x24, 0x23, 0x2c, 0x2c, 0x24, 0xd1, 0xfe, 0xfb, 0x01, 0x05, 0x01, 0xed, 0x49, 0x46,
+	0x43, 0x4c, 0x4b, 0x45, 0x44, 0x4b, 0x34, 0x28, 0x2a, 0x32, 0x34, 0x28, 0x2a, 0xfe, 0xdf, 0x32,
+	0x00, 0x01, 0x00, 0x4d, 0x01, 0x02, 0x00, 0xdd, 0x01, 0x7f, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f,
+	0x11, 0x10, 0x02, 0x08, 0x18, 0x2b, 0x13, 0x23, 0x35, 0x33, 0xdd, 0x90, 0x90, 0x01, 0x02, 0x7d,
+	0xff, 0xff, 0x00, 0x61, 0x01, 0x02, 0x00, 0xf1, 0x01, 0x7f, 0x00, 0x06, 0x01, 0x49, 0x14, 0x00,
+	0xff, 0xff, 0x00, 0x27, 0xff, 0x89, 0x00, 0x7a, 0x00, 0x44, 0x01, 0x07, 0x01, 0x4e, 0xff, 0xf9,
+	0xfd, 0xd1, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0xfd, 0xd1, 0xb0, 0x35, 0x2b, 0x00, 0x00, 0x01,
+	0x00, 0x25, 0x01, 0xb8, 0x00, 0x78, 0x02, 0x73, 0x00, 0x06, 0x00, 0x19, 0x40, 0x16, 0x02, 0x01,
+	0x01, 0x01, 0x00, 0x61, 0x00, 0x00, 0x00, 0x22, 0x01, 0x4e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06,
+	0x23, 0x03, 0x08, 0x17, 0x2b, 0x13, 0x37, 0x36, 0x36, 0x33, 0x33, 0x07, 0x25, 0x19, 0x03, 0x13,
+	0x0f, 0x15, 0x05, 0x01, 0xb8, 0x9b, 0x10, 0x10, 0xbb, 0x00, 0x00, 0x01, 0x00, 0x25, 0x01, 0xb8,
+	0x00, 0x78, 0x02, 0x73, 0x00, 0x06, 0x00, 0x26, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1b, 0x00, 0x00,
+	0x01, 0x01, 0x00, 0x59, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x00, 0x01, 0x4f, 0x00,
+	0x00, 0x00, 0x06, 0x00, 0x06, 0x23, 0x03, 0x08, 0x17, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x37,
+	0x36, 0x36, 0x33, 0x33, 0x07, 0x25, 0x19, 0x03, 0x13, 0x0f, 0x15, 0x05, 0x01, 0xb8, 0x9b, 0x10,
+	0x10, 0xbb, 0x00, 0x01, 0x00, 0x2e, 0x01, 0xb8, 0x00, 0x81, 0x02, 0x73, 0x00, 0x06, 0x00, 0x19,
+	0x40, 0x16, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x01, 0x22, 0x00, 0x4e, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x06, 0x23, 0x03, 0x08, 0x17, 0x2b, 0x13, 0x07, 0x06, 0x06, 0x23, 0x23, 0x37,
+	0x81, 0x19, 0x03, 0x13, 0x0f, 0x15, 0x05, 0x02, 0x73, 0x9b, 0x10, 0x10, 0xbb, 0x00, 0xff, 0xff,
+	0x00, 0x27, 0xff, 0x89, 0x01, 0x19, 0x00, 0x44, 0x00, 0x27, 0x01, 0x4e, 0x00, 0x98, 0xfd, 0xd1,
+	0x01, 0x07, 0x01, 0x4e, 0xff, 0xf9, 0xfd, 0xd1, 0x00, 0x12, 0xb1, 0x00, 0x01, 0xb8, 0xfd, 0xd1,
+	0xb0, 0x35, 0x2b, 0xb1, 0x01, 0x01, 0xb8, 0xfd, 0xd1, 0xb0, 0x35, 0x2b, 0x00, 0x02, 0x00, 0x25,
+	0x01, 0xb8, 0x01, 0x17, 0x02, 0x73, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x24, 0x40, 0x21, 0x05, 0x03,
+	0x04, 0x03, 0x01, 0x01, 0x00, 0x61, 0x02, 0x01, 0x00, 0x00, 0x22, 0x01, 0x4e, 0x07, 0x07, 0x00,
+	0x00, 0x07, 0x0d, 0x07, 0x0d, 0x0c, 0x0a, 0x00, 0x06, 0x00, 0x06, 0x23, 0x06, 0x08, 0x17, 0x2b,
+	0x13, 0x37, 0x36, 0x36, 0x33, 0x33, 0x07, 0x33, 0x37, 0x36, 0x36, 0x33, 0x33, 0x07, 0x25, 0x19,
+	0x03, 0x13, 0x0f, 0x15, 0x05, 0x51, 0x19, 0x03, 0x13, 0x0f, 0x15, 0x05, 0x01, 0xb8, 0x9b, 0x10,
+	0x10, 0xbb, 0x9b, 0x10, 0x10, 0xbb, 0xff, 0xff, 0x00, 0x2e, 0x01, 0xb8, 0x01, 0x20, 0x02, 0x73,
+	0x00, 0x27, 0x01, 0x4e, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x06, 0x01, 0x4e, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x34, 0x01, 0x8f, 0x00, 0x73, 0x02, 0x73, 0x00, 0x03, 0x00, 0x13, 0x40, 0x10, 0x00, 0x01,
+	0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x22, 0x01, 0x4e, 0x11, 0x10, 0x02, 0x08, 0x18, 0x2b, 0x13,
+	0x33, 0x15, 0x23, 0x34, 0x3f, 0x3f, 0x02, 0x73, 0xe4, 0x00, 0x00, 0x02, 0x00, 0x34, 0x01, 0x8f,
+	0x01, 0x04, 0x02, 0x73, 0x00, 0x03, 0x00, 0x07, 0x00, 0x17, 0x40, 0x14, 0x03, 0x01, 0x01, 0x01,
+	0x00, 0x5f, 0x02, 0x01, 0x00, 0x00, 0x22, 0x01, 0x4e, 0x11, 0x11, 0x11, 0x10, 0x04, 0x08, 0x1a,
+	0x2b, 0x13, 0x33, 0x15, 0x23, 0x37, 0x33, 0x15, 0x23, 0x34, 0x3a, 0x3a, 0x96, 0x3a, 0x3a, 0x02,
+	0x73, 0xe4, 0xe4, 0xe4, 0x00, 0x02, 0x00, 0x23, 0x01, 0x6e, 0x01, 0x2f, 0x02, 0x7a, 0x00, 0x0b,
+	0x00, 0x17, 0x00, 0x2a, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1f, 0x00, 0x01, 0x00, 0x03, 0x02, 0x01,
+	0x03, 0x69, 0x00, 0x02, 0x00, 0x00, 0x02, 0x59, 0x00, 0x02, 0x02, 0x00, 0x61, 0x00, 0x00, 0x02,
+	0x00, 0x51, 0x24, 0x24, 0x24, 0x22, 0x04, 0x08, 0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x14,
+	0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x07, 0x14, 0x16, 0x33, 0x32, 0x36,
+	0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0x2f, 0x49, 0x3d, 0x3d, 0x49, 0x4a, 0x3c, 0x3c, 0x4a,
+	0xd5, 0x2b, 0x24, 0x24, 0x2b, 0x2b, 0x24, 0x24, 0x2b, 0x01, 0xf4, 0x3d, 0x49, 0x49, 0x3d, 0x3c,
+	0x4a, 0x4a, 0x3c, 0x25, 0x2c, 0x2c, 0x25, 0x25, 0x2c, 0x2c, 0x00, 0x02, 0x00, 0x1a, 0x00, 0x00,
+	0x02, 0x21, 0x02, 0x73, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x4e, 0x40, 0x4b, 0x11, 0x0f, 0x07, 0x03,
+	0x01, 0x06, 0x04, 0x02, 0x02, 0x03, 0x01, 0x02, 0x67, 0x0c, 0x01, 0x0a, 0x0a, 0x22, 0x4d, 0x0e,
+	0x08, 0x02, 0x00, 0x00, 0x09, 0x5f, 0x10, 0x0d, 0x0b, 0x03, 0x09, 0x09, 0x25, 0x4d, 0x05, 0x01,
+	0x03, 0x03, 0x23, 0x03, 0x4e, 0x1c, 0x1c, 0x00, 0x00, 0x1c, 0x1f, 0x1c, 0x1f, 0x1e, 0x1d, 0x00,
+	0x1b, 0x00, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x12, 0x08, 0x1f, 0x2b, 0x01, 0x15, 0x23, 0x07, 0x33, 0x15, 0x23, 0x07,
+	0x23, 0x37, 0x23, 0x07, 0x23, 0x37, 0x23, 0x35, 0x33, 0x37, 0x23, 0x35, 0x33, 0x37, 0x33, 0x07,
+	0x33, 0x37, 0x33, 0x07, 0x03, 0x37, 0x23, 0x07, 0x02, 0x21, 0x5e, 0x26, 0x61, 0x6a, 0x18, 0x3c,
+	0x17, 0xa9, 0x17, 0x3d, 0x18, 0x58, 0x62, 0x26, 0x65, 0x70, 0x15, 0x3c, 0x16, 0xa9, 0x16, 0x3c,
+	0x16, 0x6c, 0x26, 0xa8, 0x27, 0x01, 0xed, 0x39, 0xeb, 0x39, 0x90, 0x90, 0x90, 0x90, 0x39, 0xeb,
+	0x39, 0x86, 0x86, 0x86, 0x86, 0xfe, 0xdc, 0xeb, 0xeb, 0x00, 0x00, 0x05, 0x00, 0x1a, 0xff, 0xfc,
+	0x02, 0x65, 0x02, 0x78, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x33, 0x00, 0x7a,
+	0x4b, 0xb0, 0x2d, 0x50, 0x58, 0x40, 0x28, 0x00, 0x05, 0x00, 0x00, 0x07, 0x05, 0x00, 0x69, 0x00,
+	0x07, 0x00, 0x08, 0x09, 0x07, 0x08, 0x6a, 0x00, 0x04, 0x04, 0x01, 0x61, 0x0a, 0x03, 0x02, 0x01,
+	0x01, 0x22, 0x4d, 0x00, 0x09, 0x09, 0x02, 0x61, 0x06, 0x01, 0x02, 0x02, 0x23, 0x02, 0x4e, 0x1b,
+	0x40, 0x2c, 0x00, 0x05, 0x00, 0x00, 0x07, 0x05, 0x00, 0x69, 0x00, 0x07, 0x00, 0x08, 0x09, 0x07,
+	0x08, 0x6a, 0x0a, 0x01, 0x03, 0x03, 0x22, 0x4d, 0x00, 0x04, 0x04, 0x01, 0x61, 0x00, 0x01, 0x01,
+	0x22, 0x4d, 0x00, 0x09, 0x09, 0x02, 0x61, 0x06, 0x01, 0x02, 0x02, 0x23, 0x02, 0x4e, 0x59, 0x40,
+	0x18, 0x0c, 0x0c, 0x32, 0x30, 0x2c, 0x2a, 0x26, 0x24, 0x20, 0x1e, 0x1a, 0x18, 0x14, 0x12, 0x0c,
+	0x0f, 0x0c, 0x0f, 0x13, 0x24, 0x22, 0x0b, 0x08, 0x19, 0x2b, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26,
+	0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x37, 0x01, 0x23, 0x01, 0x07, 0x34, 0x26, 0x23, 0x22, 0x06,
+	0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
+	0x32, 0x16, 0x07, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x01, 0x14,
+	0x39, 0x44, 0x44, 0x39, 0x39, 0x44, 0x44, 0x39, 0xdf, 0xfe, 0xd4, 0x3d, 0x01, 0x2c, 0xdd, 0x1d,
+	0x25, 0x24, 0x1d, 0x1d, 0x24, 0x25, 0x1d, 0x01, 0x8c, 0x38, 0x44, 0x44, 0x39, 0x39, 0x44, 0x43,
+	0x39, 0x3b, 0x1d, 0x24, 0x25, 0x1d, 0x1d, 0x25, 0x24, 0x1d, 0x01, 0xdc, 0x54, 0x48, 0x48, 0x54,
+	0x55, 0x47, 0x47, 0x42, 0xfd, 0x8d, 0x02, 0x73, 0x97, 0x3b, 0x2f, 0x2f, 0x3b, 0x3a, 0x2e, 0x2e,
+	0xfe, 0xf6, 0x55, 0x47, 0x47, 0x55, 0x55, 0x47, 0x47, 0x55, 0x3b, 0x2f, 0x2f, 0x3b, 0x3a, 0x2e,
+	0x2e, 0x00, 0x00, 0x07, 0x00, 0x1a, 0xff, 0xfc, 0x03, 0x8c, 0x02, 0x78, 0x00, 0x0b, 0x00, 0x0f,
+	0x00, 0x1b, 0x00, 0x27, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x8a, 0x4b, 0xb0, 0x2d, 0x50,
+	0x58, 0x40, 0x2c, 0x00, 0x05, 0x00, 0x00, 0x07, 0x05, 0x00, 0x69, 0x09, 0x01, 0x07, 0x0c, 0x01,
+	0x0a, 0x0b, 0x07, 0x0a, 0x6a, 0x00, 0x04, 0x04, 0x01, 0x61, 0x0e, 0x03, 0x02, 0x01, 0x01, 0x22,
+	0x4d, 0x0d, 0x01, 0x0b, 0x0b, 0x02, 0x61, 0x08, 0x06, 0x02, 0x02, 0x02, 0x23, 0x02, 0x4e, 0x1b,
+	0x40, 0x30, 0x00, 0x05, 0x00, 0x00, 0x07, 0x05, 0x00, 0x69, 0x09, 0x01, 0x07, 0x0c, 0x01, 0x0a,
+	0x0b, 0x07, 0x0a, 0x6a, 0x0e, 0x01, 0x03, 0x03, 0x22, 0x4d, 0x00, 0x04, 0x04, 0x01, 0x61, 0x00,
+	0x01, 0x01, 0x22, 0x4d, 0x0d, 0x01, 0x0b, 0x0b, 0x02, 0x61, 0x08, 0x06, 0x02, 0x02, 0x02, 0x23,
+	0x02, 0x4e, 0x59, 0x40, 0x20, 0x0c, 0x0c, 0x4a, 0x48, 0x44, 0x42, 0x3e, 0x3c, 0x38, 0x36, 0x32,
+	0x30, 0x2c, 0x2a, 0x26, 0x24, 0x20, 0x1e, 0x1a, 0x18, 0x14, 0x12, 0x0c, 0x0f, 0x0c, 0x0f, 0x13,
+	0x24, 0x22, 0x0f, 0x08, 0x19, 0x2b, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
+	0x32, 0x16, 0x37, 0x01, 0x23, 0x01, 0x07, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33,
+	0x32, 0x36, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x05, 0x14,
+	0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x05, 0x34, 0x26, 0x23, 0x22, 0x06,
+	0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x25, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33,
+	0x32, 0x36, 0x01, 0x13, 0x39, 0x43, 0x44, 0x39, 0x39, 0x44, 0x44, 0x38, 0xdf, 0xfe, 0xd4, 0x3d,
+	0x01, 0x2c, 0xdd, 0x1d, 0x24, 0x25, 0x1d, 0x1d, 0x25, 0x24, 0x1d, 0x01, 0x8d, 0x39, 0x44, 0x44,
+	0x39, 0x39, 0x44, 0x44, 0x39, 0x01, 0x27, 0x39, 0x44, 0x44, 0x39, 0x39, 0x44, 0x44, 0x39, 0xfe,
+	0x9d, 0x1d, 0x24, 0x24, 0x1d, 0x1d, 0x24, 0x24, 0x1d, 0x01, 0x28, 0x1d, 0x25, 0x24, 0x1d, 0x1d,
+	0x24, 0x25, 0x1d, 0x01, 0xdc, 0x55, 0x47, 0x47, 0x55, 0x55, 0x47, 0x47, 0x42, 0xfd, 0x8d, 0x02,
+	0x73, 0x97, 0x3b, 0x2f, 0x2f, 0x3b, 0x3a, 0x2e, 0x2e, 0xfe, 0xf6, 0x55, 0x47, 0x47, 0x55, 0x54,
+	0x48, 0x48, 0x54, 0x55, 0x47, 0x47, 0x55, 0x54, 0x48, 0x48, 0x54, 0x3b, 0x2f, 0x2f, 0x3b, 0x3a,
+	0x2e, 0x2e, 0x3a, 0x3b, 0x2f, 0x2f, 0x3b, 0x3a, 0x2e, 0x2e, 0x00, 0x01, 0x00, 0x2a, 0xff, 0xea,
+	0x01, 0x9a, 0x02, 0x97, 0x00, 0x1f, 0x00, 0x60, 0x40, 0x11, 0x0f, 0x09, 0x02, 0x04, 0x03, 0x1c,
+	0x10, 0x02, 0x05, 0x04, 0x1d, 0x00, 0x02, 0x01, 0x05, 0x03, 0x4c, 0x4b, 0xb0, 0x17, 0x50, 0x58,
+	0x40, 0x1b, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04, 0x6a, 0x00, 0x05, 0x00, 0x01, 0x00, 0x05,
+	0x01, 0x69, 0x00, 0x02, 0x02, 0x24, 0x4d, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x1b, 0x40, 0x1b,
+	0x00, 0x00, 0x01, 0x00, 0x86, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04, 0x6a, 0x00, 0x05, 0x00,
+	0x01, 0x00, 0x05, 0x01, 0x69, 0x00, 0x02, 0x02, 0x24, 0x02, 0x4e, 0x59, 0x40, 0x09, 0x24, 0x33,
+	0x21, 0x16, 0x11, 0x11, 0x06, 0x08, 0x1c, 0x2b, 0x25, 0x15, 0x23, 0x35, 0x26, 0x26, 0x35, 0x34,
+	0x36, 0x37, 0x35, 0x33, 0x15, 0x16, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14,
+	0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x01, 0x26, 0x47, 0x64, 0x51, 0x54, 0x61, 0x47,
+	0x1d, 0x2e, 0x1c, 0x25, 0x2f, 0x1d, 0x5e, 0x42, 0x34, 0x4a, 0x29, 0x58, 0x1f, 0x10, 0x3f, 0x46,
+	0x5c, 0x58, 0x02, 0x73, 0x8b, 0x7b, 0x76, 0x0c, 0x58, 0x55, 0x01, 0x03, 0x04, 0x49, 0x05, 0x02,
+	0x4d, 0x69, 0x69, 0x4b, 0x11, 0x0d, 0x45, 0x0a, 0x12, 0x00, 0x00, 0x02, 0x00, 0x2b, 0x00, 0x27,
+	0x02, 0x53, 0x02, 0x50, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x4a, 0x40, 0x47, 0x13, 0x11, 0x0b, 0x09,
+	0x04, 0x02, 0x00, 0x1a, 0x14, 0x08, 0x02, 0x04, 0x03, 0x02, 0x23, 0x1d, 0x1b, 0x01, 0x04, 0x01,
+	0x03, 0x03, 0x4c, 0x12, 0x0a, 0x02, 0x00, 0x4a, 0x1c, 0x01, 0x01, 0x49, 0x00, 0x00, 0x04, 0x01,
+	0x02, 0x03, 0x00, 0x02, 0x69, 0x00, 0x03, 0x01, 0x01, 0x03, 0x59, 0x00, 0x03, 0x03, 0x01, 0x61,
+	0x00, 0x01, 0x03, 0x01, 0x51, 0x25, 0x24, 0x2b, 0x29, 0x24, 0x2f, 0x25, 0x2f, 0x21, 0x1f, 0x2d,
+	0x05, 0x08, 0x17, 0x2b, 0x37, 0x27, 0x37, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x27, 0x37, 0x17,
+	0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x37, 0x17, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07, 0x17,
+	0x07, 0x27, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x13, 0x22, 0x06, 0x15, 0x14, 0x16, 0x37, 0x16,
+	0x36, 0x35, 0x34, 0x26, 0x5f, 0x34, 0x42, 0x19, 0x1a, 0x1a, 0x19, 0x42, 0x34, 0x42, 0x20, 0x50,
+	0x2c, 0x2d, 0x50, 0x22, 0x42, 0x34, 0x42, 0x19, 0x1b, 0x1a, 0x19, 0x42, 0x34, 0x42, 0x21, 0x51,
+	0x2c, 0x2c, 0x50, 0x21, 0x9c, 0x50, 0x68, 0x69, 0x50, 0x51, 0x68, 0x69, 0x27, 0x34, 0x42, 0x21,
+	0x52, 0x2c, 0x2c, 0x50, 0x22, 0x41, 0x35, 0x42, 0x18, 0x19, 0x19, 0x19, 0x43, 0x34, 0x41, 0x22,
+	0x51, 0x2d, 0x2b, 0x50, 0x22, 0x42, 0x34, 0x42, 0x18, 0x1a, 0x19, 0x19, 0x01, 0x8d, 0x69, 0x51,
+	0x52, 0x69, 0x01, 0x01, 0x69, 0x52, 0x51, 0x68, 0x00, 0x01, 0x00, 0x27, 0xff, 0xa1, 0x01, 0xc3,
+	0x02, 0xd2, 0x00, 0x2d, 0x00, 0xc0, 0x40, 0x14, 0x1d, 0x17, 0x02, 0x05, 0x04, 0x1e, 0x07, 0x02,
+	0x02, 0x05, 0x06, 0x01, 0x01, 0x02, 0x00, 0x01, 0x00, 0x01, 0x04, 0x4c, 0x4b, 0xb0, 0x0d, 0x50,
+	0x58, 0x40, 0x21, 0x00, 0x03, 0x04, 0x04, 0x03, 0x70, 0x00, 0x00, 0x01, 0x01, 0x00, 0x71, 0x00,
+	0x05, 0x05, 0x04, 0x61, 0x00, 0x04, 0x04, 0x28, 0x4d, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01,
+	0x01, 0x29, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x20, 0x00, 0x03, 0x04, 0x04,
+	0x03, 0x70, 0x00, 0x00, 0x01, 0x00, 0x86, 0x00, 0x05, 0x05, 0x04, 0x61, 0x00, 0x04, 0x04, 0x28,
+	0x4d, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x0f,
+	0x50, 0x58, 0x40, 0x21, 0x00, 0x03, 0x04, 0x04, 0x03, 0x70, 0x00, 0x00, 0x01, 0x01, 0x00, 0x71,
+	0x00, 0x05, 0x05, 0x04, 0x61, 0x00, 0x04, 0x04, 0x28, 0x4d, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00,
+	0x01, 0x01, 0x29, 0x01, 0x4e, 0x1b, 0x40, 0x1f, 0x00, 0x03, 0x04, 0x03, 0x85, 0x00, 0x00, 0x01,
+	0x00, 0x86, 0x00, 0x05, 0x05, 0x04, 0x61, 0x00, 0x04, 0x04, 0x28, 0x4d, 0x00, 0x02, 0x02, 0x01,
+	0x61, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4e, 0x59, 0x59, 0x59, 0x40, 0x09, 0x25, 0x11, 0x1d, 0x25,
+	0x11, 0x11, 0x06, 0x08, 0x1c, 0x2b, 0x05, 0x15, 0x23, 0x35, 0x26, 0x26, 0x27, 0x35, 0x16, 0x16,
+	0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x27, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x35, 0x33,
+	0x15, 0x16, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x17, 0x17, 0x16,
+	0x16, 0x15, 0x14, 0x06, 0x01, 0x12, 0x48, 0x30, 0x58, 0x1b, 0x33, 0x62, 0x31, 0x45, 0x39, 0x1d,
+	0x2d, 0x83, 0x41, 0x36, 0x50, 0x53, 0x48, 0x25, 0x3f, 0x1f, 0x37, 0x40, 0x22, 0x44, 0x3d, 0x1d,
+	0x23, 0x83, 0x54, 0x31, 0x56, 0x07, 0x58, 0x58, 0x02, 0x0f, 0x0b, 0x50, 0x0f, 0x0e, 0x2e, 0x3d,
+	0x26, 0x23, 0x0c, 0x24, 0x12, 0x45, 0x3e, 0x55, 0x5a, 0x0a, 0x58, 0x55, 0x01, 0x09, 0x08, 0x4d,
+	0x0b, 0x07, 0x31, 0x38, 0x21, 0x23, 0x0a, 0x24, 0x18, 0x43, 0x45, 0x5b, 0x59, 0x00, 0x00, 0x01,
+	0x00, 0x1f, 0xff, 0xf8, 0x02, 0x06, 0x02, 0x7d, 0x00, 0x2d, 0x00, 0x57, 0x40, 0x54, 0x0f, 0x01,
+	0x03, 0x02, 0x10, 0x01, 0x01, 0x03, 0x26, 0x01, 0x08, 0x07, 0x27, 0x01, 0x09, 0x08, 0x04, 0x4c,
+	0x07, 0x01, 0x05, 0x01, 0x4b, 0x04, 0x01, 0x01, 0x00, 0x05, 0x00, 0x01, 0x05, 0x67, 0x06, 0x01,
+	0x00, 0x0b, 0x0a, 0x02, 0x07, 0x08, 0x00, 0x07, 0x68, 0x00, 0x03, 0x03, 0x02, 0x61, 0x00, 0x02,
+	0x02, 0x28, 0x4d, 0x00, 0x08, 0x08, 0x09, 0x61, 0x00, 0x09, 0x09, 0x29, 0x09, 0x4e, 0x00, 0x00,
+	0x00, 0x2d, 0x00, 0x2d, 0x2b, 0x29, 0x22, 0x11, 0x14, 0x11, 0x12, 0x34, 0x22, 0x16, 0x11, 0x0c,
+	0x08, 0x1f, 0x2b, 0x37, 0x35, 0x33, 0x35, 0x34, 0x34, 0x37, 0x23, 0x35, 0x33, 0x36, 0x36, 0x33,
+	0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x21, 0x15, 0x21, 0x06, 0x14, 0x15,
+	0x15, 0x21, 0x15, 0x21, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22, 0x26,
+	0x27, 0x1f, 0x4e, 0x01, 0x4f, 0x54, 0x10, 0x7b, 0x7b, 0x22, 0x41, 0x1c, 0x27, 0x3d, 0x1b, 0x57,
+	0x4c, 0x0b, 0x01, 0x07, 0xfe, 0xf4, 0x01, 0x01, 0x0d, 0xfe, 0xf7, 0x09, 0x47, 0x56, 0x23, 0x50,
+	0x24, 0x26, 0x54, 0x31, 0x72, 0x6c, 0x0c, 0xdf, 0x3f, 0x1d, 0x10, 0x0f, 0x06, 0x3f, 0x75, 0x69,
+	0x06, 0x06, 0x4a, 0x05, 0x04, 0x41, 0x50, 0x3f, 0x06, 0x0f, 0x10, 0x1d, 0x3f, 0x55, 0x42, 0x13,
+	0x10, 0x4c, 0x14, 0x13, 0x6b, 0x7c, 0x00, 0x01, 0x00, 0x25, 0xff, 0x68, 0x01, 0x90, 0x02, 0x7c,
+	0x00, 0x17, 0x00, 0x31, 0x40, 0x2e, 0x0a, 0x01, 0x03, 0x02, 0x0b, 0x01, 0x01, 0x03, 0x02, 0x4c,
+	0x04, 0x01, 0x01, 0x05, 0x01, 0x00, 0x06, 0x01, 0x00, 0x67, 0x00, 0x03, 0x03, 0x02, 0x61, 0x00,
+	0x02, 0x02, 0x28, 0x4d, 0x00, 0x06, 0x06, 0x27, 0x06, 0x4e, 0x11, 0x11, 0x13, 0x25, 0x23, 0x11,
+	0x10, 0x07, 0x08, 0x1d, 0x2b, 0x13, 0x23, 0x35, 0x33, 0x37, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17,
+	0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x07, 0x33, 0x15, 0x23, 0x03, 0x23, 0x6f, 0x4a, 0x55,
+	0x10, 0x0f, 0x4e, 0x52, 0x0c, 0x2b, 0x20, 0x0d, 0x2a, 0x15, 0x31, 0x2b, 0x0a, 0x0e, 0xa7, 0xb2,
+	0x4a, 0x55, 0x01, 0x2f, 0x48, 0x62, 0x5e, 0x45, 0x04, 0x04, 0x49, 0x03, 0x03, 0x27, 0x3e, 0x55,
+	0x48, 0xfe, 0x39, 0x00, 0x00, 0x01, 0x00, 0x29, 0x00, 0x00, 0x02, 0x15, 0x02, 0x73, 0x00, 0x1b,
+	0x00, 0x3a, 0x40, 0x37, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x06, 0x05, 0x04, 0x03, 0x02,
+	0x0c, 0x02, 0x00, 0x1b, 0x10, 0x01, 0x00, 0x04, 0x01, 0x02, 0x02, 0x4c, 0x00, 0x02, 0x00, 0x01,
+	0x00, 0x02, 0x01, 0x80, 0x00, 0x00, 0x00, 0x22, 0x4d, 0x00, 0x01, 0x01, 0x03, 0x60, 0x00, 0x03,
+	0x03, 0x23, 0x03, 0x4e, 0x22, 0x12, 0x29, 0x17, 0x04, 0x08, 0x1a, 0x2b, 0x37, 0x35, 0x37, 0x35,
+	0x07, 0x35, 0x37, 0x35, 0x33, 0x15, 0x37, 0x15, 0x07, 0x15, 0x37, 0x15, 0x07, 0x15, 0x33, 0x32,
+	0x36, 0x35, 0x33, 0x14, 0x06, 0x23, 0x23, 0x35, 0x29, 0x46, 0x46, 0x46, 0x55, 0xe3, 0xe3, 0xe3,
+	0xe3, 0x52, 0x5b, 0x4f, 0x55, 0x7f, 0x80, 0xa7, 0xc6, 0x41, 0x16, 0x45, 0x16, 0x41, 0x16, 0xd0,
+	0xb6, 0x47, 0x41, 0x47, 0x45, 0x46, 0x41, 0x46, 0xa6, 0x5a, 0x68, 0x8a, 0x88, 0xdc, 0x00, 0x01,
+	0x00, 0x23, 0x00, 0x00, 0x01, 0xcd, 0x02, 0x7d, 0x00, 0x21, 0x00, 0x42, 0x40, 0x3f, 0x09, 0x01,
+	0x02, 0x01, 0x0a, 0x01, 0x00, 0x02, 0x02, 0x4c, 0x1d, 0x01, 0x05, 0x01, 0x4b, 0x03, 0x01, 0x00,
+	0x08, 0x07, 0x02, 0x04, 0x05, 0x00, 0x04, 0x67, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01,
+	0x28, 0x4d, 0x00, 0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x23, 0x06, 0x4e, 0x00, 0x00, 0x00,
+	0x21, 0x00, 0x21, 0x11, 0x24, 0x11, 0x13, 0x25, 0x23, 0x11, 0x09, 0x08, 0x1d, 0x2b, 0x13, 0x35,
+	0x33, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x15,
+	0x33, 0x15, 0x23, 0x15, 0x14, 0x06, 0x07, 0x15, 0x21, 0x15, 0x21, 0x35, 0x36, 0x36, 0x35, 0x35,
+	0x23, 0x4e, 0x5f, 0x5e, 0x21, 0x3d, 0x31, 0x21, 0x41, 0x21, 0x3d, 0x37, 0xd5, 0xd5, 0x25, 0x27,
+	0x01, 0x53, 0xfe, 0x56, 0x27, 0x27, 0x01, 0x0a, 0x48, 0x74, 0x5b, 0x5c, 0x07, 0x0b, 0x4a, 0x08,
+	0x07, 0x38, 0x3d, 0x69, 0x48, 0x28, 0x37, 0x45, 0x13, 0x03, 0x50, 0x51, 0x15, 0x4a, 0x32, 0x28,
+	0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x02, 0x0c, 0x02, 0x73, 0x00, 0x16, 0x00, 0x3e, 0x40, 0x3b,
+	0x09, 0x01, 0x02, 0x03, 0x01, 0x4c, 0x05, 0x01, 0x02, 0x06, 0x01, 0x01, 0x00, 0x02, 0x01, 0x68,
+	0x07, 0x01, 0x00, 0x0b, 0x0a, 0x02, 0x08, 0x09, 0x00, 0x08, 0x67, 0x04, 0x01, 0x03, 0x03, 0x22,
+	0x4d, 0x00, 0x09, 0x09, 0x23, 0x09, 0x4e, 0x00, 0x00, 0x00, 0x16, 0x00, 0x16, 0x15, 0x14, 0x11,
+	0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x08, 0x1f, 0x2b, 0x37, 0x35, 0x33, 0x35,
+	0x23, 0x35, 0x33, 0x03, 0x33, 0x13, 0x13, 0x33, 0x03, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23,
+	0x15, 0x23, 0x35, 0x3d, 0xab, 0xab, 0x90, 0xbb, 0x61, 0xa0, 0xa0, 0x59, 0xb5, 0x91, 0xac, 0xac,
+	0xac, 0x54, 0x6b, 0x3f, 0x3c, 0x3f, 0x01, 0x4e, 0xfe, 0xcc, 0x01, 0x34, 0xfe, 0xb2, 0x3f, 0x3c,
+	0x3f, 0x6b, 0x6b, 0x00, 0x00, 0x02, 0x00, 0x16, 0x00, 0x00, 0x02, 0x4e, 0x02, 0x73, 0x00, 0x05,
+	0x00, 0x08, 0x00, 0x43, 0xb5, 0x04, 0x01, 0x02, 0x02, 0x01, 0x4b, 0x4b, 0xb0, 0x1a, 0x50, 0x58,
+	0x40, 0x11, 0x00, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x03, 0x01, 0x01, 0x01,
+	0x15, 0x01, 0x4e, 0x1b, 0x40, 0x11, 0x00, 0x00, 0x02, 0x00, 0x85, 0x00, 0x02, 0x02, 0x01, 0x5f,
+	0x03, 0x01, 0x01, 0x01, 0x15, 0x01, 0x4e, 0x59, 0x40, 0x0c, 0x00, 0x00, 0x08, 0x07, 0x00, 0x05,
+	0x00, 0x05, 0x12, 0x04, 0x07, 0x17, 0x2b, 0x33, 0x35, 0x13, 0x33, 0x13, 0x15, 0x01, 0x03, 0x21,
+	0x16, 0xf0, 0x58, 0xf0, 0xfe, 0xe4, 0xc7, 0x01, 0x8e, 0x50, 0x02, 0x23, 0xfd, 0xdd, 0x50, 0x02,
+	0x17, 0xfe, 0x39, 0x00, 0xff, 0xff, 0x00, 0x15, 0x00, 0x00, 0x02, 0x4d, 0x02, 0x73, 0x00, 0x06,
+	0x01, 0x60, 0xff, 0x00, 0x00, 0x01, 0x00, 0x28, 0x00, 0x00, 0x02, 0x89, 0x02, 0x87, 0x00, 0x21,
+	0x00, 0x32, 0x40, 0x2f, 0x20, 0x14, 0x0f, 0x03, 0x04, 0x00, 0x04, 0x01, 0x4c, 0x00, 0x04, 0x04,
+	0x01, 0x61, 0x00, 0x01, 0x01, 0x14, 0x4d, 0x02, 0x01, 0x00, 0x00, 0x03, 0x5f, 0x06, 0x05, 0x02,
+	0x03, 0x03, 0x15, 0x03, 0x4e, 0x00, 0x00, 0x00, 0x21, 0x00, 0x21, 0x26, 0x11, 0x16, 0x26, 0x11,
+	0x07, 0x07, 0x1b, 0x2b, 0x33, 0x35, 0x33, 0x35, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
+	0x15, 0x14, 0x06, 0x07, 0x15, 0x33, 0x15, 0x23, 0x35, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
+	0x06, 0x15, 0x14, 0x16, 0x17, 0x15, 0x46, 0x8e, 0x53, 0x59, 0xa1, 0x90, 0x90, 0xa0, 0x59, 0x52,
+	0x8e, 0xdd, 0x4e, 0x52, 0x6f, 0x67, 0x68, 0x6f, 0x53, 0x4e, 0x50, 0x3a, 0x1a, 0x7b, 0x5b, 0x7d,
+	0x90, 0x8f, 0x7e, 0x59, 0x7c, 0x1b, 0x3a, 0x50, 0xba, 0x11, 0x60, 0x4c, 0x59, 0x60, 0x60, 0x59,
+	0x4c, 0x61, 0x10, 0xba, 0xff, 0xff, 0x00, 0x28, 0x00, 0x00, 0x02, 0x89, 0x02, 0x87, 0x00, 0x06,
+	0x01, 0x62, 0x00, 0x00, 0x00, 0x01, 0x00, 0x42, 0xff, 0x68, 0x01, 0xe2, 0x01, 0xee, 0x00, 0x1a,
+	0x00, 0x3d, 0x40, 0x3a, 0x13, 0x01, 0x03, 0x02, 0x18, 0x03, 0x02, 0x05, 0x03, 0x02, 0x4c, 0x04,
+	0x01, 0x02, 0x02, 0x16, 0x4d, 0x00, 0x05, 0x05, 0x15, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x61, 0x06,
+	0x01, 0x00, 0x00, 0x15, 0x4d, 0x00, 0x01, 0x01, 0x18, 0x01, 0x4e, 0x01, 0x00, 0x17, 0x16, 0x15,
+	0x14, 0x11, 0x0f, 0x0c, 0x0b, 0x07, 0x06, 0x00, 0x1a, 0x01, 0x1a, 0x07, 0x07, 0x16, 0x2b, 0x17,
+	0x22, 0x26, 0x27, 0x14, 0x16, 0x17, 0x23, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x33,
+	0x32, 0x36, 0x37, 0x11, 0x33, 0x11, 0x23, 0x27, 0x06, 0x06, 0xeb, 0x24, 0x2c, 0x07, 0x0d, 0x0f,
+	0x54, 0x0e, 0x0c, 0x52, 0x30, 0x39, 0x23, 0x4c, 0x24, 0x52, 0x4b, 0x04, 0x2e, 0x52, 0x08, 0x14,
+	0x14, 0x46, 0x51, 0x21, 0x23, 0x56, 0x5b, 0x01, 0xb2, 0xfe, 0xb8, 0x34, 0x2d, 0x13, 0x12, 0x01,
+	0x84, 0xfe, 0x12, 0x2b, 0x1a, 0x19, 0xff, 0xff, 0x00, 0x42, 0xff, 0x68, 0x01, 0xe2, 0x01, 0xee,
+	0x00, 0x06, 0x01, 0x64, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x02, 0x31, 0x01, 0xee,
+	0x00, 0x17, 0x00, 0x25, 0x40, 0x22, 0x06, 0x03, 0x02, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02, 0x02,
+	0x16, 0x4d, 0x00, 0x04, 0x04, 0x00, 0x61, 0x05, 0x01, 0x00, 0x00, 0x15, 0x00, 0x4e, 0x13, 0x21,
+	0x23, 0x11, 0x11, 0x13, 0x10, 0x07, 0x07, 0x1d, 0x2b, 0x33, 0x23, 0x36, 0x36, 0x27, 0x23, 0x35,
+	0x21, 0x15, 0x23, 0x11, 0x14, 0x16, 0x33, 0x33, 0x15, 0x23, 0x22, 0x26, 0x35, 0x11, 0x23, 0x16,
+	0x06, 0x8b, 0x5c, 0x2b, 0x2e, 0x03, 0x6c, 0x02, 0x18, 0x6f, 0x2a, 0x2a, 0x0d, 0x24, 0x43, 0x4c,
+	0x9a, 0x02, 0x27, 0x5f, 0xde, 0x64, 0x4d, 0x4d, 0xfe, 0xfe, 0x29, 0x28, 0x4e, 0x4c, 0x44, 0x01,
+	0x11, 0x70, 0xd7, 0x00, 0x00, 0x02, 0x00, 0x1b, 0xff, 0xf6, 0x01, 0xfa, 0x02, 0xa2, 0x00, 0x19,
+	0x00, 0x25, 0x00, 0x45, 0x40, 0x42, 0x08, 0x01, 0x00, 0x01, 0x07, 0x01, 0x03, 0x00, 0x00, 0x01,
+	0x04, 0x03, 0x23, 0x01, 0x05, 0x04, 0x04, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x69,
+	0x00, 0x03, 0x06, 0x01, 0x04, 0x05, 0x03, 0x04, 0x69, 0x00, 0x05, 0x02, 0x02, 0x05, 0x59, 0x00,
+	0x05, 0x05, 0x02, 0x61, 0x00, 0x02, 0x05, 0x02, 0x51, 0x1b, 0x1a, 0x21, 0x1f, 0x1a, 0x25, 0x1b,
+	0x25, 0x24, 0x24, 0x25, 0x23, 0x07, 0x06, 0x1a, 0x2b, 0x01, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+	0x07, 0x35, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36,
+	0x33, 0x32, 0x16, 0x07, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x26, 0x26, 0x01,
+	0xaa, 0x45, 0x5d, 0x26, 0x48, 0x23, 0x27, 0x4b, 0x2c, 0x7e, 0x67, 0x91, 0x8b, 0x5e, 0x65, 0x77,
+	0x6b, 0x34, 0x51, 0x7b, 0x4a, 0x4f, 0x41, 0x3f, 0x4c, 0x5c, 0x0e, 0x27, 0x49, 0x01, 0x89, 0x20,
+	0x67, 0x4c, 0x09, 0x09, 0x46, 0x09, 0x09, 0x71, 0x87, 0xcf, 0xe5, 0x6a, 0x60, 0x72, 0x80, 0x13,
+	0x35, 0x55, 0x4d, 0x3f, 0x41, 0x7e, 0x79, 0x17, 0x14, 0x00, 0x00, 0x01, 0x00, 0x13, 0xff, 0x68,
+	0x02, 0x45, 0x02, 0x73, 0x00, 0x0b, 0x00, 0x2a, 0x40, 0x27, 0x04, 0x01, 0x00, 0x01, 0x00, 0x86,
+	0x00, 0x02, 0x01, 0x01, 0x02, 0x57, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x06, 0x05, 0x03, 0x03, 0x01,
+	0x02, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x07, 0x06,
+	0x1b, 0x2b, 0x13, 0x11, 0x23, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x23, 0x11, 0xc6, 0x55,
+	0x5e, 0x02, 0x32, 0x5e, 0x55, 0x02, 0x23, 0xfd, 0x45, 0x02, 0xbb, 0x50, 0x50, 0xfd, 0x45, 0x02,
+	0xbb, 0x00, 0x00, 0x01, 0x00, 0x14, 0xff, 0x68, 0x01, 0xf6, 0x02, 0x73, 0x00, 0x0b, 0x00, 0x37,
+	0x40, 0x34, 0x08, 0x02, 0x02, 0x02, 0x01, 0x01, 0x4c, 0x03, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+	0x4b, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x67, 0x00, 0x02, 0x03, 0x03, 0x02, 0x57, 0x00,
+	0x02, 0x02, 0x03, 0x5f, 0x04, 0x01, 0x03, 0x02, 0x03, 0x4f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b,
+	0x12, 0x11, 0x14, 0x05, 0x06, 0x19, 0x2b, 0x17, 0x35, 0x01, 0x03, 0x35, 0x21, 0x15, 0x21, 0x13,
+	0x01, 0x21, 0x15, 0x14, 0x01, 0x0e, 0xf5, 0x01, 0xb5, 0xfe, 0xbd, 0xef, 0xfe, 0xf6, 0x01, 0x72,
+	0x98, 0x50, 0x01, 0x36, 0x01, 0x35, 0x50, 0x50, 0xfe, 0xca, 0xfe, 0xcb, 0x50, 0x00, 0x00, 0x01,
+	0x00, 0x25, 0x00, 0x6e, 0x01, 0xcf, 0x02, 0x14, 0x00, 0x0b, 0x00, 0x2c, 0x40, 0x29, 0x00, 0x04,
+	0x03, 0x01, 0x04, 0x57, 0x06, 0x05, 0x02, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00, 0x67, 0x00,
+	0x04, 0x04, 0x01, 0x5f, 0x00, 0x01, 0x04, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0b, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x07, 0x08, 0x1b, 0x2b, 0x01, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35,
+	0x33, 0x35, 0x33, 0x15, 0x01, 0xcf, 0xac, 0x50, 0xae, 0xae, 0x50, 0x01, 0x69, 0x4e, 0xad, 0xad,
+	0x4e, 0xab, 0xab, 0x00, 0x00, 0x02, 0x00, 0x25, 0x00, 0x3d, 0x01, 0xcf, 0x02, 0x59, 0x00, 0x0b,
+	0x00, 0x0f, 0x00, 0x3e, 0x40, 0x3b, 0x08, 0x05, 0x02, 0x03, 0x02, 0x01, 0x00, 0x01, 0x03, 0x00,
+	0x67, 0x00, 0x04, 0x00, 0x01, 0x07, 0x04, 0x01, 0x67, 0x09, 0x01, 0x07, 0x06, 0x06, 0x07, 0x57,
+	0x09, 0x01, 0x07, 0x07, 0x06, 0x5f, 0x00, 0x06, 0x07, 0x06, 0x4f, 0x0c, 0x0c, 0x00, 0x00, 0x0c,
+	0x0f, 0x0c, 0x0f, 0x0e, 0x0d, 0x00, 0x0b, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x08,
+	0x1b, 0x2b, 0x01, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x13, 0x15,
+	0x21, 0x35, 0x01, 0xcf, 0xad, 0x50, 0xad, 0xad, 0x50, 0xad, 0xfe, 0x56, 0x01, 0xc2, 0x4e, 0x99,
+	0x99, 0x4e, 0x97, 0x97, 0xfe, 0xc9, 0x4e, 0x4e, 0x00, 0x01, 0x00, 0x25, 0x01, 0x1b, 0x01, 0xcf,
+	0x01, 0x69, 0x00, 0x03, 0x00, 0x1f, 0x40, 0x1c, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x57, 0x02,
+	0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03,
+	0x11, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x15, 0x21, 0x35, 0x01, 0xcf, 0xfe, 0x56, 0x01, 0x69, 0x4e,
+	0x4e, 0x00, 0xff, 0xff, 0x00, 0x25, 0x00, 0x5a, 0x01, 0xcf, 0x02, 0x27, 0x02, 0x26, 0x01, 0x6c,
+	0x00, 0x00, 0x00, 0x27, 0x01, 0x31, 0x00, 0xa7, 0x00, 0x5a, 0x01, 0x07, 0x01, 0x31, 0x00, 0xa7,
+	0x01, 0xd4, 0x00, 0x11, 0xb1, 0x01, 0x01, 0xb0, 0x5a, 0xb0, 0x35, 0x2b, 0xb1, 0x02, 0x01, 0xb8,
+	0x01, 0xd4, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x25, 0x00, 0xa8, 0x01, 0xcf, 0x01, 0xc8,
+	0x00, 0x26, 0x01, 0x6c, 0x00, 0x8d, 0x01, 0x06, 0x01, 0x6c, 0x00, 0x5f, 0x00, 0x11, 0xb1, 0x00,
+	0x01, 0xb8, 0xff, 0x8d, 0xb0, 0x35, 0x2b, 0xb1, 0x01, 0x01, 0xb0, 0x5f, 0xb0, 0x35, 0x2b, 0x00,
+	0x00, 0x01, 0x00, 0x25, 0x00, 0x39, 0x01, 0xcf, 0x02, 0x37, 0x00, 0x13, 0x00, 0x72, 0x4b, 0xb0,
+	0x0c, 0x50, 0x58, 0x40, 0x2a, 0x00, 0x05, 0x04, 0x04, 0x05, 0x70, 0x00, 0x00, 0x01, 0x01, 0x00,
+	0x71, 0x06, 0x01, 0x04, 0x07, 0x01, 0x03, 0x02, 0x04, 0x03, 0x68, 0x08, 0x01, 0x02, 0x01, 0x01,
+	0x02, 0x57, 0x08, 0x01, 0x02, 0x02, 0x01, 0x5f, 0x0a, 0x09, 0x02, 0x01, 0x02, 0x01, 0x4f, 0x1b,
+	0x40, 0x28, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00, 0x00, 0x01, 0x00, 0x86, 0x06, 0x01, 0x04, 0x07,
+	0x01, 0x03, 0x02, 0x04, 0x03, 0x68, 0x08, 0x01, 0x02, 0x01, 0x01, 0x02, 0x57, 0x08, 0x01, 0x02,
+	0x02, 0x01, 0x5f, 0x0a, 0x09, 0x02, 0x01, 0x02, 0x01, 0x4f, 0x59, 0x40, 0x12, 0x00, 0x00, 0x00,
+	0x13, 0x00, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0b, 0x06, 0x1f, 0x2b,
+	0x37, 0x07, 0x23, 0x37, 0x23, 0x35, 0x33, 0x37, 0x23, 0x35, 0x33, 0x37, 0x33, 0x07, 0x33, 0x15,
+	0x23, 0x07, 0x33, 0x15, 0xda, 0x2a, 0x32, 0x2a, 0x83, 0xa0, 0x31, 0xd1, 0xee, 0x2a, 0x32, 0x2a,
+	0x8a, 0xa7, 0x31, 0xd8, 0xa8, 0x6f, 0x6f, 0x4e, 0x84, 0x4e, 0x6f, 0x6f, 0x4e, 0x84, 0x4e, 0x00,
+	0x00, 0x01, 0x00, 0x29, 0x00, 0x71, 0x01, 0xcc, 0x02, 0x13, 0x00, 0x0b, 0x00, 0x06, 0xb3, 0x07,
+	0x03, 0x01, 0x32, 0x2b, 0x13, 0x37, 0x17, 0x37, 0x17, 0x07, 0x17, 0x07, 0x27, 0x07, 0x27, 0x37,
+	0x2b, 0x38, 0x98, 0x99, 0x37, 0x99, 0x9a, 0x38, 0x9a, 0x9a, 0x37, 0x9a, 0x01, 0xda, 0x38, 0x98,
+	0x99, 0x37, 0x99, 0x9a, 0x38, 0x9a, 0x9a, 0x37, 0x9a, 0x00, 0x00, 0x01, 0x00, 0x51, 0x01, 0x6d,
+	0x01, 0xa2, 0x02, 0x73, 0x00, 0x06, 0x00, 0x21, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x16, 0x06, 0x01,
+	0x00, 0x01, 0x01, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x85, 0x02, 0x01, 0x00, 0x00, 0x76, 0x11, 0x11,
+	0x10, 0x03, 0x08, 0x19, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x23, 0x13, 0x33, 0x13, 0x23, 0x27,
+	0xa1, 0x50, 0x84, 0x4a, 0x83, 0x50, 0x58, 0x01, 0x6d, 0x01, 0x06, 0xfe, 0xfa, 0xbd, 0x00, 0x01,
+	0x00, 0x29, 0x00, 0xe0, 0x02, 0x51, 0x01, 0xce, 0x00, 0x19, 0x00, 0x61, 0xb1, 0x06, 0x64, 0x44,
+	0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x1a, 0x04, 0x01, 0x00, 0x00, 0x02, 0x05, 0x00, 0x02, 0x69,
+	0x00, 0x05, 0x01, 0x01, 0x05, 0x59, 0x00, 0x05, 0x05, 0x01, 0x61, 0x03, 0x01, 0x01, 0x05, 0x01,
+	0x51, 0x1b, 0x40, 0x28, 0x00, 0x00, 0x04, 0x02, 0x04, 0x00, 0x02, 0x80, 0x00, 0x03, 0x05, 0x01,
+	0x05, 0x03, 0x01, 0x80, 0x00, 0x04, 0x00, 0x02, 0x05, 0x04, 0x02, 0x69, 0x00, 0x05, 0x03, 0x01,
+	0x05, 0x59, 0x00, 0x05, 0x05, 0x01, 0x61, 0x00, 0x01, 0x05, 0x01, 0x51, 0x59, 0x40, 0x09, 0x24,
+	0x22, 0x12, 0x24, 0x22, 0x10, 0x06, 0x08, 0x1c, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x33, 0x14,
+	0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36, 0x33, 0x32,
+	0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x02, 0x06, 0x4b, 0x4b, 0x46, 0x22, 0x42, 0x37, 0x2a,
+	0x28, 0x12, 0x26, 0x27, 0x4b, 0x4e, 0x49, 0x22, 0x43, 0x37, 0x29, 0x28, 0x12, 0x22, 0x25, 0x01,
+	0xc6, 0x6c, 0x7a, 0x24, 0x38, 0x29, 0x19, 0x4d, 0x49, 0x6b, 0x7b, 0x24, 0x37, 0x2a, 0x18, 0x50,
+	0x00, 0x02, 0x00, 0x25, 0x00, 0x7d, 0x01, 0xcf, 0x01, 0xf1, 0x00, 0x19, 0x00, 0x33, 0x00, 0x4c,
+	0x40, 0x49, 0x0e, 0x00, 0x02, 0x01, 0x02, 0x0d, 0x01, 0x02, 0x00, 0x03, 0x28, 0x1a, 0x02, 0x05,
+	0x06, 0x27, 0x1b, 0x02, 0x04, 0x07, 0x04, 0x4c, 0x00, 0x02, 0x00, 0x01, 0x03, 0x02, 0x01, 0x69,
+	0x00, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x69, 0x00, 0x06, 0x00, 0x05, 0x07, 0x06, 0x05, 0x69,
+	0x00, 0x07, 0x04, 0x04, 0x07, 0x59, 0x00, 0x07, 0x07, 0x04, 0x61, 0x00, 0x04, 0x07, 0x04, 0x51,
+	0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x23, 0x08, 0x06, 0x1e, 0x2b, 0x01, 0x15, 0x06, 0x06,
+	0x23, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x33, 0x32, 0x16,
+	0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x17, 0x15, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26,
+	0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+	0x01, 0xcf, 0x16, 0x30, 0x1a, 0x17, 0x32, 0x30, 0x2d, 0x2f, 0x15, 0x19, 0x30, 0x17, 0x17, 0x30,
+	0x19, 0x17, 0x32, 0x30, 0x2d, 0x2f, 0x15, 0x19, 0x30, 0x17, 0x16, 0x30, 0x1a, 0x17, 0x32, 0x30,
+	0x2d, 0x2f, 0x15, 0x19, 0x30, 0x17, 0x17, 0x30, 0x19, 0x17, 0x32, 0x30, 0x2d, 0x2f, 0x15, 0x19,
+	0x30, 0x01, 0xc7, 0x50, 0x14, 0x14, 0x10, 0x1b, 0x19, 0x10, 0x15, 0x15, 0x50, 0x14, 0x14, 0x10,
+	0x1b, 0x19, 0x10, 0x15, 0xbd, 0x50, 0x14, 0x14, 0x10, 0x1b, 0x19, 0x10, 0x15, 0x15, 0x50, 0x14,
+	0x14, 0x10, 0x1b, 0x19, 0x10, 0x15, 0xff, 0xff, 0x00, 0x25, 0x00, 0x3d, 0x01, 0xcf, 0x02, 0x5e,
+	0x00, 0x27, 0x01, 0x6c, 0x00, 0x00, 0xff, 0x22, 0x01, 0x06, 0x01, 0x73, 0x00, 0x6d, 0x00, 0x11,
+	0xb1, 0x00, 0x01, 0xb8, 0xff, 0x22, 0xb0, 0x35, 0x2b, 0xb1, 0x01, 0x02, 0xb0, 0x6d, 0xb0, 0x35,
+	0x2b, 0x00, 0x00, 0x01, 0x00, 0x25, 0x00, 0x83, 0x01, 0xcf, 0x01, 0x88, 0x00, 0x05, 0x00, 0x25,
+	0x40, 0x22, 0x00, 0x00, 0x01, 0x00, 0x86, 0x03, 0x01, 0x02, 0x01, 0x01, 0x02, 0x57, 0x03, 0x01,
+	0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x02, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x11,
+	0x11, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x11, 0x23, 0x35, 0x21, 0x35, 0x01, 0xcf, 0x50, 0xfe, 0xa6,
+	0x01, 0x88, 0xfe, 0xfb, 0xb8, 0x4d, 0x00, 0x01, 0x00, 0x25, 0x00, 0x52, 0x01, 0xcf, 0x02, 0x1e,
+	0x00, 0x06, 0x00, 0x06, 0xb3, 0x04, 0x01, 0x01, 0x32, 0x2b, 0x25, 0x15, 0x25, 0x35, 0x25, 0x15,
+	0x05, 0x01, 0xcf, 0xfe, 0x56, 0x01, 0xaa, 0xfe, 0x93, 0xa4, 0x52, 0xb8, 0x5c, 0xb8, 0x50, 0x95,
+	0x00, 0x01, 0x00, 0x25, 0x00, 0x52, 0x01, 0xcf, 0x02, 0x1e, 0x00, 0x06, 0x00, 0x06, 0xb3, 0x05,
+	0x01, 0x01, 0x32, 0x2b, 0x01, 0x05, 0x35, 0x25, 0x25, 0x35, 0x05, 0x01, 0xcf, 0xfe, 0x56, 0x01,
+	0x6d, 0xfe, 0x93, 0x01, 0xaa, 0x01, 0x0a, 0xb8, 0x52, 0x95, 0x95, 0x50, 0xb8, 0x00, 0x00, 0x02,
+	0x00, 0x25, 0x00, 0x3d, 0x01, 0xcf, 0x02, 0x5e, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x36, 0x40, 0x33,
+	0x05, 0x04, 0x03, 0x03, 0x01, 0x4a, 0x04, 0x01, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x67, 0x05,
+	0x01, 0x03, 0x02, 0x02, 0x03, 0x57, 0x05, 0x01, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x03, 0x02,
+	0x4f, 0x07, 0x07, 0x00, 0x00, 0x07, 0x0a, 0x07, 0x0a, 0x09, 0x08, 0x00, 0x06, 0x00, 0x06, 0x11,
+	0x06, 0x06, 0x17, 0x2b, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x05, 0x05, 0x15, 0x21, 0x35, 0x01,
+	0xcf, 0xfe, 0x56, 0x01, 0xaa, 0xfe, 0xca, 0x01, 0x36, 0xfe, 0x56, 0x01, 0x2b, 0x48, 0x48, 0x01,
+	0x33, 0x58, 0xdb, 0xa0, 0x4e, 0x4e, 0x00, 0x02, 0x00, 0x25, 0x00, 0x3d, 0x01, 0xcf, 0x02, 0x5e,
+	0x00, 0x06, 0x00, 0x0a, 0x00, 0x28, 0x40, 0x25, 0x06, 0x05, 0x04, 0x03, 0x01, 0x4a, 0x00, 0x01,
+	0x00, 0x00, 0x03, 0x01, 0x00, 0x67, 0x00, 0x03, 0x02, 0x02, 0x03, 0x57, 0x00, 0x03, 0x03, 0x02,
+	0x5f, 0x00, 0x02, 0x03, 0x02, 0x4f, 0x11, 0x14, 0x11, 0x10, 0x04, 0x06, 0x1a, 0x2b, 0x25, 0x21,
+	0x35, 0x21, 0x25, 0x35, 0x01, 0x15, 0x21, 0x35, 0x21, 0x01, 0xcf, 0xfe, 0x56, 0x01, 0x36, 0xfe,
+	0xca, 0x01, 0xaa, 0xfe, 0x56, 0x01, 0xaa, 0xe3, 0x48, 0xdb, 0x58, 0xfe, 0xcd, 0xee, 0x4e, 0x00,
+	0x00, 0x03, 0x00, 0x29, 0x00, 0x78, 0x03, 0x8e, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x37,
+	0x00, 0x33, 0x40, 0x30, 0x1d, 0x15, 0x07, 0x03, 0x04, 0x05, 0x01, 0x4c, 0x03, 0x01, 0x02, 0x06,
+	0x01, 0x05, 0x04, 0x02, 0x05, 0x69, 0x07, 0x01, 0x04, 0x00, 0x00, 0x04, 0x59, 0x07, 0x01, 0x04,
+	0x04, 0x00, 0x61, 0x01, 0x01, 0x00, 0x04, 0x00, 0x51, 0x24, 0x25, 0x24, 0x26, 0x26, 0x24, 0x26,
+	0x22, 0x08, 0x06, 0x1e, 0x2b, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x27, 0x07, 0x06, 0x06,
+	0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x17, 0x37, 0x36, 0x36, 0x33, 0x32,
+	0x16, 0x05, 0x07, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07,
+	0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x03, 0x8e, 0x73,
+	0x5a, 0x28, 0x49, 0x1d, 0x58, 0x58, 0x1c, 0x48, 0x2a, 0x5b, 0x71, 0x72, 0x5a, 0x29, 0x49, 0x1c,
+	0x58, 0x58, 0x1c, 0x49, 0x29, 0x5b, 0x72, 0xfe, 0xda, 0x58, 0x58, 0x12, 0x2e, 0x19, 0x36, 0x44,
+	0x44, 0x36, 0x1a, 0x2e, 0xd4, 0x57, 0x12, 0x2d, 0x1a, 0x35, 0x44, 0x44, 0x35, 0x1a, 0x2e, 0x11,
+	0x01, 0x3c, 0x56, 0x6e, 0x1e, 0x1c, 0x54, 0x54, 0x1c, 0x1e, 0x6e, 0x56, 0x56, 0x6e, 0x1d, 0x1c,
+	0x55, 0x55, 0x1c, 0x1d, 0x6e, 0x01, 0x55, 0x56, 0x10, 0x12, 0x43, 0x35, 0x36, 0x43, 0x13, 0x66,
+	0x55, 0x12, 0x12, 0x43, 0x36, 0x35, 0x43, 0x11, 0x11, 0x00, 0x00, 0x02, 0x00, 0x0f, 0xff, 0x68,
+	0x02, 0x42, 0x03, 0x14, 0x00, 0x05, 0x00, 0x09, 0x00, 0x1b, 0x40, 0x18, 0x09, 0x08, 0x07, 0x05,
+	0x02, 0x05, 0x00, 0x01, 0x01, 0x4c, 0x00, 0x01, 0x00, 0x01, 0x85, 0x00, 0x00, 0x00, 0x76, 0x12,
+	0x10, 0x02, 0x06, 0x18, 0x2b, 0x05, 0x23, 0x03, 0x13, 0x33, 0x13, 0x25, 0x13, 0x13, 0x03, 0x01,
+	0x4e, 0x4a, 0xf5, 0xf3, 0x4d, 0xf3, 0xfe, 0x28, 0xc1, 0xbd, 0xc1, 0x98, 0x01, 0xd3, 0x01, 0xd9,
+	0xfe, 0x27, 0x04, 0xfe, 0x88, 0x01, 0x72, 0x01, 0x81, 0x00, 0x00, 0x01, 0x00, 0x08, 0xff, 0x68,
+	0x02, 0x93, 0x03, 0x0b, 0x00, 0x08, 0x00, 0x2a, 0x40, 0x27, 0x06, 0x01, 0x00, 0x01, 0x01, 0x4c,
+	0x00, 0x03, 0x02, 0x03, 0x85, 0x00, 0x00, 0x01, 0x00, 0x86, 0x00, 0x02, 0x01, 0x01, 0x02, 0x57,
+	0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x02, 0x01, 0x4f, 0x12, 0x11, 0x11, 0x10, 0x04, 0x06,
+	0x1a, 0x2b, 0x05, 0x23, 0x03, 0x23, 0x35, 0x33, 0x13, 0x01, 0x33, 0x01, 0x67, 0x5c, 0xa3, 0x60,
+	0xa1, 0x8b, 0x01, 0x05, 0x5a, 0x98, 0x01, 0x8f, 0x50, 0xfe, 0x8f, 0x03, 0x35, 0x00, 0x00, 0x01,
+	0x00, 0x05, 0xff, 0x68, 0x01, 0xcf, 0x03, 0x0b, 0x00, 0x13, 0x00, 0x22, 0x40, 0x1f, 0x00, 0x02,
+	0x00, 0x03, 0x01, 0x02, 0x03, 0x69, 0x00, 0x01, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x00,
+	0x61, 0x00, 0x00, 0x01, 0x00, 0x51, 0x21, 0x25, 0x21, 0x23, 0x04, 0x06, 0x1a, 0x2b, 0x01, 0x03,
+	0x06, 0x06, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x37, 0x13, 0x36, 0x36, 0x33, 0x33, 0x15, 0x23,
+	0x22, 0x06, 0x01, 0x37, 0x47, 0x0b, 0x50, 0x53, 0x3d, 0x33, 0x31, 0x2d, 0x06, 0x47, 0x0b, 0x50,
+	0x54, 0x3d, 0x34, 0x31, 0x2d, 0x02, 0x5d, 0xfd, 0xb0, 0x59, 0x4c, 0x50, 0x2a, 0x34, 0x02, 0x50,
+	0x59, 0x4c, 0x50, 0x2a, 0x00, 0x01, 0x00, 0x2c, 0xff, 0xb0, 0x00, 0xbd, 0x02, 0xc3, 0x00, 0x0d,
+	0x00, 0x06, 0xb3, 0x0a, 0x04, 0x01, 0x32, 0x2b, 0x13, 0x14, 0x16, 0x17, 0x07, 0x26, 0x26, 0x35,
+	0x34, 0x36, 0x37, 0x17, 0x06, 0x06, 0x75, 0x25, 0x23, 0x38, 0x2b, 0x2e, 0x2d, 0x2c, 0x37, 0x23,
+	0x24, 0x01, 0x39, 0x6e, 0xc5, 0x44, 0x12, 0x4e, 0xca, 0x71, 0x75, 0xc9, 0x4c, 0x12, 0x44, 0xc3,
+	0x00, 0x01, 0x00, 0x1f, 0xff, 0xb0, 0x00, 0xb0, 0x02, 0xc3, 0x00, 0x0d, 0x00, 0x06, 0xb3, 0x0a,
+	0x04, 0x01, 0x32, 0x2b, 0x13, 0x34, 0x26, 0x27, 0x37, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07, 0x27,
+	0x36, 0x36, 0x67, 0x24, 0x23, 0x37, 0x2c, 0x2d, 0x2e, 0x2b, 0x38, 0x23, 0x25, 0x01, 0x39, 0x71,
+	0xc3, 0x44, 0x12, 0x4c, 0xc9, 0x75, 0x71, 0xca, 0x4e, 0x12, 0x44, 0xc5, 0x00, 0x01, 0x00, 0x46,
+	0xff, 0xae, 0x00, 0xee, 0x02, 0xc3, 0x00, 0x07, 0x00, 0x29, 0x40, 0x26, 0x00, 0x01, 0x00, 0x02,
+	0x03, 0x01, 0x02, 0x67, 0x04, 0x01, 0x03, 0x00, 0x00, 0x03, 0x57, 0x04, 0x01, 0x03, 0x03, 0x00,
+	0x5f, 0x00, 0x00, 0x03, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x11, 0x11, 0x11, 0x05,
+	0x08, 0x19, 0x2b, 0x17, 0x15, 0x23, 0x11, 0x33, 0x15, 0x23, 0x11, 0xee, 0xa8, 0xa8, 0x65, 0x14,
+	0x3e, 0x03, 0x15, 0x3d, 0xfd, 0x66, 0x00, 0x01, 0x00, 0x19, 0xff, 0xae, 0x00, 0xc1, 0x02, 0xc3,
+	0x00, 0x07, 0x00, 0x22, 0x40, 0x1f, 0x00, 0x03, 0x00, 0x02, 0x01, 0x03, 0x02, 0x67, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x11, 0x11,
+	0x11, 0x10, 0x04, 0x08, 0x1a, 0x2b, 0x17, 0x23, 0x35, 0x33, 0x11, 0x23, 0x35, 0x33, 0xc1, 0xa8,
+	0x65, 0x65, 0xa8, 0x52, 0x3e, 0x02, 0x9a, 0x3d, 0x00, 0x01, 0x00, 0x0c, 0xff, 0xa4, 0x01, 0x0e,
+	0x02, 0xce, 0x00, 0x21, 0x00, 0x2c, 0x40, 0x29, 0x00, 0x04, 0x00, 0x05, 0x03, 0x04, 0x05, 0x69,
+	0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x02, 0x69, 0x00, 0x00, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00,
+	0x00, 0x01, 0x61, 0x00, 0x01, 0x00, 0x01, 0x51, 0x11, 0x15, 0x21, 0x25, 0x11, 0x17, 0x06, 0x08,
+	0x1c, 0x2b, 0x13, 0x15, 0x16, 0x16, 0x15, 0x15, 0x14, 0x16, 0x33, 0x15, 0x22, 0x26, 0x35, 0x35,
+	0x34, 0x26, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x35, 0x35, 0x34, 0x36, 0x33, 0x15, 0x22, 0x06,
+	0x15, 0x15, 0x14, 0x06, 0x5e, 0x26, 0x2e, 0x2b, 0x31, 0x4e, 0x52, 0x31, 0x24, 0x0d, 0x0d, 0x24,
+	0x31, 0x52, 0x4e, 0x31, 0x2b, 0x2d, 0x01, 0x3e, 0x04, 0x07, 0x54, 0x42, 0x6b, 0x2c, 0x25, 0x3d,
+	0x48, 0x45, 0x6c, 0x3c, 0x46, 0x38, 0x46, 0x3c, 0x68, 0x45, 0x48, 0x3d, 0x25, 0x2c, 0x67, 0x42,
+	0x52, 0x00, 0x00, 0x01, 0x00, 0x17, 0xff, 0xa4, 0x01, 0x19, 0x02, 0xce, 0x00, 0x21, 0x00, 0x2c,
+	0x40, 0x29, 0x00, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x69, 0x00, 0x02, 0x00, 0x03, 0x05, 0x02,
+	0x03, 0x69, 0x00, 0x05, 0x04, 0x04, 0x05, 0x59, 0x00, 0x05, 0x05, 0x04, 0x61, 0x00, 0x04, 0x05,
+	0x04, 0x51, 0x11, 0x15, 0x21, 0x25, 0x11, 0x17, 0x06, 0x08, 0x1c, 0x2b, 0x13, 0x35, 0x26, 0x26,
+	0x35, 0x35, 0x34, 0x26, 0x23, 0x35, 0x32, 0x16, 0x15, 0x15, 0x14, 0x16, 0x33, 0x33, 0x15, 0x23,
+	0x22, 0x06, 0x15, 0x15, 0x14, 0x06, 0x23, 0x35, 0x32, 0x36, 0x35, 0x35, 0x34, 0x36, 0xc7, 0x27,
+	0x2d, 0x2b, 0x31, 0x4e, 0x52, 0x31, 0x24, 0x0d, 0x0d, 0x24, 0x31, 0x52, 0x4e, 0x31, 0x2b, 0x2e,
+	0x01, 0x3a, 0x04, 0x07, 0x52, 0x42, 0x67, 0x2c, 0x25, 0x3d, 0x48, 0x45, 0x68, 0x3c, 0x46, 0x38,
+	0x46, 0x3c, 0x6c, 0x45, 0x48, 0x3d, 0x25, 0x2c, 0x6b, 0x42, 0x54, 0x00, 0x00, 0x01, 0x00, 0x16,
+	0x00, 0x40, 0x01, 0x02, 0x01, 0xee, 0x00, 0x05, 0x00, 0x1a, 0x40, 0x17, 0x05, 0x02, 0x02, 0x00,
+	0x01, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x25, 0x00, 0x4e, 0x12, 0x10,
+	0x02, 0x08, 0x18, 0x2b, 0x25, 0x23, 0x27, 0x37, 0x33, 0x07, 0x01, 0x02, 0x57, 0x95, 0x95, 0x57,
+	0x93, 0x40, 0xd9, 0xd5, 0xd4, 0x00, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x40, 0x01, 0x07, 0x01, 0xee,
+	0x00, 0x05, 0x00, 0x19, 0x40, 0x16, 0x03, 0x01, 0x00, 0x01, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x01,
+	0x5f, 0x00, 0x01, 0x01, 0x25, 0x00, 0x4e, 0x12, 0x11, 0x02, 0x08, 0x18, 0x2b, 0x01, 0x07, 0x23,
+	0x37, 0x27, 0x33, 0x01, 0x07, 0x95, 0x57, 0x93, 0x93, 0x57, 0x01, 0x19, 0xd9, 0xda, 0xd4, 0x00,
+	0x00, 0x02, 0x00, 0x16, 0x00, 0x40, 0x01, 0xc7, 0x01, 0xee, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x20,
+	0x40, 0x1d, 0x0b, 0x08, 0x05, 0x02, 0x04, 0x00, 0x01, 0x01, 0x4c, 0x02, 0x01, 0x00, 0x00, 0x01,
+	0x5f, 0x03, 0x01, 0x01, 0x01, 0x25, 0x00, 0x4e, 0x12, 0x12, 0x12, 0x10, 0x04, 0x08, 0x1a, 0x2b,
+	0x37, 0x23, 0x27, 0x37, 0x33, 0x07, 0x05, 0x23, 0x27, 0x37, 0x33, 0x07, 0xf9, 0x4e, 0x95, 0x95,
+	0x4e, 0x94, 0x01, 0x62, 0x4e, 0x95, 0x95, 0x4e, 0x93, 0x40, 0xd9, 0xd5, 0xd4, 0xda, 0xd9, 0xd5,
+	0xd4, 0x00, 0x00, 0x02, 0x00, 0x1b, 0x00, 0x40, 0x01, 0xcc, 0x01, 0xee, 0x00, 0x05, 0x00, 0x0b,
+	0x00, 0x1e, 0x40, 0x1b, 0x09, 0x03, 0x02, 0x00, 0x01, 0x01, 0x4c, 0x02, 0x01, 0x00, 0x00, 0x01,
+	0x5f, 0x03, 0x01, 0x01, 0x01, 0x25, 0x00, 0x4e, 0x12, 0x12, 0x12, 0x11, 0x04, 0x08, 0x1a, 0x2b,
+	0x01, 0x07, 0x23, 0x37, 0x27, 0x33, 0x07, 0x07, 0x23, 0x37, 0x27, 0x33, 0x01, 0xcc, 0x95, 0x4e,
+	0x94, 0x94, 0x4e, 0x39, 0x95, 0x4e, 0x93, 0x93, 0x4e, 0x01, 0x19, 0xd9, 0xda, 0xd4, 0xd5, 0xd9,
+	0xda, 0xd4, 0x00, 0x01, 0x00, 0x37, 0x01, 0x1e, 0x01, 0x76, 0x01, 0x5e, 0x00, 0x03, 0x00, 0x1f,
+	0x40, 0x1c, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x57, 0x02, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00,
+	0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x01,
+	0x15, 0x21, 0x35, 0x01, 0x76, 0xfe, 0xc1, 0x01, 0x5e, 0x40, 0x40, 0x00, 0xff, 0xff, 0x00, 0x37,
+	0x01, 0x1e, 0x01, 0x76, 0x01, 0x5e, 0x02, 0x06, 0x01, 0x88, 0x00, 0x00, 0x00, 0x01, 0x00, 0x37,
+	0x01, 0x1e, 0x01, 0xd0, 0x01, 0x5e, 0x00, 0x03, 0x00, 0x1f, 0x40, 0x1c, 0x02, 0x01, 0x01, 0x00,
+	0x00, 0x01, 0x57, 0x02, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x03, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x01, 0x15, 0x21, 0x35, 0x01, 0xd0, 0xfe,
+	0x67, 0x01, 0x5e, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x37, 0x01, 0x1e, 0x02, 0xe8, 0x01, 0x5e,
+	0x00, 0x03, 0x00, 0x1f, 0x40, 0x1c, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x57, 0x02, 0x01, 0x01,
+	0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x03,
+	0x08, 0x17, 0x2b, 0x01, 0x15, 0x21, 0x35, 0x02, 0xe8, 0xfd, 0x4f, 0x01, 0x5e, 0x40, 0x40, 0x00,
+	0xff, 0xff, 0x00, 0x24, 0xff, 0x99, 0x01, 0xbd, 0xff, 0xd9, 0x01, 0x07, 0x01, 0x8a, 0xff, 0xed,
+	0xfe, 0x7b, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0xfe, 0x7b, 0xb0, 0x35, 0x2b, 0x00, 0x00, 0x02,
+	0x00, 0x31, 0xff, 0xf8, 0x02, 0x0a, 0x02, 0x7d, 0x00, 0x11, 0x00, 0x20, 0x00, 0x1f, 0x40, 0x1c,
+	0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01, 0x28, 0x4d, 0x00, 0x03, 0x03, 0x00, 0x61, 0x00,
+	0x00, 0x00, 0x29, 0x00, 0x4e, 0x24, 0x27, 0x27, 0x22, 0x04, 0x08, 0x1a, 0x2b, 0x01, 0x14, 0x06,
+	0x23, 0x22, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x27,
+	0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x02, 0x0a,
+	0x68, 0x84, 0x55, 0x5d, 0x18, 0x12, 0x11, 0x68, 0x85, 0x54, 0x5e, 0x18, 0x11, 0x11, 0x67, 0x0d,
+	0x3c, 0x3c, 0x59, 0x3e, 0x3b, 0x5c, 0x58, 0x3e, 0x08, 0x01, 0x3b, 0xb3, 0x90, 0x2a, 0x30, 0x24,
+	0x70, 0x55, 0xb2, 0x90, 0x2a, 0x30, 0x24, 0x6f, 0x52, 0x2b, 0x23, 0x66, 0x8f, 0x93, 0x60, 0x65,
+	0x8e, 0x3d, 0x50, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x1d, 0x02, 0x7d, 0x00, 0x05,
+	0x00, 0x14, 0x40, 0x11, 0x05, 0x04, 0x03, 0x02, 0x04, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x23, 0x00,
+	0x4e, 0x10, 0x01, 0x08, 0x17, 0x2b, 0x21, 0x23, 0x11, 0x07, 0x35, 0x25, 0x01, 0x1d, 0x55, 0xb9,
+	0x01, 0x0e, 0x02, 0x29, 0x17, 0x49, 0x22, 0x00, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x9d,
+	0x02, 0x7d, 0x00, 0x18, 0x00, 0x34, 0x40, 0x31, 0x0e, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x03, 0x01,
+	0x02, 0x4c, 0x03, 0x01, 0x03, 0x01, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x61, 0x00, 0x02, 0x02, 0x28,
+	0x4d, 0x04, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x18, 0x25, 0x27, 0x11, 0x05, 0x08, 0x19, 0x2b, 0x25, 0x15, 0x21, 0x35, 0x37, 0x36,
+	0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+	0x06, 0x07, 0x07, 0x01, 0x9d, 0xfe, 0x7f, 0xe3, 0x23, 0x1d, 0x31, 0x2e, 0x27, 0x69, 0x15, 0x27,
+	0x5c, 0x2f, 0x50, 0x57, 0x24, 0x2c, 0xc3, 0x50, 0x50, 0x50, 0xfd, 0x28, 0x3f, 0x22, 0x2b, 0x2f,
+	0x0e, 0x07, 0x4b, 0x0b, 0x0c, 0x53, 0x4b, 0x31, 0x54, 0x31, 0xd9, 0x00, 0x00, 0x01, 0x00, 0x22,
+	0xff, 0xf8, 0x01, 0x9e, 0x02, 0x7d, 0x00, 0x29, 0x00, 0x3f, 0x40, 0x3c, 0x24, 0x01, 0x04, 0x05,
+	0x23, 0x01, 0x03, 0x04, 0x03, 0x01, 0x02, 0x03, 0x0e, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x00, 0x01,
+	0x05, 0x4c, 0x00, 0x03, 0x00, 0x02, 0x01, 0x03, 0x02, 0x67, 0x00, 0x04, 0x04, 0x05, 0x61, 0x00,
+	0x05, 0x05, 0x28, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x61, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x25,
+	0x24, 0x21, 0x24, 0x25, 0x29, 0x06, 0x08, 0x1c, 0x2b, 0x01, 0x14, 0x06, 0x07, 0x15, 0x16, 0x16,
+	0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26,
+	0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36,
+	0x33, 0x32, 0x16, 0x01, 0x83, 0x35, 0x33, 0x40, 0x43, 0x6b, 0x66, 0x39, 0x54, 0x1e, 0x27, 0x47,
+	0x30, 0x49, 0x45, 0x3d, 0x42, 0x62, 0x4e, 0x39, 0x3f, 0x33, 0x38, 0x22, 0x59, 0x18, 0x22, 0x58,
+	0x2d, 0x52, 0x55, 0x01, 0xdd, 0x3a, 0x4b, 0x0e, 0x02, 0x04, 0x4e, 0x47, 0x59, 0x5e, 0x0a, 0x0a,
+	0x4c, 0x09, 0x07, 0x35, 0x38, 0x36, 0x31, 0x4a, 0x37, 0x33, 0x33, 0x2d, 0x0c, 0x06, 0x48, 0x0b,
+	0x0c, 0x52, 0x00, 0x01, 0x00, 0x23, 0x00, 0x00, 0x01, 0xed, 0x02, 0x73, 0x00, 0x0e, 0x00, 0x59,
+	0xb4, 0x07, 0x01, 0x04, 0x01, 0x4b, 0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x1b, 0x07, 0x06, 0x02,
+	0x04, 0x02, 0x01, 0x00, 0x01, 0x04, 0x00, 0x68, 0x00, 0x03, 0x03, 0x22, 0x4d, 0x00, 0x05, 0x05,
+	0x25, 0x4d, 0x00, 0x01, 0x01, 0x23, 0x01, 0x4e, 0x1b, 0x40, 0x1b, 0x07, 0x06, 0x02, 0x04, 0x02,
+	0x01, 0x00, 0x01, 0x04, 0x00, 0x68, 0x00, 0x03, 0x03, 0x22, 0x4d, 0x00, 0x05, 0x05, 0x01, 0x5f,
+	0x00, 0x01, 0x01, 0x23, 0x01, 0x4e, 0x59, 0x40, 0x0f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x11,
+	0x11, 0x12, 0x11, 0x11, 0x11, 0x08, 0x08, 0x1c, 0x2b, 0x25, 0x15, 0x23, 0x15, 0x23, 0x35, 0x21,
+	0x35, 0x13, 0x33, 0x03, 0x33, 0x11, 0x33, 0x11, 0x01, 0xed, 0x56, 0x55, 0xfe, 0xe1, 0x4c, 0x52,
+	0x48, 0xc9, 0x55, 0xf0, 0x4a, 0xa6, 0xa6, 0x4a, 0x01, 0x83, 0xfe, 0x7d, 0x01, 0x15, 0xfe, 0xeb,
+	0x00, 0x01, 0x00, 0x28, 0xff, 0xf8, 0x01, 0xa5, 0x02, 0x73, 0x00, 0x1d, 0x00, 0x38, 0x40, 0x35,
+	0x18, 0x01, 0x02, 0x05, 0x13, 0x07, 0x02, 0x01, 0x02, 0x06, 0x01, 0x00, 0x01, 0x03, 0x4c, 0x00,
+	0x05, 0x00, 0x02, 0x01, 0x05, 0x02, 0x69, 0x00, 0x04, 0x04, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x22,
+	0x4d, 0x00, 0x01, 0x01, 0x00, 0x61, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x23, 0x11, 0x13, 0x24,
+	0x25, 0x22, 0x06, 0x08, 0x1c, 0x2b, 0x25, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16,
+	0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x11, 0x21, 0x15, 0x23, 0x15, 0x36,
+	0x36, 0x33, 0x32, 0x16, 0x01, 0xa5, 0x66, 0x65, 0x3d, 0x5a, 0x1b, 0x23, 0x4d, 0x2d, 0x4c, 0x3f,
+	0x3c, 0x53, 0x22, 0x3c, 0x1e, 0x01, 0x38, 0xe3, 0x17, 0x27, 0x13, 0x62, 0x58, 0xb9, 0x60, 0x61,
+	0x0a, 0x0a, 0x4c, 0x08, 0x08, 0x34, 0x3e, 0x39, 0x2e, 0x05, 0x06, 0x01, 0x5d, 0x4d, 0xc2, 0x03,
+	0x03, 0x56, 0x00, 0x02, 0x00, 0x2f, 0xff, 0xf8, 0x01, 0xe1, 0x02, 0x7d, 0x00, 0x18, 0x00, 0x24,
+	0x00, 0x46, 0x40, 0x43, 0x09, 0x01, 0x02, 0x01, 0x0a, 0x01, 0x03, 0x02, 0x10, 0x01, 0x04, 0x03,
+	0x1f, 0x01, 0x05, 0x04, 0x04, 0x4c, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04, 0x69, 0x00, 0x02,
+	0x02, 0x01, 0x61, 0x00, 0x01, 0x01, 0x28, 0x4d, 0x00, 0x05, 0x05, 0x00, 0x61, 0x06, 0x01, 0x00,
+	0x00, 0x29, 0x00, 0x4e, 0x01, 0x00, 0x23, 0x21, 0x1d, 0x1b, 0x14, 0x12, 0x0e, 0x0b, 0x07, 0x05,
+	0x00, 0x18, 0x01, 0x18, 0x07, 0x08, 0x16, 0x2b, 0x05, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+	0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+	0x06, 0x37, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x16, 0x16, 0x33, 0x32, 0x36, 0x01, 0x0c, 0x79,
+	0x64, 0x81, 0x92, 0x16, 0x35, 0x0e, 0x1a, 0x2a, 0x15, 0x63, 0x53, 0x07, 0x2e, 0x54, 0x30, 0x57,
+	0x53, 0x70, 0x1e, 0x35, 0x43, 0x25, 0x4c, 0x23, 0x01, 0x3a, 0x4b, 0x42, 0x44, 0x08, 0x8a, 0xa7,
+	0xb6, 0x9e, 0x04, 0x03, 0x4b, 0x03, 0x02, 0x5a, 0x73, 0x19, 0x16, 0x5e, 0x62, 0x67, 0x73, 0xd7,
+	0x43, 0x38, 0x16, 0x14, 0x79, 0x5f, 0x44, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x01, 0xa5,
+	0x02, 0x73, 0x00, 0x06, 0x00, 0x24, 0x40, 0x21, 0x01, 0x01, 0x01, 0x01, 0x4b, 0x00, 0x01, 0x01,
+	0x02, 0x5f, 0x03, 0x01, 0x02, 0x02, 0x22, 0x4d, 0x00, 0x00, 0x00, 0x23, 0x00, 0x4e, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x06, 0x11, 0x12, 0x04, 0x08, 0x18, 0x2b, 0x01, 0x15, 0x01, 0x23, 0x01, 0x21,
+	0x35, 0x01, 0xa5, 0xfe, 0xde, 0x5f, 0x01, 0x26, 0xfe, 0xd4, 0x02, 0x73, 0x4d, 0xfd, 0xda, 0x02,
+	0x26, 0x4d, 0x00, 0x03, 0x00, 0x2e, 0xff, 0xf8, 0x01, 0xdd, 0x02, 0x7d, 0x00, 0x17, 0x00, 0x23,
+	0x00, 0x2f, 0x00, 0x30, 0x40, 0x2d, 0x15, 0x09, 0x02, 0x04, 0x03, 0x01, 0x4c, 0x00, 0x03, 0x00,
+	0x04, 0x05, 0x03, 0x04, 0x69, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01, 0x28, 0x4d, 0x00,
+	0x05, 0x05, 0x00, 0x61, 0x00, 0x00, 0x00, 0x29, 0x00, 0x4e, 0x24, 0x24, 0x24, 0x2a, 0x2a, 0x22,
+	0x06, 0x08, 0x1c, 0x2b, 0x25, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x26, 0x26,
+	0x37, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x27, 0x34, 0x26, 0x23,
+	0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x17, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14,
+	0x16, 0x33, 0x32, 0x36, 0x01, 0xdd, 0x68, 0x71, 0x71, 0x65, 0x41, 0x3c, 0x39, 0x39, 0x01, 0x62,
+	0x68, 0x6c, 0x62, 0x3a, 0x39, 0x3d, 0x41, 0x57, 0x3e, 0x44, 0x42, 0x3c, 0x3d, 0x41, 0x43, 0x3f,
+	0x08, 0x42, 0x48, 0x46, 0x40, 0x40, 0x46, 0x48, 0x42, 0xa8, 0x5b, 0x55, 0x51, 0x5a, 0x42, 0x53,
+	0x0a, 0x0b, 0x4d, 0x3f, 0x54, 0x50, 0x4c, 0x55, 0x41, 0x4d, 0x0c, 0x09, 0x50, 0xe5, 0x34, 0x30,
+	0x30, 0x35, 0x39, 0x33, 0x34, 0xe2, 0x37, 0x33, 0x34, 0x3a, 0x37, 0x32, 0x34, 0x00, 0x00, 0x02,
+	0x00, 0x21, 0xff, 0xf8, 0x01, 0xd0, 0x02, 0x7d, 0x00, 0x18, 0x00, 0x24, 0x00, 0x4b, 0x40, 0x48,
+	0x22, 0x01, 0x05, 0x04, 0x10, 0x01, 0x03, 0x05, 0x0a, 0x01, 0x02, 0x03, 0x09, 0x01, 0x01, 0x02,
+	0x04, 0x4c, 0x00, 0x05, 0x00, 0x03, 0x02, 0x05, 0x03, 0x69, 0x07, 0x01, 0x04, 0x04, 0x00, 0x61,
+	0x06, 0x01, 0x00, 0x00, 0x28, 0x4d, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01, 0x29, 0x01,
+	0x4e, 0x1a, 0x19, 0x01, 0x00, 0x20, 0x1e, 0x19, 0x24, 0x1a, 0x24, 0x14, 0x12, 0x0e, 0x0b, 0x07,
+	0x05, 0x00, 0x18, 0x01, 0x18, 0x08, 0x08, 0x16, 0x2b, 0x13, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+	0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35,
+	0x34, 0x36, 0x17, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x26, 0x26, 0xf8, 0x79,
+	0x5f, 0x81, 0x92, 0x18, 0x36, 0x0e, 0x10, 0x2f, 0x1d, 0x62, 0x53, 0x07, 0x26, 0x52, 0x2f, 0x5b,
+	0x56, 0x71, 0x66, 0x41, 0x43, 0x37, 0x45, 0x25, 0x46, 0x20, 0x01, 0x37, 0x02, 0x7d, 0x88, 0xa9,
+	0xb5, 0x9f, 0x05, 0x03, 0x4d, 0x02, 0x03, 0x5a, 0x72, 0x17, 0x17, 0x5f, 0x63, 0x65, 0x70, 0x4d,
+	0x43, 0x41, 0x45, 0x39, 0x15, 0x15, 0x7d, 0x5b, 0x00, 0x02, 0x00, 0x1e, 0xff, 0xf8, 0x01, 0xd7,
+	0x02, 0x7e, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x22, 0x40, 0x1f, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01,
+	0x02, 0x69, 0x00, 0x03, 0x00, 0x00, 0x03, 0x59, 0x00, 0x03, 0x03, 0x00, 0x61, 0x00, 0x00, 0x03,
+	0x00, 0x51, 0x24, 0x27, 0x27, 0x22, 0x04, 0x06, 0x1a, 0x2b, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26,
+	0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x07, 0x34, 0x26, 0x23,
+	0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x01, 0xd7, 0x61, 0x7b, 0x51, 0x58, 0x16, 0x10,
+	0x0e, 0x61, 0x7c, 0x51, 0x58, 0x15, 0x10, 0x0e, 0x56, 0x35, 0x51, 0x4f, 0x38, 0x35, 0x52, 0x4f,
+	0x37, 0x01, 0x3b, 0xb2, 0x91, 0x2d, 0x33, 0x23, 0x6e, 0x52, 0xb2, 0x91, 0x2d, 0x33, 0x24, 0x6d,
+	0x52, 0x94, 0x61, 0x66, 0x8f, 0x93, 0x60, 0x65, 0x00, 0x01, 0x00, 0x34, 0x00, 0x00, 0x01, 0xd2,
+	0x02, 0x7d, 0x00, 0x09, 0x00, 0x28, 0x40, 0x25, 0x06, 0x05, 0x04, 0x03, 0x04, 0x00, 0x4a, 0x01,
+	0x01, 0x00, 0x02, 0x02, 0x00, 0x57, 0x01, 0x01, 0x00, 0x00, 0x02, 0x5f, 0x03, 0x01, 0x02, 0x00,
+	0x02, 0x4f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x15, 0x11, 0x04, 0x06, 0x18, 0x2b, 0x33, 0x35,
+	0x33, 0x11, 0x07, 0x35, 0x25, 0x11, 0x33, 0x15, 0x34, 0xc0, 0xb9, 0x01, 0x0e, 0x89, 0x50, 0x01,
+	0xd9, 0x16, 0x49, 0x21, 0xfd, 0xd3, 0x50, 0x00, 0x00, 0x01, 0x00, 0x2c, 0x00, 0x00, 0x01, 0xbd,
+	0x02, 0x7e, 0x00, 0x18, 0x00, 0x38, 0x40, 0x35, 0x0e, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x03, 0x01,
+	0x02, 0x4c, 0x03, 0x01, 0x03, 0x01, 0x4b, 0x00, 0x02, 0x00, 0x01, 0x03, 0x02, 0x01, 0x69, 0x04,
+	0x01, 0x03, 0x00, 0x00, 0x03, 0x57, 0x04, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00, 0x03, 0x00,
+	0x4f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x25, 0x27, 0x11, 0x05, 0x06, 0x19, 0x2b, 0x25, 0x15,
+	0x21, 0x35, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x33,
+	0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x07, 0x01, 0xbd, 0xfe, 0x6f, 0xee, 0x25, 0x1f, 0x34, 0x31,
+	0x28, 0x6d, 0x18, 0x29, 0x60, 0x30, 0x53, 0x5b, 0x26, 0x2e, 0xcd, 0x50, 0x50, 0x50, 0xfd, 0x27,
+	0x40, 0x23, 0x2a, 0x2f, 0x0e, 0x07, 0x4c, 0x0b, 0x0c, 0x54, 0x4b, 0x31, 0x53, 0x31, 0xda, 0x00,
+	0x00, 0x01, 0x00, 0x29, 0xff, 0xf8, 0x01, 0xc2, 0x02, 0x7e, 0x00, 0x29, 0x00, 0x42, 0x40, 0x3f,
+	0x24, 0x01, 0x04, 0x05, 0x23, 0x01, 0x03, 0x04, 0x03, 0x01, 0x02, 0x03, 0x0e, 0x01, 0x01, 0x02,
+	0x0d, 0x01, 0x00, 0x01, 0x05, 0x4c, 0x00, 0x05, 0x00, 0x04, 0x03, 0x05, 0x04, 0x69, 0x00, 0x03,
+	0x00, 0x02, 0x01, 0x03, 0x02, 0x67, 0x00, 0x01, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x00,
+	0x61, 0x00, 0x00, 0x01, 0x00, 0x51, 0x25, 0x24, 0x21, 0x24, 0x25, 0x29, 0x06, 0x06, 0x1c, 0x2b,
+	0x01, 0x14, 0x06, 0x07, 0x15, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16,
+	0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26,
+	0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x33, 0x32, 0x16, 0x01, 0xa5, 0x3c, 0x36, 0x46, 0x49,
+	0x73, 0x6e, 0x3e, 0x5a, 0x20, 0x28, 0x4d, 0x36, 0x50, 0x4e, 0x45, 0x49, 0x6a, 0x55, 0x3f, 0x47,
+	0x3a, 0x3e, 0x23, 0x5a, 0x22, 0x26, 0x5d, 0x32, 0x58, 0x5a, 0x01, 0xe1, 0x3a, 0x4f, 0x0d, 0x02,
+	0x05, 0x4e, 0x47, 0x59, 0x5e, 0x0a, 0x0a, 0x4c, 0x09, 0x07, 0x36, 0x37, 0x36, 0x32, 0x4a, 0x37,
+	0x33, 0x32, 0x2d, 0x0b, 0x07, 0x49, 0x0b, 0x0c, 0x4f, 0x00, 0x00, 0x01, 0x00, 0x23, 0x00, 0x00,
+	0x01, 0xda, 0x02, 0x74, 0x00, 0x0e, 0x00, 0x3b, 0x40, 0x38, 0x07, 0x01, 0x04, 0x01, 0x4b, 0x00,
+	0x03, 0x05, 0x03, 0x85, 0x00, 0x05, 0x04, 0x05, 0x85, 0x00, 0x01, 0x00, 0x01, 0x86, 0x07, 0x06,
+	0x02, 0x04, 0x00, 0x00, 0x04, 0x57, 0x07, 0x06, 0x02, 0x04, 0x04, 0x00, 0x5f, 0x02, 0x01, 0x00,
+	0x04, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x08,
+	0x06, 0x1c, 0x2b, 0x25, 0x15, 0x23, 0x15, 0x23, 0x35, 0x21, 0x35, 0x13, 0x33, 0x03, 0x33, 0x11,
+	0x33, 0x11, 0x01, 0xda, 0x51, 0x55, 0xfe, 0xef, 0x49, 0x51, 0x44, 0xbb, 0x55, 0xf0, 0x4a, 0xa6,
+	0xa6, 0x4a, 0x01, 0x84, 0xfe, 0x7c, 0x01, 0x16, 0xfe, 0xea, 0x00, 0x01, 0x00, 0x31, 0xff, 0xf8,
+	0x01, 0xc8, 0x02, 0x74, 0x00, 0x1d, 0x00, 0x3b, 0x40, 0x38, 0x18, 0x01, 0x02, 0x05, 0x13, 0x07,
+	0x02, 0x01, 0x02, 0x06, 0x01, 0x00, 0x01, 0x03, 0x4c, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04,
+	0x67, 0x00, 0x05, 0x00, 0x02, 0x01, 0x05, 0x02, 0x69, 0x00, 0x01, 0x00, 0x00, 0x01, 0x59, 0x00,
+	0x01, 0x01, 0x00, 0x61, 0x00, 0x00, 0x01, 0x00, 0x51, 0x32, 0x11, 0x13, 0x24, 0x25, 0x22, 0x06,
+	0x06, 0x1c, 0x2b, 0x25, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36,
+	0x35, 0x34, 0x26, 0x23, 0x06, 0x06, 0x07, 0x11, 0x21, 0x15, 0x23, 0x15, 0x36, 0x36, 0x33, 0x32,
+	0x16, 0x01, 0xc8, 0x6c, 0x6e, 0x3f, 0x62, 0x1c, 0x24, 0x54, 0x30, 0x53, 0x47, 0x45, 0x59, 0x27,
+	0x3e, 0x20, 0x01, 0x4c, 0xf7, 0x13, 0x30, 0x16, 0x6a, 0x60, 0xb9, 0x61, 0x60, 0x0a, 0x0a, 0x4c,
+	0x08, 0x08, 0x35, 0x3d, 0x39, 0x30, 0x01, 0x05, 0x06, 0x01, 0x5d, 0x4d, 0xc2, 0x03, 0x03, 0x57,
+	0x00, 0x02, 0x00, 0x2c, 0xff, 0xf8, 0x01, 0xd7, 0x02, 0x7e, 0x00, 0x18, 0x00, 0x24, 0x00, 0x49,
+	0x40, 0x46, 0x09, 0x01, 0x02, 0x01, 0x0a, 0x01, 0x03, 0x02, 0x10, 0x01, 0x04, 0x03, 0x1f, 0x01,
+	0x05, 0x04, 0x04, 0x4c, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x69, 0x00, 0x03, 0x00, 0x04,
+	0x05, 0x03, 0x04, 0x69, 0x00, 0x05, 0x00, 0x00, 0x05, 0x59, 0x00, 0x05, 0x05, 0x00, 0x61, 0x06,
+	0x01, 0x00, 0x05, 0x00, 0x51, 0x01, 0x00, 0x23, 0x21, 0x1d, 0x1b, 0x14, 0x12, 0x0e, 0x0b, 0x07,
+	0x05, 0x00, 0x18, 0x01, 0x18, 0x07, 0x06, 0x16, 0x2b, 0x05, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
+	0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15,
+	0x14, 0x06, 0x37, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x14, 0x16, 0x33, 0x32, 0x36, 0x01, 0x05,
+	0x77, 0x62, 0x7f, 0x8f, 0x19, 0x33, 0x0c, 0x1a, 0x29, 0x15, 0x5e, 0x52, 0x07, 0x2d, 0x51, 0x2f,
+	0x55, 0x52, 0x6f, 0x1c, 0x33, 0x41, 0x23, 0x4a, 0x22, 0x39, 0x49, 0x3f, 0x42, 0x08, 0x8a, 0xa7,
+	0xb5, 0xa0, 0x04, 0x03, 0x4c, 0x03, 0x02, 0x5a, 0x71, 0x19, 0x15, 0x5e, 0x63, 0x67, 0x73, 0xd7,
+	0x44, 0x38, 0x16, 0x15, 0x79, 0x5f, 0x45, 0x00, 0x00, 0x01, 0x00, 0x2c, 0x00, 0x00, 0x01, 0xce,
+	0x02, 0x74, 0x00, 0x06, 0x00, 0x2a, 0x40, 0x27, 0x01, 0x01, 0x01, 0x01, 0x4b, 0x00, 0x00, 0x01,
+	0x00, 0x86, 0x03, 0x01, 0x02, 0x01, 0x01, 0x02, 0x57, 0x03, 0x01, 0x02, 0x02, 0x01, 0x5f, 0x00,
+	0x01, 0x02, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x11, 0x12, 0x04, 0x06, 0x18, 0x2b,
+	0x01, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35, 0x01, 0xce, 0xfe, 0xc5, 0x5f, 0x01, 0x3f, 0xfe, 0xb9,
+	0x02, 0x74, 0x4d, 0xfd, 0xd9, 0x02, 0x27, 0x4d, 0x00, 0x03, 0x00, 0x2c, 0xff, 0xf8, 0x01, 0xc9,
+	0x02, 0x7e, 0x00, 0x17, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x33, 0x40, 0x30, 0x15, 0x09, 0x02, 0x04,
+	0x03, 0x01, 0x4c, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x69, 0x00, 0x03, 0x00, 0x04, 0x05,
+	0x03, 0x04, 0x69, 0x00, 0x05, 0x00, 0x00, 0x05, 0x59, 0x00, 0x05, 0x05, 0x00, 0x61, 0x00, 0x00,
+	0x05, 0x00, 0x51, 0x24, 0x24, 0x24, 0x2a, 0x2a, 0x22, 0x06, 0x06, 0x1c, 0x2b, 0x25, 0x14, 0x06,
+	0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x26, 0x26, 0x37, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+	0x14, 0x06, 0x07, 0x16, 0x16, 0x27, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32,
+	0x36, 0x17, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x01, 0xc9, 0x64,
+	0x6c, 0x6c, 0x61, 0x3e, 0x39, 0x36, 0x37, 0x01, 0x5f, 0x63, 0x68, 0x5d, 0x36, 0x36, 0x39, 0x3e,
+	0x57, 0x39, 0x40, 0x3f, 0x37, 0x39, 0x3d, 0x3e, 0x3b, 0x08, 0x3d, 0x44, 0x42, 0x3b, 0x3b, 0x42,
+	0x44, 0x3d, 0xa8, 0x5b, 0x55, 0x51, 0x5a, 0x42, 0x54, 0x0a, 0x0b, 0x4c, 0x40, 0x54, 0x50, 0x4c,
+	0x55, 0x41, 0x4e, 0x0b, 0x0a, 0x50, 0xe6, 0x35, 0x2f, 0x2f, 0x36, 0x39, 0x33, 0x34, 0xe3, 0x37,
+	0x33, 0x34, 0x3a, 0x37, 0x32, 0x34, 0x00, 0x02, 0x00, 0x20, 0xff, 0xf8, 0x01, 0xc7, 0x02, 0x7e,
+	0x00, 0x18, 0x00, 0x24, 0x00, 0x4e, 0x40, 0x4b, 0x22, 0x01, 0x05, 0x04, 0x10, 0x01, 0x03, 0x05,
+	0x0a, 0x01, 0x02, 0x03, 0x09, 0x01, 0x01, 0x02, 0x04, 0x4c, 0x06, 0x01, 0x00, 0x07, 0x01, 0x04,
+	0x05, 0x00, 0x04, 0x69, 0x00, 0x05, 0x00, 0x03, 0x02, 0x05, 0x03, 0x69, 0x00, 0x02, 0x01, 0x01,
+	0x02, 0x59, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x02, 0x01, 0x51, 0x1a, 0x19, 0x01, 0x00,
+	0x20, 0x1e, 0x19, 0x24, 0x1a, 0x24, 0x14, 0x12, 0x0e, 0x0b, 0x07, 0x05, 0x00, 0x18, 0x01, 0x18,
+	0x08, 0x06, 0x16, 0x2b, 0x13, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16,
+	0x16, 0x33, 0x32, 0x36, 0x37, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x17, 0x22, 0x06,
+	0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x26, 0x26, 0xf2, 0x77, 0x5e, 0x7f, 0x90, 0x18, 0x35,
+	0x0d, 0x10, 0x2f, 0x1b, 0x60, 0x52, 0x06, 0x27, 0x50, 0x2d, 0x58, 0x54, 0x6f, 0x63, 0x3e, 0x41,
+	0x35, 0x42, 0x25, 0x44, 0x1f, 0x01, 0x36, 0x02, 0x7e, 0x88, 0xa9, 0xb6, 0x9f, 0x05, 0x03, 0x4d,
+	0x02, 0x03, 0x5a, 0x72, 0x18, 0x16, 0x5f, 0x64, 0x65, 0x70, 0x4e, 0x43, 0x40, 0x46, 0x39, 0x15,
+	0x16, 0x7c, 0x5b, 0x00, 0x00, 0x02, 0x00, 0x2d, 0xff, 0xf8, 0x01, 0xfa, 0x01, 0xf8, 0x00, 0x0b,
+	0x00, 0x17, 0x00, 0x22, 0x40, 0x1f, 0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x69, 0x00, 0x03,
+	0x00, 0x00, 0x03, 0x59, 0x00, 0x03, 0x03, 0x00, 0x61, 0x00, 0x00, 0x03, 0x00, 0x51, 0x24, 0x24,
+	0x24, 0x22, 0x04, 0x06, 0x1a, 0x2b, 0x25, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
+	0x32, 0x16, 0x07, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x01, 0xfa,
+	0x6c, 0x7a, 0x7e, 0x69, 0x6c, 0x7b, 0x7e, 0x68, 0x50, 0x42, 0x54, 0x52, 0x45, 0x42, 0x55, 0x51,
+	0x45, 0xf8, 0x88, 0x78, 0x74, 0x8c, 0x88, 0x78, 0x74, 0x8c, 0x69, 0x4d, 0x51, 0x65, 0x66, 0x4a,
+	0x4f, 0x00, 0x00, 0x01, 0x00, 0x15, 0x00, 0x00, 0x01, 0x29, 0x01, 0xf8, 0x00, 0x05, 0x00, 0x12,
+	0x40, 0x0f, 0x05, 0x04, 0x03, 0x02, 0x04, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x76, 0x10, 0x01, 0x06,
+	0x17, 0x2b, 0x21, 0x23, 0x11, 0x07, 0x35, 0x25, 0x01, 0x29, 0x4f, 0xc5, 0x01, 0x14, 0x01, 0xa5,
+	0x1e, 0x45, 0x2c, 0x00, 0x00, 0x01, 0x00, 0x21, 0x00, 0x00, 0x01, 0x93, 0x01, 0xf8, 0x00, 0x18,
+	0x00, 0x37, 0x40, 0x34, 0x0e, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x03, 0x01, 0x03, 0x01, 0x00, 0x03,
+	0x03, 0x4c, 0x00, 0x02, 0x00, 0x01, 0x03, 0x02, 0x01, 0x69, 0x04, 0x01, 0x03, 0x00, 0x00, 0x03,
+	0x57, 0x04, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00, 0x03, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x18,
+	0x00, 0x18, 0x25, 0x27, 0x11, 0x05, 0x06, 0x19, 0x2b, 0x25, 0x15, 0x21, 0x35, 0x37, 0x36, 0x36,
+	0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+	0x07, 0x07, 0x01, 0x93, 0xfe, 0x8e, 0xcc, 0x2a, 0x1c, 0x32, 0x34, 0x23, 0x51, 0x22, 0x20, 0x57,
+	0x2b, 0x53, 0x57, 0x28, 0x2e, 0xa1, 0x4d, 0x4d, 0x4b, 0xb0, 0x25, 0x2b, 0x18, 0x25, 0x23, 0x0e,
+	0x0b, 0x4c, 0x0c, 0x0e, 0x45, 0x42, 0x2c, 0x4a, 0x26, 0x88, 0x00, 0x01, 0x00, 0x1f, 0xff, 0x60,
+	0x01, 0x9b, 0x01, 0xf8, 0x00, 0x29, 0x00, 0x42, 0x40, 0x3f, 0x24, 0x01, 0x04, 0x05, 0x23, 0x01,
+	0x03, 0x04, 0x03, 0x01, 0x02, 0x03, 0x0e, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x00, 0x01, 0x05, 0x4c,
+	0x00, 0x05, 0x00, 0x04, 0x03, 0x05, 0x04, 0x69, 0x00, 0x03, 0x00, 0x02, 0x01, 0x03, 0x02, 0x67,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x00, 0x61, 0x00, 0x00, 0x01, 0x00, 0x51,
+	0x25, 0x24, 0x21, 0x24, 0x25, 0x29, 0x06, 0x06, 0x1c, 0x2b, 0x01, 0x14, 0x06, 0x07, 0x15, 0x16,
+	0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34,
+	0x26, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36,
+	0x36, 0x33, 0x32, 0x16, 0x01, 0x80, 0x35, 0x33, 0x40, 0x43, 0x6b, 0x66, 0x39, 0x54, 0x1e, 0x26,
+	0x48, 0x30, 0x48, 0x46, 0x3d, 0x42, 0x62, 0x4e, 0x39, 0x3f, 0x33, 0x38, 0x24, 0x5b, 0x14, 0x22,
+	0x5a, 0x2c, 0x51, 0x55, 0x01, 0x53, 0x3c, 0x4d, 0x0e, 0x02, 0x05, 0x51, 0x48, 0x5b, 0x61, 0x0a,
+	0x0a, 0x4c, 0x09, 0x07, 0x38, 0x3a, 0x38, 0x34, 0x4a, 0x39, 0x36, 0x34, 0x30, 0x0d, 0x06, 0x49,
+	0x0b, 0x0c, 0x55, 0x00, 0x00, 0x01, 0x00, 0x2b, 0xff, 0x68, 0x01, 0xf5, 0x01, 0xee, 0x00, 0x0e,
+	0x00, 0x3b, 0x40, 0x38, 0x07, 0x01, 0x04, 0x01, 0x4b, 0x00, 0x03, 0x05, 0x03, 0x85, 0x00, 0x05,
+	0x04, 0x05, 0x85, 0x00, 0x01, 0x00, 0x01, 0x86, 0x07, 0x06, 0x02, 0x04, 0x00, 0x00, 0x04, 0x57,
+	0x07, 0x06, 0x02, 0x04, 0x04, 0x00, 0x5f, 0x02, 0x01, 0x00, 0x04, 0x00, 0x4f, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x0e, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x08, 0x06, 0x1c, 0x2b, 0x25, 0x15, 0x23,
+	0x15, 0x23, 0x35, 0x21, 0x35, 0x13, 0x33, 0x03, 0x33, 0x11, 0x33, 0x11, 0x01, 0xf5, 0x56, 0x55,
+	0xfe, 0xe1, 0x4c, 0x52, 0x48, 0xc9, 0x55, 0x5e, 0x4a, 0xac, 0xac, 0x4a, 0x01, 0x90, 0xfe, 0x70,
+	0x01, 0x1f, 0xfe, 0xe1, 0x00, 0x01, 0x00, 0x24, 0xff, 0x60, 0x01, 0xa1, 0x01, 0xee, 0x00, 0x1d,
+	0x00, 0x3b, 0x40, 0x38, 0x18, 0x01, 0x02, 0x05, 0x13, 0x07, 0x02, 0x01, 0x02, 0x06, 0x01, 0x00,
+	0x01, 0x03, 0x4c, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04, 0x67, 0x00, 0x05, 0x00, 0x02, 0x01,
+	0x05, 0x02, 0x69, 0x00, 0x01, 0x00, 0x00, 0x01, 0x59, 0x00, 0x01, 0x01, 0x00, 0x61, 0x00, 0x00,
+	0x01, 0x00, 0x51, 0x23, 0x11, 0x13, 0x24, 0x25, 0x22, 0x06, 0x06, 0x1c, 0x2b, 0x25, 0x14, 0x06,
+	0x23, 0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+	0x07, 0x11, 0x21, 0x15, 0x23, 0x15, 0x36, 0x36, 0x33, 0x32, 0x16, 0x01, 0xa1, 0x66, 0x65, 0x3a,
+	0x5c, 0x1c, 0x23, 0x4d, 0x2d, 0x4c, 0x3f, 0x3d, 0x52, 0x24, 0x3b, 0x1d, 0x01, 0x38, 0xe3, 0x17,
+	0x27, 0x13, 0x61, 0x59, 0x26, 0x62, 0x64, 0x0a, 0x0a, 0x4c, 0x08, 0x08, 0x36, 0x41, 0x3c, 0x32,
+	0x06, 0x06, 0x01, 0x65, 0x4d, 0xcb, 0x03, 0x03, 0x59, 0x00, 0xff, 0xff, 0x00, 0x2f, 0xff, 0xf8,
+	0x01, 0xe1, 0x02, 0x7d, 0x00, 0x06, 0x01, 0x93, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1a, 0xff, 0x68,
+	0x01, 0xa1, 0x01, 0xee, 0x00, 0x06, 0x00, 0x2a, 0x40, 0x27, 0x01, 0x01, 0x01, 0x01, 0x4b, 0x00,
+	0x00, 0x01, 0x00, 0x86, 0x03, 0x01, 0x02, 0x01, 0x01, 0x02, 0x57, 0x03, 0x01, 0x02, 0x02, 0x01,
+	0x5f, 0x00, 0x01, 0x02, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x11, 0x12, 0x04, 0x06,
+	0x18, 0x2b, 0x01, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35, 0x01, 0xa1, 0xfe, 0xde, 0x5f, 0x01, 0x26,
+	0xfe, 0xd4, 0x01, 0xee, 0x4d, 0xfd, 0xc7, 0x02, 0x39, 0x4d, 0xff, 0xff, 0x00, 0x2d, 0xff, 0xf8,
+	0x01, 0xdc, 0x02, 0x7d, 0x00, 0x06, 0x01, 0x95, 0xff, 0x00, 0x00, 0x02, 0x00, 0x1f, 0xff, 0x60,
+	0x01, 0xce, 0x01, 0xf8, 0x00, 0x18, 0x00, 0x24, 0x00, 0x4e, 0x40, 0x4b, 0x22, 0x01, 0x05, 0x04,
+	0x10, 0x01, 0x03, 0x05, 0x0a, 0x01, 0x02, 0x03, 0x09, 0x01, 0x01, 0x02, 0x04, 0x4c, 0x06, 0x01,
+	0x00, 0x07, 0x01, 0x04, 0x05, 0x00, 0x04, 0x69, 0x00, 0x05, 0x00, 0x03, 0x02, 0x05, 0x03, 0x69,
+	0x00, 0x02, 0x01, 0x01, 0x02, 0x59, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x02, 0x01, 0x51,
+	0x1a, 0x19, 0x01, 0x00, 0x20, 0x1e, 0x19, 0x24, 0x1a, 0x24, 0x14, 0x12, 0x0e, 0x0b, 0x07, 0x05,
+	0x00, 0x18, 0x01, 0x18, 0x08, 0x06, 0x16, 0x2b, 0x13, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
+	0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34,
+	0x36, 0x17, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x26, 0x26, 0xf6, 0x79, 0x5f,
+	0x81, 0x92, 0x19, 0x35, 0x0e, 0x14, 0x2e, 0x1a, 0x62, 0x54, 0x06, 0x25, 0x53, 0x2f, 0x5a, 0x57,
+	0x71, 0x66, 0x41, 0x43, 0x37, 0x45, 0x24, 0x46, 0x21, 0x01, 0x37, 0x01, 0xf8, 0x8b, 0xaf, 0xbb,
+	0xa3, 0x05, 0x03, 0x4e, 0x03, 0x03, 0x5e, 0x77, 0x18, 0x17, 0x62, 0x65, 0x68, 0x73, 0x4d, 0x47,
+	0x43, 0x48, 0x3b, 0x15, 0x16, 0x82, 0x60, 0x00, 0xff, 0xff, 0x00, 0x23, 0xff, 0xfb, 0x01, 0x49,
+	0x01, 0x6b, 0x01, 0x07, 0x01, 0xb6, 0x00, 0x00, 0xfe, 0xf2, 0x00, 0x09, 0xb1, 0x00, 0x02, 0xb8,
+	0xfe, 0xf2, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x6b,
+	0x01, 0x07, 0x01, 0xb7, 0x00, 0x00, 0xfe, 0xf2, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0xfe, 0xf2,
+	0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x19, 0x00, 0x00, 0x01, 0x08, 0x01, 0x6b, 0x01, 0x07,
+	0x01, 0xb8, 0x00, 0x00, 0xfe, 0xf2, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0xfe, 0xf2, 0xb0, 0x35,
+	0x2b, 0x00, 0xff, 0xff, 0x00, 0x1c, 0xff, 0xfb, 0x01, 0x06, 0x01, 0x6b, 0x01, 0x07, 0x01, 0xb9,
+	0x00, 0x00, 0xfe, 0xf2, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0xfe, 0xf2, 0xb0, 0x35, 0x2b, 0x00,
+	0xff, 0xff, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x37, 0x01, 0x65, 0x01, 0x07, 0x01, 0xba, 0x00, 0x00,
+	0xfe, 0xf2, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0xfe, 0xf2, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff,
+	0x00, 0x1e, 0xff, 0xfb, 0x01, 0x09, 0x01, 0x65, 0x01, 0x07, 0x01, 0xbb, 0x00, 0x00, 0xfe, 0xf2,
+	0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0xfe, 0xf2, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x22,
+	0xff, 0xfb, 0x01, 0x2e, 0x01, 0x6b, 0x01, 0x07, 0x01, 0xbc, 0x00, 0x00, 0xfe, 0xf2, 0x00, 0x09,
+	0xb1, 0x00, 0x02, 0xb8, 0xfe, 0xf2, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x1b, 0x00, 0x00,
+	0x01, 0x0d, 0x01, 0x65, 0x01, 0x07, 0x01, 0xbd, 0x00, 0x01, 0xfe, 0xf2, 0x00, 0x09, 0xb1, 0x00,
+	0x01, 0xb8, 0xfe, 0xf2, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x21, 0xff, 0xfb, 0x01, 0x2d,
+	0x01, 0x6b, 0x01, 0x07, 0x01, 0xbe, 0x00, 0x00, 0xfe, 0xf2, 0x00, 0x09, 0xb1, 0x00, 0x03, 0xb8,
+	0xfe, 0xf2, 0xb0, 0x35, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x1a, 0xff, 0xfb, 0x01, 0x25, 0x01, 0x6b,
+	0x01, 0x07, 0x01, 0xbf, 0x00, 0x00, 0xfe, 0xf2, 0x00, 0x09, 0xb1, 0x00, 0x02, 0xb8, 0xfe, 0xf2,
+	0xb0, 0x35, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x23, 0x01, 0x09, 0x01, 0x49, 0x02, 0x79, 0x00, 0x0b,
+	0x00, 0x17, 0x00, 0x1f, 0x40, 0x1c, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01, 0x34, 0x4d,
+	0x00, 0x03, 0x03, 0x00, 0x61, 0x00, 0x00, 0x00, 0x35, 0x00, 0x4e, 0x24, 0x24, 0x24, 0x22, 0x04,
+	0x09, 0x1a, 0x2b, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x07,
+	0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x01, 0x49, 0x40, 0x53, 0x57,
+	0x3c, 0x40, 0x53, 0x56, 0x3d, 0x41, 0x20, 0x32, 0x32, 0x21, 0x20, 0x33, 0x31, 0x21, 0x01, 0xc2,
+	0x66, 0x53, 0x4d, 0x6c, 0x65, 0x52, 0x4c, 0x6b, 0x4c, 0x31, 0x33, 0x4a, 0x4b, 0x32, 0x32, 0x00,
+	0x00, 0x01, 0x00, 0x11, 0x01, 0x0e, 0x00, 0xbf, 0x02, 0x79, 0x00, 0x05, 0x00, 0x14, 0x40, 0x11,
+	0x05, 0x04, 0x03, 0x02, 0x04, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x33, 0x00, 0x4e, 0x10, 0x01, 0x09,
+	0x17, 0x2b, 0x13, 0x23, 0x11, 0x07, 0x35, 0x37, 0xbf, 0x40, 0x6e, 0xae, 0x01, 0x0e, 0x01, 0x2d,
+	0x0d, 0x36, 0x15, 0x00, 0x00, 0x01, 0x00, 0x19, 0x01, 0x0e, 0x01, 0x08, 0x02, 0x79, 0x00, 0x18,
+	0x00, 0x34, 0x40, 0x31, 0x0e, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x03, 0x01, 0x02, 0x4c, 0x03, 0x01,
+	0x03, 0x01, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x61, 0x00, 0x02, 0x02, 0x34, 0x4d, 0x04, 0x01, 0x03,
+	0x03, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x33, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x25,
+	0x27, 0x11, 0x05, 0x09, 0x19, 0x2b, 0x01, 0x15, 0x23, 0x35, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26,
+	0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x07, 0x01,
+	0x08, 0xef, 0x89, 0x12, 0x10, 0x1a, 0x18, 0x17, 0x43, 0x0c, 0x17, 0x3b, 0x1e, 0x32, 0x36, 0x15,
+	0x19, 0x70, 0x01, 0x4a, 0x3c, 0x3c, 0x89, 0x13, 0x20, 0x10, 0x14, 0x15, 0x08, 0x03, 0x38, 0x06,
+	0x07, 0x31, 0x2c, 0x1c, 0x2d, 0x19, 0x70, 0x00, 0x00, 0x01, 0x00, 0x1c, 0x01, 0x09, 0x01, 0x06,
+	0x02, 0x79, 0x00, 0x29, 0x00, 0x3f, 0x40, 0x3c, 0x24, 0x01, 0x04, 0x05, 0x23, 0x01, 0x03, 0x04,
+	0x03, 0x01, 0x02, 0x03, 0x0e, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x00, 0x01, 0x05, 0x4c, 0x00, 0x03,
+	0x00, 0x02, 0x01, 0x03, 0x02, 0x69, 0x00, 0x04, 0x04, 0x05, 0x61, 0x00, 0x05, 0x05, 0x34, 0x4d,
+	0x00, 0x01, 0x01, 0x00, 0x61, 0x00, 0x00, 0x00, 0x35, 0x00, 0x4e, 0x25, 0x24, 0x21, 0x24, 0x25,
+	0x29, 0x06, 0x09, 0x1c, 0x2b, 0x13, 0x14, 0x06, 0x07, 0x15, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23,
+	0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x35, 0x33,
+	0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x36, 0x36, 0x33, 0x32, 0x16, 0xf6,
+	0x21, 0x1d, 0x26, 0x28, 0x42, 0x3e, 0x22, 0x36, 0x12, 0x14, 0x2c, 0x1f, 0x2a, 0x26, 0x21, 0x24,
+	0x3d, 0x2f, 0x20, 0x24, 0x1d, 0x1f, 0x14, 0x39, 0x0c, 0x13, 0x38, 0x1f, 0x31, 0x34, 0x02, 0x1e,
+	0x21, 0x2b, 0x07, 0x02, 0x02, 0x2c, 0x28, 0x33, 0x37, 0x06, 0x06, 0x35, 0x04, 0x04, 0x1a, 0x1c,
+	0x1a, 0x19, 0x34, 0x1b, 0x19, 0x19, 0x16, 0x07, 0x03, 0x33, 0x06, 0x08, 0x2f, 0x00, 0x00, 0x01,
+	0x00, 0x1c, 0x01, 0x0e, 0x01, 0x37, 0x02, 0x73, 0x00, 0x0e, 0x00, 0x32, 0x40, 0x2f, 0x07, 0x01,
+	0x04, 0x01, 0x4b, 0x07, 0x06, 0x02, 0x04, 0x02, 0x01, 0x00, 0x01, 0x04, 0x00, 0x68, 0x00, 0x03,
+	0x03, 0x32, 0x4d, 0x00, 0x05, 0x05, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x33, 0x01, 0x4e, 0x00, 0x00,
+	0x00, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x08, 0x09, 0x1c, 0x2b, 0x01, 0x15,
+	0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x37, 0x33, 0x07, 0x33, 0x35, 0x33, 0x15, 0x01, 0x37, 0x31,
+	0x3f, 0xab, 0x2e, 0x3c, 0x2b, 0x6e, 0x3d, 0x01, 0x9f, 0x38, 0x59, 0x59, 0x38, 0xd4, 0xd4, 0x96,
+	0x96, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x01, 0x09, 0x01, 0x09, 0x02, 0x73, 0x00, 0x1d, 0x00, 0x38,
+	0x40, 0x35, 0x18, 0x01, 0x02, 0x05, 0x13, 0x07, 0x02, 0x01, 0x02, 0x06, 0x01, 0x00, 0x01, 0x03,
+	0x4c, 0x00, 0x05, 0x00, 0x02, 0x01, 0x05, 0x02, 0x69, 0x00, 0x04, 0x04, 0x03, 0x5f, 0x00, 0x03,
+	0x03, 0x32, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x61, 0x00, 0x00, 0x00, 0x35, 0x00, 0x4e, 0x23, 0x11,
+	0x13, 0x24, 0x25, 0x22, 0x06, 0x09, 0x1c, 0x2b, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x35,
+	0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x33, 0x15, 0x23,
+	0x15, 0x36, 0x36, 0x33, 0x32, 0x16, 0x01, 0x09, 0x40, 0x3c, 0x26, 0x39, 0x10, 0x13, 0x2e, 0x1e,
+	0x2a, 0x24, 0x22, 0x2e, 0x14, 0x27, 0x11, 0xc2, 0x85, 0x0a, 0x19, 0x0c, 0x3a, 0x34, 0x01, 0x78,
+	0x36, 0x39, 0x06, 0x06, 0x36, 0x04, 0x04, 0x19, 0x1d, 0x1d, 0x17, 0x03, 0x03, 0xcc, 0x37, 0x60,
+	0x01, 0x02, 0x32, 0x00, 0x00, 0x02, 0x00, 0x22, 0x01, 0x09, 0x01, 0x2e, 0x02, 0x79, 0x00, 0x18,
+	0x00, 0x24, 0x00, 0x46, 0x40, 0x43, 0x09, 0x01, 0x02, 0x01, 0x0a, 0x01, 0x03, 0x02, 0x10, 0x01,
+	0x04, 0x03, 0x1f, 0x01, 0x05, 0x04, 0x04, 0x4c, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04, 0x69,
+	0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01, 0x34, 0x4d, 0x00, 0x05, 0x05, 0x00, 0x61, 0x06,
+	0x01, 0x00, 0x00, 0x35, 0x00, 0x4e, 0x01, 0x00, 0x23, 0x21, 0x1d, 0x1b, 0x14, 0x12, 0x0e, 0x0b,
+	0x07, 0x05, 0x00, 0x18, 0x01, 0x18, 0x07, 0x09, 0x16, 0x2b, 0x13, 0x22, 0x26, 0x35, 0x34, 0x36,
+	0x33, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x36, 0x36, 0x33, 0x32, 0x16,
+	0x15, 0x14, 0x06, 0x37, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x16, 0x16, 0x33, 0x32, 0x36, 0xac,
+	0x4d, 0x3d, 0x50, 0x5a, 0x11, 0x20, 0x07, 0x1c, 0x13, 0x09, 0x37, 0x30, 0x04, 0x18, 0x31, 0x1d,
+	0x35, 0x32, 0x45, 0x0a, 0x1c, 0x26, 0x15, 0x2b, 0x12, 0x01, 0x20, 0x29, 0x25, 0x25, 0x01, 0x09,
+	0x4e, 0x60, 0x67, 0x5b, 0x03, 0x02, 0x32, 0x02, 0x01, 0x2e, 0x39, 0x0d, 0x0b, 0x37, 0x39, 0x3b,
+	0x42, 0x7b, 0x23, 0x1b, 0x0a, 0x09, 0x40, 0x31, 0x23, 0x00, 0x00, 0x01, 0x00, 0x1a, 0x01, 0x0e,
+	0x01, 0x0c, 0x02, 0x73, 0x00, 0x06, 0x00, 0x24, 0x40, 0x21, 0x01, 0x01, 0x01, 0x01, 0x4b, 0x00,
+	0x01, 0x01, 0x02, 0x5f, 0x03, 0x01, 0x02, 0x02, 0x32, 0x4d, 0x00, 0x00, 0x00, 0x33, 0x00, 0x4e,
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x11, 0x12, 0x04, 0x09, 0x18, 0x2b, 0x01, 0x15, 0x03, 0x23,
+	0x13, 0x23, 0x35, 0x01, 0x0c, 0xa9, 0x48, 0xac, 0xad, 0x02, 0x73, 0x39, 0xfe, 0xd4, 0x01, 0x2c,
+	0x39, 0x00, 0x00, 0x03, 0x00, 0x21, 0x01, 0x09, 0x01, 0x2d, 0x02, 0x79, 0x00, 0x17, 0x00, 0x23,
+	0x00, 0x2f, 0x00, 0x30, 0x40, 0x2d, 0x15, 0x09, 0x02, 0x04, 0x03, 0x01, 0x4c, 0x00, 0x03, 0x00,
+	0x04, 0x05, 0x03, 0x04, 0x69, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01, 0x34, 0x4d, 0x00,
+	0x05, 0x05, 0x00, 0x61, 0x00, 0x00, 0x00, 0x35, 0x00, 0x4e, 0x24, 0x24, 0x24, 0x2a, 0x2a, 0x22,
+	0x06, 0x09, 0x1c, 0x2b, 0x01, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x37, 0x26, 0x26,
+	0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x27, 0x34, 0x26, 0x23,
+	0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x17, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14,
+	0x16, 0x33, 0x32, 0x36, 0x01, 0x2d, 0x41, 0x46, 0x47, 0x3e, 0x26, 0x23, 0x21, 0x21, 0x3d, 0x41,
+	0x44, 0x3c, 0x22, 0x21, 0x23, 0x27, 0x40, 0x21, 0x26, 0x25, 0x20, 0x21, 0x24, 0x25, 0x22, 0x05,
+	0x24, 0x28, 0x26, 0x24, 0x23, 0x27, 0x28, 0x24, 0x01, 0x6e, 0x35, 0x30, 0x2e, 0x35, 0x24, 0x30,
+	0x06, 0x08, 0x2b, 0x22, 0x31, 0x2d, 0x2b, 0x32, 0x23, 0x2b, 0x08, 0x07, 0x2e, 0x82, 0x1b, 0x17,
+	0x18, 0x1b, 0x1d, 0x19, 0x1a, 0x80, 0x1c, 0x19, 0x1a, 0x1c, 0x1c, 0x1a, 0x1a, 0x00, 0x00, 0x02,
+	0x00, 0x1a, 0x01, 0x09, 0x01, 0x25, 0x02, 0x79, 0x00, 0x18, 0x00, 0x24, 0x00, 0x4b, 0x40, 0x48,
+	0x22, 0x01, 0x05, 0x04, 0x10, 0x01, 0x03, 0x05, 0x0a, 0x01, 0x02, 0x03, 0x09, 0x01, 0x01, 0x02,
+	0x04, 0x4c, 0x00, 0x05, 0x00, 0x03, 0x02, 0x05, 0x03, 0x69, 0x07, 0x01, 0x04, 0x04, 0x00, 0x61,
+	0x06, 0x01, 0x00, 0x00, 0x34, 0x4d, 0x00, 0x02, 0x02, 0x01, 0x61, 0x00, 0x01, 0x01, 0x35, 0x01,
+	0x4e, 0x1a, 0x19, 0x01, 0x00, 0x20, 0x1e, 0x19, 0x24, 0x1a, 0x24, 0x14, 0x12, 0x0e, 0x0c, 0x07,
+	0x05, 0x00, 0x18, 0x01, 0x18, 0x08, 0x09, 0x16, 0x2b, 0x13, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+	0x22, 0x26, 0x27, 0x35, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35,
+	0x34, 0x36, 0x17, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x26, 0x26, 0x9e, 0x4c,
+	0x3b, 0x51, 0x5a, 0x10, 0x22, 0x08, 0x0f, 0x1c, 0x0f, 0x38, 0x2f, 0x05, 0x18, 0x2e, 0x1b, 0x36,
+	0x35, 0x45, 0x3f, 0x24, 0x24, 0x1d, 0x27, 0x15, 0x26, 0x13, 0x01, 0x1e, 0x02, 0x79, 0x4d, 0x61,
+	0x66, 0x5c, 0x03, 0x02, 0x34, 0x02, 0x02, 0x2e, 0x3a, 0x0d, 0x0c, 0x38, 0x39, 0x3a, 0x41, 0x36,
+	0x21, 0x21, 0x24, 0x1c, 0x0a, 0x0a, 0x41, 0x2d, 0x00, 0x01, 0xff, 0x97, 0x00, 0x00, 0x01, 0x00,
+	0x02, 0x73, 0x00, 0x03, 0x00, 0x19, 0x40, 0x16, 0x02, 0x01, 0x01, 0x01, 0x22, 0x4d, 0x00, 0x00,
+	0x00, 0x23, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x03, 0x08, 0x17, 0x2b, 0x01,
+	0x01, 0x23, 0x01, 0x01, 0x00, 0xfe, 0xd4, 0x3d, 0x01, 0x2c, 0x02, 0x73, 0xfd, 0x8d, 0x02, 0x73,
+	0xff, 0xff, 0x00, 0x13, 0x00, 0x00, 0x02, 0xbb, 0x02, 0x79, 0x00, 0x26, 0x01, 0xb7, 0x02, 0x00,
+	0x00, 0x27, 0x01, 0xc0, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x07, 0x01, 0xb0, 0x01, 0x84, 0x00, 0x00,
+	0xff, 0xff, 0x00, 0x13, 0x00, 0x00, 0x02, 0xa9, 0x02, 0x79, 0x00, 0x26, 0x01, 0xb7, 0x02, 0x00,
+	0x00, 0x27, 0x01, 0xc0, 0x00, 0xf9, 0x00, 0x00, 0x00, 0x07, 0x01, 0xae, 0x01, 0xa1, 0x00, 0x00,
+	0xff, 0xff, 0x00, 0x1e, 0x00, 0x00, 0x02, 0xdf, 0x02, 0x79, 0x00, 0x26, 0x01, 0xb9, 0x02, 0x00,
+	0x00, 0x27, 0x01, 0xc0, 0x01, 0x1d, 0x00, 0x00, 0x00, 0x07, 0x01, 0xb0, 0x01, 0xa8, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x15, 0xff, 0xed, 0x02, 0x88, 0x02, 0x73, 0x00, 0x19, 0x00, 0x15, 0x40, 0x12,
+	0x19, 0x18, 0x17, 0x0f, 0x05, 0x01, 0x00, 0x07, 0x00, 0x49, 0x00, 0x00, 0x00, 0x76, 0x1a, 0x01,
+	0x06, 0x17, 0x2b, 0x37, 0x35, 0x17, 0x16, 0x16, 0x17, 0x37, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11,
+	0x14, 0x06, 0x07, 0x17, 0x36, 0x36, 0x37, 0x36, 0x36, 0x37, 0x37, 0x15, 0x05, 0x15, 0xd1, 0x11,
+	0x24, 0x0b, 0x02, 0x01, 0x01, 0x52, 0x01, 0x01, 0x02, 0x05, 0x10, 0x13, 0x0b, 0x0b, 0x04, 0xce,
+	0xfe, 0xc8, 0x99, 0x5a, 0x73, 0x09, 0x15, 0x07, 0x01, 0x10, 0x20, 0x34, 0x01, 0xb3, 0xfe, 0x4d,
+	0x34, 0x20, 0x10, 0x01, 0x03, 0x0a, 0x0a, 0x06, 0x06, 0x02, 0x73, 0x5a, 0xac, 0x00, 0x00, 0x01,
+	0x00, 0x14, 0x00, 0x00, 0x02, 0x87, 0x02, 0x86, 0x00, 0x19, 0x00, 0x15, 0x40, 0x12, 0x19, 0x18,
+	0x17, 0x0f, 0x05, 0x01, 0x00, 0x07, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x76, 0x1a, 0x01, 0x06, 0x17,
+	0x2b, 0x01, 0x15, 0x27, 0x26, 0x26, 0x27, 0x07, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x36,
+	0x37, 0x27, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x07, 0x35, 0x25, 0x02, 0x87, 0xd1, 0x11, 0x24,
+	0x0b, 0x02, 0x01, 0x01, 0x52, 0x01, 0x01, 0x02, 0x05, 0x10, 0x13, 0x0b, 0x0b, 0x04, 0xce, 0x01,
+	0x38, 0x01, 0xda, 0x5a, 0x73, 0x09, 0x15, 0x07, 0x01, 0x10, 0x20, 0x34, 0xfe, 0x4d, 0x01, 0xb3,
+	0x34, 0x20, 0x10, 0x01, 0x03, 0x0a, 0x0a, 0x06, 0x06, 0x02, 0x73, 0x5a, 0xac, 0x00, 0x00, 0x01,
+	0x00, 0x15, 0x00, 0x00, 0x02, 0x9b, 0x02, 0x73, 0x00, 0x19, 0x00, 0x2a, 0x40, 0x27, 0x19, 0x01,
+	0x01, 0x02, 0x01, 0x4c, 0x00, 0x03, 0x02, 0x03, 0x85, 0x00, 0x00, 0x01, 0x00, 0x86, 0x00, 0x02,
+	0x01, 0x01, 0x02, 0x57, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x02, 0x01, 0x4f, 0x18, 0x41,
+	0x54, 0x10, 0x04, 0x06, 0x1a, 0x2b, 0x21, 0x23, 0x37, 0x36, 0x36, 0x37, 0x27, 0x06, 0x06, 0x23,
+	0x21, 0x35, 0x21, 0x32, 0x16, 0x17, 0x37, 0x26, 0x26, 0x27, 0x26, 0x26, 0x27, 0x27, 0x33, 0x13,
+	0x01, 0xef, 0x5a, 0x73, 0x09, 0x15, 0x07, 0x01, 0x10, 0x20, 0x34, 0xfe, 0x4d, 0x01, 0xb3, 0x34,
+	0x20, 0x10, 0x01, 0x03, 0x0a, 0x0a, 0x06, 0x06, 0x02, 0x73, 0x5a, 0xac, 0xd1, 0x11, 0x24, 0x0b,
+	0x02, 0x01, 0x01, 0x52, 0x01, 0x01, 0x02, 0x05, 0x10, 0x13, 0x0b, 0x0b, 0x04, 0xce, 0xfe, 0xc8,
+	0x00, 0x01, 0x00, 0x15, 0x00, 0x00, 0x02, 0x9b, 0x02, 0x73, 0x00, 0x19, 0x00, 0x2a, 0x40, 0x27,
+	0x19, 0x01, 0x02, 0x01, 0x01, 0x4c, 0x00, 0x00, 0x01, 0x00, 0x85, 0x00, 0x03, 0x02, 0x03, 0x86,
+	0x00, 0x01, 0x02, 0x02, 0x01, 0x57, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02, 0x01, 0x02, 0x4f,
+	0x18, 0x41, 0x54, 0x10, 0x04, 0x06, 0x1a, 0x2b, 0x13, 0x33, 0x07, 0x06, 0x06, 0x07, 0x17, 0x36,
+	0x36, 0x33, 0x21, 0x15, 0x21, 0x22, 0x26, 0x27, 0x07, 0x16, 0x16, 0x17, 0x16, 0x16, 0x17, 0x17,
+	0x23, 0x03, 0xc1, 0x5a, 0x73, 0x09, 0x15, 0x07, 0x01, 0x10, 0x20, 0x34, 0x01, 0xb3, 0xfe, 0x4d,
+	0x34, 0x20, 0x10, 0x01, 0x03, 0x0a, 0x0a, 0x06, 0x06, 0x02, 0x73, 0x5a, 0xac, 0x02, 0x73, 0xd1,
+	0x11, 0x24, 0x0b, 0x02, 0x01, 0x01, 0x52, 0x01, 0x01, 0x02, 0x05, 0x10, 0x13, 0x0b, 0x0b, 0x04,
+	0xce, 0x01, 0x38, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xc9, 0x00, 0x4d, 0x00, 0x07, 0x00, 0x50,
+	0x00, 0x04, 0x00, 0x02, 0x00, 0x24, 0x00, 0x4e, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8a, 0x0e, 0x15,
+	0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x58, 0x00, 0x69,
+	0x00, 0x79, 0x00, 0x89, 0x00, 0x99, 0x00, 0xdd, 0x00, 0xee, 0x00, 0xfe, 0x01, 0x0e, 0x01, 0x63,
+	0x01, 0x74, 0x01, 0x84, 0x01, 0xcd, 0x02, 0x11, 0x02, 0x22, 0x02, 0x32, 0x02, 0x9e, 0x02, 0xae,
+	0x02, 0xbf, 0x02, 0xfa, 0x03, 0x0a, 0x03, 0x58, 0x03, 0xa6, 0x03, 0xd5, 0x03, 0xe6, 0x03, 0xf6,
+	0x04, 0x06, 0x04, 0x16, 0x04, 0x26, 0x04, 0x37, 0x04, 0x47, 0x04, 0x57, 0x04, 0xa6, 0x04, 0xfa,
+	0x05, 0x23, 0x05, 0x72, 0x05, 0x83, 0x05, 0x93, 0x05, 0x9f, 0x05, 0xb0, 0x05, 0xd7, 0x06, 0x18,
+	0x06, 0x28, 0x06, 0x42, 0x06, 0x52, 0x06, 0x62, 0x06, 0x72, 0x06, 0x82, 0x06, 0x92, 0x06, 0xa2,
+	0x06, 0xae, 0x06, 0xbe, 0x06, 0xf3, 0x07, 0x03, 0x07, 0x31, 0x07, 0x41, 0x07, 0x6c, 0x07, 0x78,
+	0x07, 0x97, 0x07, 0xa7, 0x07, 0xb9, 0x07, 0xc5, 0x07, 0xd6, 0x08, 0x06, 0x08, 0x39, 0x08, 0x63,
+	0x08, 0x74, 0x08, 0x84, 0x08, 0x90, 0x08, 0xa1, 0x08, 0xe4, 0x09, 0x23, 0x09, 0x34, 0x09, 0x45,
+	0x09, 0x56, 0x09, 0x66, 0x09, 0x77, 0x0a, 0x12, 0x0a, 0x22, 0x0a, 0x33, 0x0a, 0x9e, 0x0a, 0xaf,
+	0x0a, 0xbf, 0x0a, 0xf5, 0x0b, 0x2f, 0x0b, 0x94, 0x0b, 0xd2, 0x0b, 0xe3, 0x0b, 0xf3, 0x0b, 0xff,
+	0x0c, 0x51, 0x0c, 0x62, 0x0c, 0x72, 0x0c, 0xf2, 0x0d, 0x02, 0x0d, 0x0e, 0x0d, 0x1a, 0x0d, 0x93,
+	0x0d, 0xb5, 0x0d, 0xe7, 0x0d, 0xf7, 0x0e, 0x03, 0x0e, 0x0f, 0x0e, 0x3b, 0x0e, 0x4c, 0x0e, 0x5c,
+	0x0e, 0x6c, 0x0e, 0x7d, 0x0e, 0x8e, 0x0e, 0x9e, 0x0e, 0xaf, 0x0f, 0x02, 0x0f, 0x13, 0x0f, 0x23,
+	0x0f, 0x4f, 0x0f, 0x9a, 0x0f, 0xab, 0x0f, 0xbc, 0x0f, 0xcd, 0x0f, 0xde, 0x10, 0x08, 0x10, 0x19,
+	0x10, 0x3c, 0x10, 0x4d, 0x10, 0x5d, 0x10, 0x6d, 0x10, 0x7d, 0x10, 0xaa, 0x10, 0xbb, 0x10, 0xcb,
+	0x10, 0xdc, 0x11, 0x17, 0x11, 0x2c, 0x11, 0x55, 0x11, 0x72, 0x11, 0x90, 0x11, 0xb8, 0x11, 0xd0,
+	0x11, 0xe9, 0x12, 0x0b, 0x12, 0x27, 0x12, 0x5e, 0x12, 0xe2, 0x13, 0x72, 0x13, 0x7d, 0x13, 0x88,
+	0x13, 0x93, 0x13, 0x9e, 0x14, 0x30, 0x14, 0x3c, 0x14, 0x47, 0x14, 0x52, 0x14, 0xd9, 0x14, 0xe4,
+	0x14, 0xef, 0x15, 0x3b, 0x15, 0x7a, 0x15, 0x86, 0x15, 0x91, 0x15, 0xfd, 0x16, 0x08, 0x16, 0x14,
+	0x16, 0x7a, 0x16, 0x86, 0x17, 0x1f, 0x17, 0x81, 0x17, 0xcd, 0x17, 0xd9, 0x17, 0xe4, 0x17, 0xef,
+	0x17, 0xfa, 0x18, 0x05, 0x18, 0x11, 0x18, 0x1c, 0x18, 0x27, 0x18, 0x98, 0x18, 0xe4, 0x19, 0x35,
+	0x19, 0x86, 0x19, 0x8e, 0x19, 0x9a, 0x19, 0xa2, 0x19, 0xae, 0x1a, 0x12, 0x1a, 0x1d, 0x1a, 0x28,
+	0x1a, 0x34, 0x1a, 0x40, 0x1a, 0x75, 0x1a, 0xd1, 0x1a, 0xe2, 0x1b, 0x04, 0x1b, 0x15, 0x1b, 0x26,
+	0x1b, 0x37, 0x1b, 0x48, 0x1b, 0x59, 0x1b, 0x65, 0x1b, 0x76, 0x1b, 0xba, 0x1b, 0xcb, 0x1b, 0xe0,
+	0x1c, 0x1e, 0x1c, 0x2f, 0x1c, 0x60, 0x1c, 0x90, 0x1c, 0x9c, 0x1c, 0xb6, 0x1c, 0xc7, 0x1c, 0xd3,
+	0x1c, 0xde, 0x1c, 0xef, 0x1d, 0x17, 0x1d, 0x7b, 0x1d, 0xc1, 0x1d, 0xcd, 0x1d, 0xd8, 0x1d, 0xe3,
+	0x1d, 0xef, 0x1d, 0xfa, 0x1e, 0x5d, 0x1e, 0x93, 0x1e, 0x9f, 0x1e, 0xaa, 0x1e, 0xb5, 0x1e, 0xc0,
+	0x1f, 0x33, 0x1f, 0x3e, 0x1f, 0x49, 0x1f, 0x54, 0x1f, 0xbe, 0x1f, 0xca, 0x1f, 0xd5, 0x20, 0x36,
+	0x20, 0x82, 0x20, 0xcc, 0x20, 0xfe, 0x21, 0x0f, 0x21, 0x20, 0x21, 0x2b, 0x21, 0x82, 0x21, 0x8d,
+	0x21, 0x98, 0x22, 0x1a, 0x22, 0x25, 0x22, 0x30, 0x22, 0xbc, 0x23, 0x0d, 0x23, 0x73, 0x23, 0x84,
+	0x23, 0x90, 0x23, 0x9c, 0x23, 0xf2, 0x24, 0x04, 0x24, 0x15, 0x24, 0x26, 0x24, 0x37, 0x24, 0x48,
+	0x24, 0x59, 0x24, 0x6a, 0x24, 0xc4, 0x24, 0xd5, 0x24, 0xe6, 0x25, 0x06, 0x25, 0x33, 0x25, 0x45,
+	0x25, 0x57, 0x25, 0x69, 0x25, 0x7b, 0x25, 0xa4, 0x25, 0xb5, 0x25, 0xf0, 0x26, 0x02, 0x26, 0x13,
+	0x26, 0x24, 0x26, 0x35, 0x26, 0x62, 0x26, 0x73, 0x26, 0x84, 0x26, 0x95, 0x26, 0xd0, 0x26, 0xe9,
+	0x27, 0x16, 0x27, 0x37, 0x27, 0x55, 0x27, 0x99, 0x27, 0xbb, 0x27, 0xdf, 0x28, 0x03, 0x28, 0x2f,
+	0x28, 0x4b, 0x28, 0x68, 0x28, 0x8e, 0x28, 0xae, 0x28, 0xe4, 0x29, 0x1f, 0x29, 0x5f, 0x29, 0x7c,
+	0x29, 0xa8, 0x29, 0xc2, 0x29, 0xdc, 0x29, 0xfc, 0x2a, 0x11, 0x2a, 0x23, 0x2a, 0x35, 0x2a, 0x35,
+	0x2a, 0x44, 0x2a, 0x4c, 0x2a, 0x71, 0x2a, 0x96, 0x2a, 0xcb, 0x2b, 0x16, 0x2b, 0x60, 0x2b, 0xc8,
+	0x2c, 0x6c, 0x2c, 0x98, 0x2d, 0x1a, 0x2d, 0x57, 0x2d, 0xc0, 0x2e, 0x1f, 0x2e, 0x92, 0x2f, 0x0d,
+	0x2f, 0x7c, 0x2f, 0xc5, 0x30, 0x66, 0x30, 0xba, 0x30, 0xd2, 0x30, 0xda, 0x30, 0xe9, 0x31, 0x07,
+	0x31, 0x2b, 0x31, 0x49, 0x31, 0x60, 0x31, 0x8d, 0x31, 0x99, 0x31, 0xaf, 0x31, 0xcc, 0x32, 0x07,
+	0x32, 0x5f, 0x32, 0xeb, 0x33, 0x9f, 0x33, 0xff, 0x34, 0x6e, 0x35, 0x11, 0x35, 0x7d, 0x35, 0xbc,
+	0x36, 0x01, 0x36, 0x52, 0x36, 0x94, 0x36, 0xcc, 0x36, 0xd4, 0x37, 0x1c, 0x37, 0x24, 0x37, 0x6d,
+	0x37, 0x75, 0x37, 0xac, 0x38, 0x07, 0x38, 0x33, 0x38, 0x69, 0x38, 0x94, 0x38, 0xce, 0x38, 0xeb,
+	0x39, 0x05, 0x39, 0x1a, 0x39, 0x72, 0x39, 0x8f, 0x39, 0xb1, 0x3a, 0x0a, 0x3a, 0x7d, 0x3a, 0x93,
+	0x3a, 0xb5, 0x3a, 0xca, 0x3a, 0xe1, 0x3b, 0x15, 0x3b, 0x42, 0x3b, 0xaf, 0x3b, 0xd7, 0x3c, 0x01,
+	0x3c, 0x34, 0x3c, 0x52, 0x3c, 0x70, 0x3c, 0x95, 0x3c, 0xb6, 0x3c, 0xfb, 0x3d, 0x40, 0x3d, 0x5d,
+	0x3d, 0x7a, 0x3d, 0xa3, 0x3d, 0xcb, 0x3d, 0xe8, 0x3d, 0xf0, 0x3e, 0x0d, 0x3e, 0x2a, 0x3e, 0x39,
+	0x3e, 0x7c, 0x3e, 0x96, 0x3e, 0xd8, 0x3f, 0x33, 0x3f, 0x7a, 0x3f, 0xc3, 0x40, 0x1e, 0x40, 0x43,
+	0x40, 0xa1, 0x40, 0xfe, 0x41, 0x3e, 0x41, 0x66, 0x41, 0xaa, 0x42, 0x07, 0x42, 0x3f, 0x42, 0x8a,
+	0x42, 0xe6, 0x43, 0x0e, 0x43, 0x6d, 0x43, 0xcc, 0x44, 0x03, 0x44, 0x1c, 0x44, 0x5f, 0x44, 0xbc,
+	0x44, 0xf4, 0x45, 0x3f, 0x45, 0x47, 0x45, 0x6f, 0x45, 0x77, 0x45, 0xd6, 0x45, 0xd6, 0x45, 0xe5,
+	0x45, 0xf4, 0x46, 0x03, 0x46, 0x12, 0x46, 0x21, 0x46, 0x30, 0x46, 0x3f, 0x46, 0x4e, 0x46, 0x5d,
+	0x46, 0x6c, 0x46, 0xa2, 0x46, 0xbc, 0x46, 0xfe, 0x47, 0x59, 0x47, 0x8b, 0x47, 0xd4, 0x48, 0x2f,
+	0x48, 0x53, 0x48, 0xb1, 0x49, 0x0e, 0x49, 0x2a, 0x49, 0x2a, 0x49, 0x3a, 0x49, 0x4a, 0x49, 0x5a,
+	0x49, 0x91, 0x49, 0xc9, 0x4a, 0x0a, 0x4a, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x03, 0xd7,
+	0x15, 0x15, 0xb0, 0x0c, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x0f, 0x03, 0xe8, 0x00, 0x00, 0x00, 0x00,
+	0xd8, 0x6c, 0x98, 0x71, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x2f, 0xbe, 0xa5, 0xff, 0x97, 0xff, 0x21,
+	0x03, 0xcf, 0x03, 0x46, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x7e, 0x00, 0x32, 0x00, 0xab, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x02, 0x56, 0x00, 0x08,
+	0x02, 0x56, 0x00, 0x08, 0x02, 0x56, 0x00, 0x08, 0x02, 0x56, 0x00, 0x08, 0x02, 0x56, 0x00, 0x08,
+	0x02, 0xe4, 0x00, 0x08, 0x02, 0xe4, 0x00, 0x08, 0x02, 0x56, 0x00, 0x08, 0x02, 0x56, 0x00, 0x08,
+	0x02, 0x56, 0x00, 0x08, 0x02, 0x56, 0x00, 0x08, 0x02, 0x56, 0x00, 0x08, 0x02, 0x30, 0x00, 0x48,
+	0x02, 0x06, 0x00, 0x2c, 0x02, 0x06, 0x00, 0x2c, 0x02, 0x06, 0x00, 0x2c, 0x02, 0x06, 0x00, 0x2c,
+	0x02, 0x06, 0x00, 0x2c, 0x02, 0x06, 0x00, 0x2c, 0x02, 0x5e, 0x00, 0x48, 0x02, 0x5e, 0x00, 0x48,
+	0x02, 0x70, 0x00, 0x14, 0x02, 0x70, 0x00, 0x14, 0x02, 0x0b, 0x00, 0x48, 0x02, 0x0b, 0x00, 0x48,
+	0x02, 0x0b, 0x00, 0x48, 0x02, 0x0b, 0x00, 0x48, 0x02, 0x0b, 0x00, 0x48, 0x02, 0x0b, 0x00, 0x48,
+	0x02, 0x0b, 0x00, 0x48, 0x02, 0x0b, 0x00, 0x48, 0x02, 0x0b, 0x00, 0x48, 0x02, 0x0b, 0x00, 0x48,
+	0x02, 0x53, 0x00, 0x26, 0x01, 0xf2, 0x00, 0x48, 0x02, 0x54, 0x00, 0x2d, 0x02, 0x54, 0x00, 0x2d,
+	0x02, 0x54, 0x00, 0x2d, 0x02, 0x54, 0x00, 0x2d, 0x02, 0x54, 0x00, 0x2d, 0x02, 0x82, 0x00, 0x48,
+	0x02, 0xa6, 0x00, 0x1a, 0x02, 0x82, 0x00, 0x48, 0x00, 0xe5, 0x00, 0x48, 0x00, 0xe5, 0x00, 0x2c,
+	0x00, 0xe5, 0xff, 0xe6, 0x00, 0xe5, 0xff, 0xd2, 0x00, 0xe5, 0xff, 0xf1, 0x00, 0xe5, 0x00, 0x48,
+	0x00, 0xe5, 0xff, 0xed, 0x02, 0x9a, 0x00, 0x48, 0x00, 0xe5, 0xff, 0xf8, 0x00, 0xe6, 0xff, 0xcf,
+	0x00, 0xe5, 0xff, 0xdf, 0x01, 0xad, 0x00, 0x11, 0x01, 0xad, 0x00, 0x11, 0x02, 0x43, 0x00, 0x48,
+	0x02, 0x43, 0x00, 0x48, 0x01, 0xd8, 0x00, 0x48, 0x01, 0xd8, 0x00, 0x2c, 0x01, 0xdb, 0x00, 0x48,
+	0x01, 0xd8, 0x00, 0x48, 0x01, 0xd9, 0x00, 0x48, 0x01, 0xf7, 0x00, 0x20, 0x02, 0xdf, 0x00, 0x48,
+	0x02, 0x91, 0x00, 0x48, 0x02, 0x91, 0x00, 0x48, 0x02, 0x91, 0x00, 0x48, 0x02, 0x91, 0x00, 0x48,
+	0x02, 0x91, 0x00, 0x48, 0x02, 0x91, 0x00, 0x48, 0x02, 0x89, 0x00, 0x2d, 0x02, 0x89, 0x00, 0x2d,
+	0x02, 0x89, 0x00, 0x2d, 0x02, 0x89, 0x00, 0x2d, 0x02, 0x89, 0x00, 0x2d, 0x02, 0x89, 0x00, 0x2d,
+	0x03, 0x6f, 0x00, 0x2d, 0x02, 0x89, 0x00, 0x2d, 0x02, 0x89, 0x00, 0x2d, 0x02, 0x89, 0x00, 0x2d,
+	0x02, 0x89, 0x00, 0x2d, 0x02, 0x89, 0x00, 0x2d, 0x02, 0x33, 0x00, 0x48, 0x02, 0x3c, 0x00, 0x48,
+	0x02, 0x89, 0x00, 0x2d, 0x02, 0x43, 0x00, 0x48, 0x02, 0x43, 0x00, 0x48, 0x02, 0x43, 0x00, 0x48,
+	0x02, 0x43, 0x00, 0x48, 0x01, 0xf8, 0x00, 0x2b, 0x01, 0xf8, 0x00, 0x2b, 0x01, 0xf8, 0x00, 0x2b,
+	0x01, 0xf8, 0x00, 0x2b, 0x01, 0xf8, 0x00, 0x2b, 0x01, 0xf8, 0x00, 0x2b, 0x03, 0xee, 0x00, 0x2b,
+	0x02, 0x87, 0x00, 0x43, 0x02, 0x13, 0x00, 0x0f, 0x02, 0x23, 0x00, 0x17, 0x02, 0x13, 0x00, 0x0f,
+	0x02, 0x13, 0x00, 0x0f, 0x02, 0x13, 0x00, 0x0f, 0x02, 0x79, 0x00, 0x42, 0x02, 0x79, 0x00, 0x42,
+	0x02, 0x79, 0x00, 0x42, 0x02, 0x79, 0x00, 0x42, 0x02, 0x79, 0x00, 0x42, 0x02, 0x79, 0x00, 0x42,
+	0x02, 0x79, 0x00, 0x42, 0x02, 0x79, 0x00, 0x42, 0x02, 0x79, 0x00, 0x42, 0x02, 0x79, 0x00, 0x42,
+	0x02, 0x79, 0x00, 0x42, 0x02, 0x4a, 0x00, 0x08, 0x03, 0x56, 0x00, 0x0d, 0x03, 0x56, 0x00, 0x0d,
+	0x03, 0x56, 0x00, 0x0d, 0x03, 0x56, 0x00, 0x0d, 0x03, 0x56, 0x00, 0x0d, 0x02, 0x23, 0x00, 0x04,
+	0x02, 0x23, 0x00, 0x04, 0x02, 0x3f, 0x00, 0x07, 0x02, 0x3f, 0x00, 0x07, 0x02, 0x3f, 0x00, 0x07,
+	0x02, 0x3f, 0x00, 0x07, 0x02, 0x3f, 0x00, 0x07, 0x01, 0xfc, 0x00, 0x18, 0x01, 0xfc, 0x00, 0x18,
+	0x01, 0xfc, 0x00, 0x18, 0x01, 0xfc, 0x00, 0x18, 0x02, 0x0a, 0x00, 0x1f, 0x01, 0x33, 0x00, 0x32,
+	0x01, 0x7d, 0x00, 0x32, 0x01, 0xa7, 0x00, 0x32, 0x01, 0xa7, 0x00, 0x32, 0x01, 0x68, 0x00, 0x32,
+	0x00, 0xc8, 0x00, 0x3c, 0x01, 0x33, 0x00, 0x34, 0x01, 0xe6, 0x00, 0x37, 0x01, 0x59, 0x00, 0x32,
+	0x01, 0x49, 0x00, 0x33, 0x01, 0x8b, 0x00, 0x32, 0x01, 0xed, 0x00, 0x1f, 0x01, 0xed, 0x00, 0x1f,
+	0x01, 0xed, 0x00, 0x1f, 0x01, 0xed, 0x00, 0x1f, 0x01, 0xed, 0x00, 0x1f, 0x02, 0xfe, 0x00, 0x1f,
+	0x02, 0xfe, 0x00, 0x1f, 0x01, 0xed, 0x00, 0x1f, 0x01, 0xed, 0x00, 0x1f, 0x01, 0xed, 0x00, 0x1f,
+	0x01, 0xed, 0x00, 0x1f, 0x01, 0xed, 0x00, 0x1f, 0x02, 0x1c, 0x00, 0x41, 0x01, 0xb7, 0x00, 0x2b,
+	0x01, 0xb7, 0x00, 0x2b, 0x01, 0xb7, 0x00, 0x2b, 0x01, 0xb7, 0x00, 0x2b, 0x01, 0xb7, 0x00, 0x2b,
+	0x01, 0xb7, 0x00, 0x2b, 0x02, 0x1d, 0x00, 0x2a, 0x02, 0x32, 0x00, 0x2a, 0x02, 0x1e, 0x00, 0x2a,
+	0x02, 0x25, 0x00, 0x2b, 0x01, 0xf2, 0x00, 0x2a, 0x01, 0xf2, 0x00, 0x2a, 0x01, 0xf2, 0x00, 0x2a,
+	0x01, 0xf2, 0x00, 0x2a, 0x01, 0xf2, 0x00, 0x2a, 0x01, 0xf2, 0x00, 0x2a, 0x01, 0xf2, 0x00, 0x2a,
+	0x01, 0xf2, 0x00, 0x2a, 0x01, 0xf2, 0x00, 0x2a, 0x01, 0xf2, 0x00, 0x2a, 0x01, 0xf3, 0x00, 0x29,
+	0x01, 0x5f, 0x00, 0x15, 0x01, 0x41, 0x00, 0x15, 0x02, 0x2e, 0x00, 0x15, 0x02, 0x2e, 0x00, 0x15,
+	0x02, 0x2c, 0x00, 0x15, 0x02, 0x2c, 0x00, 0x15, 0x02, 0x1a, 0x00, 0x2b, 0x02, 0x1a, 0x00, 0x2b,
+	0x02, 0x1a, 0x00, 0x2b, 0x02, 0x1a, 0x00, 0x2b, 0x02, 0x1a, 0x00, 0x2b, 0x02, 0x29, 0x00, 0x42,
+	0x02, 0x29, 0xff, 0xfc, 0x02, 0x29, 0xff, 0xca, 0x00, 0xd6, 0x00, 0x3f, 0x00, 0xd6, 0x00, 0x24,
+	0x00, 0xd6, 0xff, 0xde, 0x00, 0xd6, 0xff, 0xca, 0x00, 0xd6, 0xff, 0xe9, 0x00, 0xd6, 0xff, 0xe3,
+	0x01, 0xd0, 0x00, 0x3f, 0x00, 0xd6, 0xff, 0xf0, 0x00, 0xd8, 0xff, 0xc8, 0x00, 0xd6, 0xff, 0xd7,
+	0x00, 0xd6, 0x00, 0x42, 0x00, 0xdf, 0xff, 0xb8, 0x00, 0xdf, 0xff, 0xb8, 0x00, 0xdf, 0xff, 0xb8,
+	0x01, 0xed, 0x00, 0x42, 0x01, 0xed, 0x00, 0x42, 0x00, 0xd6, 0x00, 0x42, 0x00, 0xd6, 0x00, 0x24,
+	0x00, 0xeb, 0x00, 0x42, 0x00, 0xd6, 0x00, 0x3c, 0x01, 0x44, 0x00, 0x42, 0x01, 0x1d, 0x00, 0x1e,
+	0x03, 0x22, 0x00, 0x42, 0x02, 0x2a, 0x00, 0x42, 0x02, 0x2a, 0x00, 0x42, 0x02, 0x2a, 0xff, 0xdf,
+	0x02, 0x2a, 0x00, 0x42, 0x02, 0x2a, 0x00, 0x42, 0x02, 0x2a, 0x00, 0x42, 0x02, 0x2a, 0x00, 0x42,
+	0x02, 0x1f, 0x00, 0x2b, 0x02, 0x1f, 0x00, 0x2b, 0x02, 0x1f, 0x00, 0x2b, 0x02, 0x1f, 0x00, 0x2b,
+	0x02, 0x1f, 0x00, 0x2b, 0x03, 0x48, 0x00, 0x2b, 0x02, 0x1f, 0x00, 0x2b, 0x02, 0x1f, 0x00, 0x2b,
+	0x02, 0x1f, 0x00, 0x2b, 0x02, 0x20, 0x00, 0x2b, 0x02, 0x20, 0x00, 0x2b, 0x02, 0x1f, 0x00, 0x2b,
+	0x02, 0x1d, 0x00, 0x42, 0x02, 0x1d, 0x00, 0x42, 0x02, 0x1d, 0x00, 0x2a, 0x01, 0x61, 0x00, 0x42,
+	0x01, 0x61, 0x00, 0x42, 0x01, 0x61, 0x00, 0x26, 0x01, 0x61, 0x00, 0x3b, 0x01, 0xb7, 0x00, 0x29,
+	0x01, 0xb7, 0x00, 0x29, 0x01, 0xb7, 0x00, 0x29, 0x01, 0xb7, 0x00, 0x29, 0x01, 0xb7, 0x00, 0x29,
+	0x01, 0xb7, 0x00, 0x29, 0x02, 0x49, 0x00, 0x42, 0x01, 0x73, 0x00, 0x13, 0x01, 0x7e, 0x00, 0x1a,
+	0x01, 0x73, 0x00, 0x13, 0x01, 0x73, 0x00, 0x13, 0x01, 0x73, 0x00, 0x13, 0x02, 0x1a, 0x00, 0x3e,
+	0x02, 0x1a, 0x00, 0x3e, 0x02, 0x1a, 0x00, 0x3e, 0x02, 0x1a, 0x00, 0x3e, 0x02, 0x1a, 0x00, 0x3e,
+	0x02, 0x1a, 0x00, 0x3e, 0x02, 0x1a, 0x00, 0x3e, 0x02, 0x1a, 0x00, 0x3e, 0x02, 0x1a, 0x00, 0x3e,
+	0x02, 0x1a, 0x00, 0x3e, 0x02, 0x1a, 0x00, 0x3e, 0x01, 0xee, 0x00, 0x0a, 0x02, 0xc5, 0x00, 0x11,
+	0x02, 0xc5, 0x00, 0x11, 0x02, 0xc5, 0x00, 0x11, 0x02, 0xc5, 0x00, 0x11, 0x02, 0xc5, 0x00, 0x11,
+	0x01, 0xbe, 0x00, 0x0a, 0x01, 0xbe, 0x00, 0x0a, 0x01, 0xef, 0x00, 0x08, 0x01, 0xef, 0x00, 0x08,
+	0x01, 0xef, 0x00, 0x08, 0x01, 0xef, 0x00, 0x08, 0x01, 0xef, 0x00, 0x08, 0x01, 0xaa, 0x00, 0x1d,
+	0x01, 0xaa, 0x00, 0x1d, 0x01, 0xaa, 0x00, 0x1d, 0x01, 0xaa, 0x00, 0x1d, 0x01, 0xb4, 0x00, 0x22,
+	0x01, 0x33, 0x00, 0x32, 0x01, 0x7d, 0x00, 0x32, 0x01, 0xa7, 0x00, 0x32, 0x01, 0x4c, 0x00, 0x26,
+	0x01, 0x45, 0x00, 0x3c, 0x01, 0xa7, 0x00, 0x32, 0x00, 0xba, 0x00, 0x31, 0x00, 0xba, 0x00, 0x32,
+	0x01, 0x68, 0x00, 0x32, 0x00, 0xc8, 0x00, 0x32, 0x01, 0x33, 0x00, 0x32, 0x01, 0xe6, 0x00, 0x37,
+	0x01, 0x59, 0x00, 0x32, 0x01, 0x39, 0x00, 0x39, 0x01, 0x49, 0x00, 0x33, 0x01, 0x8b, 0x00, 0x32,
+	0x00, 0xcf, 0x00, 0x46, 0x00, 0xcf, 0x00, 0x46, 0x01, 0x35, 0x00, 0x12, 0x01, 0x34, 0x00, 0x11,
+	0x00, 0xa8, 0x00, 0x29, 0x00, 0xae, 0x00, 0x2e, 0x00, 0xca, 0x00, 0x39, 0x00, 0xc2, 0x00, 0x38,
+	0x00, 0xae, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x38, 0x00, 0xc2, 0x00, 0x38, 0x01, 0xe9, 0x00, 0x2e,
+	0x00, 0xdc, 0x00, 0x3f, 0x00, 0xd5, 0x00, 0x3c, 0x01, 0x7b, 0x00, 0x16, 0x01, 0x78, 0x00, 0x16,
+	0x02, 0xc0, 0x00, 0x2b, 0x02, 0x84, 0x00, 0x2a, 0x01, 0x77, 0x00, 0x18, 0x01, 0xd3, 0x00, 0x1c,
+	0x01, 0x63, 0x00, 0x19, 0x01, 0x85, 0x00, 0x2a, 0x01, 0xe2, 0x00, 0x1c, 0x02, 0xbe, 0x00, 0x2a,
+	0x03, 0x00, 0x00, 0x31, 0x01, 0xb3, 0x00, 0x26, 0x03, 0x04, 0x00, 0x14, 0x01, 0x5c, 0x00, 0x32,
+	0x01, 0x76, 0x00, 0x33, 0x01, 0x2a, 0x00, 0x4d, 0x01, 0x52, 0x00, 0x61, 0x00, 0xa2, 0x00, 0x27,
+	0x00, 0xa5, 0x00, 0x25, 0x00, 0xa5, 0x00, 0x25, 0x00, 0xa1, 0x00, 0x2e, 0x01, 0x41, 0x00, 0x27,
+	0x01, 0x44, 0x00, 0x25, 0x01, 0x40, 0x00, 0x2e, 0x00, 0xa7, 0x00, 0x34, 0x01, 0x38, 0x00, 0x34,
+	0x01, 0x52, 0x00, 0x23, 0x02, 0x3b, 0x00, 0x1a, 0x02, 0x80, 0x00, 0x1a, 0x03, 0xa6, 0x00, 0x1a,
+	0x01, 0xbb, 0x00, 0x2a, 0x02, 0x7f, 0x00, 0x2b, 0x01, 0xdf, 0x00, 0x27, 0x02, 0x29, 0x00, 0x1f,
+	0x01, 0xa4, 0x00, 0x25, 0x02, 0x2b, 0x00, 0x29, 0x01, 0xed, 0x00, 0x23, 0x02, 0x21, 0x00, 0x12,
+	0x02, 0x64, 0x00, 0x16, 0x02, 0x62, 0x00, 0x15, 0x02, 0xb1, 0x00, 0x28, 0x02, 0xb2, 0x00, 0x28,
+	0x02, 0x24, 0x00, 0x42, 0x02, 0x27, 0x00, 0x42, 0x02, 0x4f, 0x00, 0x19, 0x02, 0x25, 0x00, 0x1b,
+	0x02, 0x58, 0x00, 0x13, 0x02, 0x0b, 0x00, 0x14, 0x01, 0xf4, 0x00, 0x25, 0x01, 0xf4, 0x00, 0x25,
+	0x01, 0xf4, 0x00, 0x25, 0x01, 0xf4, 0x00, 0x25, 0x01, 0xf4, 0x00, 0x25, 0x01, 0xf4, 0x00, 0x25,
+	0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x51, 0x02, 0x7a, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x25,
+	0x01, 0xf4, 0x00, 0x25, 0x01, 0xf4, 0x00, 0x25, 0x01, 0xf4, 0x00, 0x25, 0x01, 0xf4, 0x00, 0x25,
+	0x01, 0xf4, 0x00, 0x25, 0x01, 0xf4, 0x00, 0x25, 0x03, 0xb7, 0x00, 0x29, 0x02, 0x51, 0x00, 0x0f,
+	0x02, 0x90, 0x00, 0x08, 0x01, 0xd3, 0x00, 0x05, 0x00, 0xdc, 0x00, 0x2c, 0x00, 0xdc, 0x00, 0x1f,
+	0x01, 0x07, 0x00, 0x46, 0x01, 0x07, 0x00, 0x19, 0x01, 0x25, 0x00, 0x0c, 0x01, 0x25, 0x00, 0x17,
+	0x01, 0x1d, 0x00, 0x16, 0x01, 0x1d, 0x00, 0x1b, 0x01, 0xe2, 0x00, 0x16, 0x01, 0xe2, 0x00, 0x1b,
+	0x01, 0xad, 0x00, 0x37, 0x01, 0xad, 0x00, 0x37, 0x02, 0x07, 0x00, 0x37, 0x03, 0x1f, 0x00, 0x37,
+	0x01, 0xe1, 0x00, 0x24, 0x02, 0x3b, 0x00, 0x31, 0x01, 0x6c, 0x00, 0x0f, 0x01, 0xc4, 0x00, 0x1c,
+	0x01, 0xc9, 0x00, 0x22, 0x02, 0x06, 0x00, 0x23, 0x01, 0xc8, 0x00, 0x28, 0x02, 0x02, 0x00, 0x2f,
+	0x01, 0xbd, 0x00, 0x1e, 0x02, 0x0b, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x21, 0x01, 0xf4, 0x00, 0x1e,
+	0x01, 0xf4, 0x00, 0x34, 0x01, 0xf4, 0x00, 0x2c, 0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x23,
+	0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x2c, 0x01, 0xf4, 0x00, 0x2c, 0x01, 0xf4, 0x00, 0x2c,
+	0x01, 0xf4, 0x00, 0x20, 0x02, 0x27, 0x00, 0x2d, 0x01, 0x72, 0x00, 0x15, 0x01, 0xb8, 0x00, 0x21,
+	0x01, 0xc3, 0x00, 0x1f, 0x02, 0x10, 0x00, 0x2b, 0x01, 0xc2, 0x00, 0x24, 0x02, 0x01, 0x00, 0x2f,
+	0x01, 0xb9, 0x00, 0x1a, 0x02, 0x09, 0x00, 0x2d, 0x01, 0xfb, 0x00, 0x1f, 0x01, 0xf4, 0x00, 0x00,
+	0x01, 0x6c, 0x00, 0x23, 0x00, 0xf3, 0x00, 0x11, 0x01, 0x27, 0x00, 0x19, 0x01, 0x25, 0x00, 0x1c,
+	0x01, 0x4e, 0x00, 0x1c, 0x01, 0x24, 0x00, 0x1e, 0x01, 0x47, 0x00, 0x22, 0x01, 0x21, 0x00, 0x1b,
+	0x01, 0x4e, 0x00, 0x21, 0x01, 0x47, 0x00, 0x1a, 0x01, 0x6c, 0x00, 0x23, 0x00, 0xf3, 0x00, 0x11,
+	0x01, 0x27, 0x00, 0x19, 0x01, 0x25, 0x00, 0x1c, 0x01, 0x4e, 0x00, 0x1c, 0x01, 0x24, 0x00, 0x1e,
+	0x01, 0x47, 0x00, 0x22, 0x01, 0x21, 0x00, 0x1a, 0x01, 0x4e, 0x00, 0x21, 0x01, 0x47, 0x00, 0x1a,
+	0x00, 0x96, 0xff, 0x97, 0x00, 0x7d, 0x00, 0x00, 0x02, 0xd1, 0x00, 0x13, 0x02, 0xcb, 0x00, 0x13,
+	0x02, 0xf3, 0x00, 0x1e, 0x02, 0x9d, 0x00, 0x15, 0x02, 0x9b, 0x00, 0x14, 0x02, 0xb0, 0x00, 0x15,
+	0x02, 0xaf, 0x00, 0x15, 0x00, 0x01, 0x00, 0x00, 0x03, 0xc0, 0xff, 0x10, 0x00, 0x00, 0x03, 0xee,
+	0xff, 0x97, 0xff, 0x96, 0x03, 0xcf, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc9, 0x00, 0x03, 0x01, 0xdf, 0x01, 0x90, 0x00, 0x05,
+	0x00, 0x00, 0x02, 0x8a, 0x02, 0x58, 0x00, 0x00, 0x00, 0x4b, 0x02, 0x8a, 0x02, 0x58, 0x00, 0x00,
+	0x01, 0x5e, 0x00, 0x3f, 0x01, 0x28, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xa0, 0x00, 0x00, 0x3f, 0x40, 0x00, 0x20, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x73, 0x70, 0x74, 0x79, 0x00, 0x40, 0x00, 0x20, 0xfb, 0x02, 0x03, 0xc0, 0xff, 0x10,
+	0x00, 0x00, 0x03, 0xc0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0xee,
+	0x02, 0x73, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x04, 0x04, 0xa2,
+	0x00, 0x00, 0x00, 0x72, 0x00, 0x40, 0x00, 0x05, 0x00, 0x32, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x7e,
+	0x01, 0x37, 0x01, 0x7e, 0x01, 0x8f, 0x01, 0x92, 0x01, 0xb6, 0x01, 0xff, 0x02, 0x1b, 0x02, 0x37,
+	0x02, 0x59, 0x02, 0xbb, 0x02, 0xc7, 0x02, 0xdd, 0x03, 0x12, 0x03, 0x26, 0x03, 0x94, 0x03, 0xa9,
+	0x03, 0xbc, 0x03, 0xc0, 0x1e, 0x85, 0x1e, 0x8b, 0x1e, 0x9e, 0x1e, 0xf3, 0x20, 0x09, 0x20, 0x14,
+	0x20, 0x1a, 0x20, 0x1e, 0x20, 0x22, 0x20, 0x26, 0x20, 0x30, 0x20, 0x3a, 0x20, 0x44, 0x20, 0x70,
+	0x20, 0x79, 0x20, 0xac, 0x20, 0xba, 0x21, 0x20, 0x21, 0x22, 0x21, 0x26, 0x21, 0x93, 0x22, 0x02,
+	0x22, 0x06, 0x22, 0x0f, 0x22, 0x12, 0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x45, 0x22, 0x48,
+	0x22, 0x60, 0x22, 0x65, 0x22, 0xc5, 0x25, 0xca, 0xfb, 0x02, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x30, 0x00, 0x3a, 0x00, 0xa0, 0x01, 0x39, 0x01, 0x8f, 0x01, 0x92, 0x01, 0xb5, 0x01, 0xfc,
+	0x02, 0x18, 0x02, 0x37, 0x02, 0x59, 0x02, 0xbb, 0x02, 0xc6, 0x02, 0xd8, 0x03, 0x12, 0x03, 0x26,
+	0x03, 0x94, 0x03, 0xa9, 0x03, 0xbc, 0x03, 0xc0, 0x1e, 0x80, 0x1e, 0x8a, 0x1e, 0x9e, 0x1e, 0xf2,
+	0x20, 0x07, 0x20, 0x13, 0x20, 0x18, 0x20, 0x1c, 0x20, 0x20, 0x20, 0x26, 0x20, 0x30, 0x20, 0x39,
+	0x20, 0x44, 0x20, 0x70, 0x20, 0x74, 0x20, 0xac, 0x20, 0xba, 0x21, 0x20, 0x21, 0x22, 0x21, 0x26,
+	0x21, 0x90, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0f, 0x22, 0x11, 0x22, 0x19, 0x22, 0x1e, 0x22, 0x2b,
+	0x22, 0x45, 0x22, 0x48, 0x22, 0x60, 0x22, 0x64, 0x22, 0xc5, 0x25, 0xca, 0xfb, 0x01, 0xff, 0xff,
+	0x00, 0x00, 0x01, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x95, 0xff, 0xca, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0x98, 0xfe, 0x5a, 0xfe, 0x92, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x11,
+	0xfd, 0xfc, 0xfd, 0xcc, 0xfd, 0xb9, 0xfd, 0xa8, 0xfd, 0xa6, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc6,
+	0x00, 0x00, 0x00, 0x00, 0xe1, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x11, 0xe1, 0x27,
+	0xe1, 0x4b, 0xe1, 0x7c, 0xe1, 0x46, 0xe1, 0x46, 0xe0, 0xaf, 0xe0, 0xa3, 0xe0, 0x24, 0xe0, 0x24,
+	0xe0, 0x3d, 0x00, 0x00, 0xdf, 0x65, 0xdf, 0x5b, 0xdf, 0x59, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x5c,
+	0xdf, 0x52, 0xdf, 0x2f, 0xdf, 0x2b, 0xdf, 0x0f, 0xdf, 0x14, 0xde, 0x71, 0xdb, 0xb1, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x72, 0x00, 0x00, 0x00, 0x8e, 0x01, 0x16, 0x02, 0x44, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0xca, 0x02, 0xcc, 0x02, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd2, 0x02, 0xd4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd2, 0x02, 0xdc,
+	0x00, 0x00, 0x02, 0xdc, 0x02, 0xde, 0x00, 0x00, 0x02, 0xe0, 0x02, 0xe4, 0x02, 0xe8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd6, 0x02, 0xd8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0xca, 0x00, 0x00, 0x00, 0x01, 0x01, 0x38, 0x01, 0x53, 0x01, 0x55, 0x01, 0x5a, 0x01, 0x56,
+	0x01, 0x3c, 0x01, 0x52, 0x01, 0x7e, 0x01, 0x7f, 0x01, 0x3e, 0x01, 0x6a, 0x01, 0x30, 0x01, 0x88,
+	0x01, 0x31, 0x01, 0x2e, 0x01, 0x33, 0x01, 0x32, 0x01, 0x76, 0x01, 0x6e, 0x01, 0x77, 0x01, 0x3a,
+	0x01, 0x3d, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x16, 0x00, 0x1a, 0x00, 0x25, 0x00, 0x26,
+	0x00, 0x2b, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x43, 0x00, 0x44, 0x00, 0x4a,
+	0x00, 0x56, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x76,
+	0x00, 0x7b, 0x00, 0x7d, 0x00, 0x82, 0x01, 0x80, 0x01, 0x2f, 0x01, 0x81, 0x01, 0x71, 0x01, 0x8c,
+	0x01, 0x26, 0x00, 0x92, 0x00, 0x9e, 0x00, 0x9f, 0x00, 0xa5, 0x00, 0xa9, 0x00, 0xb4, 0x00, 0xba,
+	0x00, 0xbf, 0x00, 0xc2, 0x00, 0xcd, 0x00, 0xd0, 0x00, 0xd2, 0x00, 0xd8, 0x00, 0xd9, 0x00, 0xe0,
+	0x00, 0xec, 0x00, 0xee, 0x00, 0xef, 0x00, 0xf3, 0x00, 0xfa, 0x00, 0xff, 0x01, 0x0a, 0x01, 0x0b,
+	0x01, 0x10, 0x01, 0x12, 0x01, 0x17, 0x01, 0x82, 0x01, 0x2c, 0x01, 0x83, 0x01, 0x72, 0x00, 0x02,
+	0x01, 0x39, 0x01, 0x58, 0x01, 0x5e, 0x01, 0x59, 0x01, 0x5f, 0x01, 0x2d, 0x01, 0x3f, 0x01, 0x24,
+	0x01, 0x43, 0x01, 0x47, 0x01, 0x86, 0x01, 0x75, 0x01, 0x89, 0x01, 0x45, 0x01, 0x28, 0x01, 0x54,
+	0x01, 0x6b, 0x01, 0xb8, 0x01, 0xb9, 0x01, 0x1c, 0x01, 0x65, 0x01, 0x42, 0x01, 0x35, 0x01, 0x20,
+	0x01, 0xb7, 0x01, 0x48, 0x01, 0x87, 0x01, 0xc2, 0x01, 0xc3, 0x01, 0xc4, 0x01, 0x3b, 0x00, 0x0a,
+	0x00, 0x04, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x13, 0x00, 0x21,
+	0x00, 0x1b, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x34, 0x00, 0x2f, 0x00, 0x31, 0x00, 0x32, 0x00, 0x19,
+	0x00, 0x48, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4e, 0x00, 0x55, 0x00, 0x4f, 0x01, 0x70, 0x00, 0x53,
+	0x00, 0x6f, 0x00, 0x6b, 0x00, 0x6d, 0x00, 0x6e, 0x00, 0x7e, 0x00, 0x57, 0x00, 0xf9, 0x00, 0x99,
+	0x00, 0x93, 0x00, 0x95, 0x00, 0x9d, 0x00, 0x96, 0x00, 0x9c, 0x00, 0x97, 0x00, 0xa2, 0x00, 0xb0,
+	0x00, 0xaa, 0x00, 0xad, 0x00, 0xae, 0x00, 0xc7, 0x00, 0xc3, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xa8,
+	0x00, 0xde, 0x00, 0xe6, 0x00, 0xe1, 0x00, 0xe3, 0x00, 0xeb, 0x00, 0xe4, 0x01, 0x6d, 0x00, 0xe9,
+	0x01, 0x04, 0x01, 0x00, 0x01, 0x02, 0x01, 0x03, 0x01, 0x13, 0x00, 0xed, 0x01, 0x15, 0x00, 0x0b,
+	0x00, 0x9a, 0x00, 0x05, 0x00, 0x94, 0x00, 0x0c, 0x00, 0x9b, 0x00, 0x11, 0x00, 0xa0, 0x00, 0x14,
+	0x00, 0xa3, 0x00, 0x15, 0x00, 0xa4, 0x00, 0x12, 0x00, 0xa1, 0x00, 0x17, 0x00, 0xa6, 0x00, 0x18,
+	0x00, 0xa7, 0x00, 0x22, 0x00, 0xb1, 0x00, 0x1c, 0x00, 0xab, 0x00, 0x20, 0x00, 0xaf, 0x00, 0x23,
+	0x00, 0xb2, 0x00, 0x1d, 0x00, 0xac, 0x00, 0x28, 0x00, 0xbc, 0x00, 0x27, 0x00, 0xbb, 0x00, 0x2a,
+	0x00, 0xbe, 0x00, 0x29, 0x00, 0xbd, 0x00, 0x2d, 0x00, 0xc1, 0x00, 0x2c, 0x00, 0xc0, 0x00, 0x38,
+	0x00, 0xcb, 0x00, 0x36, 0x00, 0xc9, 0x00, 0x30, 0x00, 0xc4, 0x00, 0x37, 0x00, 0xca, 0x00, 0x33,
+	0x00, 0xcc, 0x00, 0x35, 0x00, 0xc8, 0x00, 0x3a, 0x00, 0xce, 0x00, 0x3c, 0x00, 0xd1, 0x00, 0x3e,
+	0x00, 0xd3, 0x00, 0x40, 0x00, 0xd5, 0x00, 0x3f, 0x00, 0xd4, 0x00, 0x41, 0x00, 0xd6, 0x00, 0x42,
+	0x00, 0xd7, 0x00, 0x45, 0x00, 0xda, 0x00, 0x47, 0x00, 0xdd, 0x00, 0x46, 0x00, 0xdc, 0x00, 0xdb,
+	0x00, 0x49, 0x00, 0xdf, 0x00, 0x52, 0x00, 0xe8, 0x00, 0x4d, 0x00, 0xe2, 0x00, 0x51, 0x00, 0xe7,
+	0x00, 0x50, 0x00, 0xe5, 0x00, 0x5a, 0x00, 0xf0, 0x00, 0x5c, 0x00, 0xf2, 0x00, 0x5b, 0x00, 0xf1,
+	0x00, 0x5e, 0x00, 0xf4, 0x00, 0x61, 0x00, 0xf7, 0x00, 0x60, 0x00, 0xf6, 0x00, 0x5f, 0x00, 0xf5,
+	0x00, 0x68, 0x00, 0xfd, 0x00, 0x67, 0x00, 0xfc, 0x00, 0x66, 0x00, 0xfb, 0x00, 0x74, 0x01, 0x09,
+	0x00, 0x71, 0x01, 0x06, 0x00, 0x6c, 0x01, 0x01, 0x00, 0x73, 0x01, 0x08, 0x00, 0x70, 0x01, 0x05,
+	0x00, 0x72, 0x01, 0x07, 0x00, 0x78, 0x01, 0x0d, 0x00, 0x7f, 0x01, 0x14, 0x00, 0x80, 0x00, 0x83,
+	0x01, 0x18, 0x00, 0x85, 0x01, 0x1a, 0x00, 0x84, 0x01, 0x19, 0x00, 0x86, 0x01, 0x1b, 0x00, 0x09,
+	0x00, 0x98, 0x00, 0x54, 0x00, 0xea, 0x00, 0x62, 0x00, 0xf8, 0x00, 0x69, 0x00, 0xfe, 0x01, 0x21,
+	0x01, 0x1e, 0x01, 0x1d, 0x01, 0x25, 0x01, 0x2a, 0x01, 0x29, 0x01, 0x2b, 0x01, 0x27, 0x00, 0x7a,
+	0x01, 0x0f, 0x00, 0x77, 0x01, 0x0c, 0x00, 0x79, 0x01, 0x0e, 0x00, 0x7c, 0x01, 0x11, 0x00, 0x81,
+	0x01, 0x16, 0x01, 0xab, 0x01, 0x34, 0x01, 0xc1, 0x01, 0x4c, 0x01, 0x4e, 0x01, 0x4b, 0x01, 0x50,
+	0x01, 0x51, 0x01, 0x4f, 0x01, 0x40, 0x01, 0x41, 0x01, 0x49, 0x01, 0xc8, 0x01, 0xc6, 0x01, 0xc7,
+	0x01, 0xc5, 0x01, 0x69, 0x01, 0x6c, 0x01, 0x4a, 0x01, 0x7c, 0x00, 0xb7, 0x00, 0xb9, 0x00, 0x00,
+	0xb0, 0x00, 0x2c, 0x20, 0xb0, 0x00, 0x55, 0x58, 0x45, 0x59, 0x20, 0x20, 0x4b, 0xb8, 0x00, 0x0e,
+	0x51, 0x4b, 0xb0, 0x06, 0x53, 0x5a, 0x58, 0xb0, 0x34, 0x1b, 0xb0, 0x28, 0x59, 0x60, 0x66, 0x20,
+	0x8a, 0x55, 0x58, 0xb0, 0x02, 0x25, 0x61, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x63, 0x23, 0x62,
+	0x1b, 0x21, 0x21, 0xb0, 0x00, 0x59, 0xb0, 0x00, 0x43, 0x23, 0x44, 0xb2, 0x00, 0x01, 0x00, 0x43,
+	0x60, 0x42, 0x2d, 0xb0, 0x01, 0x2c, 0xb0, 0x20, 0x60, 0x66, 0x2d, 0xb0, 0x02, 0x2c, 0x23, 0x21,
+	0x23, 0x21, 0x2d, 0xb0, 0x03, 0x2c, 0x20, 0x64, 0xb3, 0x03, 0x14, 0x15, 0x00, 0x42, 0x43, 0xb0,
+	0x13, 0x43, 0x20, 0x60, 0x60, 0x42, 0xb1, 0x02, 0x14, 0x43, 0x42, 0xb1, 0x25, 0x03, 0x43, 0xb0,
+	0x02, 0x43, 0x54, 0x78, 0x20, 0xb0, 0x0c, 0x23, 0xb0, 0x02, 0x43, 0x43, 0x61, 0x64, 0xb0, 0x04,
+	0x50, 0x78, 0xb2, 0x02, 0x02, 0x02, 0x43, 0x60, 0x42, 0xb0, 0x21, 0x65, 0x1c, 0x21, 0xb0, 0x02,
+	0x43, 0x43, 0xb2, 0x0e, 0x15, 0x01, 0x42, 0x1c, 0x20, 0xb0, 0x02, 0x43, 0x23, 0x42, 0xb2, 0x13,
+	0x01, 0x13, 0x43, 0x60, 0x42, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0xb2, 0x16, 0x01, 0x02,
+	0x43, 0x60, 0x42, 0x2d, 0xb0, 0x04, 0x2c, 0xb0, 0x03, 0x2b, 0xb0, 0x15, 0x43, 0x58, 0x23, 0x21,
+	0x23, 0x21, 0xb0, 0x16, 0x43, 0x43, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x1b, 0x20, 0x64,
+	0x20, 0xb0, 0xc0, 0x50, 0xb0, 0x04, 0x26, 0x5a, 0xb2, 0x28, 0x01, 0x0d, 0x43, 0x45, 0x63, 0x45,
+	0xb0, 0x06, 0x45, 0x58, 0x21, 0xb0, 0x03, 0x25, 0x59, 0x52, 0x5b, 0x58, 0x21, 0x23, 0x21, 0x1b,
+	0x8a, 0x58, 0x20, 0xb0, 0x50, 0x50, 0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b, 0x20, 0xb0, 0x38, 0x50,
+	0x58, 0x21, 0xb0, 0x38, 0x59, 0x59, 0x20, 0xb1, 0x01, 0x0d, 0x43, 0x45, 0x63, 0x45, 0x61, 0x64,
+	0xb0, 0x28, 0x50, 0x58, 0x21, 0xb1, 0x01, 0x0d, 0x43, 0x45, 0x63, 0x45, 0x20, 0xb0, 0x30, 0x50,
+	0x58, 0x21, 0xb0, 0x30, 0x59, 0x1b, 0x20, 0xb0, 0xc0, 0x50, 0x58, 0x20, 0x66, 0x20, 0x8a, 0x8a,
+	0x61, 0x20, 0xb0, 0x0a, 0x50, 0x58, 0x60, 0x1b, 0x20, 0xb0, 0x20, 0x50, 0x58, 0x21, 0xb0, 0x0a,
+	0x60, 0x1b, 0x20, 0xb0, 0x36, 0x50, 0x58, 0x21, 0xb0, 0x36, 0x60, 0x1b, 0x60, 0x59, 0x59, 0x59,
+	0x1b, 0xb0, 0x02, 0x25, 0xb0, 0x0c, 0x43, 0x63, 0xb0, 0x00, 0x52, 0x58, 0xb0, 0x00, 0x4b, 0xb0,
+	0x0a, 0x50, 0x58, 0x21, 0xb0, 0x0c, 0x43, 0x1b, 0x4b, 0xb0, 0x1e, 0x50, 0x58, 0x21, 0xb0, 0x1e,
+	0x4b, 0x61, 0xb8, 0x10, 0x00, 0x63, 0xb0, 0x0c, 0x43, 0x63, 0xb8, 0x05, 0x00, 0x62, 0x59, 0x59,
+	0x64, 0x61, 0x59, 0xb0, 0x01, 0x2b, 0x59, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x59,
+	0x20, 0x64, 0xb0, 0x16, 0x43, 0x23, 0x42, 0x59, 0x2d, 0xb0, 0x05, 0x2c, 0x20, 0x45, 0x20, 0xb0,
+	0x04, 0x25, 0x61, 0x64, 0x20, 0xb0, 0x07, 0x43, 0x50, 0x58, 0xb0, 0x07, 0x23, 0x42, 0xb0, 0x08,
+	0x23, 0x42, 0x1b, 0x21, 0x21, 0x59, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x06, 0x2c, 0x23, 0x21, 0x23,
+	0x21, 0xb0, 0x03, 0x2b, 0x20, 0x64, 0xb1, 0x07, 0x62, 0x42, 0x20, 0xb0, 0x08, 0x23, 0x42, 0xb0,
+	0x06, 0x45, 0x58, 0x1b, 0xb1, 0x01, 0x0d, 0x43, 0x45, 0x63, 0xb1, 0x01, 0x0d, 0x43, 0xb0, 0x03,
+	0x60, 0x45, 0x63, 0xb0, 0x05, 0x2a, 0x21, 0x20, 0xb0, 0x08, 0x43, 0x20, 0x8a, 0x20, 0x8a, 0xb0,
+	0x01, 0x2b, 0xb1, 0x30, 0x05, 0x25, 0xb0, 0x04, 0x26, 0x51, 0x58, 0x60, 0x50, 0x1b, 0x61, 0x52,
+	0x59, 0x58, 0x23, 0x59, 0x21, 0x59, 0x20, 0xb0, 0x40, 0x53, 0x58, 0xb0, 0x01, 0x2b, 0x1b, 0x21,
+	0xb0, 0x40, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x2d, 0xb0, 0x07, 0x2c, 0xb0, 0x09,
+	0x43, 0x2b, 0xb2, 0x00, 0x02, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x08, 0x2c, 0xb0, 0x09, 0x23,
+	0x42, 0x23, 0x20, 0xb0, 0x00, 0x23, 0x42, 0x61, 0xb0, 0x02, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0,
+	0x01, 0x60, 0xb0, 0x07, 0x2a, 0x2d, 0xb0, 0x09, 0x2c, 0x20, 0x20, 0x45, 0x20, 0xb0, 0x0e, 0x43,
+	0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
+	0x01, 0x63, 0x60, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x0a, 0x2c, 0xb2, 0x09, 0x0e, 0x00, 0x43,
+	0x45, 0x42, 0x2a, 0x21, 0xb2, 0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x0b, 0x2c, 0xb0,
+	0x00, 0x43, 0x23, 0x44, 0xb2, 0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x0c, 0x2c, 0x20,
+	0x20, 0x45, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43, 0xb0, 0x04, 0x25, 0x60, 0x20, 0x45,
+	0x8a, 0x23, 0x61, 0x20, 0x64, 0x20, 0xb0, 0x20, 0x50, 0x58, 0x21, 0xb0, 0x00, 0x1b, 0xb0, 0x30,
+	0x50, 0x58, 0xb0, 0x20, 0x1b, 0xb0, 0x40, 0x59, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59,
+	0xb0, 0x03, 0x25, 0x23, 0x61, 0x44, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x0d, 0x2c, 0x20, 0x20,
+	0x45, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43, 0xb0, 0x04, 0x25, 0x60, 0x20, 0x45, 0x8a,
+	0x23, 0x61, 0x20, 0x64, 0xb0, 0x24, 0x50, 0x58, 0xb0, 0x00, 0x1b, 0xb0, 0x40, 0x59, 0x23, 0xb0,
+	0x00, 0x50, 0x58, 0x65, 0x59, 0xb0, 0x03, 0x25, 0x23, 0x61, 0x44, 0x44, 0xb0, 0x01, 0x60, 0x2d,
+	0xb0, 0x0e, 0x2c, 0x20, 0xb0, 0x00, 0x23, 0x42, 0xb3, 0x0d, 0x0c, 0x00, 0x03, 0x45, 0x50, 0x58,
+	0x21, 0x1b, 0x23, 0x21, 0x59, 0x2a, 0x21, 0x2d, 0xb0, 0x0f, 0x2c, 0xb1, 0x02, 0x02, 0x45, 0xb0,
+	0x64, 0x61, 0x44, 0x2d, 0xb0, 0x10, 0x2c, 0xb0, 0x01, 0x60, 0x20, 0x20, 0xb0, 0x0f, 0x43, 0x4a,
+	0xb0, 0x00, 0x50, 0x58, 0x20, 0xb0, 0x0f, 0x23, 0x42, 0x59, 0xb0, 0x10, 0x43, 0x4a, 0xb0, 0x00,
+	0x52, 0x58, 0x20, 0xb0, 0x10, 0x23, 0x42, 0x59, 0x2d, 0xb0, 0x11, 0x2c, 0x20, 0xb0, 0x10, 0x62,
+	0x66, 0xb0, 0x01, 0x63, 0x20, 0xb8, 0x04, 0x00, 0x63, 0x8a, 0x23, 0x61, 0xb0, 0x11, 0x43, 0x60,
+	0x20, 0x8a, 0x60, 0x20, 0xb0, 0x11, 0x23, 0x42, 0x23, 0x2d, 0xb0, 0x12, 0x2c, 0x4b, 0x54, 0x58,
+	0xb1, 0x04, 0x64, 0x44, 0x59, 0x24, 0xb0, 0x0d, 0x65, 0x23, 0x78, 0x2d, 0xb0, 0x13, 0x2c, 0x4b,
+	0x51, 0x58, 0x4b, 0x53, 0x58, 0xb1, 0x04, 0x64, 0x44, 0x59, 0x1b, 0x21, 0x59, 0x24, 0xb0, 0x13,
+	0x65, 0x23, 0x78, 0x2d, 0xb0, 0x14, 0x2c, 0xb1, 0x00, 0x12, 0x43, 0x55, 0x58, 0xb1, 0x12, 0x12,
+	0x43, 0xb0, 0x01, 0x61, 0x42, 0xb0, 0x11, 0x2b, 0x59, 0xb0, 0x00, 0x43, 0xb0, 0x02, 0x25, 0x42,
+	0xb1, 0x0f, 0x02, 0x25, 0x42, 0xb1, 0x10, 0x02, 0x25, 0x42, 0xb0, 0x01, 0x16, 0x23, 0x20, 0xb0,
+	0x03, 0x25, 0x50, 0x58, 0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x04, 0x25, 0x42, 0x8a, 0x8a, 0x20,
+	0x8a, 0x23, 0x61, 0xb0, 0x10, 0x2a, 0x21, 0x23, 0xb0, 0x01, 0x61, 0x20, 0x8a, 0x23, 0x61, 0xb0,
+	0x10, 0x2a, 0x21, 0x1b, 0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x02, 0x25, 0x42, 0xb0, 0x02, 0x25,
+	0x61, 0xb0, 0x10, 0x2a, 0x21, 0x59, 0xb0, 0x0f, 0x43, 0x47, 0xb0, 0x10, 0x43, 0x47, 0x60, 0xb0,
+	0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x20,
+	0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60,
+	0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb1, 0x00, 0x00, 0x13, 0x23, 0x44, 0xb0, 0x01, 0x43, 0xb0,
+	0x00, 0x3e, 0xb2, 0x01, 0x01, 0x01, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x15, 0x2c, 0x00, 0xb1, 0x00,
+	0x02, 0x45, 0x54, 0x58, 0xb0, 0x12, 0x23, 0x42, 0x20, 0x45, 0xb0, 0x0e, 0x23, 0x42, 0xb0, 0x0d,
+	0x23, 0xb0, 0x03, 0x60, 0x42, 0x20, 0xb0, 0x14, 0x23, 0x42, 0x20, 0x60, 0xb0, 0x01, 0x61, 0xb7,
+	0x18, 0x18, 0x01, 0x00, 0x11, 0x00, 0x13, 0x00, 0x42, 0x42, 0x42, 0x8a, 0x60, 0x20, 0xb0, 0x14,
+	0x43, 0x60, 0xb0, 0x14, 0x23, 0x42, 0xb1, 0x14, 0x08, 0x2b, 0xb0, 0x8b, 0x2b, 0x1b, 0x22, 0x59,
+	0x2d, 0xb0, 0x16, 0x2c, 0xb1, 0x00, 0x15, 0x2b, 0x2d, 0xb0, 0x17, 0x2c, 0xb1, 0x01, 0x15, 0x2b,
+	0x2d, 0xb0, 0x18, 0x2c, 0xb1, 0x02, 0x15, 0x2b, 0x2d, 0xb0, 0x19, 0x2c, 0xb1, 0x03, 0x15, 0x2b,
+	0x2d, 0xb0, 0x1a, 0x2c, 0xb1, 0x04, 0x15, 0x2b, 0x2d, 0xb0, 0x1b, 0x2c, 0xb1, 0x05, 0x15, 0x2b,
+	0x2d, 0xb0, 0x1c, 0x2c, 0xb1, 0x06, 0x15, 0x2b, 0x2d, 0xb0, 0x1d, 0x2c, 0xb1, 0x07, 0x15, 0x2b,
+	0x2d, 0xb0, 0x1e, 0x2c, 0xb1, 0x08, 0x15, 0x2b, 0x2d, 0xb0, 0x1f, 0x2c, 0xb1, 0x09, 0x15, 0x2b,
+	0x2d, 0xb0, 0x2b, 0x2c, 0x23, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x06, 0x60,
+	0x4b, 0x54, 0x58, 0x23, 0x20, 0x2e, 0xb0, 0x01, 0x5d, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb0, 0x2c,
+	0x2c, 0x23, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x16, 0x60, 0x4b, 0x54, 0x58,
+	0x23, 0x20, 0x2e, 0xb0, 0x01, 0x71, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb0, 0x2d, 0x2c, 0x23, 0x20,
+	0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x26, 0x60, 0x4b, 0x54, 0x58, 0x23, 0x20, 0x2e,
+	0xb0, 0x01, 0x72, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb0, 0x20, 0x2c, 0x00, 0xb0, 0x0f, 0x2b, 0xb1,
+	0x00, 0x02, 0x45, 0x54, 0x58, 0xb0, 0x12, 0x23, 0x42, 0x20, 0x45, 0xb0, 0x0e, 0x23, 0x42, 0xb0,
+	0x0d, 0x23, 0xb0, 0x03, 0x60, 0x42, 0x20, 0x60, 0xb0, 0x01, 0x61, 0xb5, 0x18, 0x18, 0x01, 0x00,
+	0x11, 0x00, 0x42, 0x42, 0x8a, 0x60, 0xb1, 0x14, 0x08, 0x2b, 0xb0, 0x8b, 0x2b, 0x1b, 0x22, 0x59,
+	0x2d, 0xb0, 0x21, 0x2c, 0xb1, 0x00, 0x20, 0x2b, 0x2d, 0xb0, 0x22, 0x2c, 0xb1, 0x01, 0x20, 0x2b,
+	0x2d, 0xb0, 0x23, 0x2c, 0xb1, 0x02, 0x20, 0x2b, 0x2d, 0xb0, 0x24, 0x2c, 0xb1, 0x03, 0x20, 0x2b,
+	0x2d, 0xb0, 0x25, 0x2c, 0xb1, 0x04, 0x20, 0x2b, 0x2d, 0xb0, 0x26, 0x2c, 0xb1, 0x05, 0x20, 0x2b,
+	0x2d, 0xb0, 0x27, 0x2c, 0xb1, 0x06, 0x20, 0x2b, 0x2d, 0xb0, 0x28, 0x2c, 0xb1, 0x07, 0x20, 0x2b,
+	0x2d, 0xb0, 0x29, 0x2c, 0xb1, 0x08, 0x20, 0x2b, 0x2d, 0xb0, 0x2a, 0x2c, 0xb1, 0x09, 0x20, 0x2b,
+	0x2d, 0xb0, 0x2e, 0x2c, 0x20, 0x3c, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x2f, 0x2c, 0x20, 0x60, 0xb0,
+	0x18, 0x60, 0x20, 0x43, 0x23, 0xb0, 0x01, 0x60, 0x43, 0xb0, 0x02, 0x25, 0x61, 0xb0, 0x01, 0x60,
+	0xb0, 0x2e, 0x2a, 0x21, 0x2d, 0xb0, 0x30, 0x2c, 0xb0, 0x2f, 0x2b, 0xb0, 0x2f, 0x2a, 0x2d, 0xb0,
+	0x31, 0x2c, 0x20, 0x20, 0x47, 0x20, 0x20, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20,
+	0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x61, 0x38,
+	0x23, 0x20, 0x8a, 0x55, 0x58, 0x20, 0x47, 0x20, 0x20, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00,
+	0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23,
+	0x61, 0x38, 0x1b, 0x21, 0x59, 0x2d, 0xb0, 0x32, 0x2c, 0x00, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58,
+	0xb1, 0x0e, 0x06, 0x45, 0x42, 0xb0, 0x01, 0x16, 0xb0, 0x31, 0x2a, 0xb1, 0x05, 0x01, 0x15, 0x45,
+	0x58, 0x30, 0x59, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x33, 0x2c, 0x00, 0xb0, 0x0f, 0x2b, 0xb1, 0x00,
+	0x02, 0x45, 0x54, 0x58, 0xb1, 0x0e, 0x06, 0x45, 0x42, 0xb0, 0x01, 0x16, 0xb0, 0x31, 0x2a, 0xb1,
+	0x05, 0x01, 0x15, 0x45, 0x58, 0x30, 0x59, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x34, 0x2c, 0x20, 0x35,
+	0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x35, 0x2c, 0x00, 0xb1, 0x0e, 0x06, 0x45, 0x42, 0xb0, 0x01, 0x45,
+	0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
+	0x01, 0x63, 0xb0, 0x01, 0x2b, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00,
+	0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01, 0x2b, 0xb0, 0x00, 0x16,
+	0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x3e, 0x23, 0x38, 0xb1, 0x34, 0x01, 0x15, 0x2a, 0x21,
+	0x2d, 0xb0, 0x36, 0x2c, 0x20, 0x3c, 0x20, 0x47, 0x20, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00,
+	0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb0,
+	0x00, 0x43, 0x61, 0x38, 0x2d, 0xb0, 0x37, 0x2c, 0x2e, 0x17, 0x3c, 0x2d, 0xb0, 0x38, 0x2c, 0x20,
+	0x3c, 0x20, 0x47, 0x20, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50,
+	0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb0, 0x00, 0x43, 0x61, 0xb0, 0x01,
+	0x43, 0x63, 0x38, 0x2d, 0xb0, 0x39, 0x2c, 0xb1, 0x02, 0x00, 0x16, 0x25, 0x20, 0x2e, 0x20, 0x47,
+	0xb0, 0x00, 0x23, 0x42, 0xb0, 0x02, 0x25, 0x49, 0x8a, 0x8a, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20,
+	0x58, 0x62, 0x1b, 0x21, 0x59, 0xb0, 0x01, 0x23, 0x42, 0xb2, 0x38, 0x01, 0x01, 0x15, 0x14, 0x2a,
+	0x2d, 0xb0, 0x3a, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17, 0x23, 0x42, 0xb0, 0x04, 0x25, 0xb0, 0x04,
+	0x25, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb1, 0x0c, 0x00, 0x42, 0xb0, 0x0b, 0x43, 0x2b, 0x65, 0x8a,
+	0x2e, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x2d, 0xb0, 0x3b, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17,
+	0x23, 0x42, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20,
+	0xb0, 0x06, 0x23, 0x42, 0xb1, 0x0c, 0x00, 0x42, 0xb0, 0x0b, 0x43, 0x2b, 0x20, 0xb0, 0x60, 0x50,
+	0x58, 0x20, 0xb0, 0x40, 0x51, 0x58, 0xb3, 0x04, 0x20, 0x05, 0x20, 0x1b, 0xb3, 0x04, 0x26, 0x05,
+	0x1a, 0x59, 0x42, 0x42, 0x23, 0x20, 0xb0, 0x0a, 0x43, 0x20, 0x8a, 0x23, 0x47, 0x23, 0x47, 0x23,
+	0x61, 0x23, 0x46, 0x60, 0xb0, 0x06, 0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0,
+	0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x20, 0xb0, 0x01, 0x2b, 0x20, 0x8a, 0x8a, 0x61,
+	0x20, 0xb0, 0x04, 0x43, 0x60, 0x64, 0x23, 0xb0, 0x05, 0x43, 0x61, 0x64, 0x50, 0x58, 0xb0, 0x04,
+	0x43, 0x61, 0x1b, 0xb0, 0x05, 0x43, 0x60, 0x59, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x62, 0x20, 0xb0,
+	0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x61, 0x23, 0x20, 0x20, 0xb0,
+	0x04, 0x26, 0x23, 0x46, 0x61, 0x38, 0x1b, 0x23, 0xb0, 0x0a, 0x43, 0x46, 0xb0, 0x02, 0x25, 0xb0,
+	0x0a, 0x43, 0x47, 0x23, 0x47, 0x23, 0x61, 0x60, 0x20, 0xb0, 0x06, 0x43, 0xb0, 0x02, 0x62, 0x20,
+	0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x20, 0xb0,
+	0x01, 0x2b, 0x23, 0xb0, 0x06, 0x43, 0x60, 0xb0, 0x01, 0x2b, 0xb0, 0x05, 0x25, 0x61, 0xb0, 0x05,
+	0x25, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01,
+	0x63, 0xb0, 0x04, 0x26, 0x61, 0x20, 0xb0, 0x04, 0x25, 0x60, 0x64, 0x23, 0xb0, 0x03, 0x25, 0x60,
+	0x64, 0x50, 0x58, 0x21, 0x1b, 0x23, 0x21, 0x59, 0x23, 0x20, 0x20, 0xb0, 0x04, 0x26, 0x23, 0x46,
+	0x61, 0x38, 0x59, 0x2d, 0xb0, 0x3c, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17, 0x23, 0x42, 0x20, 0x20,
+	0x20, 0xb0, 0x05, 0x26, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x23, 0x3c, 0x38, 0x2d, 0xb0,
+	0x3d, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17, 0x23, 0x42, 0x20, 0xb0, 0x0a, 0x23, 0x42, 0x20, 0x20,
+	0x20, 0x46, 0x23, 0x47, 0xb0, 0x01, 0x2b, 0x23, 0x61, 0x38, 0x2d, 0xb0, 0x3e, 0x2c, 0xb0, 0x00,
+	0x16, 0xb0, 0x17, 0x23, 0x42, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x25, 0x47, 0x23, 0x47, 0x23, 0x61,
+	0xb0, 0x00, 0x54, 0x58, 0x2e, 0x20, 0x3c, 0x23, 0x21, 0x1b, 0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25,
+	0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0xb0, 0x05, 0x25, 0xb0, 0x04, 0x25, 0x47, 0x23, 0x47, 0x23,
+	0x61, 0xb0, 0x06, 0x25, 0xb0, 0x05, 0x25, 0x49, 0xb0, 0x02, 0x25, 0x61, 0xb9, 0x08, 0x00, 0x08,
+	0x00, 0x63, 0x63, 0x23, 0x20, 0x58, 0x62, 0x1b, 0x21, 0x59, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20,
+	0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x2e, 0x23,
+	0x20, 0x20, 0x3c, 0x8a, 0x38, 0x23, 0x21, 0x59, 0x2d, 0xb0, 0x3f, 0x2c, 0xb0, 0x00, 0x16, 0xb0,
+	0x17, 0x23, 0x42, 0x20, 0xb0, 0x0a, 0x43, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0x60,
+	0xb0, 0x20, 0x60, 0x66, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59,
+	0x66, 0xb0, 0x01, 0x63, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x2d, 0xb0, 0x40, 0x2c, 0x23, 0x20,
+	0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20,
+	0x3c, 0x59, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x41, 0x2c, 0x23, 0x20, 0x2e, 0x46,
+	0xb0, 0x02, 0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x52, 0x1b, 0x50, 0x59, 0x58, 0x20, 0x3c, 0x59,
+	0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x42, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02,
+	0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x23, 0x20,
+	0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x52, 0x1b, 0x50, 0x59, 0x58, 0x20,
+	0x3c, 0x59, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x43, 0x2c, 0xb0, 0x3a, 0x2b, 0x23,
+	0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58,
+	0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x44, 0x2c, 0xb0, 0x3b, 0x2b,
+	0x8a, 0x20, 0x20, 0x3c, 0xb0, 0x06, 0x23, 0x42, 0x8a, 0x38, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02,
+	0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1,
+	0x30, 0x01, 0x14, 0x2b, 0xb0, 0x06, 0x43, 0x2e, 0xb0, 0x30, 0x2b, 0x2d, 0xb0, 0x45, 0x2c, 0xb0,
+	0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x26, 0x20, 0x20, 0x20, 0x46, 0x23, 0x47, 0x61, 0xb0,
+	0x0c, 0x23, 0x42, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x0b, 0x43, 0x2b, 0x23, 0x20, 0x3c,
+	0x20, 0x2e, 0x23, 0x38, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x46, 0x2c, 0xb1, 0x0a, 0x04,
+	0x25, 0x42, 0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e, 0x47, 0x23, 0x47,
+	0x23, 0x61, 0x20, 0xb0, 0x06, 0x23, 0x42, 0xb1, 0x0c, 0x00, 0x42, 0xb0, 0x0b, 0x43, 0x2b, 0x20,
+	0xb0, 0x60, 0x50, 0x58, 0x20, 0xb0, 0x40, 0x51, 0x58, 0xb3, 0x04, 0x20, 0x05, 0x20, 0x1b, 0xb3,
+	0x04, 0x26, 0x05, 0x1a, 0x59, 0x42, 0x42, 0x23, 0x20, 0x47, 0xb0, 0x06, 0x43, 0xb0, 0x02, 0x62,
+	0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x20, 0xb0,
+	0x01, 0x2b, 0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x04, 0x43, 0x60, 0x64, 0x23, 0xb0, 0x05, 0x43,
+	0x61, 0x64, 0x50, 0x58, 0xb0, 0x04, 0x43, 0x61, 0x1b, 0xb0, 0x05, 0x43, 0x60, 0x59, 0xb0, 0x03,
+	0x25, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01,
+	0x63, 0x61, 0xb0, 0x02, 0x25, 0x46, 0x61, 0x38, 0x23, 0x20, 0x3c, 0x23, 0x38, 0x1b, 0x21, 0x20,
+	0x20, 0x46, 0x23, 0x47, 0xb0, 0x01, 0x2b, 0x23, 0x61, 0x38, 0x21, 0x59, 0xb1, 0x30, 0x01, 0x14,
+	0x2b, 0x2d, 0xb0, 0x47, 0x2c, 0xb1, 0x00, 0x3a, 0x2b, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d,
+	0xb0, 0x48, 0x2c, 0xb1, 0x00, 0x3b, 0x2b, 0x21, 0x23, 0x20, 0x20, 0x3c, 0xb0, 0x06, 0x23, 0x42,
+	0x23, 0x38, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0xb0, 0x06, 0x43, 0x2e, 0xb0, 0x30, 0x2b, 0x2d, 0xb0,
+	0x49, 0x2c, 0xb0, 0x00, 0x15, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2, 0x00, 0x01, 0x01, 0x15,
+	0x14, 0x13, 0x2e, 0xb0, 0x36, 0x2a, 0x2d, 0xb0, 0x4a, 0x2c, 0xb0, 0x00, 0x15, 0x20, 0x47, 0xb0,
+	0x00, 0x23, 0x42, 0xb2, 0x00, 0x01, 0x01, 0x15, 0x14, 0x13, 0x2e, 0xb0, 0x36, 0x2a, 0x2d, 0xb0,
+	0x4b, 0x2c, 0xb1, 0x00, 0x01, 0x14, 0x13, 0xb0, 0x37, 0x2a, 0x2d, 0xb0, 0x4c, 0x2c, 0xb0, 0x39,
+	0x2a, 0x2d, 0xb0, 0x4d, 0x2c, 0xb0, 0x00, 0x16, 0x45, 0x23, 0x20, 0x2e, 0x20, 0x46, 0x8a, 0x23,
+	0x61, 0x38, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x4e, 0x2c, 0xb0, 0x0a, 0x23, 0x42, 0xb0,
+	0x4d, 0x2b, 0x2d, 0xb0, 0x4f, 0x2c, 0xb2, 0x00, 0x00, 0x46, 0x2b, 0x2d, 0xb0, 0x50, 0x2c, 0xb2,
+	0x00, 0x01, 0x46, 0x2b, 0x2d, 0xb0, 0x51, 0x2c, 0xb2, 0x01, 0x00, 0x46, 0x2b, 0x2d, 0xb0, 0x52,
+	0x2c, 0xb2, 0x01, 0x01, 0x46, 0x2b, 0x2d, 0xb0, 0x53, 0x2c, 0xb2, 0x00, 0x00, 0x47, 0x2b, 0x2d,
+	0xb0, 0x54, 0x2c, 0xb2, 0x00, 0x01, 0x47, 0x2b, 0x2d, 0xb0, 0x55, 0x2c, 0xb2, 0x01, 0x00, 0x47,
+	0x2b, 0x2d, 0xb0, 0x56, 0x2c, 0xb2, 0x01, 0x01, 0x47, 0x2b, 0x2d, 0xb0, 0x57, 0x2c, 0xb3, 0x00,
+	0x00, 0x00, 0x43, 0x2b, 0x2d, 0xb0, 0x58, 0x2c, 0xb3, 0x00, 0x01, 0x00, 0x43, 0x2b, 0x2d, 0xb0,
+	0x59, 0x2c, 0xb3, 0x01, 0x00, 0x00, 0x43, 0x2b, 0x2d, 0xb0, 0x5a, 0x2c, 0xb3, 0x01, 0x01, 0x00,
+	0x43, 0x2b, 0x2d, 0xb0, 0x5b, 0x2c, 0xb3, 0x00, 0x00, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5c, 0x2c,
+	0xb3, 0x00, 0x01, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5d, 0x2c, 0xb3, 0x01, 0x00, 0x01, 0x43, 0x2b,
+	0x2d, 0xb0, 0x5e, 0x2c, 0xb3, 0x01, 0x01, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5f, 0x2c, 0xb2, 0x00,
+	0x00, 0x45, 0x2b, 0x2d, 0xb0, 0x60, 0x2c, 0xb2, 0x00, 0x01, 0x45, 0x2b, 0x2d, 0xb0, 0x61, 0x2c,
+	0xb2, 0x01, 0x00, 0x45, 0x2b, 0x2d, 0xb0, 0x62, 0x2c, 0xb2, 0x01, 0x01, 0x45, 0x2b, 0x2d, 0xb0,
+	0x63, 0x2c, 0xb2, 0x00, 0x00, 0x48, 0x2b, 0x2d, 0xb0, 0x64, 0x2c, 0xb2, 0x00, 0x01, 0x48, 0x2b,
+	0x2d, 0xb0, 0x65, 0x2c, 0xb2, 0x01, 0x00, 0x48, 0x2b, 0x2d, 0xb0, 0x66, 0x2c, 0xb2, 0x01, 0x01,
+	0x48, 0x2b, 0x2d, 0xb0, 0x67, 0x2c, 0xb3, 0x00, 0x00, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x68, 0x2c,
+	0xb3, 0x00, 0x01, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x69, 0x2c, 0xb3, 0x01, 0x00, 0x00, 0x44, 0x2b,
+	0x2d, 0xb0, 0x6a, 0x2c, 0xb3, 0x01, 0x01, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x6b, 0x2c, 0xb3, 0x00,
+	0x00, 0x01, 0x44, 0x2b, 0x2d, 0xb0, 0x6c, 0x2c, 0xb3, 0x00, 0x01, 0x01, 0x44, 0x2b, 0x2d, 0xb0,
+	0x6d, 0x2c, 0xb3, 0x01, 0x00, 0x01, 0x44, 0x2b, 0x2d, 0xb0, 0x6e, 0x2c, 0xb3, 0x01, 0x01, 0x01,
+	0x44, 0x2b, 0x2d, 0xb0, 0x6f, 0x2c, 0xb1, 0x00, 0x3c, 0x2b, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b,
+	0x2d, 0xb0, 0x70, 0x2c, 0xb1, 0x00, 0x3c, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x71, 0x2c, 0xb1,
+	0x00, 0x3c, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x72, 0x2c, 0xb0, 0x00, 0x16, 0xb1, 0x00, 0x3c,
+	0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x73, 0x2c, 0xb1, 0x01, 0x3c, 0x2b, 0xb0, 0x40, 0x2b, 0x2d,
+	0xb0, 0x74, 0x2c, 0xb1, 0x01, 0x3c, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x75, 0x2c, 0xb0, 0x00,
+	0x16, 0xb1, 0x01, 0x3c, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x76, 0x2c, 0xb1, 0x00, 0x3d, 0x2b,
+	0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x77, 0x2c, 0xb1, 0x00, 0x3d, 0x2b, 0xb0, 0x40,
+	0x2b, 0x2d, 0xb0, 0x78, 0x2c, 0xb1, 0x00, 0x3d, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x79, 0x2c,
+	0xb1, 0x00, 0x3d, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x7a, 0x2c, 0xb1, 0x01, 0x3d, 0x2b, 0xb0,
+	0x40, 0x2b, 0x2d, 0xb0, 0x7b, 0x2c, 0xb1, 0x01, 0x3d, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x7c,
+	0x2c, 0xb1, 0x01, 0x3d, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x7d, 0x2c, 0xb1, 0x00, 0x3e, 0x2b,
+	0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x7e, 0x2c, 0xb1, 0x00, 0x3e, 0x2b, 0xb0, 0x40,
+	0x2b, 0x2d, 0xb0, 0x7f, 0x2c, 0xb1, 0x00, 0x3e, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x80, 0x2c,
+	0xb1, 0x00, 0x3e, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x81, 0x2c, 0xb1, 0x01, 0x3e, 0x2b, 0xb0,
+	0x40, 0x2b, 0x2d, 0xb0, 0x82, 0x2c, 0xb1, 0x01, 0x3e, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x83,
+	0x2c, 0xb1, 0x01, 0x3e, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x84, 0x2c, 0xb1, 0x00, 0x3f, 0x2b,
+	0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x85, 0x2c, 0xb1, 0x00, 0x3f, 0x2b, 0xb0, 0x40,
+	0x2b, 0x2d, 0xb0, 0x86, 0x2c, 0xb1, 0x00, 0x3f, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x87, 0x2c,
+	0xb1, 0x00, 0x3f, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x88, 0x2c, 0xb1, 0x01, 0x3f, 0x2b, 0xb0,
+	0x40, 0x2b, 0x2d, 0xb0, 0x89, 0x2c, 0xb1, 0x01, 0x3f, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x8a,
+	0x2c, 0xb1, 0x01, 0x3f, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x8b, 0x2c, 0xb2, 0x0b, 0x00, 0x03,
+	0x45, 0x50, 0x58, 0xb0, 0x06, 0x1b, 0xb2, 0x04, 0x02, 0x03, 0x45, 0x58, 0x23, 0x21, 0x1b, 0x21,
+	0x59, 0x59, 0x42, 0x2b, 0xb0, 0x08, 0x65, 0xb0, 0x03, 0x24, 0x50, 0x78, 0xb1, 0x05, 0x01, 0x15,
+	0x45, 0x58, 0x30, 0x59, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xb8, 0x00, 0xc8, 0x52, 0x58, 0xb1,
+	0x01, 0x01, 0x8e, 0x59, 0xb0, 0x01, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x70, 0xb1, 0x00, 0x07,
+	0x42, 0xb4, 0x00, 0x2b, 0x1b, 0x03, 0x00, 0x2a, 0xb1, 0x00, 0x07, 0x42, 0xb7, 0x30, 0x04, 0x20,
+	0x08, 0x12, 0x07, 0x03, 0x0a, 0x2a, 0xb1, 0x00, 0x07, 0x42, 0xb7, 0x34, 0x02, 0x28, 0x06, 0x19,
+	0x05, 0x03, 0x0a, 0x2a, 0xb1, 0x00, 0x0a, 0x42, 0xbc, 0x0c, 0x40, 0x08, 0x40, 0x04, 0xc0, 0x00,
+	0x03, 0x00, 0x0b, 0x2a, 0xb1, 0x00, 0x0d, 0x42, 0xbc, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+	0x03, 0x00, 0x0b, 0x2a, 0xb9, 0x00, 0x03, 0x00, 0x00, 0x44, 0xb1, 0x24, 0x01, 0x88, 0x51, 0x58,
+	0xb0, 0x40, 0x88, 0x58, 0xb9, 0x00, 0x03, 0x00, 0x64, 0x44, 0xb1, 0x28, 0x01, 0x88, 0x51, 0x58,
+	0xb8, 0x08, 0x00, 0x88, 0x58, 0xb9, 0x00, 0x03, 0x00, 0x00, 0x44, 0x59, 0x1b, 0xb1, 0x27, 0x01,
+	0x88, 0x51, 0x58, 0xba, 0x08, 0x80, 0x00, 0x01, 0x04, 0x40, 0x88, 0x63, 0x54, 0x58, 0xb9, 0x00,
+	0x03, 0x00, 0x00, 0x44, 0x59, 0x59, 0x59, 0x59, 0x59, 0xb7, 0x32, 0x02, 0x22, 0x06, 0x14, 0x05,
+	0x03, 0x0e, 0x2a, 0xb8, 0x01, 0xff, 0x85, 0xb0, 0x04, 0x8d, 0xb1, 0x02, 0x00, 0x44, 0xb3, 0x05,
+	0x64, 0x06, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18,
+	0x02, 0x87, 0x00, 0x00, 0x01, 0xee, 0x00, 0x00, 0xff, 0x68, 0x02, 0x87, 0x00, 0x00, 0x01, 0xee,
+	0x00, 0x00, 0xff, 0x68, 0x00, 0x52, 0x00, 0x52, 0x00, 0x4b, 0x00, 0x4b, 0x02, 0x73, 0x00, 0x00,
+	0x02, 0x99, 0x01, 0xee, 0x00, 0x00, 0xff, 0x68, 0x02, 0x7d, 0xff, 0xf8, 0x02, 0x99, 0x01, 0xf8,
+	0xff, 0xf8, 0xff, 0x5e, 0x00, 0x40, 0x00, 0x40, 0x00, 0x3b, 0x00, 0x3b, 0x02, 0x73, 0x01, 0x0e,
+	0x02, 0x79, 0x01, 0x09, 0x00, 0x00, 0x00, 0x0e, 0x00, 0xae, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+	0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x0e,
+	0x00, 0xa8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0e, 0x00, 0xb6, 0x00, 0x03,
+	0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x34, 0x00, 0xc4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+	0x00, 0x04, 0x00, 0x0e, 0x00, 0xa8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x74,
+	0x00, 0xf8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x1e, 0x01, 0x6c, 0x00, 0x03,
+	0x00, 0x01, 0x04, 0x09, 0x00, 0x07, 0x00, 0x46, 0x01, 0x8a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+	0x00, 0x08, 0x00, 0x12, 0x01, 0xd0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x1a,
+	0x01, 0xe2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0b, 0x00, 0x26, 0x01, 0xfc, 0x00, 0x03,
+	0x00, 0x01, 0x04, 0x09, 0x00, 0x0c, 0x00, 0x26, 0x01, 0xfc, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+	0x00, 0x0d, 0x00, 0x32, 0x02, 0x22, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0e, 0x00, 0x34,
+	0x02, 0x54, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67,
+	0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x39, 0x00, 0x20,
+	0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x42, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x6e,
+	0x00, 0x6b, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x70, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6a,
+	0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x20, 0x00, 0x61, 0x00, 0x75, 0x00, 0x74, 0x00, 0x68,
+	0x00, 0x6f, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x28, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74,
+	0x00, 0x70, 0x00, 0x73, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x67, 0x00, 0x69, 0x00, 0x74,
+	0x00, 0x68, 0x00, 0x75, 0x00, 0x62, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x2f,
+	0x00, 0x73, 0x00, 0x75, 0x00, 0x70, 0x00, 0x65, 0x00, 0x72, 0x00, 0x74, 0x00, 0x79, 0x00, 0x70,
+	0x00, 0x65, 0x00, 0x2d, 0x00, 0x64, 0x00, 0x65, 0x00, 0x2f, 0x00, 0x42, 0x00, 0x6c, 0x00, 0x69,
+	0x00, 0x6e, 0x00, 0x6b, 0x00, 0x65, 0x00, 0x72, 0x00, 0x29, 0x00, 0x42, 0x00, 0x6c, 0x00, 0x69,
+	0x00, 0x6e, 0x00, 0x6b, 0x00, 0x65, 0x00, 0x72, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75,
+	0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x31, 0x00, 0x35,
+	0x00, 0x3b, 0x00, 0x73, 0x00, 0x70, 0x00, 0x74, 0x00, 0x79, 0x00, 0x3b, 0x00, 0x42, 0x00, 0x6c,
+	0x00, 0x69, 0x00, 0x6e, 0x00, 0x6b, 0x00, 0x65, 0x00, 0x72, 0x00, 0x2d, 0x00, 0x52, 0x00, 0x65,
+	0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72,
+	0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x30,
+	0x00, 0x31, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x50, 0x00, 0x53, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e,
+	0x00, 0x31, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x68, 0x00, 0x6f, 0x00, 0x74, 0x00, 0x63, 0x00, 0x6f,
+	0x00, 0x6e, 0x00, 0x76, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x2e, 0x00, 0x38,
+	0x00, 0x38, 0x00, 0x3b, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x74,
+	0x00, 0x66, 0x00, 0x2e, 0x00, 0x6c, 0x00, 0x69, 0x00, 0x62, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x35,
+	0x00, 0x2e, 0x00, 0x36, 0x00, 0x34, 0x00, 0x37, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x42,
+	0x00, 0x6c, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x6b, 0x00, 0x65, 0x00, 0x72, 0x00, 0x2d, 0x00, 0x52,
+	0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x42, 0x00, 0x6c,
+	0x00, 0x69, 0x00, 0x6e, 0x00, 0x6b, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73,
+	0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65,
+	0x00, 0x6d, 0x00, 0x61, 0x00, 0x72, 0x00, 0x6b, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x20,
+	0x00, 0x73, 0x00, 0x75, 0x00, 0x70, 0x00, 0x65, 0x00, 0x72, 0x00, 0x74, 0x00, 0x79, 0x00, 0x70,
+	0x00, 0x65, 0x00, 0x73, 0x00, 0x75, 0x00, 0x70, 0x00, 0x65, 0x00, 0x72, 0x00, 0x74, 0x00, 0x79,
+	0x00, 0x70, 0x00, 0x65, 0x00, 0x4a, 0x00, 0x75, 0x00, 0x65, 0x00, 0x72, 0x00, 0x67, 0x00, 0x65,
+	0x00, 0x6e, 0x00, 0x20, 0x00, 0x48, 0x00, 0x75, 0x00, 0x62, 0x00, 0x65, 0x00, 0x72, 0x00, 0x68,
+	0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x73, 0x00, 0x75,
+	0x00, 0x70, 0x00, 0x65, 0x00, 0x72, 0x00, 0x74, 0x00, 0x79, 0x00, 0x70, 0x00, 0x65, 0x00, 0x2e,
+	0x00, 0x64, 0x00, 0x65, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x70,
+	0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20,
+	0x00, 0x4c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20,
+	0x00, 0x31, 0x00, 0x2e, 0x00, 0x31, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a,
+	0x00, 0x2f, 0x00, 0x2f, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00, 0x74,
+	0x00, 0x73, 0x00, 0x2e, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72,
+	0x00, 0x67, 0x00, 0x2f, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x88, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc9, 0x00, 0x00,
+	0x00, 0x03, 0x01, 0x02, 0x00, 0x24, 0x00, 0xc9, 0x01, 0x03, 0x00, 0xc7, 0x00, 0x62, 0x00, 0x90,
+	0x01, 0x04, 0x00, 0xad, 0x01, 0x05, 0x01, 0x06, 0x00, 0x63, 0x00, 0xae, 0x00, 0x25, 0x00, 0x26,
+	0x00, 0xfd, 0x00, 0xff, 0x00, 0x64, 0x01, 0x07, 0x01, 0x08, 0x00, 0x27, 0x01, 0x09, 0x01, 0x0a,
+	0x00, 0xe9, 0x00, 0x28, 0x00, 0x65, 0x01, 0x0b, 0x01, 0x0c, 0x00, 0xc8, 0x00, 0xca, 0x01, 0x0d,
+	0x00, 0xcb, 0x01, 0x0e, 0x01, 0x0f, 0x01, 0x10, 0x00, 0x29, 0x00, 0x2a, 0x00, 0xf8, 0x01, 0x11,
+	0x01, 0x12, 0x01, 0x13, 0x00, 0x2b, 0x01, 0x14, 0x01, 0x15, 0x00, 0x2c, 0x00, 0xcc, 0x01, 0x16,
+	0x00, 0xcd, 0x00, 0xce, 0x00, 0xfa, 0x00, 0xcf, 0x01, 0x17, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1a,
+	0x00, 0x2d, 0x01, 0x1b, 0x00, 0x2e, 0x01, 0x1c, 0x00, 0x2f, 0x01, 0x1d, 0x01, 0x1e, 0x01, 0x1f,
+	0x01, 0x20, 0x00, 0xe2, 0x00, 0x30, 0x00, 0x31, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x00, 0x66,
+	0x01, 0x24, 0x00, 0x32, 0x00, 0xd3, 0x00, 0xd0, 0x01, 0x25, 0x00, 0xd1, 0x00, 0x67, 0x00, 0xb0,
+	0x01, 0x26, 0x01, 0x27, 0x00, 0x91, 0x01, 0x28, 0x00, 0xaf, 0x00, 0x33, 0x00, 0xed, 0x00, 0x34,
+	0x00, 0x35, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x2b, 0x00, 0x36, 0x01, 0x2c, 0x00, 0xe4, 0x00, 0xfb,
+	0x01, 0x2d, 0x01, 0x2e, 0x01, 0x2f, 0x01, 0x30, 0x00, 0x37, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33,
+	0x01, 0x34, 0x00, 0x38, 0x00, 0xd4, 0x01, 0x35, 0x00, 0xd5, 0x00, 0x68, 0x00, 0xd6, 0x01, 0x36,
+	0x01, 0x37, 0x01, 0x38, 0x01, 0x39, 0x01, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x01, 0x3b, 0x01, 0x3c,
+	0x01, 0x3d, 0x01, 0x3e, 0x00, 0x3b, 0x01, 0x3f, 0x00, 0x3c, 0x00, 0xeb, 0x01, 0x40, 0x00, 0xbb,
+	0x01, 0x41, 0x00, 0x3d, 0x01, 0x42, 0x00, 0xe6, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46,
+	0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e,
+	0x01, 0x4f, 0x00, 0x44, 0x00, 0x69, 0x01, 0x50, 0x00, 0x6b, 0x00, 0x6c, 0x00, 0xa0, 0x01, 0x51,
+	0x00, 0x6a, 0x01, 0x52, 0x01, 0x53, 0x00, 0x6e, 0x00, 0x6d, 0x00, 0x45, 0x00, 0x46, 0x00, 0xfe,
+	0x01, 0x00, 0x00, 0x6f, 0x01, 0x54, 0x01, 0x55, 0x00, 0x47, 0x01, 0x56, 0x01, 0x01, 0x00, 0xea,
+	0x00, 0x48, 0x00, 0x70, 0x01, 0x57, 0x01, 0x58, 0x00, 0x72, 0x00, 0x73, 0x01, 0x59, 0x00, 0x71,
+	0x01, 0x5a, 0x01, 0x5b, 0x01, 0x5c, 0x00, 0x49, 0x01, 0x5d, 0x01, 0x5e, 0x01, 0x5f, 0x01, 0x60,
+	0x01, 0x61, 0x00, 0x4a, 0x00, 0xf9, 0x01, 0x62, 0x01, 0x63, 0x01, 0x64, 0x00, 0x4b, 0x01, 0x65,
+	0x01, 0x66, 0x00, 0x4c, 0x00, 0x74, 0x01, 0x67, 0x00, 0x76, 0x00, 0x77, 0x00, 0x75, 0x01, 0x68,
+	0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x00, 0xd7, 0x00, 0x4d, 0x01, 0x6c, 0x01, 0x6d, 0x00, 0x4e,
+	0x01, 0x6e, 0x00, 0x4f, 0x01, 0x6f, 0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x00, 0xe3, 0x00, 0x50,
+	0x00, 0x51, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01, 0x76, 0x00, 0x78, 0x01, 0x77, 0x00, 0x52,
+	0x00, 0x79, 0x01, 0x78, 0x00, 0x7b, 0x00, 0x7c, 0x00, 0xb1, 0x00, 0x7a, 0x01, 0x79, 0x01, 0x7a,
+	0x00, 0xa1, 0x01, 0x7b, 0x00, 0x7d, 0x00, 0x53, 0x00, 0xee, 0x00, 0x54, 0x00, 0x55, 0x01, 0x7c,
+	0x01, 0x7d, 0x01, 0x7e, 0x00, 0x56, 0x01, 0x7f, 0x00, 0xe5, 0x00, 0xfc, 0x01, 0x80, 0x01, 0x81,
+	0x00, 0x89, 0x00, 0x57, 0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x00, 0x58, 0x00, 0x7e,
+	0x01, 0x86, 0x00, 0x80, 0x00, 0x81, 0x00, 0x7f, 0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x01, 0x8a,
+	0x01, 0x8b, 0x00, 0x59, 0x00, 0x5a, 0x01, 0x8c, 0x01, 0x8d, 0x01, 0x8e, 0x01, 0x8f, 0x00, 0x5b,
+	0x01, 0x90, 0x00, 0x5c, 0x00, 0xec, 0x01, 0x91, 0x00, 0xba, 0x01, 0x92, 0x00, 0x5d, 0x01, 0x93,
+	0x00, 0xe7, 0x01, 0x94, 0x01, 0x95, 0x00, 0x8d, 0x00, 0xdb, 0x00, 0xe1, 0x01, 0x96, 0x00, 0xde,
+	0x00, 0xd8, 0x01, 0x97, 0x01, 0x98, 0x00, 0x8e, 0x00, 0xdc, 0x00, 0x43, 0x00, 0xdf, 0x00, 0xda,
+	0x00, 0xe0, 0x00, 0xdd, 0x00, 0xd9, 0x00, 0x5f, 0x00, 0xe8, 0x00, 0x12, 0x00, 0x3f, 0x00, 0x0f,
+	0x00, 0x11, 0x00, 0x1e, 0x00, 0x1d, 0x01, 0x99, 0x00, 0xc3, 0x01, 0x9a, 0x00, 0xab, 0x00, 0x04,
+	0x00, 0xa3, 0x00, 0x22, 0x00, 0xa2, 0x00, 0x09, 0x00, 0x23, 0x00, 0x0d, 0x00, 0x86, 0x00, 0x82,
+	0x00, 0xc2, 0x00, 0x88, 0x00, 0x8b, 0x01, 0x9b, 0x00, 0x8a, 0x00, 0x8c, 0x00, 0x9d, 0x00, 0x9e,
+	0x00, 0x87, 0x01, 0x9c, 0x00, 0xc4, 0x00, 0xb6, 0x01, 0x9d, 0x00, 0xb7, 0x00, 0xc5, 0x00, 0xb4,
+	0x00, 0xb5, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x83, 0x00, 0x06, 0x00, 0x08, 0x00, 0xc6, 0x00, 0x84,
+	0x00, 0xbd, 0x00, 0x07, 0x01, 0x9e, 0x00, 0xa6, 0x01, 0x9f, 0x00, 0x85, 0x00, 0x96, 0x01, 0xa0,
+	0x00, 0xa8, 0x01, 0xa1, 0x00, 0x9f, 0x01, 0xa2, 0x00, 0x97, 0x00, 0x9b, 0x00, 0x98, 0x00, 0x9a,
+	0x00, 0x99, 0x00, 0x0e, 0x00, 0x93, 0x00, 0xef, 0x00, 0xb8, 0x00, 0x20, 0x00, 0x8f, 0x00, 0xf0,
+	0x00, 0x41, 0x00, 0x61, 0x00, 0xa7, 0x01, 0xa3, 0x00, 0xa4, 0x00, 0x1f, 0x00, 0x21, 0x00, 0x94,
+	0x00, 0x95, 0x00, 0x92, 0x00, 0xb9, 0x00, 0xa5, 0x00, 0x9c, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x3e,
+	0x00, 0x40, 0x00, 0x5e, 0x00, 0x60, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xa9, 0x00, 0xaa, 0x00, 0x10,
+	0x01, 0xa4, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0x42, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
+	0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x01, 0xa5, 0x01, 0xa6,
+	0x01, 0xa7, 0x01, 0xa8, 0x01, 0xa9, 0x01, 0xaa, 0x01, 0xab, 0x01, 0xac, 0x01, 0xad, 0x01, 0xae,
+	0x01, 0xaf, 0x01, 0xb0, 0x01, 0xb1, 0x01, 0xb2, 0x01, 0xb3, 0x01, 0xb4, 0x01, 0xb5, 0x01, 0xb6,
+	0x01, 0xb7, 0x01, 0xb8, 0x01, 0xb9, 0x01, 0xba, 0x01, 0xbb, 0x01, 0xbc, 0x01, 0xbd, 0x01, 0xbe,
+	0x01, 0xbf, 0x01, 0xc0, 0x01, 0xc1, 0x01, 0xc2, 0x01, 0xc3, 0x01, 0xc4, 0x01, 0xc5, 0x01, 0xc6,
+	0x01, 0xc7, 0x01, 0xc8, 0x01, 0xc9, 0x01, 0xca, 0x01, 0xcb, 0x01, 0xcc, 0x01, 0xcd, 0x00, 0xbc,
+	0x01, 0xce, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf6, 0x01, 0xcf, 0x01, 0xd0, 0x01, 0xd1, 0x01, 0xd2,
+	0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x41, 0x30, 0x06, 0x41, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07,
+	0x41, 0x45, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x41, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07,
+	0x41, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x0b, 0x43, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
+	0x6c, 0x65, 0x78, 0x0a, 0x43, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x44,
+	0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x44, 0x63, 0x72, 0x6f, 0x61, 0x74, 0x06, 0x45, 0x62, 0x72,
+	0x65, 0x76, 0x65, 0x06, 0x45, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0a, 0x45, 0x64, 0x6f, 0x74, 0x61,
+	0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x45, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x45, 0x6f,
+	0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x38, 0x46, 0x0b, 0x47, 0x63,
+	0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x32,
+	0x32, 0x0a, 0x47, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x04, 0x48, 0x62, 0x61,
+	0x72, 0x0b, 0x48, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x06, 0x49, 0x62,
+	0x72, 0x65, 0x76, 0x65, 0x02, 0x49, 0x4a, 0x07, 0x49, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07,
+	0x49, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x06, 0x49, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x0b, 0x4a,
+	0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31,
+	0x33, 0x36, 0x06, 0x4c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x4c, 0x63, 0x61, 0x72, 0x6f, 0x6e,
+	0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x33, 0x42, 0x04, 0x4c, 0x64, 0x6f, 0x74, 0x06, 0x4e, 0x61,
+	0x63, 0x75, 0x74, 0x65, 0x06, 0x4e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30,
+	0x31, 0x34, 0x35, 0x03, 0x45, 0x6e, 0x67, 0x06, 0x4f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x0d, 0x4f,
+	0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x07, 0x4f, 0x6d, 0x61,
+	0x63, 0x72, 0x6f, 0x6e, 0x0b, 0x4f, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x61, 0x63, 0x75, 0x74, 0x65,
+	0x06, 0x52, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x52, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x75,
+	0x6e, 0x69, 0x30, 0x31, 0x35, 0x36, 0x06, 0x53, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x53, 0x63,
+	0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31,
+	0x38, 0x03, 0x53, 0x5f, 0x53, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x39, 0x45, 0x04, 0x54, 0x62,
+	0x61, 0x72, 0x06, 0x54, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x36,
+	0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x41, 0x06, 0x55, 0x62, 0x72, 0x65, 0x76, 0x65,
+	0x0d, 0x55, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x07, 0x55,
+	0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x55, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x05, 0x55,
+	0x72, 0x69, 0x6e, 0x67, 0x06, 0x55, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x06, 0x57, 0x61, 0x63, 0x75,
+	0x74, 0x65, 0x0b, 0x57, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x09, 0x57,
+	0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x06, 0x57, 0x67, 0x72, 0x61, 0x76, 0x65, 0x07,
+	0x75, 0x6e, 0x69, 0x31, 0x45, 0x38, 0x41, 0x0b, 0x59, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
+	0x6c, 0x65, 0x78, 0x06, 0x59, 0x67, 0x72, 0x61, 0x76, 0x65, 0x06, 0x5a, 0x61, 0x63, 0x75, 0x74,
+	0x65, 0x0a, 0x5a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x75, 0x6e, 0x69,
+	0x30, 0x31, 0x42, 0x35, 0x08, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x75, 0x63, 0x08, 0x62, 0x72,
+	0x65, 0x76, 0x65, 0x2e, 0x75, 0x63, 0x08, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x75, 0x63, 0x0d,
+	0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2e, 0x75, 0x63, 0x0b, 0x64, 0x69,
+	0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2e, 0x75, 0x63, 0x0c, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63,
+	0x65, 0x6e, 0x74, 0x2e, 0x75, 0x63, 0x08, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2e, 0x75, 0x63, 0x0f,
+	0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x2e, 0x75, 0x63, 0x09,
+	0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x2e, 0x75, 0x63, 0x07, 0x72, 0x69, 0x6e, 0x67, 0x2e, 0x75,
+	0x63, 0x08, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2e, 0x75, 0x63, 0x06, 0x61, 0x62, 0x72, 0x65, 0x76,
+	0x65, 0x07, 0x61, 0x65, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x61, 0x6d, 0x61, 0x63, 0x72, 0x6f,
+	0x6e, 0x07, 0x61, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x0b, 0x63, 0x63, 0x69, 0x72, 0x63, 0x75,
+	0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0a, 0x63, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74,
+	0x06, 0x64, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x06, 0x65, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x65,
+	0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0a, 0x65, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74,
+	0x07, 0x65, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x65, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b,
+	0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x35, 0x39, 0x05, 0x66, 0x2e, 0x61, 0x6c, 0x74, 0x03, 0x66,
+	0x5f, 0x69, 0x07, 0x75, 0x6e, 0x69, 0x46, 0x42, 0x30, 0x31, 0x03, 0x66, 0x5f, 0x6c, 0x07, 0x75,
+	0x6e, 0x69, 0x46, 0x42, 0x30, 0x32, 0x0b, 0x67, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c,
+	0x65, 0x78, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x32, 0x33, 0x0a, 0x67, 0x64, 0x6f, 0x74, 0x61,
+	0x63, 0x63, 0x65, 0x6e, 0x74, 0x04, 0x68, 0x62, 0x61, 0x72, 0x0b, 0x68, 0x63, 0x69, 0x72, 0x63,
+	0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x06, 0x69, 0x62, 0x72, 0x65, 0x76, 0x65, 0x02, 0x69, 0x6a,
+	0x07, 0x69, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x69, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b,
+	0x06, 0x69, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x0b, 0x6a, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
+	0x6c, 0x65, 0x78, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x33, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30,
+	0x31, 0x33, 0x37, 0x06, 0x6c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x6c, 0x63, 0x61, 0x72, 0x6f,
+	0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x33, 0x43, 0x04, 0x6c, 0x64, 0x6f, 0x74, 0x06, 0x6e,
+	0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x6e, 0x61, 0x70, 0x6f, 0x73, 0x74, 0x72, 0x6f, 0x70, 0x68,
+	0x65, 0x06, 0x6e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x34, 0x36,
+	0x03, 0x65, 0x6e, 0x67, 0x06, 0x6f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x0d, 0x6f, 0x68, 0x75, 0x6e,
+	0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x07, 0x6f, 0x6d, 0x61, 0x63, 0x72, 0x6f,
+	0x6e, 0x0b, 0x6f, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x72, 0x61,
+	0x63, 0x75, 0x74, 0x65, 0x06, 0x72, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30,
+	0x31, 0x35, 0x37, 0x06, 0x73, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0b, 0x73, 0x63, 0x69, 0x72, 0x63,
+	0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x39, 0x04, 0x74,
+	0x62, 0x61, 0x72, 0x06, 0x74, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31,
+	0x36, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x42, 0x06, 0x75, 0x62, 0x72, 0x65, 0x76,
+	0x65, 0x0d, 0x75, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x07,
+	0x75, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x05,
+	0x75, 0x72, 0x69, 0x6e, 0x67, 0x06, 0x75, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x06, 0x77, 0x61, 0x63,
+	0x75, 0x74, 0x65, 0x0b, 0x77, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x09,
+	0x77, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x06, 0x77, 0x67, 0x72, 0x61, 0x76, 0x65,
+	0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x38, 0x42, 0x0b, 0x79, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d,
+	0x66, 0x6c, 0x65, 0x78, 0x06, 0x79, 0x67, 0x72, 0x61, 0x76, 0x65, 0x06, 0x7a, 0x61, 0x63, 0x75,
+	0x74, 0x65, 0x0a, 0x7a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x75, 0x6e,
+	0x69, 0x30, 0x31, 0x42, 0x36, 0x09, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x61, 0x6c, 0x74, 0x07,
+	0x75, 0x6e, 0x69, 0x30, 0x33, 0x32, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x31, 0x32, 0x07,
+	0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x38, 0x07, 0x64, 0x6f, 0x74, 0x6d, 0x61, 0x74, 0x68, 0x07,
+	0x75, 0x6e, 0x69, 0x32, 0x31, 0x32, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x32, 0x31, 0x39, 0x07,
+	0x75, 0x6e, 0x69, 0x30, 0x32, 0x42, 0x42, 0x04, 0x45, 0x75, 0x72, 0x6f, 0x07, 0x75, 0x6e, 0x69,
+	0x32, 0x30, 0x42, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x39, 0x34, 0x07, 0x75, 0x6e, 0x69,
+	0x30, 0x33, 0x41, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x42, 0x43, 0x09, 0x63, 0x6f, 0x6e,
+	0x67, 0x72, 0x75, 0x65, 0x6e, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x41, 0x44, 0x07, 0x7a,
+	0x65, 0x72, 0x6f, 0x2e, 0x74, 0x66, 0x06, 0x6f, 0x6e, 0x65, 0x2e, 0x74, 0x66, 0x06, 0x74, 0x77,
+	0x6f, 0x2e, 0x74, 0x66, 0x08, 0x74, 0x68, 0x72, 0x65, 0x65, 0x2e, 0x74, 0x66, 0x07, 0x66, 0x6f,
+	0x75, 0x72, 0x2e, 0x74, 0x66, 0x07, 0x66, 0x69, 0x76, 0x65, 0x2e, 0x74, 0x66, 0x06, 0x73, 0x69,
+	0x78, 0x2e, 0x74, 0x66, 0x08, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x2e, 0x74, 0x66, 0x08, 0x65, 0x69,
+	0x67, 0x68, 0x74, 0x2e, 0x74, 0x66, 0x07, 0x6e, 0x69, 0x6e, 0x65, 0x2e, 0x74, 0x66, 0x08, 0x7a,
+	0x65, 0x72, 0x6f, 0x2e, 0x6f, 0x73, 0x66, 0x07, 0x6f, 0x6e, 0x65, 0x2e, 0x6f, 0x73, 0x66, 0x07,
+	0x74, 0x77, 0x6f, 0x2e, 0x6f, 0x73, 0x66, 0x09, 0x74, 0x68, 0x72, 0x65, 0x65, 0x2e, 0x6f, 0x73,
+	0x66, 0x08, 0x66, 0x6f, 0x75, 0x72, 0x2e, 0x6f, 0x73, 0x66, 0x08, 0x66, 0x69, 0x76, 0x65, 0x2e,
+	0x6f, 0x73, 0x66, 0x07, 0x73, 0x69, 0x78, 0x2e, 0x6f, 0x73, 0x66, 0x09, 0x73, 0x65, 0x76, 0x65,
+	0x6e, 0x2e, 0x6f, 0x73, 0x66, 0x09, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2e, 0x6f, 0x73, 0x66, 0x08,
+	0x6e, 0x69, 0x6e, 0x65, 0x2e, 0x6f, 0x73, 0x66, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x37,
+	0x09, 0x7a, 0x65, 0x72, 0x6f, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x08, 0x6f, 0x6e, 0x65, 0x2e, 0x64,
+	0x6e, 0x6f, 0x6d, 0x08, 0x74, 0x77, 0x6f, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x0a, 0x74, 0x68, 0x72,
+	0x65, 0x65, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x09, 0x66, 0x6f, 0x75, 0x72, 0x2e, 0x64, 0x6e, 0x6f,
+	0x6d, 0x09, 0x66, 0x69, 0x76, 0x65, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x08, 0x73, 0x69, 0x78, 0x2e,
+	0x64, 0x6e, 0x6f, 0x6d, 0x0a, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x0a,
+	0x65, 0x69, 0x67, 0x68, 0x74, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x09, 0x6e, 0x69, 0x6e, 0x65, 0x2e,
+	0x64, 0x6e, 0x6f, 0x6d, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x30, 0x07, 0x75, 0x6e, 0x69,
+	0x30, 0x30, 0x42, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x42, 0x32, 0x07, 0x75, 0x6e, 0x69,
+	0x30, 0x30, 0x42, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x34, 0x07, 0x75, 0x6e, 0x69,
+	0x32, 0x30, 0x37, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x36, 0x07, 0x75, 0x6e, 0x69,
+	0x32, 0x30, 0x37, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x38, 0x07, 0x75, 0x6e, 0x69,
+	0x32, 0x30, 0x37, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x39, 0x09, 0x61, 0x72, 0x72,
+	0x6f, 0x77, 0x64, 0x6f, 0x77, 0x6e, 0x07, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x75, 0x70, 0x0a, 0x61,
+	0x72, 0x72, 0x6f, 0x77, 0x72, 0x69, 0x67, 0x68, 0x74, 0x09, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x6c,
+	0x65, 0x66, 0x74, 0x00, 0x00, 0x01, 0x00, 0x01, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x0a, 0x00, 0x30, 0x00, 0x44, 0x00, 0x02, 0x44, 0x46, 0x4c, 0x54, 0x00, 0x0e, 0x6c, 0x61,
+	0x74, 0x6e, 0x00, 0x1a, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x6b, 0x65,
+	0x72, 0x6e, 0x00, 0x0e, 0x6b, 0x65, 0x72, 0x6e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x0f, 0xb2, 0x00, 0x01,
+	0x01, 0x42, 0x00, 0x04, 0x00, 0x00, 0x00, 0x9c, 0x02, 0x76, 0x02, 0x76, 0x02, 0x76, 0x02, 0x76,
+	0x02, 0x76, 0x03, 0xea, 0x03, 0xea, 0x02, 0x76, 0x02, 0x76, 0x02, 0x6c, 0x02, 0x76, 0x02, 0x76,
+	0x02, 0x7c, 0x02, 0x96, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xbe,
+	0x02, 0xc8, 0x03, 0xea, 0x03, 0xea, 0x03, 0xea, 0x03, 0xea, 0x03, 0xea, 0x03, 0xea, 0x03, 0xea,
+	0x03, 0xea, 0x03, 0xea, 0x02, 0xda, 0x03, 0x20, 0x03, 0x26, 0x03, 0x2c, 0x03, 0x5a, 0x03, 0x6c,
+	0x03, 0x72, 0x03, 0x80, 0x03, 0x8e, 0x03, 0xa0, 0x03, 0xba, 0x03, 0xc0, 0x03, 0xea, 0x03, 0xf4,
+	0x04, 0x1a, 0x04, 0x40, 0x04, 0x4e, 0x04, 0x84, 0x04, 0xba, 0x06, 0x10, 0x06, 0x10, 0x06, 0x10,
+	0x06, 0x1a, 0x06, 0x80, 0x06, 0xa2, 0x06, 0xb8, 0x06, 0xe2, 0x06, 0xf4, 0x07, 0x16, 0x07, 0x1c,
+	0x07, 0x22, 0x07, 0x28, 0x07, 0x32, 0x07, 0x3c, 0x07, 0x46, 0x07, 0xa8, 0x07, 0xbe, 0x07, 0xf0,
+	0x08, 0x32, 0x08, 0x70, 0x08, 0x76, 0x08, 0xa4, 0x08, 0xe6, 0x09, 0x1c, 0x09, 0x2e, 0x09, 0x34,
+	0x09, 0x46, 0x09, 0x4c, 0x09, 0x5e, 0x09, 0x68, 0x09, 0x72, 0x09, 0x98, 0x09, 0xca, 0x09, 0xe4,
+	0x09, 0xe4, 0x09, 0xea, 0x0a, 0x0c, 0x0a, 0x26, 0x0a, 0x3c, 0x0a, 0x5a, 0x0a, 0x84, 0x0a, 0x9e,
+	0x0a, 0xa8, 0x0a, 0xea, 0x0b, 0x00, 0x0b, 0x06, 0x0b, 0x3c, 0x0b, 0x46, 0x0b, 0x50, 0x0b, 0x5e,
+	0x0b, 0x78, 0x0b, 0x96, 0x0b, 0xa0, 0x0b, 0xaa, 0x0b, 0xc0, 0x0b, 0xc0, 0x0b, 0xda, 0x0b, 0xaa,
+	0x0b, 0xc0, 0x0b, 0xda, 0x0b, 0xfc, 0x0b, 0xfc, 0x0c, 0x16, 0x0c, 0x20, 0x0c, 0x5e, 0x0c, 0xdc,
+	0x0d, 0x66, 0x0d, 0x70, 0x0d, 0x70, 0x0d, 0x7e, 0x0d, 0x7e, 0x0d, 0x7e, 0x0d, 0x7e, 0x0d, 0x8c,
+	0x0d, 0xaa, 0x0d, 0xc0, 0x0d, 0xc6, 0x0d, 0xd4, 0x0e, 0x02, 0x0e, 0x08, 0x0e, 0x22, 0x0e, 0x38,
+	0x0e, 0x46, 0x0e, 0x60, 0x0e, 0x82, 0x0e, 0x88, 0x0e, 0x92, 0x0e, 0xa4, 0x0e, 0xd2, 0x0e, 0xe4,
+	0x0e, 0xfe, 0x0f, 0x14, 0x0f, 0x22, 0x0f, 0x38, 0x0f, 0x3e, 0x0f, 0x44, 0x0f, 0x4a, 0x0f, 0x50,
+	0x0f, 0x7a, 0x0f, 0x56, 0x0f, 0x64, 0x0f, 0x6a, 0x0f, 0x74, 0x0f, 0x7a, 0x0f, 0x80, 0x0f, 0x86,
+	0x00, 0x02, 0x00, 0x31, 0x00, 0x03, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x14,
+	0x00, 0x25, 0x00, 0x25, 0x00, 0x1e, 0x00, 0x2f, 0x00, 0x32, 0x00, 0x1f, 0x00, 0x34, 0x00, 0x34,
+	0x00, 0x23, 0x00, 0x36, 0x00, 0x36, 0x00, 0x24, 0x00, 0x38, 0x00, 0x38, 0x00, 0x25, 0x00, 0x3a,
+	0x00, 0x3c, 0x00, 0x26, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x29, 0x00, 0x50, 0x00, 0x50, 0x00, 0x2a,
+	0x00, 0x56, 0x00, 0x58, 0x00, 0x2b, 0x00, 0x64, 0x00, 0x69, 0x00, 0x2e, 0x00, 0x75, 0x00, 0x76,
+	0x00, 0x34, 0x00, 0x7b, 0x00, 0x7b, 0x00, 0x36, 0x00, 0x7d, 0x00, 0x7d, 0x00, 0x37, 0x00, 0x82,
+	0x00, 0x82, 0x00, 0x38, 0x00, 0x86, 0x00, 0x86, 0x00, 0x39, 0x00, 0x9b, 0x00, 0x9b, 0x00, 0x3a,
+	0x00, 0xa2, 0x00, 0xa3, 0x00, 0x3b, 0x00, 0xa6, 0x00, 0xa8, 0x00, 0x3d, 0x00, 0xb4, 0x00, 0xb4,
+	0x00, 0x40, 0x00, 0xc3, 0x00, 0xc7, 0x00, 0x41, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0x46, 0x00, 0xcb,
+	0x00, 0xcb, 0x00, 0x47, 0x00, 0xce, 0x00, 0xce, 0x00, 0x48, 0x00, 0xd4, 0x00, 0xd7, 0x00, 0x49,
+	0x00, 0xee, 0x00, 0xee, 0x00, 0x4d, 0x00, 0xf0, 0x00, 0xf1, 0x00, 0x4e, 0x00, 0xf9, 0x00, 0xf9,
+	0x00, 0x50, 0x01, 0x0a, 0x01, 0x0a, 0x00, 0x51, 0x01, 0x1b, 0x01, 0x1b, 0x00, 0x52, 0x01, 0x2c,
+	0x01, 0x30, 0x00, 0x53, 0x01, 0x32, 0x01, 0x32, 0x00, 0x58, 0x01, 0x35, 0x01, 0x35, 0x00, 0x59,
+	0x01, 0x39, 0x01, 0x3e, 0x00, 0x5a, 0x01, 0x40, 0x01, 0x41, 0x00, 0x60, 0x01, 0x43, 0x01, 0x45,
+	0x00, 0x62, 0x01, 0x47, 0x01, 0x48, 0x00, 0x65, 0x01, 0x4b, 0x01, 0x54, 0x00, 0x67, 0x01, 0x7e,
+	0x01, 0x7e, 0x00, 0x71, 0x01, 0x80, 0x01, 0x80, 0x00, 0x72, 0x01, 0x82, 0x01, 0x83, 0x00, 0x73,
+	0x01, 0x85, 0x01, 0x85, 0x00, 0x75, 0x01, 0x87, 0x01, 0x8d, 0x00, 0x76, 0x01, 0x8f, 0x01, 0x96,
+	0x00, 0x7d, 0x01, 0xa1, 0x01, 0xaa, 0x00, 0x85, 0x01, 0xb0, 0x01, 0xb0, 0x00, 0x8f, 0x01, 0xb2,
+	0x01, 0xb2, 0x00, 0x90, 0x01, 0xb6, 0x01, 0xc0, 0x00, 0x91, 0x00, 0x02, 0x00, 0x66, 0xff, 0xaf,
+	0x00, 0xcd, 0x00, 0x25, 0x00, 0x01, 0x00, 0x66, 0xff, 0xaf, 0x00, 0x06, 0x00, 0x75, 0xff, 0xf4,
+	0x01, 0x81, 0xff, 0xee, 0x01, 0x83, 0xff, 0xed, 0x01, 0x8c, 0xff, 0xe7, 0x01, 0x8e, 0xff, 0xf8,
+	0x01, 0x94, 0xff, 0xf8, 0x00, 0x06, 0x00, 0xc5, 0x00, 0x1e, 0x00, 0xc6, 0x00, 0x0e, 0x00, 0xc9,
+	0x00, 0x07, 0x00, 0xcb, 0x00, 0x1f, 0x00, 0xce, 0x00, 0x14, 0x00, 0xfb, 0xff, 0xef, 0x00, 0x03,
+	0x00, 0xc5, 0x00, 0x1e, 0x00, 0xc6, 0x00, 0x0e, 0x00, 0xc9, 0x00, 0x07, 0x00, 0x02, 0x00, 0x66,
+	0xff, 0xf2, 0x00, 0x86, 0xff, 0xf8, 0x00, 0x04, 0x00, 0xc5, 0x00, 0x1a, 0x00, 0xc6, 0x00, 0x0b,
+	0x00, 0xcb, 0x00, 0x1b, 0x00, 0xce, 0x00, 0x10, 0x00, 0x11, 0x00, 0x24, 0xff, 0xf6, 0x00, 0x64,
+	0xff, 0xfa, 0x00, 0xa8, 0xff, 0xf7, 0x00, 0xb3, 0xff, 0xf7, 0x00, 0xc0, 0x00, 0x0c, 0x00, 0xc4,
+	0x00, 0x13, 0x00, 0xc5, 0x00, 0x2e, 0x00, 0xc6, 0x00, 0x1f, 0x00, 0xc9, 0x00, 0x18, 0x00, 0xcb,
+	0x00, 0x2f, 0x00, 0xcc, 0xff, 0xf1, 0x00, 0xce, 0x00, 0x25, 0x00, 0xcf, 0xff, 0xf1, 0x01, 0x1b,
+	0xff, 0xec, 0x01, 0x2e, 0xff, 0xe1, 0x01, 0x3d, 0xff, 0xf5, 0x01, 0x8c, 0xff, 0xc4, 0x00, 0x01,
+	0x00, 0x34, 0x00, 0x33, 0x00, 0x01, 0x01, 0x83, 0x00, 0x10, 0x00, 0x0b, 0x00, 0x2f, 0x00, 0x10,
+	0x00, 0x31, 0x00, 0x6a, 0x00, 0x32, 0x00, 0x4b, 0x00, 0x65, 0x00, 0x0c, 0x00, 0x66, 0x00, 0x0c,
+	0x00, 0x67, 0x00, 0x0c, 0x00, 0x68, 0x00, 0x0c, 0x00, 0x69, 0x00, 0x0c, 0x01, 0x7f, 0x00, 0x2f,
+	0x01, 0x81, 0x00, 0x39, 0x01, 0x83, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x31, 0x00, 0x4a, 0x01, 0x7f,
+	0x00, 0x12, 0x01, 0x81, 0x00, 0x19, 0x01, 0x83, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x31, 0x00, 0x0f,
+	0x00, 0x03, 0x01, 0x7f, 0x00, 0x0a, 0x01, 0x81, 0x00, 0x11, 0x01, 0x83, 0x00, 0x13, 0x00, 0x03,
+	0x00, 0x38, 0x00, 0x45, 0x01, 0x81, 0x00, 0x1a, 0x01, 0x83, 0x00, 0x22, 0x00, 0x04, 0x00, 0x65,
+	0x00, 0x11, 0x01, 0x7f, 0x00, 0x34, 0x01, 0x81, 0x00, 0x3e, 0x01, 0x83, 0x00, 0x40, 0x00, 0x06,
+	0x00, 0xc4, 0x00, 0x20, 0x00, 0xc5, 0x00, 0x09, 0x00, 0xc6, 0x00, 0x1c, 0x00, 0xc9, 0x00, 0x14,
+	0x00, 0xcb, 0x00, 0x23, 0x00, 0xfb, 0xff, 0xe6, 0x00, 0x01, 0x00, 0xc9, 0x00, 0x14, 0x00, 0x0a,
+	0x00, 0x65, 0xff, 0xd6, 0x00, 0x75, 0xff, 0xd4, 0x00, 0x76, 0xff, 0xcf, 0x00, 0x7d, 0xff, 0xd5,
+	0x01, 0x3e, 0xff, 0xcf, 0x01, 0x45, 0xff, 0xbf, 0x01, 0x4e, 0xff, 0xc6, 0x01, 0x51, 0xff, 0xc6,
+	0x01, 0x52, 0xff, 0xc5, 0x01, 0x53, 0xff, 0xc5, 0x00, 0x02, 0x00, 0xc5, 0x00, 0x1a, 0x00, 0xc6,
+	0x00, 0x0b, 0x00, 0x09, 0x00, 0x75, 0xff, 0xfb, 0x00, 0x86, 0xff, 0xf6, 0x00, 0xc5, 0x00, 0x0a,
+	0x01, 0x2e, 0xff, 0xe4, 0x01, 0x81, 0xff, 0xe9, 0x01, 0x83, 0xff, 0xe8, 0x01, 0x8c, 0xff, 0xc0,
+	0x01, 0x8f, 0xff, 0xee, 0x01, 0x90, 0xff, 0xf5, 0x00, 0x09, 0x00, 0x75, 0xff, 0xe7, 0x01, 0x2e,
+	0xff, 0xed, 0x01, 0x2f, 0xff, 0xef, 0x01, 0x3a, 0xff, 0xe4, 0x01, 0x46, 0xff, 0xe8, 0x01, 0x7f,
+	0xff, 0xed, 0x01, 0x81, 0xff, 0xe0, 0x01, 0x83, 0xff, 0xdf, 0x01, 0x8c, 0xff, 0xce, 0x00, 0x03,
+	0x00, 0xcd, 0x00, 0x12, 0x00, 0xce, 0x00, 0x12, 0x00, 0xcf, 0x00, 0x12, 0x00, 0x0d, 0x00, 0x75,
+	0xff, 0xe7, 0x00, 0xb6, 0xff, 0xf4, 0x00, 0xb7, 0xff, 0xf4, 0x00, 0xb8, 0xff, 0xf4, 0x00, 0xb9,
+	0xff, 0xf4, 0x01, 0x2f, 0xff, 0xed, 0x01, 0x3a, 0xff, 0xeb, 0x01, 0x3e, 0xff, 0xee, 0x01, 0x40,
+	0xff, 0xe8, 0x01, 0x45, 0xff, 0xf1, 0x01, 0x46, 0xff, 0xf2, 0x01, 0x83, 0xff, 0xf0, 0x01, 0x8c,
+	0xff, 0xeb, 0x00, 0x0d, 0x00, 0x31, 0x00, 0x0a, 0x00, 0xc0, 0x00, 0x14, 0x00, 0xc4, 0x00, 0x21,
+	0x00, 0xc5, 0x00, 0x37, 0x00, 0xc6, 0x00, 0x27, 0x00, 0xc9, 0x00, 0x20, 0x00, 0xcb, 0x00, 0x37,
+	0x00, 0xcc, 0xff, 0xc9, 0x00, 0xce, 0x00, 0x2d, 0x00, 0xcf, 0xff, 0xc9, 0x00, 0xfb, 0xff, 0xdc,
+	0x01, 0x14, 0xff, 0xd1, 0x01, 0x15, 0xff, 0xd1, 0x00, 0x55, 0x00, 0x03, 0xff, 0xaf, 0x00, 0x04,
+	0xff, 0xaf, 0x00, 0x05, 0xff, 0xaf, 0x00, 0x06, 0xff, 0xaf, 0x00, 0x07, 0xff, 0xaf, 0x00, 0x08,
+	0xff, 0xaf, 0x00, 0x09, 0xff, 0xaf, 0x00, 0x0a, 0xff, 0xaf, 0x00, 0x0b, 0xff, 0xaf, 0x00, 0x0c,
+	0xff, 0xaf, 0x00, 0x0d, 0xff, 0xaf, 0x00, 0x0e, 0xff, 0xaf, 0x00, 0x10, 0xff, 0xf0, 0x00, 0x26,
+	0xff, 0xf1, 0x00, 0x27, 0xff, 0xf1, 0x00, 0x28, 0xff, 0xf1, 0x00, 0x29, 0xff, 0xf1, 0x00, 0x2a,
+	0xff, 0xf1, 0x00, 0x31, 0x00, 0x0a, 0x00, 0x4a, 0xff, 0xf1, 0x00, 0x4b, 0xff, 0xf1, 0x00, 0x4c,
+	0xff, 0xf1, 0x00, 0x4d, 0xff, 0xf1, 0x00, 0x4e, 0xff, 0xf1, 0x00, 0x4f, 0xff, 0xf1, 0x00, 0x50,
+	0xff, 0xf1, 0x00, 0x51, 0xff, 0xf1, 0x00, 0x52, 0xff, 0xf1, 0x00, 0x53, 0xff, 0xf1, 0x00, 0x54,
+	0xff, 0xf1, 0x00, 0x55, 0xff, 0xf1, 0x00, 0x58, 0xff, 0xf1, 0x00, 0x9f, 0xff, 0xca, 0x00, 0xa5,
+	0xff, 0xca, 0x00, 0xa9, 0xff, 0xca, 0x00, 0xaa, 0xff, 0xca, 0x00, 0xab, 0xff, 0xca, 0x00, 0xac,
+	0xff, 0xca, 0x00, 0xad, 0xff, 0xca, 0x00, 0xae, 0xff, 0xca, 0x00, 0xaf, 0xff, 0xca, 0x00, 0xb0,
+	0xff, 0xca, 0x00, 0xb1, 0xff, 0xca, 0x00, 0xb2, 0xff, 0xca, 0x00, 0xba, 0xff, 0xcb, 0x00, 0xc5,
+	0x00, 0x37, 0x00, 0xd8, 0xff, 0xd3, 0x00, 0xd9, 0xff, 0xd3, 0x00, 0xda, 0xff, 0xd3, 0x00, 0xdc,
+	0xff, 0xd3, 0x00, 0xdd, 0xff, 0xd3, 0x00, 0xde, 0xff, 0xd3, 0x00, 0xdf, 0xff, 0xd3, 0x00, 0xe0,
+	0xff, 0xca, 0x00, 0xe1, 0xff, 0xca, 0x00, 0xe2, 0xff, 0xca, 0x00, 0xe3, 0xff, 0xca, 0x00, 0xe4,
+	0xff, 0xca, 0x00, 0xe5, 0xff, 0xca, 0x00, 0xe6, 0xff, 0xca, 0x00, 0xe7, 0xff, 0xca, 0x00, 0xe8,
+	0xff, 0xca, 0x00, 0xe9, 0xff, 0xca, 0x00, 0xea, 0xff, 0xca, 0x00, 0xeb, 0xff, 0xca, 0x00, 0xec,
+	0xff, 0xd3, 0x00, 0xef, 0xff, 0xd3, 0x00, 0xf0, 0xff, 0xd3, 0x00, 0xf1, 0xff, 0xd3, 0x00, 0xf2,
+	0xff, 0xd3, 0x00, 0xf3, 0xff, 0xd3, 0x00, 0xff, 0xff, 0xd5, 0x01, 0x0a, 0xff, 0xd8, 0x01, 0x0b,
+	0xff, 0xdb, 0x01, 0x12, 0xff, 0xd7, 0x01, 0x32, 0xff, 0xdb, 0x01, 0x3a, 0x00, 0x03, 0x01, 0x3c,
+	0xff, 0xef, 0x01, 0x43, 0xff, 0xf2, 0x01, 0x84, 0xff, 0xd6, 0x01, 0x86, 0xff, 0xd6, 0x01, 0x88,
+	0xff, 0xd2, 0x01, 0x89, 0xff, 0xd2, 0x01, 0x8a, 0xff, 0xd2, 0x01, 0x8b, 0xff, 0xd2, 0x00, 0x02,
+	0x00, 0x31, 0x00, 0x0a, 0x00, 0xc5, 0x00, 0x37, 0x00, 0x19, 0x00, 0x24, 0xff, 0xf2, 0x00, 0x42,
+	0xff, 0xf1, 0x00, 0x64, 0xff, 0xf1, 0x00, 0xa8, 0xff, 0xd7, 0x00, 0xb3, 0xff, 0xe4, 0x00, 0xc0,
+	0x00, 0x08, 0x00, 0xc4, 0x00, 0x22, 0x00, 0xc5, 0x00, 0x25, 0x00, 0xc6, 0x00, 0x1e, 0x00, 0xc9,
+	0x00, 0x17, 0x00, 0xcb, 0x00, 0x2c, 0x00, 0xcc, 0xff, 0xe8, 0x00, 0xce, 0x00, 0x1b, 0x00, 0xcf,
+	0xff, 0xe8, 0x00, 0xd7, 0xff, 0xf3, 0x01, 0x2e, 0xff, 0xd8, 0x01, 0x35, 0xff, 0xe1, 0x01, 0x3c,
+	0xff, 0xf0, 0x01, 0x3d, 0xff, 0xdd, 0x01, 0x46, 0x00, 0x13, 0x01, 0x8c, 0xff, 0xd3, 0x01, 0x8d,
+	0xff, 0xf3, 0x01, 0x91, 0xff, 0xf2, 0x01, 0x93, 0xff, 0xed, 0x01, 0x95, 0xff, 0xf8, 0x00, 0x08,
+	0x00, 0xc4, 0x00, 0x1d, 0x00, 0xc5, 0x00, 0x25, 0x00, 0xc6, 0x00, 0x19, 0x00, 0xc9, 0x00, 0x12,
+	0x00, 0xcb, 0x00, 0x2e, 0x00, 0xcc, 0xff, 0xf3, 0x00, 0xce, 0x00, 0x1c, 0x00, 0xcf, 0xff, 0xf3,
+	0x00, 0x05, 0x00, 0xc4, 0x00, 0x16, 0x00, 0xc6, 0x00, 0x12, 0x00, 0xc9, 0x00, 0x0a, 0x00, 0xcb,
+	0x00, 0x19, 0x00, 0xfb, 0xff, 0xe9, 0x00, 0x0a, 0x00, 0xc4, 0x00, 0x20, 0x00, 0xc5, 0x00, 0x14,
+	0x00, 0xc6, 0x00, 0x1c, 0x00, 0xc9, 0x00, 0x14, 0x00, 0xcb, 0x00, 0x23, 0x00, 0xcc, 0xff, 0xcd,
+	0x00, 0xce, 0x00, 0x0a, 0x00, 0xcf, 0xff, 0xcd, 0x00, 0xf9, 0xff, 0xf1, 0x00, 0xfb, 0xff, 0xe8,
+	0x00, 0x04, 0x00, 0xc5, 0x00, 0x1b, 0x00, 0xc6, 0x00, 0x0c, 0x00, 0xcb, 0x00, 0x1c, 0x00, 0xce,
+	0x00, 0x12, 0x00, 0x08, 0x00, 0xba, 0xff, 0xf9, 0x01, 0x3c, 0xff, 0xf9, 0x01, 0x84, 0xff, 0xf5,
+	0x01, 0x86, 0xff, 0xf5, 0x01, 0x88, 0xff, 0xea, 0x01, 0x89, 0xff, 0xea, 0x01, 0x8a, 0xff, 0xea,
+	0x01, 0x8b, 0xff, 0xea, 0x00, 0x01, 0x00, 0xcd, 0x00, 0x07, 0x00, 0x01, 0x00, 0xcd, 0x00, 0x1a,
+	0x00, 0x01, 0x01, 0x3e, 0x00, 0x07, 0x00, 0x02, 0x00, 0xcd, 0x00, 0x26, 0x01, 0x19, 0x00, 0x44,
+	0x00, 0x02, 0x00, 0xcb, 0x00, 0x47, 0x01, 0x3a, 0x00, 0x1a, 0x00, 0x02, 0x01, 0x0a, 0xff, 0xfc,
+	0x01, 0x8c, 0xff, 0xe4, 0x00, 0x18, 0x00, 0x24, 0xff, 0xf7, 0x00, 0x75, 0x00, 0x07, 0x00, 0xa8,
+	0xff, 0xe9, 0x00, 0xb3, 0xff, 0xfb, 0x00, 0xc0, 0x00, 0x20, 0x00, 0xc1, 0x00, 0x27, 0x00, 0xc4,
+	0x00, 0x33, 0x00, 0xc5, 0x00, 0x2f, 0x00, 0xc6, 0x00, 0x34, 0x00, 0xc7, 0x00, 0x25, 0x00, 0xc9,
+	0x00, 0x2d, 0x00, 0xcb, 0x00, 0x34, 0x00, 0xce, 0x00, 0x26, 0x00, 0xd7, 0xff, 0xea, 0x01, 0x2e,
+	0xff, 0xe4, 0x01, 0x2f, 0x00, 0x05, 0x01, 0x35, 0xff, 0xe2, 0x01, 0x3a, 0x00, 0x0b, 0x01, 0x3e,
+	0x00, 0x0e, 0x01, 0x44, 0x00, 0x06, 0x01, 0x46, 0x00, 0x2d, 0x01, 0x81, 0x00, 0x06, 0x01, 0x83,
+	0x00, 0x08, 0x01, 0x8c, 0xff, 0xdf, 0x00, 0x05, 0x00, 0xc6, 0x00, 0x16, 0x00, 0xc7, 0x00, 0x49,
+	0x01, 0x7f, 0x00, 0x18, 0x01, 0x81, 0x00, 0x23, 0x01, 0x83, 0x00, 0x26, 0x00, 0x0c, 0x01, 0x3a,
+	0x00, 0x1c, 0x01, 0x44, 0x00, 0x10, 0x01, 0x4c, 0x00, 0x16, 0x01, 0x4d, 0x00, 0x16, 0x01, 0x4e,
+	0x00, 0x27, 0x01, 0x50, 0x00, 0x16, 0x01, 0x51, 0x00, 0x27, 0x01, 0x52, 0x00, 0x26, 0x01, 0x53,
+	0x00, 0x26, 0x01, 0x7f, 0x00, 0x1c, 0x01, 0x81, 0x00, 0x27, 0x01, 0x83, 0x00, 0x2a, 0x00, 0x10,
+	0x00, 0xc3, 0x00, 0x22, 0x00, 0xc5, 0x00, 0x7c, 0x00, 0xc6, 0x00, 0x5d, 0x01, 0x38, 0x00, 0x20,
+	0x01, 0x3a, 0x00, 0x42, 0x01, 0x3e, 0x00, 0x49, 0x01, 0x44, 0x00, 0x45, 0x01, 0x45, 0x00, 0x42,
+	0x01, 0x4c, 0x00, 0x3f, 0x01, 0x4d, 0x00, 0x3f, 0x01, 0x4e, 0x00, 0x46, 0x01, 0x50, 0x00, 0x3f,
+	0x01, 0x51, 0x00, 0x46, 0x01, 0x52, 0x00, 0x43, 0x01, 0x53, 0x00, 0x43, 0x01, 0x7f, 0x00, 0x09,
+	0x00, 0x0f, 0x00, 0xc5, 0x00, 0x5c, 0x00, 0xc7, 0x00, 0x16, 0x01, 0x3a, 0x00, 0x2d, 0x01, 0x3e,
+	0x00, 0x29, 0x01, 0x44, 0x00, 0x25, 0x01, 0x45, 0x00, 0x22, 0x01, 0x4c, 0x00, 0x1f, 0x01, 0x4d,
+	0x00, 0x1f, 0x01, 0x4e, 0x00, 0x26, 0x01, 0x50, 0x00, 0x1f, 0x01, 0x51, 0x00, 0x26, 0x01, 0x52,
+	0x00, 0x23, 0x01, 0x53, 0x00, 0x23, 0x01, 0x81, 0x00, 0x12, 0x01, 0x83, 0x00, 0x0a, 0x00, 0x01,
+	0x00, 0xc5, 0x00, 0x21, 0x00, 0x0b, 0x01, 0x3a, 0x00, 0x25, 0x01, 0x3e, 0x00, 0x1a, 0x01, 0x44,
+	0x00, 0x1c, 0x01, 0x45, 0x00, 0x1c, 0x01, 0x4c, 0x00, 0x16, 0x01, 0x4d, 0x00, 0x16, 0x01, 0x4e,
+	0x00, 0x1e, 0x01, 0x50, 0x00, 0x16, 0x01, 0x51, 0x00, 0x1e, 0x01, 0x52, 0x00, 0x1b, 0x01, 0x53,
+	0x00, 0x1b, 0x00, 0x10, 0x00, 0xcb, 0x00, 0x5e, 0x01, 0x38, 0x00, 0x0f, 0x01, 0x3a, 0x00, 0x2a,
+	0x01, 0x3e, 0x00, 0x1a, 0x01, 0x44, 0x00, 0x1a, 0x01, 0x45, 0x00, 0x16, 0x01, 0x4c, 0x00, 0x1d,
+	0x01, 0x4d, 0x00, 0x1d, 0x01, 0x4e, 0x00, 0x31, 0x01, 0x50, 0x00, 0x1d, 0x01, 0x51, 0x00, 0x31,
+	0x01, 0x52, 0x00, 0x30, 0x01, 0x53, 0x00, 0x30, 0x01, 0x7f, 0x00, 0x23, 0x01, 0x81, 0x00, 0x2e,
+	0x01, 0x83, 0x00, 0x31, 0x00, 0x0d, 0x01, 0x38, 0x00, 0x20, 0x01, 0x3a, 0x00, 0x42, 0x01, 0x3e,
+	0x00, 0x49, 0x01, 0x44, 0x00, 0x45, 0x01, 0x45, 0x00, 0x42, 0x01, 0x4c, 0x00, 0x3f, 0x01, 0x4d,
+	0x00, 0x3f, 0x01, 0x4e, 0x00, 0x46, 0x01, 0x50, 0x00, 0x3f, 0x01, 0x51, 0x00, 0x46, 0x01, 0x52,
+	0x00, 0x43, 0x01, 0x53, 0x00, 0x43, 0x01, 0x7f, 0x00, 0x09, 0x00, 0x04, 0x00, 0xa1, 0x00, 0x0c,
+	0x00, 0xcd, 0x00, 0x26, 0x00, 0xf5, 0x00, 0x33, 0x01, 0x19, 0x00, 0x44, 0x00, 0x01, 0x00, 0xcd,
+	0x00, 0x0d, 0x00, 0x04, 0x01, 0x3a, 0xff, 0xe8, 0x01, 0x7f, 0xff, 0xee, 0x01, 0x81, 0xff, 0xe5,
+	0x01, 0x83, 0xff, 0xe1, 0x00, 0x01, 0x01, 0x83, 0xff, 0xf0, 0x00, 0x04, 0x00, 0xca, 0x00, 0x0a,
+	0x00, 0xcd, 0x00, 0x1a, 0x00, 0xce, 0x00, 0x1a, 0x00, 0xcf, 0x00, 0x1a, 0x00, 0x02, 0x01, 0x81,
+	0xff, 0xf6, 0x01, 0x83, 0xff, 0xf8, 0x00, 0x02, 0x01, 0x81, 0x00, 0x0f, 0x01, 0x83, 0x00, 0x11,
+	0x00, 0x09, 0x00, 0x75, 0xff, 0xd2, 0x01, 0x0a, 0xff, 0xe1, 0x01, 0x2f, 0xff, 0xe3, 0x01, 0x3a,
+	0xff, 0xe4, 0x01, 0x3e, 0xff, 0xec, 0x01, 0x40, 0xff, 0xe6, 0x01, 0x45, 0xff, 0xee, 0x01, 0x46,
+	0xff, 0xec, 0x01, 0x8c, 0xff, 0xeb, 0x00, 0x0c, 0x00, 0x24, 0xff, 0xf6, 0x00, 0xa8, 0xff, 0xf4,
+	0x00, 0xb3, 0xff, 0xfa, 0x00, 0xd7, 0xff, 0xf7, 0x01, 0x2e, 0xff, 0xe4, 0x01, 0x3d, 0xff, 0xf5,
+	0x01, 0x3e, 0x00, 0x09, 0x01, 0x40, 0x00, 0x08, 0x01, 0x46, 0xff, 0xf2, 0x01, 0x81, 0xff, 0xeb,
+	0x01, 0x83, 0xff, 0xea, 0x01, 0x8c, 0xff, 0xd9, 0x00, 0x06, 0x01, 0x84, 0xff, 0xf5, 0x01, 0x86,
+	0xff, 0xf5, 0x01, 0x88, 0xff, 0xf1, 0x01, 0x89, 0xff, 0xf1, 0x01, 0x8a, 0xff, 0xf1, 0x01, 0x8b,
+	0xff, 0xf1, 0x00, 0x01, 0x00, 0xcd, 0x00, 0x13, 0x00, 0x08, 0x00, 0xa8, 0xff, 0xe8, 0x00, 0xb3,
+	0xff, 0xed, 0x01, 0x2e, 0xff, 0x94, 0x01, 0xa1, 0xff, 0xe9, 0x01, 0xa3, 0xff, 0xf0, 0x01, 0xa5,
+	0xff, 0xe2, 0x01, 0xa6, 0xff, 0xee, 0x01, 0xaa, 0xff, 0xee, 0x00, 0x06, 0x00, 0x75, 0xff, 0xd8,
+	0x00, 0xcd, 0x00, 0x47, 0x01, 0x0a, 0xff, 0xe4, 0x01, 0x2f, 0xff, 0x94, 0x01, 0x8e, 0xff, 0xd8,
+	0x01, 0xa2, 0xff, 0xe1, 0x00, 0x05, 0x00, 0x37, 0x00, 0x14, 0x00, 0xca, 0x00, 0x1a, 0x00, 0xcd,
+	0x00, 0x2b, 0x00, 0xce, 0x00, 0x2b, 0x00, 0xcf, 0x00, 0x2b, 0x00, 0x07, 0x00, 0x24, 0xff, 0xf4,
+	0x00, 0xca, 0x00, 0x08, 0x00, 0xcd, 0x00, 0x19, 0x00, 0xce, 0x00, 0x19, 0x00, 0xcf, 0x00, 0x19,
+	0x00, 0xd7, 0xff, 0xf3, 0x01, 0x2f, 0xff, 0xf0, 0x00, 0x0a, 0x00, 0x75, 0xff, 0xe1, 0x01, 0x8e,
+	0xff, 0xc0, 0x01, 0x8f, 0xff, 0xd4, 0x01, 0x90, 0xff, 0xe0, 0x01, 0x94, 0xff, 0xd2, 0x01, 0x95,
+	0xff, 0xef, 0x01, 0xa3, 0xff, 0xe5, 0x01, 0xa4, 0xff, 0xe0, 0x01, 0xa8, 0xff, 0xe6, 0x01, 0xa9,
+	0xff, 0xef, 0x00, 0x06, 0x00, 0x37, 0x00, 0x1f, 0x00, 0x66, 0xff, 0xe7, 0x00, 0xca, 0x00, 0x25,
+	0x00, 0xcd, 0x00, 0x34, 0x00, 0xce, 0x00, 0x34, 0x00, 0xcf, 0x00, 0x34, 0x00, 0x02, 0x01, 0x4b,
+	0xff, 0xca, 0x01, 0x4f, 0xff, 0xca, 0x00, 0x10, 0x00, 0x24, 0xff, 0xe8, 0x00, 0x37, 0x00, 0x2d,
+	0x00, 0x42, 0xff, 0xe3, 0x00, 0x64, 0xff, 0xec, 0x00, 0x66, 0xff, 0xc4, 0x00, 0x75, 0xff, 0xd0,
+	0x00, 0x9e, 0xff, 0xec, 0x00, 0xa8, 0xff, 0xe2, 0x00, 0xb3, 0xff, 0xe6, 0x00, 0xca, 0x00, 0x35,
+	0x00, 0xcd, 0x00, 0x47, 0x00, 0xce, 0x00, 0x47, 0x00, 0xcf, 0x00, 0x47, 0x00, 0xd7, 0xff, 0xe5,
+	0x01, 0x0a, 0xff, 0xe1, 0x01, 0x3e, 0xff, 0xe5, 0x00, 0x05, 0x00, 0x66, 0xff, 0xe0, 0x00, 0x75,
+	0xff, 0xe4, 0x00, 0x86, 0xff, 0xf4, 0x01, 0x81, 0xff, 0xe7, 0x01, 0x83, 0xff, 0xe1, 0x00, 0x01,
+	0x00, 0x75, 0xff, 0xe7, 0x00, 0x0d, 0x00, 0xc5, 0x00, 0x46, 0x00, 0xc6, 0x00, 0x27, 0x00, 0xc9,
+	0x00, 0x19, 0x00, 0xcb, 0x00, 0x39, 0x00, 0xce, 0x00, 0x3d, 0x01, 0x0a, 0x00, 0x09, 0x01, 0x3b,
+	0xff, 0xcc, 0x01, 0x81, 0xff, 0xe5, 0x01, 0x83, 0xff, 0xe6, 0x01, 0xa1, 0xff, 0xf3, 0x01, 0xa5,
+	0xff, 0xec, 0x01, 0xa8, 0x00, 0x05, 0x01, 0xaa, 0xff, 0xf8, 0x00, 0x02, 0x01, 0x81, 0xff, 0xe7,
+	0x01, 0x83, 0xff, 0xe9, 0x00, 0x02, 0x01, 0x81, 0xff, 0xe8, 0x01, 0x83, 0xff, 0xe8, 0x00, 0x03,
+	0x00, 0x66, 0xff, 0xf2, 0x01, 0x81, 0xff, 0xe7, 0x01, 0x83, 0xff, 0xe6, 0x00, 0x06, 0x00, 0xc4,
+	0x00, 0x23, 0x00, 0xc5, 0x00, 0x3e, 0x00, 0xc6, 0x00, 0x1f, 0x00, 0xc9, 0x00, 0x18, 0x00, 0xcb,
+	0x00, 0x31, 0x00, 0xce, 0x00, 0x34, 0x00, 0x07, 0x00, 0xc5, 0x00, 0x41, 0x00, 0xc6, 0x00, 0x22,
+	0x00, 0xc9, 0x00, 0x1d, 0x00, 0xcb, 0x00, 0x34, 0x00, 0xce, 0x00, 0x37, 0x01, 0x81, 0xff, 0xeb,
+	0x01, 0x83, 0xff, 0xea, 0x00, 0x02, 0x01, 0x81, 0xff, 0xee, 0x01, 0x83, 0xff, 0xec, 0x00, 0x02,
+	0x01, 0x81, 0xff, 0xed, 0x01, 0x83, 0xff, 0xeb, 0x00, 0x05, 0x00, 0x37, 0x00, 0x18, 0x00, 0xca,
+	0x00, 0x1e, 0x00, 0xcd, 0x00, 0x30, 0x00, 0xce, 0x00, 0x30, 0x00, 0xcf, 0x00, 0x30, 0x00, 0x06,
+	0x00, 0xc4, 0x00, 0x2d, 0x00, 0xc5, 0x00, 0x46, 0x00, 0xc6, 0x00, 0x29, 0x00, 0xc9, 0x00, 0x22,
+	0x00, 0xcb, 0x00, 0x39, 0x00, 0xce, 0x00, 0x3d, 0x00, 0x08, 0x00, 0xc0, 0x00, 0x0e, 0x00, 0xc4,
+	0x00, 0x3b, 0x00, 0xc5, 0x00, 0x4b, 0x00, 0xc6, 0x00, 0x37, 0x00, 0xc7, 0x00, 0x10, 0x00, 0xc9,
+	0x00, 0x30, 0x00, 0xcb, 0x00, 0x41, 0x00, 0xce, 0x00, 0x42, 0x00, 0x06, 0x00, 0xc4, 0x00, 0x27,
+	0x00, 0xc5, 0x00, 0x42, 0x00, 0xc6, 0x00, 0x23, 0x00, 0xc9, 0x00, 0x1c, 0x00, 0xcb, 0x00, 0x35,
+	0x00, 0xce, 0x00, 0x38, 0x00, 0x02, 0x01, 0xa1, 0xff, 0xf0, 0x01, 0xa5, 0xff, 0xea, 0x00, 0x0f,
+	0x00, 0x31, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x11, 0x00, 0x36, 0x00, 0x0a, 0x00, 0x37, 0x00, 0x1e,
+	0x00, 0x38, 0x00, 0x23, 0x00, 0xa8, 0xff, 0xf0, 0x00, 0xc4, 0x00, 0x1d, 0x00, 0xc5, 0x00, 0x08,
+	0x00, 0xc7, 0x00, 0x18, 0x00, 0xca, 0x00, 0x23, 0x00, 0xcd, 0x00, 0x2a, 0x00, 0xce, 0x00, 0x2a,
+	0x00, 0xcf, 0x00, 0x2a, 0x01, 0x43, 0xff, 0xf0, 0x01, 0xa1, 0xff, 0xf0, 0x00, 0x1f, 0x00, 0x24,
+	0xff, 0xef, 0x00, 0x31, 0x00, 0x37, 0x00, 0x32, 0x00, 0x18, 0x00, 0x36, 0x00, 0x11, 0x00, 0x37,
+	0x00, 0x2b, 0x00, 0x38, 0x00, 0x2a, 0x00, 0x42, 0xff, 0xf0, 0x00, 0xa8, 0xff, 0xed, 0x00, 0xc4,
+	0x00, 0x28, 0x00, 0xc6, 0x00, 0x12, 0x00, 0xc7, 0x00, 0x23, 0x00, 0xca, 0x00, 0x31, 0x00, 0xcb,
+	0x00, 0x1c, 0x00, 0xcd, 0x00, 0x43, 0x00, 0xce, 0x00, 0x43, 0x00, 0xcf, 0x00, 0x43, 0x01, 0x0a,
+	0xff, 0xeb, 0x01, 0x3c, 0xff, 0xe8, 0x01, 0x3e, 0xff, 0xe4, 0x01, 0x43, 0xff, 0xe7, 0x01, 0x44,
+	0xff, 0xef, 0x01, 0x45, 0xff, 0xeb, 0x01, 0x82, 0xff, 0xf0, 0x01, 0x8d, 0xff, 0xeb, 0x01, 0x91,
+	0xff, 0xeb, 0x01, 0x93, 0xff, 0xea, 0x01, 0x95, 0xff, 0xf0, 0x01, 0xa1, 0xff, 0xec, 0x01, 0xa2,
+	0xff, 0xe9, 0x01, 0xa7, 0xff, 0xe9, 0x01, 0xa9, 0xff, 0xf0, 0x00, 0x22, 0x00, 0x24, 0xff, 0xed,
+	0x00, 0x30, 0x00, 0x10, 0x00, 0x31, 0x00, 0x39, 0x00, 0x32, 0x00, 0x1a, 0x00, 0x36, 0x00, 0x13,
+	0x00, 0x37, 0x00, 0x2f, 0x00, 0x38, 0x00, 0x2c, 0x00, 0x42, 0xff, 0xed, 0x00, 0xa8, 0xff, 0xec,
+	0x00, 0xb3, 0xff, 0xf0, 0x00, 0xc1, 0x00, 0x3e, 0x00, 0xc4, 0x00, 0x2a, 0x00, 0xc6, 0x00, 0x09,
+	0x00, 0xc7, 0x00, 0x25, 0x00, 0xca, 0x00, 0x35, 0x00, 0xcb, 0x00, 0x16, 0x00, 0xcd, 0x00, 0x45,
+	0x00, 0xce, 0x00, 0x45, 0x00, 0xcf, 0x00, 0x45, 0x01, 0x0a, 0xff, 0xea, 0x01, 0x3c, 0xff, 0xe8,
+	0x01, 0x3e, 0xff, 0xe6, 0x01, 0x43, 0xff, 0xe6, 0x01, 0x44, 0xff, 0xec, 0x01, 0x45, 0xff, 0xea,
+	0x01, 0x82, 0xff, 0xed, 0x01, 0x8d, 0xff, 0xeb, 0x01, 0x91, 0xff, 0xeb, 0x01, 0x93, 0xff, 0xe9,
+	0x01, 0x95, 0xff, 0xf0, 0x01, 0xa1, 0xff, 0xeb, 0x01, 0xa2, 0xff, 0xe9, 0x01, 0xa7, 0xff, 0xe9,
+	0x01, 0xa9, 0xff, 0xef, 0x00, 0x02, 0x01, 0x81, 0xff, 0xf0, 0x01, 0x83, 0xff, 0xed, 0x00, 0x03,
+	0x00, 0x66, 0xff, 0xd6, 0x00, 0x86, 0xff, 0xf3, 0x01, 0x1b, 0xff, 0xf2, 0x00, 0x03, 0x00, 0x66,
+	0xff, 0xd2, 0x00, 0x86, 0xff, 0xe8, 0x01, 0x1b, 0xff, 0xec, 0x00, 0x07, 0x00, 0x24, 0xff, 0xe1,
+	0x00, 0x75, 0xff, 0xd3, 0x00, 0x9e, 0xff, 0xf3, 0x00, 0xa8, 0xff, 0xe5, 0x00, 0xb3, 0xff, 0xe8,
+	0x00, 0xcd, 0x00, 0x4d, 0x01, 0x0a, 0xff, 0xd9, 0x00, 0x05, 0x00, 0x75, 0xff, 0xf5, 0x01, 0x81,
+	0xff, 0xec, 0x01, 0x83, 0xff, 0xeb, 0x01, 0x8f, 0xff, 0xf7, 0x01, 0x94, 0xff, 0xf5, 0x00, 0x01,
+	0x01, 0x35, 0xff, 0xea, 0x00, 0x03, 0x00, 0x75, 0xff, 0xf2, 0x01, 0x81, 0xff, 0xee, 0x01, 0x83,
+	0xff, 0xee, 0x00, 0x0b, 0x00, 0x75, 0xff, 0xdd, 0x01, 0x2f, 0xff, 0xe9, 0x01, 0x3e, 0xff, 0xec,
+	0x01, 0x54, 0xff, 0xeb, 0x01, 0x81, 0xff, 0xec, 0x01, 0x83, 0xff, 0xec, 0x01, 0x8e, 0xff, 0xe0,
+	0x01, 0x8f, 0xff, 0xf4, 0x01, 0x90, 0xff, 0xf6, 0x01, 0x94, 0xff, 0xe9, 0x01, 0x96, 0xff, 0xf5,
+	0x00, 0x01, 0x01, 0x3e, 0xff, 0xf5, 0x00, 0x06, 0x00, 0x75, 0xff, 0xec, 0x01, 0x3e, 0xff, 0xf0,
+	0x01, 0x54, 0xff, 0xec, 0x01, 0x83, 0xff, 0xf0, 0x01, 0x8e, 0xff, 0xeb, 0x01, 0x94, 0xff, 0xf3,
+	0x00, 0x05, 0x01, 0x2e, 0xff, 0xd5, 0x01, 0x35, 0xff, 0xd6, 0x01, 0x8d, 0xff, 0xf8, 0x01, 0x91,
+	0xff, 0xf4, 0x01, 0x93, 0xff, 0xf2, 0x00, 0x03, 0x01, 0x35, 0xff, 0xf0, 0x01, 0x81, 0xff, 0xf0,
+	0x01, 0x83, 0xff, 0xef, 0x00, 0x06, 0x00, 0x75, 0xff, 0xf5, 0x01, 0x81, 0xff, 0xea, 0x01, 0x83,
+	0xff, 0xea, 0x01, 0x8f, 0xff, 0xf2, 0x01, 0x90, 0xff, 0xf6, 0x01, 0x94, 0xff, 0xf4, 0x00, 0x08,
+	0x01, 0x2f, 0xff, 0xe9, 0x01, 0x3e, 0xff, 0xf4, 0x01, 0x7f, 0xff, 0xf0, 0x01, 0x81, 0xff, 0xec,
+	0x01, 0x83, 0xff, 0xea, 0x01, 0xa3, 0xff, 0xf8, 0x01, 0xa4, 0xff, 0xec, 0x01, 0xa8, 0xff, 0xf1,
+	0x00, 0x01, 0x01, 0xa4, 0xff, 0xf4, 0x00, 0x02, 0x01, 0x2f, 0xff, 0xec, 0x01, 0x3e, 0xff, 0xf8,
+	0x00, 0x04, 0x01, 0x2f, 0xff, 0xe3, 0x01, 0x3e, 0xff, 0xec, 0x01, 0x54, 0xff, 0xec, 0x01, 0xa8,
+	0xff, 0xf6, 0x00, 0x0b, 0x01, 0x2f, 0xff, 0xd6, 0x01, 0x35, 0xff, 0xe2, 0x01, 0x3e, 0xff, 0xd5,
+	0x01, 0x47, 0xff, 0xe5, 0x01, 0x48, 0xff, 0xe2, 0x01, 0x54, 0xff, 0xd1, 0x01, 0xa2, 0xff, 0xe0,
+	0x01, 0xa4, 0xff, 0xe5, 0x01, 0xa6, 0xff, 0xee, 0x01, 0xa8, 0xff, 0xdf, 0x01, 0xaa, 0xff, 0xef,
+	0x00, 0x04, 0x01, 0x2f, 0xff, 0xeb, 0x01, 0x35, 0xff, 0xd3, 0x01, 0x3e, 0xff, 0xf7, 0x01, 0xaa,
+	0xff, 0xf6, 0x00, 0x06, 0x01, 0x3e, 0xff, 0xf0, 0x01, 0x54, 0xff, 0xeb, 0x01, 0x81, 0xff, 0xf0,
+	0x01, 0x83, 0xff, 0xef, 0x01, 0xa4, 0xff, 0xf1, 0x01, 0xa8, 0xff, 0xf1, 0x00, 0x05, 0x01, 0x2e,
+	0xff, 0xe3, 0x01, 0x3e, 0x00, 0x07, 0x01, 0x81, 0xff, 0xe7, 0x01, 0x83, 0xff, 0xe8, 0x01, 0xa5,
+	0xff, 0xec, 0x00, 0x03, 0x01, 0x35, 0xff, 0xef, 0x01, 0x81, 0xff, 0xef, 0x01, 0x83, 0xff, 0xef,
+	0x00, 0x05, 0x01, 0x2f, 0xff, 0xe7, 0x01, 0x3e, 0xff, 0xef, 0x01, 0x54, 0xff, 0xec, 0x01, 0xa4,
+	0xff, 0xf3, 0x01, 0xa8, 0xff, 0xf0, 0x00, 0x01, 0x01, 0xad, 0xff, 0xf1, 0x00, 0x01, 0x01, 0xad,
+	0xff, 0xf4, 0x00, 0x01, 0x01, 0xc0, 0xff, 0xe0, 0x00, 0x01, 0x01, 0xc0, 0xff, 0xe9, 0x00, 0x01,
+	0x01, 0xc0, 0xff, 0xef, 0x00, 0x03, 0x01, 0xb7, 0xff, 0xf1, 0x01, 0xbd, 0xff, 0xf4, 0x01, 0xc0,
+	0xff, 0xe7, 0x00, 0x01, 0x01, 0xc0, 0xff, 0xe8, 0x00, 0x02, 0x01, 0xb7, 0xff, 0xf3, 0x01, 0xc0,
+	0xff, 0xe7, 0x00, 0x01, 0x01, 0xc0, 0xff, 0xc7, 0x00, 0x01, 0x01, 0xc0, 0xff, 0xe6, 0x00, 0x01,
+	0x01, 0xc0, 0xff, 0xde, 0x00, 0x08, 0x01, 0xac, 0xff, 0xe3, 0x01, 0xae, 0xff, 0xea, 0x01, 0xaf,
+	0xff, 0xed, 0x01, 0xb0, 0xff, 0xe1, 0x01, 0xb1, 0xff, 0xe9, 0x01, 0xb2, 0xff, 0xe0, 0x01, 0xb4,
+	0xff, 0xe6, 0x01, 0xb5, 0xff, 0xea, 0x00, 0x02, 0x3e, 0xa4, 0x00, 0x04, 0x00, 0x00, 0x3f, 0x38,
+	0x41, 0xdc, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x00, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0xf3, 0xff, 0xf9,
+	0xff, 0xee, 0xff, 0xe9, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0xff, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xfb,
+	0xff, 0xe0, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xf1, 0xff, 0xf8, 0xff, 0xb1, 0xff, 0xf5,
+	0xff, 0xed, 0xff, 0xf4, 0xff, 0xf3, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xd2, 0xff, 0x76, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xaa, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xdd, 0xff, 0xac, 0xff, 0xb4, 0xff, 0xf3, 0xff, 0xb6, 0xff, 0xc6,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0xff, 0xf5,
+	0xff, 0xd5, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc2, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xf1, 0xff, 0xf2, 0xff, 0xfa, 0xff, 0xe0, 0xff, 0xd8,
+	0xff, 0xd8, 0xff, 0xdc, 0xff, 0xe8, 0xff, 0xd9, 0xff, 0xc2, 0xff, 0xe1, 0xff, 0xe9, 0xff, 0xea,
+	0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0xff, 0xca,
+	0xff, 0xc2, 0xff, 0xec, 0xff, 0xd4, 0xff, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd7, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe6,
+	0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xd7, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf4, 0xff, 0xe6, 0xff, 0xcf, 0xff, 0xed, 0xff, 0xea, 0xff, 0xd4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00,
+	0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd3, 0xff, 0xe0,
+	0x00, 0x00, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xec, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcd, 0xff, 0xe8, 0xff, 0xe8, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xed, 0xff, 0xeb, 0xff, 0xee, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xee,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe1, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xe8, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xd4, 0xff, 0xe9, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0xff, 0xed, 0xff, 0xee,
+	0x00, 0x00, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe8, 0xff, 0xea, 0x00, 0x00,
+	0xff, 0xec, 0xff, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0xff, 0xfa,
+	0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0xff, 0xc1,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf0, 0xff, 0xee, 0xff, 0xee, 0xff, 0xf2, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xd3, 0xff, 0xfc,
+	0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00,
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe8, 0xff, 0xd5, 0xff, 0xe2,
+	0xff, 0xeb, 0xff, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0xff, 0xe8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc1,
+	0xff, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd7, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0xff, 0xe0, 0xff, 0xf6, 0xff, 0xc5, 0xff, 0xf2, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xde, 0xff, 0xe9, 0xff, 0xea, 0xff, 0xe7, 0x00, 0x00,
+	0xff, 0xfa, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0x00, 0x00, 0xff, 0xef, 0x00, 0x00, 0xff, 0xea, 0xff, 0xf3,
+	0x00, 0x00, 0xff, 0xe7, 0x00, 0x00, 0xff, 0xed, 0xff, 0xea, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf4, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0xff, 0xef, 0x00, 0x00,
+	0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xf6, 0x00, 0x00, 0xff, 0xf3, 0xff, 0xf3, 0x00, 0x00,
+	0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0xff, 0xe7,
+	0xff, 0xf5, 0xff, 0xf6, 0xff, 0xeb, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xe7, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xde, 0xff, 0xb6, 0xff, 0xbf, 0xff, 0xe7,
+	0xff, 0xcf, 0xff, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0xff, 0xed, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe3, 0xff, 0xe4, 0xff, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf4,
+	0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0xff, 0xef, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xf4, 0xff, 0xbe, 0xff, 0xd4, 0x00, 0x00, 0xff, 0xc1, 0x00, 0x00, 0xff, 0xe2,
+	0xff, 0xe2, 0x00, 0x00, 0xff, 0xea, 0xff, 0xe2, 0xff, 0xe2, 0xff, 0xec, 0xff, 0xf0, 0xff, 0xe2,
+	0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4,
+	0xff, 0xdc, 0xff, 0xe3, 0xff, 0xe1, 0x00, 0x00, 0xff, 0xe3, 0xff, 0xe1, 0xff, 0xe2, 0x00, 0x00,
+	0xff, 0xe2, 0xff, 0xe7, 0x00, 0x00, 0xff, 0xeb, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xdd, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xba, 0xff, 0xa3, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xd5, 0xff, 0xf2, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc3, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xf7, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xe7, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe6, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd7, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0xff, 0xe8,
+	0xff, 0xe8, 0xff, 0xe9, 0x00, 0x00, 0xff, 0xe9, 0xff, 0xc9, 0xff, 0xee, 0xff, 0xe7, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf6, 0xff, 0xf2, 0xff, 0xf8, 0xff, 0xe8, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xe8, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf6,
+	0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd5, 0xff, 0xd9,
+	0x00, 0x00, 0xff, 0xd1, 0x00, 0x00, 0xff, 0xdd, 0xff, 0xde, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xe7,
+	0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0xff, 0xe8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xdf, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0xff, 0xde, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00,
+	0xff, 0xe3, 0xff, 0xee, 0xff, 0xf7, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7,
+	0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe3, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xdd, 0xff, 0xca, 0xff, 0xca, 0x00, 0x00, 0xff, 0xeb, 0xff, 0xf4,
+	0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf7, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf8,
+	0x00, 0x00, 0xff, 0xf6, 0xff, 0xd2, 0xff, 0xfb, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe7, 0x00, 0x00, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xee, 0xff, 0xf4, 0xff, 0xf6,
+	0xff, 0xed, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed,
+	0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xa9, 0xff, 0xe6, 0x00, 0x00, 0xff, 0xaa, 0xff, 0xdb, 0xff, 0xf2,
+	0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf5, 0x00, 0x00, 0xff, 0xfa,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe8, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe2, 0xff, 0xd2, 0xff, 0xd1, 0xff, 0xd9, 0xff, 0xeb, 0xff, 0xee, 0xff, 0xd4, 0x00, 0x00,
+	0xff, 0xeb, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf1,
+	0xff, 0xc2, 0xff, 0xea, 0xff, 0xd8, 0xff, 0xd7, 0xff, 0xcf, 0xff, 0xe8, 0xff, 0xfb, 0xff, 0xf3,
+	0xff, 0xf6, 0xff, 0xf0, 0xff, 0xc4, 0xff, 0xe8, 0xff, 0xe6, 0xff, 0xde, 0xff, 0xe3, 0xff, 0xdd,
+	0xff, 0xf3, 0xff, 0xd0, 0xff, 0xf7, 0xff, 0xe4, 0xff, 0xdd, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xd9, 0xff, 0xf8, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0xff, 0xf8, 0xff, 0xf2,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xf6, 0x00, 0x00, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xf5, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdc,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0x00, 0x00,
+	0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0xff, 0xdf, 0xff, 0xeb, 0xff, 0xf9,
+	0xff, 0xe1, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf8, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xd9, 0xff, 0xe7, 0xff, 0xe7, 0xff, 0xeb, 0xff, 0xf3, 0xff, 0xec,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0xff, 0xf5, 0xff, 0xf6, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xf6, 0x00, 0x00, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf4, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfa,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf9, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf4, 0xff, 0xfa, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0xff, 0xf4, 0xff, 0xf9, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xc8, 0xff, 0xd8, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe8,
+	0xff, 0xe6, 0xff, 0xd6, 0x00, 0x00, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xed,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd5, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe1,
+	0xff, 0xee, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf4, 0x00, 0x00, 0xff, 0xe3, 0xff, 0xf3, 0x00, 0x00,
+	0xff, 0xef, 0xff, 0xec, 0xff, 0xe5, 0xff, 0xe6, 0xff, 0xf7, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xcb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0x00, 0x10, 0xff, 0xe4, 0x00, 0x00,
+	0xff, 0xe0, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xed, 0xff, 0xe8, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0x9f, 0xff, 0xbf, 0x00, 0x00, 0xff, 0x99, 0xff, 0xb3, 0xff, 0xef, 0xff, 0xf0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0xff, 0xee, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd2, 0xff, 0xb4,
+	0xff, 0xb4, 0xff, 0xc2, 0xff, 0xdf, 0xff, 0xd4, 0xff, 0xb4, 0x00, 0x00, 0xff, 0xe8, 0xff, 0xef,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0xff, 0xaf, 0xff, 0xe5,
+	0xff, 0xb5, 0xff, 0xd1, 0xff, 0xa4, 0xff, 0xc1, 0x00, 0x00, 0xff, 0xd2, 0xff, 0xf3, 0xff, 0xed,
+	0xff, 0xbf, 0xff, 0xc5, 0xff, 0xc3, 0xff, 0xb7, 0xff, 0xe1, 0xff, 0xb6, 0xff, 0xf5, 0xff, 0xb6,
+	0xff, 0xf7, 0xff, 0xbe, 0xff, 0xc3, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf0, 0xff, 0xea, 0xff, 0xf0, 0xff, 0xfa, 0xff, 0xe4, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf9, 0x00, 0x00, 0xff, 0xf6, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdb, 0xff, 0xe8,
+	0xff, 0xe9, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xef,
+	0xff, 0xf4, 0xff, 0xfb, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa,
+	0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xf8, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf9, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0xff, 0xfb,
+	0xff, 0xf9, 0xff, 0xf6, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0xff, 0xe9,
+	0xff, 0xf5, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xeb, 0x00, 0x00, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa9, 0xff, 0xa8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbe, 0xff, 0xe6, 0xff, 0xe9, 0xff, 0xfa,
+	0xff, 0xbc, 0xff, 0xa6, 0xff, 0xa6, 0xff, 0xa7, 0xff, 0xc8, 0xff, 0xa7, 0xff, 0xc1, 0xff, 0xbb,
+	0xff, 0xe9, 0xff, 0xc8, 0xff, 0xd1, 0xff, 0xc7, 0x00, 0x00, 0xff, 0xe6, 0xff, 0xba, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xc9, 0xff, 0xea, 0xff, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea,
+	0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0x00, 0x00, 0xff, 0xe6,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc5, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x0b, 0x00, 0x00, 0xff, 0xe7, 0x00, 0x0c,
+	0xff, 0xed, 0x00, 0x00, 0xff, 0xca, 0xff, 0xf1, 0xff, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xc3, 0xff, 0xe8, 0xff, 0xc4, 0xff, 0xd3, 0xff, 0xec, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xea, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00,
+	0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfa, 0xff, 0xfb, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdd, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe6, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe6, 0xff, 0xf8, 0xff, 0xf9, 0x00, 0x00, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9,
+	0xff, 0xf3, 0xff, 0xe9, 0xff, 0xcd, 0xff, 0xf2, 0xff, 0xea, 0xff, 0xf6, 0x00, 0x00, 0xff, 0xfb,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe9, 0xff, 0xf3, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x0e, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5,
+	0xff, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0x00, 0x00,
+	0xff, 0xf1, 0xff, 0xe0, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0xff, 0xe2, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef,
+	0xff, 0xed, 0xff, 0xe2, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7,
+	0xff, 0xf1, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf4, 0x00, 0x00, 0xff, 0xe6, 0xff, 0xf4, 0x00, 0x00,
+	0xff, 0xf0, 0xff, 0xee, 0xff, 0xed, 0xff, 0xe7, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x06, 0xff, 0xe7, 0x00, 0x00,
+	0xff, 0xe7, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf3, 0xff, 0xeb, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xaa, 0xff, 0x9f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc9, 0xff, 0xde, 0xff, 0xde, 0xff, 0xf4,
+	0xff, 0xc1, 0xff, 0xc1, 0xff, 0xc1, 0xff, 0xc3, 0xff, 0xcd, 0xff, 0xc2, 0xff, 0xbb, 0xff, 0xc2,
+	0xff, 0xe9, 0xff, 0xd0, 0xff, 0xee, 0xff, 0xd5, 0x00, 0x00, 0xff, 0xe6, 0xff, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xf4, 0xff, 0xf3, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3,
+	0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0x00, 0x00, 0xff, 0xe0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc5, 0xff, 0xe6, 0xff, 0xeb, 0xff, 0xf4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xde, 0x00, 0x10,
+	0xff, 0xeb, 0x00, 0x00, 0xff, 0xf3, 0xff, 0xe4, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xc8, 0xff, 0xe5, 0xff, 0xc6, 0xff, 0xd1, 0xff, 0xe5, 0xff, 0xed,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd8, 0xff, 0xf8,
+	0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf3, 0x00, 0x00, 0xff, 0xfa,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf7, 0xff, 0xf8, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf4,
+	0x00, 0x00, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0xff, 0xf2,
+	0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa8, 0xff, 0xea, 0x00, 0x00, 0xff, 0xc2,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfc,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf9, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf6, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xaa, 0xff, 0xea,
+	0xff, 0xe6, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xee, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf4, 0xff, 0xf2, 0xff, 0xf7,
+	0xff, 0xfb, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdc, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf8, 0x00, 0x00, 0xff, 0xe2, 0xff, 0xea, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xcc, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xf9, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf9, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xf9, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0xff, 0xde, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x4d, 0x00, 0x2b, 0x00, 0x20, 0x00, 0x22,
+	0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x2f,
+	0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x53, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x29, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x4a, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x2d, 0x00, 0x41, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb9, 0xff, 0xef,
+	0xff, 0xfb, 0xff, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfa,
+	0xff, 0xfb, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xfa, 0x00, 0x00, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xc5, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0xff, 0xdd, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0xff, 0xd1, 0xff, 0xba, 0xff, 0xe1, 0xff, 0xd8, 0xff, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf6, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdd, 0xff, 0xe2,
+	0xff, 0xe9, 0xff, 0xe1, 0x00, 0x00, 0xff, 0xdf, 0xff, 0xdc, 0xff, 0xec, 0xff, 0xee, 0xff, 0xf6,
+	0xff, 0xe7, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xd9, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xdf, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xda, 0xff, 0xb0, 0xff, 0xbe, 0xff, 0xe6,
+	0xff, 0xcd, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xe4, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe1, 0xff, 0xe2, 0xff, 0xd7, 0xff, 0xdd, 0x00, 0x00, 0xff, 0xd1, 0xff, 0xce, 0xff, 0xf3,
+	0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0xff, 0xde, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcc, 0xff, 0xd4, 0xff, 0xd0, 0xff, 0xdf, 0xff, 0xd1,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0xff, 0xde, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0xff, 0xeb, 0xff, 0xe2, 0xff, 0xdd, 0xff, 0xe2, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0xff, 0xd8, 0xff, 0xf8, 0xff, 0xf8, 0x00, 0x00,
+	0xff, 0xf9, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe1, 0x00, 0x00, 0xff, 0xe4, 0x00, 0x00, 0xff, 0xf9,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd7, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xa8, 0xff, 0xea, 0x00, 0x00, 0xff, 0xc3, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf9, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xdb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xa8, 0xff, 0xe9, 0xff, 0xe8, 0xff, 0xc4,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0xff, 0xf9,
+	0xff, 0xfa, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf4, 0xff, 0xf2, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfb,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00,
+	0xff, 0xe4, 0xff, 0xeb, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc1, 0xff, 0xcd,
+	0x00, 0x00, 0xff, 0xba, 0xff, 0xa9, 0xff, 0xeb, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd1, 0xff, 0xae, 0xff, 0xb0, 0xff, 0xcf,
+	0xff, 0xe8, 0xff, 0xdc, 0xff, 0xac, 0x00, 0x00, 0xff, 0xeb, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0xff, 0xc2, 0xff, 0xe4, 0xff, 0xa9, 0xff, 0xc9,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcf, 0xff, 0xf0, 0xff, 0xe9, 0xff, 0xc2, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xaa, 0xff, 0xe2, 0xff, 0xa9, 0xff, 0xee, 0x00, 0x00, 0xff, 0xf1, 0xff, 0xa9,
+	0xff, 0xd2, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbe, 0xff, 0xe3, 0xff, 0xeb, 0x00, 0x00, 0xff, 0xe1,
+	0xff, 0xec, 0xff, 0xdc, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0xff, 0xbd,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xf0, 0xff, 0xee, 0xff, 0xf2, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xae, 0x00, 0x00,
+	0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xe8, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0xff, 0xe5, 0xff, 0xe7, 0x00, 0x00,
+	0xff, 0xce, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xc6, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0xff, 0xeb, 0xff, 0xea, 0xff, 0xee, 0x00, 0x00, 0xff, 0xec,
+	0xff, 0xb0, 0xff, 0xf4, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe8, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0xff, 0xe0,
+	0xff, 0xe1, 0x00, 0x00, 0xff, 0xd4, 0xff, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xac, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xca,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc9, 0xff, 0xbc, 0xff, 0xc6, 0x00, 0x00,
+	0xff, 0xe6, 0xff, 0xf3, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0xff, 0xf2,
+	0xff, 0xf2, 0xff, 0xf5, 0x00, 0x00, 0xff, 0xf3, 0xff, 0xca, 0xff, 0xfb, 0xff, 0xed, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0xff, 0xe6, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xd8, 0xff, 0xeb, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfa, 0xff, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xc1, 0xff, 0xf2, 0x00, 0x00, 0xff, 0xcc, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf9, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe8, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xea, 0x00, 0x00, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xec, 0xff, 0xec, 0xff, 0xeb, 0xff, 0xef, 0xff, 0xf0, 0xff, 0xec, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0xff, 0xed, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd3, 0x00, 0x00, 0x00, 0x00, 0xff, 0xed,
+	0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf8,
+	0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xfa, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc8, 0xff, 0xf3,
+	0x00, 0x00, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0xff, 0xd4,
+	0xff, 0xcf, 0x00, 0x00, 0xff, 0xed, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xfb, 0xff, 0xdc, 0xff, 0xfc,
+	0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0x00, 0x00, 0xff, 0xf6, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf9, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe2, 0xff, 0xea, 0xff, 0xeb, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0xff, 0xef, 0xff, 0xe1, 0xff, 0xf7,
+	0xff, 0xf8, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xee, 0xff, 0xee, 0xff, 0xeb, 0x00, 0x00, 0xff, 0xee,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xec, 0x00, 0x00,
+	0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xde, 0xff, 0xca, 0xff, 0xca, 0x00, 0x00, 0xff, 0xeb, 0xff, 0xf4,
+	0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf7, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf8,
+	0x00, 0x00, 0xff, 0xf6, 0xff, 0xd2, 0xff, 0xfb, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xe7, 0x00, 0x00, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+	0xff, 0xf4, 0x00, 0x00, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0xda, 0xff, 0xe9, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00,
+	0xff, 0xfa, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc6, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xdb, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfb,
+	0xff, 0xfa, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xfa, 0x00, 0x00, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xee, 0xff, 0xfa, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x18, 0x00, 0x01,
+	0x00, 0x2a, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x42, 0x00, 0x2b,
+	0x00, 0x4a, 0x00, 0x86, 0x00, 0x35, 0x00, 0x92, 0x00, 0xa4, 0x00, 0x72, 0x00, 0xa6, 0x00, 0xa6,
+	0x00, 0x85, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0x86, 0x00, 0xba, 0x00, 0xc1, 0x00, 0x93, 0x00, 0xd0,
+	0x00, 0xd1, 0x00, 0x9b, 0x00, 0xd4, 0x00, 0xd4, 0x00, 0x9d, 0x00, 0xd6, 0x00, 0xda, 0x00, 0x9e,
+	0x00, 0xdc, 0x01, 0x1b, 0x00, 0xa3, 0x01, 0x2e, 0x01, 0x33, 0x00, 0xe3, 0x01, 0x35, 0x01, 0x35,
+	0x00, 0xe9, 0x01, 0x37, 0x01, 0x37, 0x00, 0xea, 0x01, 0x39, 0x01, 0x3e, 0x00, 0xeb, 0x01, 0x43,
+	0x01, 0x45, 0x00, 0xf1, 0x01, 0x4b, 0x01, 0x53, 0x00, 0xf4, 0x01, 0x7e, 0x01, 0x7e, 0x00, 0xfd,
+	0x01, 0x80, 0x01, 0x80, 0x00, 0xfe, 0x01, 0x82, 0x01, 0x8d, 0x00, 0xff, 0x01, 0x8f, 0x01, 0x96,
+	0x01, 0x0b, 0x01, 0xa1, 0x01, 0xa1, 0x01, 0x13, 0x01, 0xa4, 0x01, 0xaa, 0x01, 0x14, 0x00, 0x02,
+	0x00, 0x70, 0x00, 0x01, 0x00, 0x02, 0x00, 0x52, 0x00, 0x03, 0x00, 0x07, 0x00, 0x2e, 0x00, 0x08,
+	0x00, 0x09, 0x00, 0x31, 0x00, 0x0a, 0x00, 0x0e, 0x00, 0x2e, 0x00, 0x10, 0x00, 0x15, 0x00, 0x2f,
+	0x00, 0x16, 0x00, 0x19, 0x00, 0x30, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x31, 0x00, 0x24, 0x00, 0x24,
+	0x00, 0x36, 0x00, 0x25, 0x00, 0x25, 0x00, 0x01, 0x00, 0x26, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x35,
+	0x00, 0x35, 0x00, 0x33, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x33, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x34,
+	0x00, 0x3d, 0x00, 0x42, 0x00, 0x35, 0x00, 0x4a, 0x00, 0x4f, 0x00, 0x36, 0x00, 0x50, 0x00, 0x50,
+	0x00, 0x31, 0x00, 0x51, 0x00, 0x55, 0x00, 0x36, 0x00, 0x56, 0x00, 0x56, 0x00, 0x02, 0x00, 0x57,
+	0x00, 0x57, 0x00, 0x03, 0x00, 0x58, 0x00, 0x58, 0x00, 0x36, 0x00, 0x59, 0x00, 0x5c, 0x00, 0x37,
+	0x00, 0x5d, 0x00, 0x63, 0x00, 0x38, 0x00, 0x64, 0x00, 0x64, 0x00, 0x29, 0x00, 0x65, 0x00, 0x69,
+	0x00, 0x39, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x3a, 0x00, 0x75, 0x00, 0x75, 0x00, 0x04, 0x00, 0x76,
+	0x00, 0x7a, 0x00, 0x3b, 0x00, 0x7b, 0x00, 0x7c, 0x00, 0x3c, 0x00, 0x7d, 0x00, 0x81, 0x00, 0x3d,
+	0x00, 0x82, 0x00, 0x86, 0x00, 0x3e, 0x00, 0x92, 0x00, 0x96, 0x00, 0x3f, 0x00, 0x97, 0x00, 0x98,
+	0x00, 0x44, 0x00, 0x99, 0x00, 0x9d, 0x00, 0x3f, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0x40, 0x00, 0x9f,
+	0x00, 0xa4, 0x00, 0x41, 0x00, 0xa6, 0x00, 0xa6, 0x00, 0x43, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0x0f,
+	0x00, 0xa9, 0x00, 0xb2, 0x00, 0x44, 0x00, 0xb3, 0x00, 0xb3, 0x00, 0x4b, 0x00, 0xb4, 0x00, 0xb4,
+	0x00, 0x11, 0x00, 0xba, 0x00, 0xbe, 0x00, 0x45, 0x00, 0xbf, 0x00, 0xc1, 0x00, 0x4a, 0x00, 0xd0,
+	0x00, 0xd1, 0x00, 0x49, 0x00, 0xd4, 0x00, 0xd4, 0x00, 0x43, 0x00, 0xd6, 0x00, 0xd6, 0x00, 0x17,
+	0x00, 0xd7, 0x00, 0xd7, 0x00, 0x18, 0x00, 0xd8, 0x00, 0xda, 0x00, 0x4a, 0x00, 0xdc, 0x00, 0xdf,
+	0x00, 0x4a, 0x00, 0xe0, 0x00, 0xe4, 0x00, 0x4b, 0x00, 0xe5, 0x00, 0xe5, 0x00, 0x44, 0x00, 0xe6,
+	0x00, 0xeb, 0x00, 0x4b, 0x00, 0xec, 0x00, 0xed, 0x00, 0x40, 0x00, 0xee, 0x00, 0xee, 0x00, 0x45,
+	0x00, 0xef, 0x00, 0xf2, 0x00, 0x50, 0x00, 0xf3, 0x00, 0xf8, 0x00, 0x51, 0x00, 0xf9, 0x00, 0xf9,
+	0x00, 0x16, 0x00, 0xfa, 0x00, 0xfe, 0x00, 0x53, 0x00, 0xff, 0x01, 0x09, 0x00, 0x54, 0x01, 0x0a,
+	0x01, 0x0a, 0x00, 0x2b, 0x01, 0x0b, 0x01, 0x0f, 0x00, 0x55, 0x01, 0x10, 0x01, 0x11, 0x00, 0x56,
+	0x01, 0x12, 0x01, 0x16, 0x00, 0x57, 0x01, 0x17, 0x01, 0x1b, 0x00, 0x58, 0x01, 0x2e, 0x01, 0x2e,
+	0x00, 0x24, 0x01, 0x2f, 0x01, 0x2f, 0x00, 0x08, 0x01, 0x30, 0x01, 0x31, 0x00, 0x4c, 0x01, 0x32,
+	0x01, 0x33, 0x00, 0x42, 0x01, 0x35, 0x01, 0x35, 0x00, 0x1c, 0x01, 0x37, 0x01, 0x37, 0x00, 0x4c,
+	0x01, 0x39, 0x01, 0x39, 0x00, 0x10, 0x01, 0x3a, 0x01, 0x3a, 0x00, 0x1d, 0x01, 0x3b, 0x01, 0x3b,
+	0x00, 0x1e, 0x01, 0x3c, 0x01, 0x3c, 0x00, 0x05, 0x01, 0x3d, 0x01, 0x3d, 0x00, 0x07, 0x01, 0x3e,
+	0x01, 0x3e, 0x00, 0x06, 0x01, 0x43, 0x01, 0x43, 0x00, 0x0c, 0x01, 0x44, 0x01, 0x44, 0x00, 0x2a,
+	0x01, 0x45, 0x01, 0x45, 0x00, 0x1f, 0x01, 0x4b, 0x01, 0x4b, 0x00, 0x4c, 0x01, 0x4c, 0x01, 0x4d,
+	0x00, 0x4d, 0x01, 0x4e, 0x01, 0x4e, 0x00, 0x4e, 0x01, 0x4f, 0x01, 0x4f, 0x00, 0x4c, 0x01, 0x50,
+	0x01, 0x50, 0x00, 0x4d, 0x01, 0x51, 0x01, 0x51, 0x00, 0x4e, 0x01, 0x52, 0x01, 0x53, 0x00, 0x4f,
+	0x01, 0x7e, 0x01, 0x7e, 0x00, 0x1b, 0x01, 0x80, 0x01, 0x80, 0x00, 0x0b, 0x01, 0x82, 0x01, 0x82,
+	0x00, 0x09, 0x01, 0x83, 0x01, 0x83, 0x00, 0x0a, 0x01, 0x84, 0x01, 0x84, 0x00, 0x46, 0x01, 0x85,
+	0x01, 0x85, 0x00, 0x47, 0x01, 0x86, 0x01, 0x86, 0x00, 0x46, 0x01, 0x87, 0x01, 0x87, 0x00, 0x47,
+	0x01, 0x88, 0x01, 0x8b, 0x00, 0x48, 0x01, 0x8c, 0x01, 0x8c, 0x00, 0x28, 0x01, 0x8d, 0x01, 0x8d,
+	0x00, 0x2c, 0x01, 0x8f, 0x01, 0x8f, 0x00, 0x27, 0x01, 0x90, 0x01, 0x90, 0x00, 0x25, 0x01, 0x91,
+	0x01, 0x91, 0x00, 0x14, 0x01, 0x92, 0x01, 0x92, 0x00, 0x12, 0x01, 0x93, 0x01, 0x93, 0x00, 0x22,
+	0x01, 0x94, 0x01, 0x94, 0x00, 0x20, 0x01, 0x95, 0x01, 0x95, 0x00, 0x0d, 0x01, 0x96, 0x01, 0x96,
+	0x00, 0x19, 0x01, 0xa1, 0x01, 0xa1, 0x00, 0x2d, 0x01, 0xa4, 0x01, 0xa4, 0x00, 0x26, 0x01, 0xa5,
+	0x01, 0xa5, 0x00, 0x15, 0x01, 0xa6, 0x01, 0xa6, 0x00, 0x13, 0x01, 0xa7, 0x01, 0xa7, 0x00, 0x23,
+	0x01, 0xa8, 0x01, 0xa8, 0x00, 0x21, 0x01, 0xa9, 0x01, 0xa9, 0x00, 0x0e, 0x01, 0xaa, 0x01, 0xaa,
+	0x00, 0x1a, 0x00, 0x02, 0x00, 0x72, 0x00, 0x01, 0x00, 0x02, 0x00, 0x13, 0x00, 0x03, 0x00, 0x0e,
+	0x00, 0x01, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x24, 0x00, 0x10, 0x00, 0x15, 0x00, 0x08, 0x00, 0x16,
+	0x00, 0x23, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x3b, 0x00, 0x25, 0x00, 0x25, 0x00, 0x24,
+	0x00, 0x26, 0x00, 0x2a, 0x00, 0x09, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x24, 0x00, 0x39, 0x00, 0x3a,
+	0x00, 0x02, 0x00, 0x3b, 0x00, 0x41, 0x00, 0x24, 0x00, 0x42, 0x00, 0x42, 0x00, 0x28, 0x00, 0x43,
+	0x00, 0x49, 0x00, 0x24, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x09, 0x00, 0x56, 0x00, 0x57, 0x00, 0x24,
+	0x00, 0x58, 0x00, 0x58, 0x00, 0x09, 0x00, 0x59, 0x00, 0x5c, 0x00, 0x24, 0x00, 0x5d, 0x00, 0x63,
+	0x00, 0x0a, 0x00, 0x64, 0x00, 0x64, 0x00, 0x49, 0x00, 0x65, 0x00, 0x69, 0x00, 0x03, 0x00, 0x6a,
+	0x00, 0x74, 0x00, 0x21, 0x00, 0x75, 0x00, 0x75, 0x00, 0x29, 0x00, 0x76, 0x00, 0x7a, 0x00, 0x04,
+	0x00, 0x7b, 0x00, 0x7c, 0x00, 0x05, 0x00, 0x7d, 0x00, 0x81, 0x00, 0x06, 0x00, 0x82, 0x00, 0x86,
+	0x00, 0x17, 0x00, 0x92, 0x00, 0x9d, 0x00, 0x0b, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0x4c, 0x00, 0x9f,
+	0x00, 0xa4, 0x00, 0x0c, 0x00, 0xa5, 0x00, 0xa7, 0x00, 0x0d, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0x2f,
+	0x00, 0xa9, 0x00, 0xb2, 0x00, 0x10, 0x00, 0xb3, 0x00, 0xb3, 0x00, 0x47, 0x00, 0xb4, 0x00, 0xb4,
+	0x00, 0x22, 0x00, 0xb6, 0x00, 0xb9, 0x00, 0x22, 0x00, 0xba, 0x00, 0xbe, 0x00, 0x0e, 0x00, 0xbf,
+	0x00, 0xc1, 0x00, 0x25, 0x00, 0xc2, 0x00, 0xcf, 0x00, 0x26, 0x00, 0xd0, 0x00, 0xd1, 0x00, 0x25,
+	0x00, 0xd2, 0x00, 0xd6, 0x00, 0x27, 0x00, 0xd7, 0x00, 0xd7, 0x00, 0x31, 0x00, 0xd8, 0x00, 0xda,
+	0x00, 0x0f, 0x00, 0xdc, 0x00, 0xdf, 0x00, 0x0f, 0x00, 0xe0, 0x00, 0xeb, 0x00, 0x10, 0x00, 0xec,
+	0x00, 0xec, 0x00, 0x0f, 0x00, 0xed, 0x00, 0xed, 0x00, 0x25, 0x00, 0xee, 0x00, 0xee, 0x00, 0x0d,
+	0x00, 0xef, 0x00, 0xf2, 0x00, 0x0f, 0x00, 0xf3, 0x00, 0xf8, 0x00, 0x12, 0x00, 0xf9, 0x00, 0xf9,
+	0x00, 0x25, 0x00, 0xfa, 0x00, 0xfe, 0x00, 0x1d, 0x00, 0xff, 0x01, 0x09, 0x00, 0x14, 0x01, 0x0a,
+	0x01, 0x0a, 0x00, 0x3d, 0x01, 0x0b, 0x01, 0x0f, 0x00, 0x1e, 0x01, 0x10, 0x01, 0x11, 0x00, 0x15,
+	0x01, 0x12, 0x01, 0x16, 0x00, 0x1c, 0x01, 0x17, 0x01, 0x1b, 0x00, 0x16, 0x01, 0x2e, 0x01, 0x2e,
+	0x00, 0x48, 0x01, 0x2f, 0x01, 0x2f, 0x00, 0x2c, 0x01, 0x30, 0x01, 0x31, 0x00, 0x11, 0x01, 0x32,
+	0x01, 0x33, 0x00, 0x23, 0x01, 0x35, 0x01, 0x35, 0x00, 0x36, 0x01, 0x37, 0x01, 0x37, 0x00, 0x11,
+	0x01, 0x38, 0x01, 0x38, 0x00, 0x4d, 0x01, 0x3a, 0x01, 0x3a, 0x00, 0x37, 0x01, 0x3b, 0x01, 0x3b,
+	0x00, 0x4e, 0x01, 0x3c, 0x01, 0x3c, 0x00, 0x2a, 0x01, 0x3d, 0x01, 0x3d, 0x00, 0x45, 0x01, 0x3e,
+	0x01, 0x3e, 0x00, 0x2b, 0x01, 0x40, 0x01, 0x40, 0x00, 0x2d, 0x01, 0x41, 0x01, 0x41, 0x00, 0x2e,
+	0x01, 0x43, 0x01, 0x43, 0x00, 0x46, 0x01, 0x44, 0x01, 0x44, 0x00, 0x3c, 0x01, 0x45, 0x01, 0x45,
+	0x00, 0x38, 0x01, 0x46, 0x01, 0x46, 0x00, 0x3a, 0x01, 0x47, 0x01, 0x47, 0x00, 0x34, 0x01, 0x48,
+	0x01, 0x48, 0x00, 0x35, 0x01, 0x4b, 0x01, 0x4b, 0x00, 0x11, 0x01, 0x4c, 0x01, 0x4d, 0x00, 0x1a,
+	0x01, 0x4e, 0x01, 0x4e, 0x00, 0x1b, 0x01, 0x4f, 0x01, 0x4f, 0x00, 0x11, 0x01, 0x50, 0x01, 0x50,
+	0x00, 0x1a, 0x01, 0x51, 0x01, 0x51, 0x00, 0x1b, 0x01, 0x52, 0x01, 0x53, 0x00, 0x1f, 0x01, 0x56,
+	0x01, 0x57, 0x00, 0x20, 0x01, 0x7f, 0x01, 0x7f, 0x00, 0x4b, 0x01, 0x81, 0x01, 0x81, 0x00, 0x41,
+	0x01, 0x82, 0x01, 0x82, 0x00, 0x54, 0x01, 0x83, 0x01, 0x83, 0x00, 0x40, 0x01, 0x84, 0x01, 0x84,
+	0x00, 0x19, 0x01, 0x85, 0x01, 0x85, 0x00, 0x18, 0x01, 0x86, 0x01, 0x86, 0x00, 0x19, 0x01, 0x87,
+	0x01, 0x87, 0x00, 0x18, 0x01, 0x88, 0x01, 0x8b, 0x00, 0x07, 0x01, 0x8c, 0x01, 0x8c, 0x00, 0x3f,
+	0x01, 0x8d, 0x01, 0x8d, 0x00, 0x3e, 0x01, 0x8e, 0x01, 0x8e, 0x00, 0x33, 0x01, 0x8f, 0x01, 0x8f,
+	0x00, 0x44, 0x01, 0x90, 0x01, 0x90, 0x00, 0x43, 0x01, 0x91, 0x01, 0x91, 0x00, 0x30, 0x01, 0x93,
+	0x01, 0x93, 0x00, 0x39, 0x01, 0x94, 0x01, 0x94, 0x00, 0x42, 0x01, 0x95, 0x01, 0x95, 0x00, 0x4a,
+	0x01, 0x96, 0x01, 0x96, 0x00, 0x32, 0x01, 0xa1, 0x01, 0xa1, 0x00, 0x59, 0x01, 0xa2, 0x01, 0xa2,
+	0x00, 0x50, 0x01, 0xa3, 0x01, 0xa3, 0x00, 0x53, 0x01, 0xa4, 0x01, 0xa4, 0x00, 0x52, 0x01, 0xa5,
+	0x01, 0xa5, 0x00, 0x58, 0x01, 0xa6, 0x01, 0xa6, 0x00, 0x55, 0x01, 0xa7, 0x01, 0xa7, 0x00, 0x57,
+	0x01, 0xa8, 0x01, 0xa8, 0x00, 0x51, 0x01, 0xa9, 0x01, 0xa9, 0x00, 0x4f, 0x01, 0xaa, 0x01, 0xaa,
+	0x00, 0x56, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0xc4, 0x02, 0x78, 0x00, 0x02,
+	0x44, 0x46, 0x4c, 0x54, 0x00, 0x0e, 0x6c, 0x61, 0x74, 0x6e, 0x00, 0x2e, 0x00, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x14,
+	0x00, 0x19, 0x00, 0x21, 0x00, 0x26, 0x00, 0x2b, 0x00, 0x30, 0x00, 0x35, 0x00, 0x16, 0x00, 0x03,
+	0x43, 0x41, 0x54, 0x20, 0x00, 0x32, 0x4d, 0x4f, 0x4c, 0x20, 0x00, 0x50, 0x52, 0x4f, 0x4d, 0x20,
+	0x00, 0x6e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x10,
+	0x00, 0x15, 0x00, 0x1a, 0x00, 0x22, 0x00, 0x27, 0x00, 0x2c, 0x00, 0x31, 0x00, 0x36, 0x00, 0x00,
+	0xff, 0xff, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x11, 0x00, 0x16, 0x00, 0x1b,
+	0x00, 0x1e, 0x00, 0x23, 0x00, 0x28, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x37, 0x00, 0x00, 0xff, 0xff,
+	0x00, 0x0c, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x12, 0x00, 0x17, 0x00, 0x1c, 0x00, 0x1f,
+	0x00, 0x24, 0x00, 0x29, 0x00, 0x2e, 0x00, 0x33, 0x00, 0x38, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0c,
+	0x00, 0x04, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x18, 0x00, 0x1d, 0x00, 0x20, 0x00, 0x25,
+	0x00, 0x2a, 0x00, 0x2f, 0x00, 0x34, 0x00, 0x39, 0x00, 0x3a, 0x61, 0x61, 0x6c, 0x74, 0x01, 0x5e,
+	0x61, 0x61, 0x6c, 0x74, 0x01, 0x5e, 0x61, 0x61, 0x6c, 0x74, 0x01, 0x5e, 0x61, 0x61, 0x6c, 0x74,
+	0x01, 0x5e, 0x61, 0x61, 0x6c, 0x74, 0x01, 0x5e, 0x64, 0x6c, 0x69, 0x67, 0x01, 0x66, 0x64, 0x6c,
+	0x69, 0x67, 0x01, 0x66, 0x64, 0x6c, 0x69, 0x67, 0x01, 0x66, 0x64, 0x6c, 0x69, 0x67, 0x01, 0x66,
+	0x64, 0x6c, 0x69, 0x67, 0x01, 0x66, 0x64, 0x6e, 0x6f, 0x6d, 0x01, 0x6c, 0x64, 0x6e, 0x6f, 0x6d,
+	0x01, 0x6c, 0x64, 0x6e, 0x6f, 0x6d, 0x01, 0x6c, 0x64, 0x6e, 0x6f, 0x6d, 0x01, 0x6c, 0x64, 0x6e,
+	0x6f, 0x6d, 0x01, 0x6c, 0x66, 0x72, 0x61, 0x63, 0x01, 0x72, 0x66, 0x72, 0x61, 0x63, 0x01, 0x72,
+	0x66, 0x72, 0x61, 0x63, 0x01, 0x72, 0x66, 0x72, 0x61, 0x63, 0x01, 0x72, 0x66, 0x72, 0x61, 0x63,
+	0x01, 0x72, 0x6c, 0x69, 0x67, 0x61, 0x01, 0x78, 0x6c, 0x69, 0x67, 0x61, 0x01, 0x78, 0x6c, 0x69,
+	0x67, 0x61, 0x01, 0x78, 0x6c, 0x69, 0x67, 0x61, 0x01, 0x78, 0x6c, 0x69, 0x67, 0x61, 0x01, 0x78,
+	0x6c, 0x6e, 0x75, 0x6d, 0x01, 0x7e, 0x6c, 0x6e, 0x75, 0x6d, 0x01, 0x7e, 0x6c, 0x6e, 0x75, 0x6d,
+	0x01, 0x7e, 0x6c, 0x6e, 0x75, 0x6d, 0x01, 0x7e, 0x6c, 0x6e, 0x75, 0x6d, 0x01, 0x7e, 0x6c, 0x6f,
+	0x63, 0x6c, 0x01, 0x84, 0x6c, 0x6f, 0x63, 0x6c, 0x01, 0x8a, 0x6c, 0x6f, 0x63, 0x6c, 0x01, 0x90,
+	0x6f, 0x6e, 0x75, 0x6d, 0x01, 0x96, 0x6f, 0x6e, 0x75, 0x6d, 0x01, 0x96, 0x6f, 0x6e, 0x75, 0x6d,
+	0x01, 0x96, 0x6f, 0x6e, 0x75, 0x6d, 0x01, 0x96, 0x6f, 0x6e, 0x75, 0x6d, 0x01, 0x96, 0x6f, 0x72,
+	0x64, 0x6e, 0x01, 0x9c, 0x6f, 0x72, 0x64, 0x6e, 0x01, 0x9c, 0x6f, 0x72, 0x64, 0x6e, 0x01, 0x9c,
+	0x6f, 0x72, 0x64, 0x6e, 0x01, 0x9c, 0x6f, 0x72, 0x64, 0x6e, 0x01, 0x9c, 0x70, 0x6e, 0x75, 0x6d,
+	0x01, 0xa2, 0x70, 0x6e, 0x75, 0x6d, 0x01, 0xa2, 0x70, 0x6e, 0x75, 0x6d, 0x01, 0xa2, 0x70, 0x6e,
+	0x75, 0x6d, 0x01, 0xa2, 0x70, 0x6e, 0x75, 0x6d, 0x01, 0xa2, 0x73, 0x75, 0x70, 0x73, 0x01, 0xa8,
+	0x73, 0x75, 0x70, 0x73, 0x01, 0xa8, 0x73, 0x75, 0x70, 0x73, 0x01, 0xa8, 0x73, 0x75, 0x70, 0x73,
+	0x01, 0xa8, 0x73, 0x75, 0x70, 0x73, 0x01, 0xa8, 0x74, 0x6e, 0x75, 0x6d, 0x01, 0xae, 0x74, 0x6e,
+	0x75, 0x6d, 0x01, 0xae, 0x74, 0x6e, 0x75, 0x6d, 0x01, 0xae, 0x74, 0x6e, 0x75, 0x6d, 0x01, 0xae,
+	0x74, 0x6e, 0x75, 0x6d, 0x01, 0xae, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x11, 0x00, 0x24,
+	0x00, 0x56, 0x01, 0x28, 0x01, 0x28, 0x01, 0x4a, 0x01, 0x8e, 0x01, 0xa6, 0x01, 0xb4, 0x01, 0xf0,
+	0x02, 0x2e, 0x02, 0x46, 0x02, 0x5e, 0x02, 0x6c, 0x02, 0x84, 0x02, 0xa4, 0x02, 0xcc, 0x02, 0xfa,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x16, 0x00, 0x08, 0x01, 0x47,
+	0x01, 0x48, 0x00, 0x62, 0x00, 0x69, 0x01, 0x47, 0x01, 0x48, 0x00, 0xf8, 0x00, 0xfe, 0x00, 0x01,
+	0x00, 0x08, 0x00, 0x03, 0x00, 0x4a, 0x00, 0x60, 0x00, 0x68, 0x00, 0x92, 0x00, 0xe0, 0x00, 0xf6,
+	0x00, 0xfd, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0xc0, 0x00, 0x1e,
+	0x00, 0x42, 0x00, 0x4a, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x70, 0x00, 0x78, 0x00, 0x80,
+	0x00, 0x88, 0x00, 0x90, 0x00, 0x98, 0x00, 0x9c, 0x00, 0xa0, 0x00, 0xa4, 0x00, 0xa8, 0x00, 0xac,
+	0x00, 0xb0, 0x00, 0xb4, 0x00, 0xb8, 0x00, 0xbc, 0x00, 0x98, 0x00, 0x9c, 0x00, 0xa0, 0x00, 0xa4,
+	0x00, 0xa8, 0x00, 0xac, 0x00, 0xb0, 0x00, 0xb4, 0x00, 0xb8, 0x00, 0xbc, 0x00, 0x03, 0x01, 0xac,
+	0x01, 0x97, 0x01, 0xa1, 0x00, 0x04, 0x01, 0xb7, 0x01, 0xad, 0x01, 0x98, 0x01, 0xa2, 0x00, 0x04,
+	0x01, 0xb8, 0x01, 0xae, 0x01, 0x99, 0x01, 0xa3, 0x00, 0x04, 0x01, 0xb9, 0x01, 0xaf, 0x01, 0x9a,
+	0x01, 0xa4, 0x00, 0x03, 0x01, 0xb0, 0x01, 0x9b, 0x01, 0xa5, 0x00, 0x03, 0x01, 0xb1, 0x01, 0x9c,
+	0x01, 0xa6, 0x00, 0x03, 0x01, 0xb2, 0x01, 0x9d, 0x01, 0xa7, 0x00, 0x03, 0x01, 0xb3, 0x01, 0x9e,
+	0x01, 0xa8, 0x00, 0x03, 0x01, 0xb4, 0x01, 0x9f, 0x01, 0xa9, 0x00, 0x03, 0x01, 0xb5, 0x01, 0xa0,
+	0x01, 0xaa, 0x00, 0x01, 0x01, 0x8d, 0x00, 0x01, 0x01, 0x8e, 0x00, 0x01, 0x01, 0x8f, 0x00, 0x01,
+	0x01, 0x90, 0x00, 0x01, 0x01, 0x91, 0x00, 0x01, 0x01, 0x92, 0x00, 0x01, 0x01, 0x93, 0x00, 0x01,
+	0x01, 0x94, 0x00, 0x01, 0x01, 0x95, 0x00, 0x01, 0x01, 0x96, 0x00, 0x02, 0x00, 0x01, 0x01, 0x8d,
+	0x01, 0xaa, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x0e,
+	0x00, 0x04, 0x00, 0x62, 0x00, 0x69, 0x00, 0xf8, 0x00, 0xfe, 0x00, 0x01, 0x00, 0x04, 0x00, 0x60,
+	0x00, 0x68, 0x00, 0xf6, 0x00, 0xfd, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x24,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x2e, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0xd2, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x1a, 0x00, 0x14, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x01,
+	0x00, 0x01, 0x01, 0x35, 0x00, 0x01, 0x00, 0x01, 0x00, 0x3d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x00, 0x29, 0x00, 0x01, 0x00, 0x03, 0x01, 0x8e, 0x01, 0x8f,
+	0x01, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0xcc, 0x00, 0x1f,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x2c, 0x00, 0x02, 0x00, 0x0a,
+	0x00, 0x20, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0e, 0x01, 0xc3, 0x00, 0x03, 0x01, 0x2e, 0x01, 0x8f,
+	0x01, 0xc2, 0x00, 0x03, 0x01, 0x2e, 0x01, 0x91, 0x00, 0x01, 0x00, 0x04, 0x01, 0xc4, 0x00, 0x03,
+	0x01, 0x2e, 0x01, 0x91, 0x00, 0x01, 0x00, 0x02, 0x01, 0x8e, 0x01, 0x90, 0x00, 0x06, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x0a, 0x00, 0x24, 0x00, 0x03, 0x00, 0x01, 0x00, 0x80, 0x00, 0x01, 0x00, 0x12,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x92,
+	0x00, 0x03, 0x00, 0x01, 0x00, 0x66, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x01, 0x00, 0x02, 0x00, 0x4a, 0x00, 0xe0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0xff, 0xec, 0x00, 0x02, 0x00, 0x01, 0x01, 0xa1, 0x01, 0xaa,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0xff, 0xf6,
+	0x00, 0x02, 0x00, 0x01, 0x01, 0x97, 0x01, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x08, 0x00, 0x01, 0x00, 0x14, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
+	0x00, 0x01, 0x00, 0x06, 0x00, 0x14, 0x00, 0x02, 0x00, 0x01, 0x01, 0x8d, 0x01, 0x96, 0x00, 0x00,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x08,
+	0x00, 0x01, 0x00, 0x04, 0x00, 0x63, 0x00, 0x02, 0x00, 0x5d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x5d,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x08,
+	0x00, 0x02, 0x00, 0x06, 0x00, 0x0c, 0x00, 0xb6, 0x00, 0x02, 0x00, 0xc2, 0x00, 0xb8, 0x00, 0x02,
+	0x00, 0xd2, 0x00, 0x01, 0x00, 0x01, 0x00, 0xb4, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
+	0x00, 0x01, 0x00, 0x1e, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x01, 0x00, 0x04, 0x00, 0x41,
+	0x00, 0x02, 0x01, 0x35, 0x00, 0x01, 0x00, 0x04, 0x00, 0xd6, 0x00, 0x02, 0x01, 0x35, 0x00, 0x01,
+	0x00, 0x02, 0x00, 0x3d, 0x00, 0xd2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02,
+	0x00, 0x0e, 0x00, 0x04, 0x01, 0x47, 0x01, 0x48, 0x01, 0x47, 0x01, 0x48, 0x00, 0x01, 0x00, 0x04,
+	0x00, 0x03, 0x00, 0x4a, 0x00, 0x92, 0x00, 0xe0,
+};
@@ -0,0 +1,92 @@
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "governor.h"
+
+// Frames run close to the budget once their average passes the first
+// fraction of it, and have room to spare below the second
+#define DEGRADE_FRACTION 0.8
+#define RESTORE_FRACTION 0.4
+
+// Frames to wait after a change before the next one. Going back up waits
+// much longer, so a level that only just fits isn't flipped every second.
+#define DEGRADE_HOLD_FRAMES 10
+#define RESTORE_HOLD_FRAMES 180
+
+// Weight of the newest frame in the running average
+#define AVERAGE_WEIGHT 0.1
+
+#define DEFAULT_REFRESH_RATE 60
+
+struct GovernorCounters governorCounters;
+
+static SDL_atomic_t quality;
+
+// Until the game starts the governor, so tools that draw frames always get the same pictures
+static bool forced = true;
+
+static double budget = 1000.0 / DEFAULT_REFRESH_RATE;
+static double average = 0;
+static int framesSinceChange = 0;
+
+void initGovernor(int refreshRate) {
+	budget = 1000.0 / (refreshRate > 0 ? refreshRate : DEFAULT_REFRESH_RATE);
+	average = 0;
+	framesSinceChange = 0;
+	forced = false;
+}
+
+void governFrame(double milliseconds) {
+	int level = SDL_AtomicGet(&quality);
+
+	governorCounters.frames++;
+	governorCounters.framesAtLevel[level]++;
+	if (milliseconds > budget) {
+		governorCounters.overBudget++;
+	}
+
+	average += (milliseconds - average) * AVERAGE_WEIGHT;
+	framesSinceChange++;
+
+	if (forced) {
+		return;
+	}
+
+	if (average > budget * DEGRADE_FRACTION && framesSinceChange >= DEGRADE_HOLD_FRAMES && level < QUALITY_LEVELS - 1) {
+		SDL_AtomicSet(&quality, level + 1);
+		governorCounters.degrades++;
+		framesSinceChange = 0;
+	}
+	else if (average < budget * RESTORE_FRACTION && framesSinceChange >= RESTORE_HOLD_FRAMES && level > QUALITY_FULL) {
+		SDL_AtomicSet(&quality, level - 1);
+		governorCounters.restores++;
+		framesSinceChange = 0;
+	}
+}
+
+enum RenderQuality renderQuality() {
+	return SDL_AtomicGet(&quality);
+}
+
+void forceRenderQuality(int level) {
+	forced = level >= 0;
+	if (forced) {
+		SDL_AtomicSet(&quality, SDL_min(level, QUALITY_LEVELS - 1));
+	}
+	framesSinceChange = 0;
+}
+
+void reportGovernor() {
+	if (governorCounters.frames == 0) {
+		return;
+	}
+
+	printf("Governor: %llu frames, %llu over %.1fms, %llu degrades, %llu restores, frames at each level",
+		(unsigned long long)governorCounters.frames, (unsigned long long)governorCounters.overBudget, budget,
+		(unsigned long long)governorCounters.degrades, (unsigned long long)governorCounters.restores);
+	for (int i = 0; i < QUALITY_LEVELS; i++) {
+		printf(" %llu", (unsigned long long)governorCounters.framesAtLevel[i]);
+	}
+	printf(", panels drawn %llu reused %llu\n",
+		(unsigned long long)governorCounters.panelRedraws, (unsigned long long)governorCounters.panelReuses);
+}
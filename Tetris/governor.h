@@ -0,0 +1,53 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+
+// Trades drawing quality for frame time on machines that can't keep up. The
+// render thread reports what each frame cost to draw, and the governor steps
+// down a level when frames run close to the budget and back up once they have
+// had room to spare for a while. Levels are cumulative. The logic thread runs
+// every tick whatever the level, and the levels only change drawing.
+enum RenderQuality {
+	QUALITY_FULL,
+
+	// The side panels are drawn into a texture and copied from there, and only
+	// drawn again when what they show changes, at most every few frames
+	QUALITY_CACHED_PANELS,
+
+	// Empty cells are one fill for the whole board, without the grid lines
+	QUALITY_NO_GRID,
+
+	QUALITY_LEVELS,
+};
+
+struct GovernorCounters {
+	Uint64 frames;
+	Uint64 overBudget;
+
+	// Times the quality went down, and back up
+	Uint64 degrades;
+	Uint64 restores;
+
+	Uint64 framesAtLevel[QUALITY_LEVELS];
+
+	Uint64 panelRedraws;
+	Uint64 panelReuses;
+};
+
+// Written by the render thread
+extern struct GovernorCounters governorCounters;
+
+// Start adapting, with the budget for a frame set by the display's refresh
+// rate. Until then the quality stays full.
+void initGovernor(int refreshRate);
+
+// Report what the last frame took to draw, not counting the wait to present it
+void governFrame(double milliseconds);
+
+// The current level, from any thread
+enum RenderQuality renderQuality();
+
+// Hold the quality at one level, or pass -1 to let the governor choose again
+void forceRenderQuality(int level);
+
+void reportGovernor();
@@ -0,0 +1,187 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "hint.h"
+
+// Last, so requesting a hint from the logic thread is counted
+#include "alloccount.h"
+
+// Layout of a published hint: the low 16 bits of the spawn count, then the move
+#define HINT_VALID (1u << 31)
+#define HINT_SPAWN_MASK 0xffff
+#define HINT_HOLD_SHIFT 16
+#define HINT_ROTATION_SHIFT 17
+#define HINT_X_SHIFT 19
+#define HINT_Y_SHIFT 23
+
+// Pieces can hang off the left of the board and start above it
+#define HINT_X_OFFSET 3
+#define HINT_Y_OFFSET 4
+
+static struct {
+	SDL_Thread* thread;
+	SDL_sem* wake;
+	SDL_mutex* lock;
+	SDL_atomic_t stopping;
+
+	struct Weights weights;
+
+	// The latest request, under the lock. generation goes up with every
+	// request, and the worker drops whatever it's doing when it changes.
+	struct SimGame game;
+	Uint32 spawn;
+	Uint32 deadline;
+	SDL_atomic_t generation;
+
+	SDL_atomic_t result;
+} hints;
+
+static void publishHint(Uint32 spawn, const struct Move* move) {
+	Uint32 packed = HINT_VALID | (spawn & HINT_SPAWN_MASK) |
+		(Uint32)move->useHold << HINT_HOLD_SHIFT |
+		(Uint32)move->rotation << HINT_ROTATION_SHIFT |
+		(Uint32)(move->x + HINT_X_OFFSET) << HINT_X_SHIFT |
+		(Uint32)(move->y + HINT_Y_OFFSET) << HINT_Y_SHIFT;
+	SDL_AtomicSet(&hints.result, (int)packed);
+}
+
+bool readHint(Uint32 spawn, struct Move* move) {
+	Uint32 packed = (Uint32)SDL_AtomicGet(&hints.result);
+	if (!(packed & HINT_VALID) || (packed & HINT_SPAWN_MASK) != (spawn & HINT_SPAWN_MASK)) {
+		return false;
+	}
+
+	move->useHold = (packed >> HINT_HOLD_SHIFT) & 1;
+	move->rotation = (packed >> HINT_ROTATION_SHIFT) & 3;
+	move->x = (int)((packed >> HINT_X_SHIFT) & 0xf) - HINT_X_OFFSET;
+	move->y = (int)((packed >> HINT_Y_SHIFT) & 0x1f) - HINT_Y_OFFSET;
+	return true;
+}
+
+static bool cancelled(int generation, Uint32 deadline) {
+	return SDL_AtomicGet(&hints.generation) != generation || SDL_AtomicGet(&hints.stopping) ||
+		SDL_TICKS_PASSED(SDL_GetTicks(), deadline);
+}
+
+static void searchHint(const struct SimGame* game, Uint32 spawn, int generation, Uint32 deadline) {
+	struct BotMove best;
+	if (!findBestMove(game, &hints.weights, &best)) {
+		return;
+	}
+	publishHint(spawn, &best.move);
+
+	// Then the best pair of placements for this piece and the next. Lines score
+	// linearly, so the first piece's lines are added to the second's score.
+	struct Move moves[MAX_MOVES];
+	int count = listMoves(game, moves);
+
+	struct Move deepest = best.move;
+	float deepestScore = 0;
+	bool any = false;
+
+	for (int i = 0; i < count; i++) {
+		if (cancelled(generation, deadline)) {
+			return;
+		}
+
+		struct SimGame next = *game;
+		int cleared = simPlay(&next, &moves[i]);
+
+		struct BotMove reply;
+		if (next.over || !findBestMove(&next, &hints.weights, &reply)) {
+			continue;
+		}
+
+		float score = reply.score + hints.weights.lines * cleared;
+		if (!any || score > deepestScore) {
+			deepest = moves[i];
+			deepestScore = score;
+			any = true;
+		}
+	}
+
+	if (!cancelled(generation, deadline)) {
+		publishHint(spawn, &deepest);
+	}
+}
+
+static int hintThread(void* data) {
+	int handled = SDL_AtomicGet(&hints.generation);
+
+	while (true) {
+		SDL_SemWait(hints.wake);
+		if (SDL_AtomicGet(&hints.stopping)) {
+			break;
+		}
+
+		SDL_LockMutex(hints.lock);
+		struct SimGame game = hints.game;
+		Uint32 spawn = hints.spawn;
+		Uint32 deadline = hints.deadline;
+		int generation = SDL_AtomicGet(&hints.generation);
+		SDL_UnlockMutex(hints.lock);
+
+		// Several requests can come in while one search runs, and only the last matters
+		if (generation == handled) {
+			continue;
+		}
+		handled = generation;
+
+		searchHint(&game, spawn, generation, deadline);
+	}
+
+	return 0;
+}
+
+bool startHints(const struct Weights* weights) {
+	if (hints.thread != NULL) {
+		return true;
+	}
+
+	hints.weights = *weights;
+	hints.wake = SDL_CreateSemaphore(0);
+	hints.lock = SDL_CreateMutex();
+	SDL_AtomicSet(&hints.stopping, 0);
+	SDL_AtomicSet(&hints.result, 0);
+
+	hints.thread = hints.wake != NULL && hints.lock != NULL ? SDL_CreateThread(hintThread, "hints", NULL) : NULL;
+	if (hints.thread == NULL) {
+		printf("Failed to start the hint thread: %s\n", SDL_GetError());
+		stopHints();
+		return false;
+	}
+	return true;
+}
+
+void stopHints() {
+	if (hints.thread != NULL) {
+		SDL_AtomicSet(&hints.stopping, 1);
+		SDL_SemPost(hints.wake);
+		SDL_WaitThread(hints.thread, NULL);
+		hints.thread = NULL;
+	}
+
+	if (hints.wake != NULL) {
+		SDL_DestroySemaphore(hints.wake);
+		hints.wake = NULL;
+	}
+	if (hints.lock != NULL) {
+		SDL_DestroyMutex(hints.lock);
+		hints.lock = NULL;
+	}
+}
+
+void requestHint(const struct SimGame* game, Uint32 spawn, Uint32 deadline) {
+	if (hints.thread == NULL) {
+		return;
+	}
+
+	SDL_LockMutex(hints.lock);
+	hints.game = *game;
+	hints.spawn = spawn;
+	hints.deadline = SDL_GetTicks() + deadline;
+	SDL_AtomicAdd(&hints.generation, 1);
+	SDL_UnlockMutex(hints.lock);
+
+	SDL_SemPost(hints.wake);
+}
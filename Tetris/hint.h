@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+#include "bot.h"
+#include "engine.h"
+
+// Hints show the player where the bot would put the current piece. A worker
+// thread searches while the piece is being moved: it publishes the bot's
+// usual one piece search straight away, then looks a piece further ahead and
+// publishes again if it finishes before the deadline. A new request cancels
+// the search in progress, which checks between each placement it tries.
+//
+// Results are packed into one atomic word, so reading the latest never waits
+// on the worker.
+
+bool startHints(const struct Weights* weights);
+void stopHints();
+
+// Search for a piece, identified by its spawn count, giving up on looking
+// further ahead after deadline milliseconds
+void requestHint(const struct SimGame* game, Uint32 spawn, Uint32 deadline);
+
+// The latest hint for a piece, if the worker has one yet
+bool readHint(Uint32 spawn, struct Move* move);
@@ -0,0 +1,372 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL2/SDL.h>
+
+#include "tetris.h"
+#include "latency.h"
+
+// Give up on a press that hasn't shown after this long, and on the game
+// getting back to a state a press can be made in
+#define PROBE_TIMEOUT 1000
+#define STATE_TIMEOUT 5000
+
+// Time between one press being released and the next, so presses land at
+// every point in a tick and a frame. At least a couple of ticks, so the
+// release is seen before the next press.
+#define MIN_PROBE_GAP 10
+#define MAX_PROBE_GAP 40
+
+// Each second of unpause countdown is a second with nothing to measure, so
+// pausing is tried this many times less often than the other keys
+#define PAUSE_SAMPLE_DIVISOR 10
+
+#define LATENCY_SEED 1
+
+enum ProbeAction {
+	PROBE_LEFT,
+	PROBE_RIGHT,
+	PROBE_ROTATE,
+	PROBE_DROP,
+	PROBE_PAUSE,
+	PROBE_UNPAUSE,
+	PROBE_COUNT
+};
+
+static const struct {
+	const char* name;
+
+	// The state the key is pressed in
+	const char* state;
+	Uint32 button;
+} ACTIONS[PROBE_COUNT] = {
+	{ "left", "run", BUTTON_LEFT },
+	{ "right", "run", BUTTON_RIGHT },
+	{ "rotate", "run", BUTTON_ROTATE_RIGHT },
+	{ "drop", "run", BUTTON_DROP },
+	{ "pause", "run", BUTTON_PAUSE },
+	{ "unpause", "paused", BUTTON_PAUSE },
+};
+
+// Shared between the thread pushing keys and the render thread, under lock
+static struct {
+	SDL_mutex* lock;
+	SDL_sem* shown;
+
+	struct PresentedFrame last;
+	bool presented;
+
+	// Frames presented, and how many there had been when the last key was let go
+	int frames;
+	int releasedAt;
+
+	// The press waiting to show, if any, and what was on screen when it was made
+	bool waiting;
+	enum ProbeAction action;
+	struct PresentedFrame before;
+	Uint64 pushedAt;
+
+	// In milliseconds, or negative if something else changed the piece first
+	double latency;
+
+	SDL_atomic_t gameOver;
+} probes;
+
+struct LatencyRun {
+	int samples;
+	int pauseSamples;
+
+	double* latencies[PROBE_COUNT];
+	int counts[PROBE_COUNT];
+	int missed[PROBE_COUNT];
+};
+
+static bool showsPress(enum ProbeAction action, const struct PresentedFrame* before, const struct PresentedFrame* frame) {
+	switch (action) {
+	case PROBE_LEFT:
+	case PROBE_RIGHT:
+		return frame->spawn == before->spawn && frame->x != before->x;
+
+	case PROBE_ROTATE:
+		return frame->spawn == before->spawn && frame->rotation != before->rotation;
+
+	case PROBE_DROP:
+		// Either the next piece, or the line clear or game over on the way to it
+		return frame->spawn != before->spawn || frame->gameState != GAME_RUN;
+
+	case PROBE_PAUSE:
+		return frame->gameState == GAME_PAUSED;
+
+	case PROBE_UNPAUSE:
+		return frame->unpausing;
+
+	default:
+		return false;
+	}
+}
+
+// Whether the piece the press was meant for went away before the press showed
+static bool spoilsPress(enum ProbeAction action, const struct PresentedFrame* before, const struct PresentedFrame* frame) {
+	switch (action) {
+	case PROBE_LEFT:
+	case PROBE_RIGHT:
+	case PROBE_ROTATE:
+		return frame->spawn != before->spawn || frame->gameState != GAME_RUN;
+
+	default:
+		return false;
+	}
+}
+
+static void onPresent(const struct PresentedFrame* frame) {
+	SDL_LockMutex(probes.lock);
+	probes.last = *frame;
+	probes.presented = true;
+	probes.frames++;
+
+	if (probes.waiting) {
+		if (showsPress(probes.action, &probes.before, frame)) {
+			probes.latency = (frame->presentedAt - probes.pushedAt) * 1000.0 / SDL_GetPerformanceFrequency();
+			probes.waiting = false;
+			SDL_SemPost(probes.shown);
+		}
+		else if (spoilsPress(probes.action, &probes.before, frame)) {
+			probes.latency = -1;
+			probes.waiting = false;
+			SDL_SemPost(probes.shown);
+		}
+	}
+	SDL_UnlockMutex(probes.lock);
+
+	if (frame->gameState == GAME_OVER) {
+		SDL_AtomicSet(&probes.gameOver, 1);
+	}
+}
+
+static bool readyFor(enum ProbeAction action, const struct PresentedFrame* frame) {
+	if (action == PROBE_UNPAUSE) {
+		return frame->gameState == GAME_PAUSED && !frame->unpausing;
+	}
+	return frame->gameState == GAME_RUN && !frame->unpausing;
+}
+
+static void pushKey(Uint32 button, Uint32 type) {
+	SDL_Event e;
+	SDL_zero(e);
+	e.type = type;
+	e.key.type = type;
+	e.key.timestamp = SDL_GetTicks();
+	e.key.state = type == SDL_KEYDOWN ? SDL_PRESSED : SDL_RELEASED;
+	e.key.keysym.scancode = scancodeForButton(button);
+	SDL_PushEvent(&e);
+}
+
+// Press and release a key once it can be pressed, and record how long it took
+// to show. Presses spoilt by the piece locking first are made again.
+static void probe(struct LatencyRun* run, enum ProbeAction action) {
+	while (true) {
+		Uint32 deadline = SDL_GetTicks() + STATE_TIMEOUT;
+		bool ready = false;
+
+		while (!ready) {
+			if (SDL_TICKS_PASSED(SDL_GetTicks(), deadline)) {
+				run->missed[action]++;
+				return;
+			}
+
+			// Events are only read once a frame, so a release and the next press
+			// could otherwise land in the same frame and never be seen apart
+			SDL_LockMutex(probes.lock);
+			ready = probes.presented && probes.frames - probes.releasedAt >= 2 && readyFor(action, &probes.last);
+			if (ready) {
+				probes.waiting = true;
+				probes.action = action;
+				probes.before = probes.last;
+				probes.pushedAt = SDL_GetPerformanceCounter();
+				pushKey(ACTIONS[action].button, SDL_KEYDOWN);
+			}
+			SDL_UnlockMutex(probes.lock);
+
+			if (!ready) {
+				SDL_Delay(1);
+			}
+		}
+
+		bool timedOut = SDL_SemWaitTimeout(probes.shown, PROBE_TIMEOUT) == SDL_MUTEX_TIMEDOUT;
+
+		SDL_LockMutex(probes.lock);
+		pushKey(ACTIONS[action].button, SDL_KEYUP);
+		probes.releasedAt = probes.frames;
+		bool waiting = probes.waiting;
+		double latency = probes.latency;
+		probes.waiting = false;
+		SDL_UnlockMutex(probes.lock);
+
+		// Shown just as the wait ran out, so the semaphore was posted after all
+		if (timedOut && !waiting) {
+			SDL_SemWait(probes.shown);
+		}
+
+		if (waiting) {
+			run->missed[action]++;
+			return;
+		}
+		if (latency >= 0) {
+			run->latencies[action][run->counts[action]++] = latency;
+			return;
+		}
+	}
+}
+
+static int injectorThread(void* data) {
+	struct LatencyRun* run = data;
+	Uint32 rng = LATENCY_SEED;
+
+	int pauseEvery = SDL_max(run->samples / SDL_max(run->pauseSamples, 1), 1);
+
+	for (int i = 0; i < run->samples; i++) {
+		// Left and right alternate so the piece stays clear of the walls
+		for (int action = PROBE_LEFT; action <= PROBE_DROP; action++) {
+			probe(run, action);
+
+			rng = rng * 1664525 + 1013904223;
+			SDL_Delay(MIN_PROBE_GAP + (rng >> 16) % (MAX_PROBE_GAP - MIN_PROBE_GAP));
+		}
+
+		if (i % pauseEvery == 0 && run->counts[PROBE_PAUSE] + run->missed[PROBE_PAUSE] < run->pauseSamples) {
+			probe(run, PROBE_PAUSE);
+			SDL_Delay(MIN_PROBE_GAP);
+			probe(run, PROBE_UNPAUSE);
+			SDL_Delay(MIN_PROBE_GAP);
+		}
+	}
+
+	SDL_Event quit;
+	SDL_zero(quit);
+	quit.type = SDL_QUIT;
+	SDL_PushEvent(&quit);
+	return 0;
+}
+
+static int compareDoubles(const void* a, const void* b) {
+	double x = *(const double*)a;
+	double y = *(const double*)b;
+	return x < y ? -1 : x > y;
+}
+
+static double percentile(const double* sorted, int count, int percent) {
+	return sorted[SDL_min(count - 1, count * percent / 100)];
+}
+
+// Play until the injector has made every press, starting a new game whenever
+// one ends
+static void runLatency(struct LatencyRun* run) {
+	Uint32 seed = LATENCY_SEED;
+	resetGame(seed);
+	publishRenderState();
+
+	SDL_AtomicSet(&quitting, 0);
+	SDL_Thread* logic = SDL_CreateThread(logicThread, "logic", NULL);
+	SDL_Thread* injector = SDL_CreateThread(injectorThread, "injector", run);
+
+	while (mainLoop(0, NULL)) {
+		if (SDL_AtomicSet(&probes.gameOver, 0)) {
+			SDL_AtomicSet(&quitting, 1);
+			SDL_WaitThread(logic, NULL);
+			SDL_AtomicSet(&quitting, 0);
+
+			resetGame(++seed);
+			publishRenderState();
+			logic = SDL_CreateThread(logicThread, "logic", NULL);
+		}
+	}
+
+	SDL_AtomicSet(&quitting, 1);
+	SDL_WaitThread(logic, NULL);
+	SDL_WaitThread(injector, NULL);
+}
+
+int benchLatencyMain(int argc, char* argv[]) {
+	int samples = argc > 0 ? atoi(argv[0]) : 100;
+	double maxP99 = argc > 1 ? atof(argv[1]) : 0;
+	samples = SDL_max(samples, 1);
+
+	SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+	openWindow("Tetris latency");
+	if (renderer == NULL) {
+		printf("Failed to create a renderer: %s\n", SDL_GetError());
+		return 1;
+	}
+
+	historyEnabled = false;
+
+	probes.lock = SDL_CreateMutex();
+	probes.shown = SDL_CreateSemaphore(0);
+	presentHook = onPresent;
+
+	struct LatencyRun run;
+	run.samples = samples;
+	run.pauseSamples = SDL_max(samples / PAUSE_SAMPLE_DIVISOR, 1);
+	for (int i = 0; i < PROBE_COUNT; i++) {
+		run.latencies[i] = malloc(samples * sizeof(double));
+	}
+
+	bool failed = false;
+	bool headerPrinted = false;
+
+	for (int vsync = 0; vsync <= 1; vsync++) {
+		if (SDL_RenderSetVSync(renderer, vsync) != 0) {
+			printf("%-6s not supported by this renderer: %s\n", vsync ? "on" : "off", SDL_GetError());
+			continue;
+		}
+
+		memset(run.counts, 0, sizeof(run.counts));
+		memset(run.missed, 0, sizeof(run.missed));
+		probes.presented = false;
+		probes.waiting = false;
+		probes.frames = 0;
+		probes.releasedAt = 0;
+
+		runLatency(&run);
+
+		// After the first run, so the startup report doesn't land in the table
+		if (!headerPrinted) {
+			printf("%-6s %-7s %-8s %7s %6s %8s %8s %8s %8s\n", "vsync", "state", "key", "samples", "missed", "p50 ms", "p90 ms", "p99 ms", "max ms");
+			headerPrinted = true;
+		}
+
+		for (int i = 0; i < PROBE_COUNT; i++) {
+			int count = run.counts[i];
+			printf("%-6s %-7s %-8s %7d %6d", vsync ? "on" : "off", ACTIONS[i].state, ACTIONS[i].name, count, run.missed[i]);
+
+			if (count == 0) {
+				printf(" %8s %8s %8s %8s\n", "-", "-", "-", "-");
+				failed = failed || maxP99 > 0;
+				continue;
+			}
+
+			double* sorted = run.latencies[i];
+			qsort(sorted, count, sizeof(double), compareDoubles);
+			double p99 = percentile(sorted, count, 99);
+			printf(" %8.2f %8.2f %8.2f %8.2f\n", percentile(sorted, count, 50), percentile(sorted, count, 90), p99, sorted[count - 1]);
+
+			if (maxP99 > 0 && (p99 > maxP99 || run.missed[i] > 0)) {
+				failed = true;
+			}
+		}
+	}
+
+	presentHook = NULL;
+	for (int i = 0; i < PROBE_COUNT; i++) {
+		free(run.latencies[i]);
+	}
+	SDL_DestroySemaphore(probes.shown);
+	SDL_DestroyMutex(probes.lock);
+
+	if (failed) {
+		printf("Latency over %.2f ms, or presses not shown\n", maxP99);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+// Measures how long it takes for a key press to show on screen. Key events are
+// pushed into SDL's queue from a second thread, the same way the OS delivers
+// them, and timed until the first presented frame that reflects them: the
+// piece moving or rotating, the next piece spawning after a drop, or the pause
+// screen appearing and counting down. The whole path is covered, from the
+// event loop through the logic thread's ticks and the render state handoff to
+// drawing and presenting.
+//
+// Runs the real window and game loop, on SDL's dummy video driver unless
+// SDL_VIDEODRIVER says otherwise, once with vsync off and once with it on, and
+// reports latency percentiles for each key by the state it was pressed in.
+// With a limit, fails if any p99 is above it or presses go unseen, so it can
+// be used as a regression check.
+// Arguments: [samples] [max p99 ms]
+int benchLatencyMain(int argc, char* argv[]);
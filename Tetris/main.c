@@ -3,17 +3,61 @@
 #include <string.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #define SDL_MAIN_HANDLED
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 
+#include "font_data.h"
+#include "tetris.h"
+#include "engine.h"
+#include "replay.h"
+#include "corpus.h"
+#include "selfplay.h"
+#include "video.h"
+#include "versus.h"
+#include "broadcast.h"
+#include "pcsolver.h"
+#include "batch.h"
+#include "renderbench.h"
+#include "events.h"
+#include "botlink.h"
+#include "finesse.h"
+#include "bot.h"
+#include "tuner.h"
+#include "book.h"
+#include "governor.h"
+#include "hint.h"
+#include "latency.h"
+#include "pieces.h"
+
+// After SDL, so the draw code is counted
+#include "drawcount.h"
+
+// After the C library, so allocations here are counted
+#include "alloccount.h"
+
 SDL_Window* window;
 SDL_Renderer* renderer;
 
 TTF_Font* font_big;
 TTF_Font* font_small;
 void loadFont();
+void loadDeferredFont();
+
+// Startup instrumentation, reported once the first frame has been presented
+#define MAX_STARTUP_STAGES 8
+
+struct {
+	const char* name;
+	Uint64 counter;
+} startupStages[MAX_STARTUP_STAGES];
+int startupStageCount = 0;
+bool firstFramePresented = false;
+
+void markStartup(const char* name);
+void reportStartup();
 
 enum TextAlignment {
 	TEXT_ALIGN_LEFT = 0,
@@ -35,31 +79,11 @@ struct DrawStringInfo {
 
 void drawString(struct DrawStringInfo* dsi, const char* msg);
 void drawStringf(struct DrawStringInfo* dsi, const char* fmt, ...);
-
-#define BLOCKS_X 10
-#define BLOCKS_Y 20
-
-#define BLOCK_SIZE 40
-
-#define BOARD_WIDTH (BLOCKS_X * BLOCK_SIZE)
-#define BOARD_HEIGHT (BLOCKS_Y * BLOCK_SIZE)
-
-#define WINDOW_WIDTH (BOARD_WIDTH * 2)
-#define WINDOW_HEIGHT BOARD_HEIGHT
+void drawNumber(struct DrawStringInfo* dsi, int value);
 
 #define BOARD_LEFT ((WINDOW_WIDTH - BOARD_WIDTH) / 2)
 #define BOARD_RIGHT (BOARD_LEFT + BOARD_WIDTH)
 
-struct BlockRotation {
-	bool vals[4][4];
-};
-
-struct BlockDef {
-	SDL_Color colour;
-	struct BlockRotation rotations[4];
-};
-
-#define NUM_BLOCKS 7
 
 const struct BlockDef BLOCKS[NUM_BLOCKS] = {
 	// O piece
@@ -274,56 +298,136 @@ const struct BlockDef BLOCKS[NUM_BLOCKS] = {
 	},
 };
 
-enum PieceType {
-	O_PIECE = 0,
-	I_PIECE = 1,
-	T_PIECE = 2,
-	L_PIECE = 3,
-	J_PIECE = 4,
-	S_PIECE = 5,
-	Z_PIECE = 6,
-};
+struct CurrentBlock currentBlock;
 
-struct CurrentBlock {
-	int x;
-	int y;
+struct Board board = { 0 };
 
-	enum PieceType type;
+// Colours for each piece, in the order of the piece types
+const struct {
+	const char* name;
+	SDL_Color colours[NUM_BLOCKS];
+} THEMES[] = {
+	// Filled in from BLOCKS
+	{ "default", { { 0 } } },
 
-	int rotation;
+	// Okabe and Ito's palette, which stays distinct with any kind of colour blindness
+	{
+		"colour-blind",
+		{
+			{ 0xf0, 0xe4, 0x42, 0xff },
+			{ 0x56, 0xb4, 0xe9, 0xff },
+			{ 0xcc, 0x79, 0xa7, 0xff },
+			{ 0xe6, 0x9f, 0x00, 0xff },
+			{ 0x00, 0x72, 0xb2, 0xff },
+			{ 0x00, 0x9e, 0x73, 0xff },
+			{ 0xd5, 0x5e, 0x00, 0xff },
+		},
+	},
+};
 
-	// How much to move on this frame.
-	int dx;
-	int dy;
+SDL_Color palette[PALETTE_SIZE] = { { 0x2b, 0x2b, 0x2b, 0xff } };
+int theme = -1;
 
-	// How much to rotate on this frame.
-	int dr;
-} currentBlock;
+void nextTheme() {
+	theme = (theme + 1) % SDL_arraysize(THEMES);
+	applyTheme();
+}
 
-struct Cell {
-	bool solid;
-	SDL_Color colour;
-};
+// Themes only cover the standard pieces. Other sets keep their own colours.
+void applyTheme() {
+	for (int i = 0; i < pieceSet.count; i++) {
+		palette[PIECE_CELL(i)] = theme == 0 || !pieceSet.standard ? pieceSet.pieces[i].colour : THEMES[theme].colours[i];
+	}
+}
 
-struct {
-	struct Cell cells[BLOCKS_X][BLOCKS_Y];
-} board = { 0 };
+// The palette index of a cell, with everything above the board empty
+int cellAt(int x, int y) {
+	return y < 0 ? CELL_EMPTY : ROW_CELL(board.rows[y], x);
+}
+
+// Bit x set for each solid cell in a packed row
+Uint16 solidCells(Uint64 row) {
+	Uint16 solid = 0;
+	for (int x = 0; x < BLOCKS_X; x++) {
+		solid |= (ROW_CELL(row, x) != CELL_EMPTY) << x;
+	}
+	return solid;
+}
 
 int lines = 0;
 int level = 1;
 
-// Time left until block moves down
-int blockTimer = 1000;
+// Gravity is measured in rows per tick, in fixed point with GRAVITY_ONE being
+// one row. Anything from MAX_GRAVITY up drops the piece to the floor the tick
+// it spawns (20G).
+#define GRAVITY_ONE 65536
+#define MAX_GRAVITY (BLOCKS_Y * GRAVITY_ONE)
+
+// Gravity for each level, starting at level 1. Each level is 1.5 times faster
+// than the one before until it reaches MAX_GRAVITY, which is used for every
+// level after the end of the table.
+const Sint32 GRAVITY_TABLE[] = {
+	262, 393, 590, 885, 1327, 1991, 2986, 4479,
+	6718, 10078, 15117, 22675, 34012, 51018, 76528, 114791,
+	172187, 258280, 387420, 581131, 871696, 1307544, MAX_GRAVITY,
+};
+
+// Fraction of a row the current piece has fallen since it last moved down
+Sint32 gravityProgress = 0;
+
+// Ticks a piece can rest on something before it locks. Moving or rotating a
+// resting piece starts the delay again, but only MAX_LOCK_RESETS times until it
+// falls to a row lower than it has reached before.
+#define LOCK_DELAY_TICKS (1000 / TICK_LENGTH)
+#define MAX_LOCK_RESETS 15
+
+int lockTimer = LOCK_DELAY_TICKS;
+int lockResets = 0;
+int lowestY = 0;
+
+Sint32 gravityForLevel(int level);
+void resetLockDelay();
+void applyGravity();
+
+// Everything needed to draw a frame, published by the logic thread once it has
+// run the ticks that are due. The render thread only ever reads these.
+struct RenderState {
+	Uint64 rows[BLOCKS_Y];
+
+	int x;
+	int y;
+	enum PieceType type;
+	int rotation;
+
+	// Where the current piece would land if dropped
+	int ghostY;
+
+	// Which piece this is, for matching it up with its hint
+	Uint32 spawn;
+	bool hints;
+
+	enum PieceType pieceQueue[QUEUE_LENGTH];
+	bool pieceHeld;
+	enum PieceType heldPieceType;
+
+	int lines;
+	int level;
+	int finesseFaults;
 
-// Time between each time the block moves down
-int blockTimerLength = 1000;
+	enum GameState gameState;
+	bool unpausing;
+	int unpauseCounter;
 
-// Time left until block is permanently placed
-int placementTimer = 1000;
-const int placementTimerLength = 1000;
+	int lineCount;
+	int linesToClear[MAX_PIECE_SIZE];
+	int clearTimer;
+
+	int historyPos;
+	int historyCount;
+};
 
 void GAME_PAUSED_update();
-void GAME_PAUSED_draw();
+void GAME_PAUSED_draw(const struct RenderState* rs);
 
 void GAME_RUN_update();
 void selectPiece();
@@ -331,70 +435,184 @@ void enqueuePiece();
 void placeCurrent();
 void dropCurrent();
 bool tryMove();
+bool pieceFits(enum PieceType type, int rotation, int x, int y);
+Uint32 placePiece(enum PieceType type, int rotation, int x, int y);
 void removeLine(int y);
 
-void GAME_RUN_draw();
-void drawBoard();
-void drawCurrent();
-void drawPieceQueue();
-void drawHeldPiece();
-void drawScore();
+void GAME_RUN_draw(const struct RenderState* rs);
+void drawBoard(const struct RenderState* rs);
+void drawCurrent(const struct RenderState* rs);
+void drawPieceQueue(const struct RenderState* rs);
+void drawHeldPiece(const struct RenderState* rs);
+void drawScore(const struct RenderState* rs);
+void drawPanels(const struct RenderState* rs);
 
 void GAME_OVER_update();
+void GAME_OVER_draw(const struct RenderState* rs);
 
 void GAME_LINE_CLEAR_update();
+void GAME_LINE_CLEAR_draw(const struct RenderState* rs);
+
+void drawFrame(const struct RenderState* rs);
 
-#define QUEUE_LENGTH 4
 enum PieceType pieceQueue[QUEUE_LENGTH];
 
+// The bag randomiser: each bag deals one of every piece in the set, so seven
+// with the standard pieces. Pieces are drawn from a seeded generator rather
+// than rand() so the sequence can be saved and restored with the rest of the
+// game.
+Uint32 rngState = 1;
+bool bagUsed[MAX_PIECE_TYPES] = { 0 };
+bool pieceQueueInitialised = false;
+
+void seedRandom(Uint32 seed);
+Uint32 nextRandom();
+
+// Time each repeating key last took effect
+int lastLeft = 0;
+int lastRight = 0;
+int lastDown = 0;
+int lastRotR = 0;
+int lastRotL = 0;
+
+// Rewind history. A checkpoint is taken each time a piece spawns. Only the rows
+// changed since the previous checkpoint are stored, as XOR deltas of the packed
+// rows, so the same record steps the board both backwards and forwards. Every
+// HISTORY_KEYFRAME_INTERVAL checkpoints the full board is stored as well.
+#define HISTORY_CHECKPOINTS 4096
+#define HISTORY_BYTES (128 * 1024)
+#define HISTORY_KEYFRAME_INTERVAL 64
+
+// Board rows only use their low BLOCKS_X * CELL_BITS bits, so only those are stored
+#define HISTORY_ROW_BYTES ((BLOCKS_X * CELL_BITS + 7) / 8)
+
+// Row index, row XOR
+#define HISTORY_DELTA_SIZE (1 + HISTORY_ROW_BYTES)
+// Every row
+#define HISTORY_KEYFRAME_SIZE (BLOCKS_Y * HISTORY_ROW_BYTES)
+
+struct Checkpoint {
+	// Where this checkpoint's rows are stored in historyData
+	Uint32 offset;
+	Uint16 deltaRows;
+	bool keyframe;
+
+	Uint32 rngState;
+	Sint32 lines;
+	Sint32 level;
+
+	Uint8 pieceQueue[QUEUE_LENGTH];
+	Uint8 type;
+	Uint8 heldPieceType;
+	Uint16 bagUsed;
+	bool pieceHeld;
+};
+
+// Rows which placeCurrent or removeLine have changed since the last checkpoint
+Uint32 dirtyRows = 0;
+
+bool historyEnabled = true;
+
+Uint32 changedRows = 0;
+
+// history is a ring: historyFirst is the oldest checkpoint kept, historyPos is
+// the one the game is currently at, counted from the oldest.
+int historyFirst = 0;
+int historyCount = 0;
+int historyPos = -1;
+Uint32 historyWrite = 0;
+
+void resetHistory();
+void recordCheckpoint();
+bool rewindPiece();
+bool replayPiece();
+
+// If the logic falls further behind than this it skips ahead instead of catching up
+#define MAX_CATCHUP_TICKS 25
+
 int time = 0;
 int lastTime = 0;
 int dt = 0;
 
-enum {
-	GAME_PAUSED,
-	GAME_RUN,
-	GAME_LINE_CLEAR,
-	GAME_OVER
-} gameState = GAME_RUN;
+enum GameState gameState = GAME_RUN;
+
+const struct {
+	enum Button button;
+	SDL_Scancode scancode;
+} KEY_BINDINGS[] = {
+	{ BUTTON_LEFT, SDL_SCANCODE_LEFT },
+	{ BUTTON_RIGHT, SDL_SCANCODE_RIGHT },
+	{ BUTTON_DOWN, SDL_SCANCODE_DOWN },
+	{ BUTTON_ROTATE_RIGHT, SDL_SCANCODE_R },
+	{ BUTTON_ROTATE_LEFT, SDL_SCANCODE_E },
+	{ BUTTON_DROP, SDL_SCANCODE_SPACE },
+	{ BUTTON_HOLD, SDL_SCANCODE_C },
+	{ BUTTON_PAUSE, SDL_SCANCODE_ESCAPE },
+	{ BUTTON_REWIND, SDL_SCANCODE_BACKSPACE },
+	{ BUTTON_SAVE, SDL_SCANCODE_F5 },
+	{ BUTTON_LOAD, SDL_SCANCODE_F9 },
+};
+
+// Buttons held during this tick and the previous one
+Uint32 buttons = 0;
+Uint32 lastButtons = 0;
 
-int keysLen;
-Uint8* keys = NULL;
-Uint8* lastKeys = NULL;
+// Buttons held, written by the render thread as key events arrive and read by
+// the logic thread. Presses are kept separately until a tick has seen them, so
+// a key let go within the same tick still counts.
+SDL_atomic_t inputButtons;
+SDL_atomic_t pressedButtons;
 
-bool keyPressed(int scancode) {
-	return keys[scancode] && !lastKeys[scancode];
+bool buttonPressed(Uint32 button) {
+	return (buttons & button) && !(lastButtons & button);
 }
 
-bool mainLoop(double _emTime, void* _emUserData) {
-	SDL_Event e;
-	while (SDL_PollEvent(&e)) {
-		switch (e.type) {
-		case SDL_QUIT:
-			return false;
+Uint32 buttonForScancode(SDL_Scancode scancode) {
+	for (int i = 0; i < SDL_arraysize(KEY_BINDINGS); i++) {
+		if (KEY_BINDINGS[i].scancode == scancode) {
+			return KEY_BINDINGS[i].button;
+		}
+	}
+	return 0;
+}
 
-		default:
-			break;
+SDL_Scancode scancodeForButton(Uint32 button) {
+	for (int i = 0; i < SDL_arraysize(KEY_BINDINGS); i++) {
+		if (KEY_BINDINGS[i].button == button) {
+			return KEY_BINDINGS[i].scancode;
 		}
 	}
+	return SDL_SCANCODE_UNKNOWN;
+}
 
-	if (lastKeys == NULL) {
-		Uint8* keys1 = SDL_GetKeyboardState(&keysLen);
-		keys = malloc(keysLen);
-		lastKeys = malloc(keysLen);
-		memset(keys, 0, keysLen);
-		memset(lastKeys, 0, keysLen);
+// Follow the keys from their events, rather than the keyboard state, so events
+// pushed by the latency harness count the same as real ones
+void handleKeyEvent(const SDL_KeyboardEvent* key) {
+	Uint32 button = buttonForScancode(key->keysym.scancode);
+	if (button == 0 || key->repeat) {
+		return;
 	}
-	else {
-		memcpy(lastKeys, keys, keysLen);
 
-		Uint8* keys1 = SDL_GetKeyboardState(NULL);
-		memcpy(keys, keys1, keysLen);
+	if (key->type == SDL_KEYDOWN) {
+		SDL_AtomicSet(&inputButtons, SDL_AtomicGet(&inputButtons) | button);
+
+		int pressed;
+		do {
+			pressed = SDL_AtomicGet(&pressedButtons);
+		} while (!SDL_AtomicCAS(&pressedButtons, pressed, pressed | button));
+	}
+	else {
+		SDL_AtomicSet(&inputButtons, SDL_AtomicGet(&inputButtons) & ~button);
 	}
+}
+
+void stepGame(Uint32 input) {
+	lastButtons = buttons;
+	buttons = input;
 
 	lastTime = time;
-	time = SDL_GetTicks();
-	dt = time - lastTime;
+	time += TICK_LENGTH;
+	dt = TICK_LENGTH;
 
 	switch (gameState) {
 	case GAME_PAUSED:
@@ -413,6 +631,308 @@ bool mainLoop(double _emTime, void* _emUserData) {
 		printf("Invalid game state\n");
 		exit(-1);
 	}
+}
+
+// Lock-free triple buffer of render states. The logic thread fills the back
+// slot and swaps it with the middle one; the render thread swaps the middle
+// slot with its front one whenever a newer state has been published.
+#define TRIPLE_BUFFER_DIRTY 4
+
+struct RenderState renderStates[3];
+SDL_atomic_t renderMiddle = { 1 };
+int renderBack = 0;
+int renderFront = 2;
+
+void publishRenderState();
+
+const struct RenderState* acquireRenderState() {
+	if (SDL_AtomicGet(&renderMiddle) & TRIPLE_BUFFER_DIRTY) {
+		renderFront = SDL_AtomicSet(&renderMiddle, renderFront) & 3;
+	}
+	return &renderStates[renderFront];
+}
+
+// Goes up every time a new piece comes into play, from the queue or the hold
+Uint32 spawnCount = 0;
+
+// The bot playing in place of the keyboard, toggled with B. It presses
+// buttons like a player would, one at a time with a release in between, so
+// its games are recorded and replayed like any other.
+SDL_atomic_t autoplayEnabled;
+struct Weights autoplayWeights;
+
+// Tuned weights from --tune, if there are any
+#define WEIGHTS_PATH "weights.txt"
+
+// Moves for the start of a game from --build-book, if there is one
+#define BOOK_PATH "book.bin"
+struct OpeningBook openingBook;
+
+// Presses before the bot gives up on reaching its target and drops where it is
+#define MAX_AUTOPLAY_PRESSES 20
+
+struct {
+	bool planned;
+	Uint32 spawn;
+
+	bool hold;
+	int rotation;
+	int x;
+
+	int presses;
+	Uint32 lastPress;
+} autoplay;
+
+// The game as the bot sees it, from where the current piece spawned
+void currentSimGame(struct SimGame* game) {
+	memset(game, 0, sizeof(*game));
+	readBoardRows(&game->board, 0, BLOCKS_Y - 1);
+	game->current = currentBlock.type;
+	memcpy(game->queue, pieceQueue, sizeof(game->queue));
+	game->held = pieceHeld ? heldPieceType : NO_PIECE;
+	game->canHold = canHold;
+
+	// The bag carries on as the game's will, for moves that draw past the queue
+	game->bag.rngState = rngState;
+	for (int i = 0; i < NUM_BLOCKS; i++) {
+		game->bag.used |= bagUsed[i] << i;
+	}
+}
+
+void planAutoplay() {
+	struct SimGame game;
+	currentSimGame(&game);
+
+	struct BotMove best;
+	const struct BookEntry* entry = openingBook.data != NULL ? lookupBook(&openingBook, &game) : NULL;
+	bool found = true;
+	if (entry != NULL) {
+		best.move = (struct Move){ entry->useHold, entry->rotation, entry->x, entry->y };
+	}
+	else {
+		found = findBestMove(&game, &autoplayWeights, &best);
+	}
+
+	autoplay.planned = true;
+	autoplay.spawn = spawnCount;
+	autoplay.hold = found && best.move.useHold;
+	autoplay.rotation = found ? best.move.rotation : currentBlock.rotation;
+	autoplay.x = found ? best.move.x : currentBlock.x;
+	autoplay.presses = 0;
+}
+
+Uint32 autoplayInput() {
+	// The bot only knows the standard pieces
+	if (!SDL_AtomicGet(&autoplayEnabled) || gameState != GAME_RUN || !pieceSet.standard) {
+		autoplay.planned = false;
+		return 0;
+	}
+
+	if (autoplay.lastPress != 0) {
+		autoplay.lastPress = 0;
+		return 0;
+	}
+
+	if (!autoplay.planned || autoplay.spawn != spawnCount) {
+		planAutoplay();
+	}
+
+	// Rotate first, then shift from wherever the kicks left the piece
+	Uint32 press = BUTTON_DROP;
+	if (autoplay.hold) {
+		press = BUTTON_HOLD;
+		autoplay.planned = false;
+	}
+	else if (autoplay.presses < MAX_AUTOPLAY_PRESSES) {
+		int turns = (autoplay.rotation - currentBlock.rotation + 4) % 4;
+		if (turns != 0) {
+			press = turns == 3 ? BUTTON_ROTATE_LEFT : BUTTON_ROTATE_RIGHT;
+		}
+		else if (currentBlock.x != autoplay.x) {
+			press = currentBlock.x < autoplay.x ? BUTTON_RIGHT : BUTTON_LEFT;
+		}
+	}
+
+	autoplay.presses++;
+	autoplay.lastPress = press;
+	return press;
+}
+
+Uint64 nextTick = 0;
+
+// The game being played, recorded so it can be saved as a replay on exit.
+// Loading a quicksave breaks the chain of inputs, so the replay is dropped, as
+// it is if there's no memory to record it.
+struct Replay liveReplay;
+bool liveReplayValid = true;
+
+// Room reserved for the live replay up front, so recording doesn't allocate
+// on the logic thread during play: half an hour of ticks, under a megabyte.
+// Longer games grow it as they go.
+#define LIVE_REPLAY_RESERVE_TICKS (30 * 60 * 1000 / TICK_LENGTH)
+
+void beginLiveReplay(Uint32 seed) {
+	beginReplay(&liveReplay, seed);
+	reserveReplay(&liveReplay, LIVE_REPLAY_RESERVE_TICKS);
+}
+
+// Hints from the bot for where to put each piece, toggled with H
+SDL_atomic_t hintsEnabled;
+
+// The piece the last hint was asked for
+Uint32 hintSpawn = 0;
+
+// Longest the hint thread looks ahead for, even when the piece falls slowly
+#define MAX_HINT_SEARCH_MS 250
+
+// The hint has until the piece could lock on its own: the time it takes to
+// fall to where it would land, then the lock delay
+Uint32 hintDeadline() {
+	int rows = 0;
+	while (pieceFits(currentBlock.type, currentBlock.rotation, currentBlock.x, currentBlock.y + rows + 1)) {
+		rows++;
+	}
+
+	Sint64 ticks = (Sint64)rows * GRAVITY_ONE / gravityForLevel(level) + LOCK_DELAY_TICKS;
+	return (Uint32)SDL_min(ticks * TICK_LENGTH, MAX_HINT_SEARCH_MS);
+}
+
+// Ask for a hint whenever a new piece comes into play, which cancels the search for the last one
+void refreshHint() {
+	if (!SDL_AtomicGet(&hintsEnabled) || hintSpawn == spawnCount || gameState == GAME_OVER || !pieceSet.standard) {
+		return;
+	}
+
+	struct SimGame game;
+	currentSimGame(&game);
+	requestHint(&game, spawnCount, hintDeadline());
+	hintSpawn = spawnCount;
+}
+
+#define QUICKSAVE_PATH "quicksave.bin"
+
+// Quicksave keys held during the last tick
+Uint32 lastQuickButtons = 0;
+
+// Save or load the quicksave when its key is pressed. This is done between
+// ticks rather than in stepGame, since it touches a file: a replay that
+// quicksaved would otherwise write it again, and one that quickloaded would
+// play on from whatever file is there now.
+void quicksaveTick(Uint32 quickButtons) {
+	Uint32 pressed = quickButtons & ~lastQuickButtons;
+	lastQuickButtons = quickButtons;
+
+	if (gameState != GAME_RUN) {
+		return;
+	}
+
+	if (pressed & BUTTON_SAVE) {
+		writeSnapshotFile(QUICKSAVE_PATH);
+	}
+	if ((pressed & BUTTON_LOAD) && readSnapshotFile(QUICKSAVE_PATH)) {
+		// Neither the history nor the replay lead up to the loaded board any more
+		liveReplayValid = false;
+		resetHistory();
+		recordCheckpoint();
+	}
+}
+
+// Run however many ticks have come due since the last call, then hand the
+// result to the renderer. Returns how long until the next tick in milliseconds.
+int runDueTicks() {
+	Uint64 tickCounts = SDL_GetPerformanceFrequency() * TICK_LENGTH / 1000;
+	Uint64 now = SDL_GetPerformanceCounter();
+
+	if (nextTick == 0) {
+		nextTick = now;
+	}
+
+	int ticks = 0;
+	while (now >= nextTick && ticks < MAX_CATCHUP_TICKS) {
+		Uint32 keys = SDL_AtomicGet(&inputButtons) | SDL_AtomicSet(&pressedButtons, 0);
+		quicksaveTick(keys & QUICKSAVE_BUTTONS);
+
+		Uint32 input = (keys | botLinkInput() | autoplayInput()) & ~QUICKSAVE_BUTTONS;
+		if (liveReplayValid && !recordReplayTick(&liveReplay, input)) {
+			liveReplayValid = false;
+		}
+		stepGame(input);
+		broadcastTick();
+		botLinkTick();
+		nextTick += tickCounts;
+		ticks++;
+	}
+
+	if (now >= nextTick) {
+		nextTick = now + tickCounts;
+	}
+
+	if (ticks > 0) {
+		publishRenderState();
+	}
+
+	return (int)((nextTick - now) * 1000 / SDL_GetPerformanceFrequency());
+}
+
+SDL_atomic_t quitting;
+
+int logicThread(void* data) {
+	SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+	while (!SDL_AtomicGet(&quitting)) {
+		int wait = runDueTicks();
+		if (wait > 0) {
+			SDL_Delay(wait);
+		}
+	}
+
+	return 0;
+}
+
+bool mainLoop(double _emTime, void* _emUserData) {
+	SDL_Event e;
+	while (SDL_PollEvent(&e)) {
+		switch (e.type) {
+		case SDL_QUIT:
+			return false;
+
+		case SDL_KEYDOWN:
+			if (e.key.keysym.scancode == SDL_SCANCODE_B && !e.key.repeat) {
+				SDL_AtomicSet(&autoplayEnabled, !SDL_AtomicGet(&autoplayEnabled));
+			}
+			if (e.key.keysym.scancode == SDL_SCANCODE_H && !e.key.repeat) {
+				SDL_AtomicSet(&hintsEnabled, !SDL_AtomicGet(&hintsEnabled));
+			}
+			if (e.key.keysym.scancode == SDL_SCANCODE_T && !e.key.repeat) {
+				nextTheme();
+			}
+			handleKeyEvent(&e.key);
+			break;
+
+		case SDL_KEYUP:
+			handleKeyEvent(&e.key);
+			break;
+
+		default:
+			break;
+		}
+	}
+
+#ifdef __EMSCRIPTEN__
+	// No threads on the web, so the logic runs just before each frame instead
+	runDueTicks();
+#endif
+
+	drawFrame(acquireRenderState());
+
+	if (!firstFramePresented) {
+		firstFramePresented = true;
+		markStartup("first frame");
+		reportStartup();
+
+		// The big font is only needed once the game is paused or over
+		loadDeferredFont();
+	}
 
 	return true;
 }
@@ -422,41 +942,160 @@ bool mainLoop(double _emTime, void* _emUserData) {
 #include <emscripten/html5.h>
 #endif
 
-int main() {
-	SDL_Init(SDL_INIT_EVERYTHING);
+#define REPLAY_PATH "replays.bin"
+
+// Play with SRS kicks instead of the legacy ones
+int runSrsGame(int argc, char* argv[]) {
+	rotationSystem = ROTATION_SRS;
+	return runGame();
+}
+
+// Play with a piece set loaded from a file. There's no bot, hints or finesse
+// count, which only know the standard pieces, and no replay, since replays
+// don't record which pieces they were played with.
+int runPieceSetGame(int argc, char* argv[]) {
+	if (argc < 1) {
+		printf("Usage: --pieces <piece set file>\n");
+		return 1;
+	}
+
+	if (!loadPieceSet(argv[0], &pieceSet)) {
+		return 1;
+	}
+	applyTheme();
+
+	liveReplayValid = false;
+	return runGame();
+}
+
+// Headless tools and game variants, run instead of the game when named on the command line
+const struct {
+	const char* name;
+	const char* usage;
+	int (*run)(int argc, char* argv[]);
+} TOOLS[] = {
+	{ "--build-corpus", "<corpus> <replay files>...", buildCorpusMain },
+	{ "--query-corpus", "<corpus> [threads]", queryCorpusMain },
+	{ "--selfplay", "<output prefix> <samples> [threads] [seed]", selfPlayMain },
+	{ "--render-video", "<replay file> <output.y4m> [replay index] [fps] [threads]", renderVideoMain },
+	{ "--versus-test", "[latency ms] [jitter ms] [seconds]", versusTestMain },
+	{ "--broadcast", "<channel>", broadcastMain },
+	{ "--spectate", "<channel>", spectateMain },
+	{ "--solve-pc", "<quicksave file or pieces> [max lines] [threads] [held piece]", solvePcMain },
+	{ "--pc-table", "<table> [first sequence] [count] [threads]", buildPcTableMain },
+	{ "--pc-lookup", "<table> <pieces>", lookupPcMain },
+	{ "--bench-batch", "[games] [seed]", benchBatchMain },
+	{ "--bench-render", "[frames] [baseline file] [write]", benchRenderMain },
+	{ "--check-alloc", "[frames]", checkAllocMain },
+	{ "--bench-latency", "[samples] [max p99 ms]", benchLatencyMain },
+	{ "--srs", "", runSrsGame },
+	{ "--pieces", "<piece set file>", runPieceSetGame },
+	{ "--events", "<file> [json|binary]", eventStreamMain },
+	{ "--bot-link", "<channel>", botLinkMain },
+	{ "--bot-client", "<channel>", botClientMain },
+	{ "--finesse-table", "[pieces] [srs]", finesseTableMain },
+	{ "--check-srs", "", checkSrsMain },
+	{ "--tune", "<weights file> [generations] [population] [games] [threads] [seed]", tuneMain },
+	{ "--build-book", "<book> [pieces] [depth] [threads] [weights file]", buildBookMain },
+};
+
+int runTool(int argc, char* argv[]) {
+	for (int i = 0; i < SDL_arraysize(TOOLS); i++) {
+		if (strcmp(argv[1], TOOLS[i].name) == 0) {
+			return TOOLS[i].run(argc - 2, argv + 2);
+		}
+	}
+
+	printf("Usage:\n");
+	for (int i = 0; i < SDL_arraysize(TOOLS); i++) {
+		printf("  %s %s %s\n", argv[0], TOOLS[i].name, TOOLS[i].usage);
+	}
+	return 1;
+}
+
+int main(int argc, char* argv[]) {
+	initEngine();
+	initFinesse();
+	initPieceSet();
+	nextTheme();
+
+	if (argc > 1) {
+		return runTool(argc, argv);
+	}
+
+	return runGame();
+}
+
+void openWindow(const char* title) {
+	// Audio, joysticks and the like are never used, so don't pay to bring them up
+	SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS);
 	TTF_Init();
+	markStartup("init");
 
 	window = SDL_CreateWindow(
-		"Tetris",
+		title,
 		SDL_WINDOWPOS_UNDEFINED,
 		SDL_WINDOWPOS_UNDEFINED,
 		WINDOW_WIDTH,
 		WINDOW_HEIGHT,
 		0);
+	markStartup("window");
 
 	renderer = SDL_CreateRenderer(
 		window,
 		-1,
 		SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+	if (renderer == NULL) {
+		// No GPU, or the dummy video driver, so take whatever there is
+		renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_PRESENTVSYNC);
+	}
 	SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+	markStartup("renderer");
 
 	loadFont();
+	markStartup("font");
+}
+
+int runGame() {
+	markStartup("start");
+	openWindow("Tetris");
 
 	//printf("%d\n", SDL_GetTicks());
-	srand(SDL_GetTicks());
+	autoplayWeights = DEFAULT_WEIGHTS;
+	loadWeights(WEIGHTS_PATH, &autoplayWeights);
+	openBook(&openingBook, BOOK_PATH);
 
-	selectPiece();
+	SDL_DisplayMode mode;
+	initGovernor(SDL_GetWindowDisplayMode(window, &mode) == 0 ? mode.refresh_rate : 0);
+	startHints(&autoplayWeights);
+
+	Uint32 seed = SDL_GetTicks();
+	resetGame(seed);
+	beginLiveReplay(seed);
+	publishRenderState();
 
 #ifdef __EMSCRIPTEN__
 	emscripten_request_animation_frame_loop(mainLoop, 0);
 #else
+	SDL_Thread* logic = SDL_CreateThread(logicThread, "logic", NULL);
+
 	while (true) {
 		if (!mainLoop(0, NULL)) {
 			break;
 		}
 	}
+
+	SDL_AtomicSet(&quitting, 1);
+	SDL_WaitThread(logic, NULL);
+	stopHints();
+
+	if (liveReplayValid && liveReplay.tickCount > 0) {
+		appendReplayFile(REPLAY_PATH, &liveReplay);
+	}
 #endif
 
+	reportGovernor();
+
 	return 0;
 }
 
@@ -466,12 +1105,23 @@ bool unpausing = false;
 int unpauseTimer;
 int unpauseCounter;
 void GAME_PAUSED_update() {
-	if (keyPressed(SDL_SCANCODE_ESCAPE)) {
+	if (buttonPressed(BUTTON_PAUSE)) {
 		unpausing = true;
 		unpauseTimer = 1000;
 		unpauseCounter = 3;
 	}
 
+	// Step through the history while paused. Unpausing carries on from the
+	// selected piece and discards everything after it.
+	if (!unpausing) {
+		if (buttonPressed(BUTTON_LEFT) || buttonPressed(BUTTON_REWIND)) {
+			rewindPiece();
+		}
+		if (buttonPressed(BUTTON_RIGHT)) {
+			replayPiece();
+		}
+	}
+
 	if (unpausing) {
 		unpauseTimer -= dt;
 		if (unpauseTimer <= 0) {
@@ -482,24 +1132,21 @@ void GAME_PAUSED_update() {
 		if (unpauseCounter <= 0) {
 			gameState = GAME_RUN;
 			unpausing = false;
+			emitGameEvent(EVENT_RESUME, 0);
 			return;
 		}
 	}
-
-	GAME_PAUSED_draw();
 }
 
-void GAME_PAUSED_draw() {
+void GAME_PAUSED_draw(const struct RenderState* rs) {
 	SDL_SetRenderDrawColor(renderer, backgroundColour.r, backgroundColour.g, backgroundColour.b, backgroundColour.a);
 	SDL_RenderClear(renderer);
 
-	drawBoard();
-	drawCurrent();
-	drawPieceQueue();
-	drawHeldPiece();
-	drawScore();
+	drawBoard(rs);
+	drawCurrent(rs);
+	drawPanels(rs);
 
-	if (unpausing) {
+	if (rs->unpausing) {
 		struct DrawStringInfo dsi = {
 			.font = font_big,
 			.colour = {0xff, 0xff, 0xff, 0xff},
@@ -508,7 +1155,7 @@ void GAME_PAUSED_draw() {
 			.alignX = TEXT_ALIGN_CENTRE,
 			.alignY = TEXT_ALIGN_CENTRE,
 		};
-		drawStringf(&dsi, "%d", unpauseCounter);
+		drawStringf(&dsi, "%d", rs->unpauseCounter);
 	}
 	else {
 		struct DrawStringInfo dsi = {
@@ -520,26 +1167,27 @@ void GAME_PAUSED_draw() {
 			.alignY = TEXT_ALIGN_CENTRE,
 		};
 		drawString(&dsi, "Paused");
-	}
 
-	SDL_RenderPresent(renderer);
+		dsi.font = font_small;
+		dsi.y += 80;
+		drawStringf(&dsi, "Piece %d / %d", rs->historyPos + 1, rs->historyCount);
+	}
 }
 
-void GAME_OVER_draw();
-
 void GAME_OVER_update() {
-	GAME_OVER_draw();
+	if (buttonPressed(BUTTON_REWIND) && rewindPiece()) {
+		gameState = GAME_PAUSED;
+		return;
+	}
 }
 
-void GAME_OVER_draw() {
+void GAME_OVER_draw(const struct RenderState* rs) {
 	SDL_SetRenderDrawColor(renderer, backgroundColour.r, backgroundColour.g, backgroundColour.b, backgroundColour.a);
 	SDL_RenderClear(renderer);
 
-	drawBoard();
-	drawCurrent();
-	drawPieceQueue();
-	drawHeldPiece();
-	drawScore();
+	drawBoard(rs);
+	drawCurrent(rs);
+	drawPanels(rs);
 
 	struct DrawStringInfo dsi = {
 		.font = font_big,
@@ -550,32 +1198,14 @@ void GAME_OVER_draw() {
 		.alignY = TEXT_ALIGN_CENTRE,
 	};
 	drawString(&dsi, "Game Over");
-
-	SDL_RenderPresent(renderer);
 }
 
 int linesToClear[BLOCKS_Y];
 int lineCount = 0;
 
-void GAME_LINE_CLEAR_draw();
+int clearTimer = CLEAR_TIMER_LENGTH;
 
 void GAME_LINE_CLEAR_update() {
-	GAME_LINE_CLEAR_draw();
-}
-
-void GAME_LINE_CLEAR_draw() {
-	SDL_SetRenderDrawColor(renderer, backgroundColour.r, backgroundColour.g, backgroundColour.b, backgroundColour.a);
-	SDL_RenderClear(renderer);
-
-	drawBoard();
-	drawCurrent();
-	drawPieceQueue();
-	drawHeldPiece();
-	drawScore();
-
-#define CLEAR_TIMER_LENGTH 10
-
-	static int clearTimer = CLEAR_TIMER_LENGTH;
 	if (--clearTimer <= 0) {
 		for (int i = 0; i < lineCount; i++) {
 			removeLine(linesToClear[i]);
@@ -584,86 +1214,103 @@ void GAME_LINE_CLEAR_draw() {
 		gameState = GAME_RUN;
 		clearTimer = CLEAR_TIMER_LENGTH;
 		lineCount = 0;
-	}
 
-	SDL_SetRenderDrawColor(renderer, 0xff, 0xff, 0xff, (CLEAR_TIMER_LENGTH - clearTimer) * (256 / CLEAR_TIMER_LENGTH));
-	for (int i = 0; i < lineCount; i++) {
-		SDL_Rect rect = { BOARD_LEFT, linesToClear[i] * BLOCK_SIZE, BOARD_WIDTH, BLOCK_SIZE };
-		SDL_RenderFillRect(renderer, &rect);
+		recordCheckpoint();
 	}
-
-	SDL_RenderPresent(renderer);
 }
 
-bool tryRotate();
-bool checkResting();
+void GAME_LINE_CLEAR_draw(const struct RenderState* rs) {
+	SDL_SetRenderDrawColor(renderer, backgroundColour.r, backgroundColour.g, backgroundColour.b, backgroundColour.a);
+	SDL_RenderClear(renderer);
+
+	drawBoard(rs);
+	drawCurrent(rs);
+	drawPanels(rs);
+
+	SDL_SetRenderDrawColor(renderer, 0xff, 0xff, 0xff, (CLEAR_TIMER_LENGTH - rs->clearTimer) * 255 / CLEAR_TIMER_LENGTH);
+	for (int i = 0; i < rs->lineCount; i++) {
+		SDL_Rect rect = { BOARD_LEFT, rs->linesToClear[i] * BLOCK_SIZE, BOARD_WIDTH, BLOCK_SIZE };
+		SDL_RenderFillRect(renderer, &rect);
+	}
+}
+
+bool tryRotate();
+bool checkResting();
 
 bool pieceHeld = false;
 bool canHold = true;
 enum PieceType heldPieceType;
 
+// Pieces placed with more keys than they needed, and the keys pressed for the current one
+int finesseFaults = 0;
+int finesseKeys = 0;
+void checkFinesse();
+
 void GAME_RUN_update() {
-	if (keyPressed(SDL_SCANCODE_ESCAPE)) {
+	if (buttonPressed(BUTTON_PAUSE)) {
 		gameState = GAME_PAUSED;
+		emitGameEvent(EVENT_PAUSE, 0);
 		return;
 	}
 
-#define MOVEMENT_TIMER_LENGTH 100
-	if (keys[SDL_SCANCODE_LEFT]) {
-		static int lastLeft = 0;
+	if (buttonPressed(BUTTON_REWIND) && rewindPiece()) {
+		gameState = GAME_PAUSED;
+		return;
+	}
+
+	// For hints turned on part way through a piece
+	refreshHint();
 
-		if ((time - lastLeft) > MOVEMENT_TIMER_LENGTH || !lastKeys[SDL_SCANCODE_LEFT]) {
+	// Holding a key to repeat it counts once, the same as in the finesse tables
+	finesseKeys += buttonPressed(BUTTON_LEFT) + buttonPressed(BUTTON_RIGHT) +
+		buttonPressed(BUTTON_ROTATE_RIGHT) + buttonPressed(BUTTON_ROTATE_LEFT);
+
+#define MOVEMENT_TIMER_LENGTH 100
+	if (buttons & BUTTON_LEFT) {
+		if ((time - lastLeft) > MOVEMENT_TIMER_LENGTH || !(lastButtons & BUTTON_LEFT)) {
 			currentBlock.dx--;
 			lastLeft = time;
 		}
 	}
 
-	if (keys[SDL_SCANCODE_RIGHT]) {
-		static int lastRight = 0;
-
-		if ((time - lastRight) > MOVEMENT_TIMER_LENGTH || !lastKeys[SDL_SCANCODE_RIGHT]) {
+	if (buttons & BUTTON_RIGHT) {
+		if ((time - lastRight) > MOVEMENT_TIMER_LENGTH || !(lastButtons & BUTTON_RIGHT)) {
 			currentBlock.dx++;
 			lastRight = time;
 		}
 	}
 
 #define SOFT_DROP_TIMER_LENGTH 25
-	if (keys[SDL_SCANCODE_DOWN]) {
-		static int lastDown = 0;
-
-		if ((time - lastDown) > SOFT_DROP_TIMER_LENGTH || !lastKeys[SDL_SCANCODE_DOWN]) {
+	if (buttons & BUTTON_DOWN) {
+		if ((time - lastDown) > SOFT_DROP_TIMER_LENGTH || !(lastButtons & BUTTON_DOWN)) {
 			currentBlock.dy++;
-			blockTimer = blockTimerLength;
+			gravityProgress = 0;
 			lastDown = time;
 		}
 	}
 
 #define ROT_TIMER_LENGTH 250
-	if (keys[SDL_SCANCODE_R]) {
-		static int lastRotR = 0;
-
-		if ((time - lastRotR) > ROT_TIMER_LENGTH || !lastKeys[SDL_SCANCODE_R]) {
+	if (buttons & BUTTON_ROTATE_RIGHT) {
+		if ((time - lastRotR) > ROT_TIMER_LENGTH || !(lastButtons & BUTTON_ROTATE_RIGHT)) {
 			currentBlock.dr++;
-			blockTimer = blockTimerLength;
+			gravityProgress = 0;
 			lastRotR = time;
 		}
 	}
-	if (keys[SDL_SCANCODE_E]) {
-		static int lastRotL = 0;
-
-		if ((time - lastRotL) > ROT_TIMER_LENGTH || !lastKeys[SDL_SCANCODE_E]) {
+	if (buttons & BUTTON_ROTATE_LEFT) {
+		if ((time - lastRotL) > ROT_TIMER_LENGTH || !(lastButtons & BUTTON_ROTATE_LEFT)) {
 			currentBlock.dr--;
-			blockTimer = blockTimerLength;
+			gravityProgress = 0;
 			lastRotL = time;
 		}
 	}
 
 	// The user must press space seperately for each hard drop.
-	if (keys[SDL_SCANCODE_SPACE] && !lastKeys[SDL_SCANCODE_SPACE]) {
+	if (buttonPressed(BUTTON_DROP)) {
 		dropCurrent();
 	}
 
-	if (keyPressed(SDL_SCANCODE_C) && canHold) {
+	if (buttonPressed(BUTTON_HOLD) && canHold) {
 		currentBlock.x = BLOCKS_X / 2 - 1;
 		currentBlock.y = 0;
 		currentBlock.rotation = 0;
@@ -681,37 +1328,71 @@ void GAME_RUN_update() {
 
 		pieceHeld = true;
 		canHold = false;
+		resetLockDelay();
+		finesseKeys = 0;
+		spawnCount++;
+
+		emitGameEvent(EVENT_HOLD, heldPieceType);
+		refreshHint();
 	}
 
-	blockTimer -= dt;
-	if (blockTimer <= 0) {
-		blockTimer = blockTimerLength;
+	int startX = currentBlock.x;
+	int startRotation = currentBlock.rotation;
 
-		currentBlock.dy++;
+	if ((currentBlock.dx != 0 || currentBlock.dy != 0) && tryMove()) {
+		emitGameEvent(EVENT_MOVE, 0);
 	}
+	if (currentBlock.dr != 0 && tryRotate()) {
+		emitGameEvent(EVENT_ROTATE, 0);
+	}
+
+	bool moved = currentBlock.x != startX || currentBlock.rotation != startRotation;
 
-	if (currentBlock.dx != 0 || currentBlock.dy != 0 || currentBlock.dr != 0) {
-		tryMove();
+	applyGravity();
+
+	if (currentBlock.y > lowestY) {
+		resetLockDelay();
 	}
-	if (currentBlock.dr != 0) {
-		tryRotate();
+	else if (moved && lockResets < MAX_LOCK_RESETS && checkResting()) {
+		lockTimer = LOCK_DELAY_TICKS;
+		lockResets++;
 	}
 
 	if (checkResting()) {
-		placementTimer -= dt;
-		//printf("%d\n", placementTimer);
-
-		if (placementTimer <= 0) {
-			placementTimer = placementTimerLength;
+		lockTimer--;
+		if (lockTimer <= 0) {
 			placeCurrent();
 		}
 	}
+}
 
-	if (gameState == GAME_LINE_CLEAR) {
-		return;
-	}
+Sint32 gravityForLevel(int level) {
+	int index = SDL_min(SDL_max(level, 1), (int)SDL_arraysize(GRAVITY_TABLE)) - 1;
+	return GRAVITY_TABLE[index];
+}
 
-	GAME_RUN_draw();
+// Start the lock delay afresh for a piece that has just spawned or fallen further
+void resetLockDelay() {
+	lockTimer = LOCK_DELAY_TICKS;
+	lockResets = 0;
+	lowestY = currentBlock.y;
+}
+
+// Move the piece down by however many whole rows gravity has built up, which
+// can be several a tick at high levels
+void applyGravity() {
+	gravityProgress += gravityForLevel(level);
+
+	while (gravityProgress >= GRAVITY_ONE) {
+		if (!pieceFits(currentBlock.type, currentBlock.rotation, currentBlock.x, currentBlock.y + 1)) {
+			// Resting pieces don't build up a fall to make the moment they're moved off the edge
+			gravityProgress = 0;
+			break;
+		}
+
+		currentBlock.y++;
+		gravityProgress -= GRAVITY_ONE;
+	}
 }
 
 void dropCurrent() {
@@ -721,69 +1402,70 @@ void dropCurrent() {
 		success = tryMove();
 	} while (success);
 	placeCurrent();
-	placementTimer = placementTimerLength;
 }
 
 bool checkResting() {
-	struct BlockDef* block = &BLOCKS[currentBlock.type];
-	struct BlockRotation* br = &block->rotations[currentBlock.rotation];
-
-	for (int i = 0; i < 4; i++) {
-		for (int j = 0; j < 4; j++) {
-			int x = j + currentBlock.x + currentBlock.dx;
-			int y = i + currentBlock.y + currentBlock.dy;
+	return !pieceFits(currentBlock.type, currentBlock.rotation,
+		currentBlock.x + currentBlock.dx, currentBlock.y + currentBlock.dy + 1);
+}
 
-			if (!br->vals[i][j]) {
-				continue;
-			}
+void checkForLines();
 
-			// Non - inclusion of check for y >= 0 intentional
-			bool inRange = x >= 0 && x < BLOCKS_X&& y < BLOCKS_Y;
+// Compare the keys pressed for the piece with the fewest that would have put
+// it in the same place. Called before the piece is locked, while the board is
+// as it was when the piece spawned.
+void checkFinesse() {
+	if (!pieceSet.standard) {
+		return;
+	}
 
-			bool resting = y == BLOCKS_Y - 1;
-			if (inRange && y < (BLOCKS_Y - 1)) {
-				resting |= board.cells[x][y + 1].solid;
-			}
+	struct Bitboard bitboard;
+	readBoardRows(&bitboard, 0, BLOCKS_Y - 1);
 
-			if (resting) {
-				return true;
-			}
-		}
+	struct FinessePath path;
+	int x = currentBlock.x + currentBlock.dx;
+	int y = currentBlock.y + currentBlock.dy;
+	if (findFinessePath(&bitboard, rotationSystem, currentBlock.type, currentBlock.rotation, x, y, &path) &&
+		finesseKeys > finesseMoves(&path)) {
+		finesseFaults++;
 	}
-
-	return false;
 }
 
-void checkForLines();
-
 void placeCurrent() {
-	blockTimer = blockTimerLength;
-
-	struct BlockDef* block = &BLOCKS[currentBlock.type];
-	struct BlockRotation* br = &block->rotations[currentBlock.rotation];
+	checkFinesse();
 
-	for (int i = 0; i < 4; i++) {
-		for (int j = 0; j < 4; j++) {
-			int x = j + currentBlock.x + currentBlock.dx;
-			int y = i + currentBlock.y + currentBlock.dy;
-
-			if (br->vals[i][j]) {
-				struct Cell* cell = &board.cells[x][y];
-				cell->solid = true;
-				cell->colour = block->colour;
-			}
-		}
-	}
+	Uint32 placed = placePiece(currentBlock.type, currentBlock.rotation,
+		currentBlock.x + currentBlock.dx, currentBlock.y + currentBlock.dy);
+	dirtyRows |= placed;
+	changedRows |= placed;
 
 	canHold = true;
 
+	emitGameEvent(EVENT_LOCK, 0);
 	checkForLines();
 
+	if (placementHook != NULL) {
+		struct Placement placement = {
+			.tick = time / TICK_LENGTH,
+			.type = currentBlock.type,
+			.rotation = currentBlock.rotation,
+			.x = currentBlock.x + currentBlock.dx,
+			.y = currentBlock.y + currentBlock.dy,
+			.linesCleared = lineCount,
+			.level = level,
+		};
+		placementHook(&placement);
+	}
+
 	selectPiece();
+
+	// With lines to clear the checkpoint is taken once they have been removed
+	if (gameState != GAME_LINE_CLEAR) {
+		recordCheckpoint();
+	}
 }
 
 void selectPiece() {
-	static bool pieceQueueInitialised = false;
 	if (!pieceQueueInitialised) {
 		pieceQueueInitialised = true;
 
@@ -799,29 +1481,27 @@ void selectPiece() {
 	currentBlock.type = pieceQueue[0];
 	enqueuePiece();
 
-	// If any cells that would be occupied by the new piece are solid, game over
-	struct BlockDef* block = &BLOCKS[currentBlock.type];
-	struct BlockRotation* br = &block->rotations[currentBlock.rotation];
+	gravityProgress = 0;
+	resetLockDelay();
+	finesseKeys = 0;
+	spawnCount++;
 
-	for (int i = 0; i < 4; i++) {
-		for (int j = 0; j < 4; j++) {
-			int x = j + currentBlock.x;
-			int y = i + currentBlock.y;
+	emitGameEvent(EVENT_SPAWN, 0);
 
-			if (br->vals[i][j] && board.cells[x][y].solid) {
-				gameState = GAME_OVER;
-				return;
-			}
-		}
+	// If any cells that would be occupied by the new piece are solid, game over
+	if (!pieceFits(currentBlock.type, currentBlock.rotation, currentBlock.x, currentBlock.y)) {
+		gameState = GAME_OVER;
+		emitGameEvent(EVENT_GAME_OVER, 0);
+		return;
 	}
+
+	refreshHint();
 }
 
 void enqueuePiece() {
-	static bool usedPieces[7] = { 0 };
-
 	bool allUsed = true;
-	for (int i = 0; i < 7; i++) {
-		if (!usedPieces[i]) {
+	for (int i = 0; i < pieceSet.count; i++) {
+		if (!bagUsed[i]) {
 			allUsed = false;
 			break;
 		}
@@ -829,24 +1509,57 @@ void enqueuePiece() {
 
 	if (allUsed) {
 		allUsed = false;
-		for (int i = 0; i < 7; i++) {
-			usedPieces[i] = false;
+		for (int i = 0; i < pieceSet.count; i++) {
+			bagUsed[i] = false;
 		}
 	}
 
 	int type;
 	do
 	{
-		type = rand() % 7;
-	} while (usedPieces[type]);
+		type = nextRandom() % pieceSet.count;
+	} while (bagUsed[type]);
 
-	usedPieces[type] = true;
+	bagUsed[type] = true;
 
 	memmove(&pieceQueue[0], &pieceQueue[1], (QUEUE_LENGTH - 1) * sizeof(enum PieceType));
 	pieceQueue[QUEUE_LENGTH - 1] = type;
 }
 
-void drawPieceQueue() {
+// Pieces in the side panels are drawn smaller if the set has any bigger than
+// the standard ones
+int panelCellSize() {
+	return BLOCK_SIZE * 4 / SDL_max(pieceSet.maxSize, 4);
+}
+
+// Draw a piece's first rotation in a side panel, leaving out empty rows of its
+// box. Returns the y below the last row drawn.
+int drawPanelPiece(enum PieceType type, int left, int y) {
+	const struct PieceDef* piece = &pieceSet.pieces[type];
+	const struct PieceRotation* shape = &piece->rotations[0];
+	int size = panelCellSize();
+
+	SDL_Color colour = palette[PIECE_CELL(type)];
+	SDL_SetRenderDrawColor(renderer, colour.r, colour.g, colour.b, colour.a);
+
+	for (int i = 0; i < piece->size; i++) {
+		if (shape->rows[i] == 0) {
+			continue;
+		}
+
+		for (int j = 0; j < piece->size; j++) {
+			if (PIECE_SOLID(shape, j, i)) {
+				SDL_Rect rect = { left + j * size, y, size, size };
+				SDL_RenderFillRect(renderer, &rect);
+			}
+		}
+		y += size;
+	}
+
+	return y;
+}
+
+void drawPieceQueue(const struct RenderState* rs) {
 	int queueLeft = BOARD_RIGHT + 30;
 	int queueWidth = 100;
 
@@ -865,33 +1578,11 @@ void drawPieceQueue() {
 	int y = queueTop;
 
 	for (int i = 0; i < QUEUE_LENGTH; i++) {
-		struct BlockDef* block = &BLOCKS[pieceQueue[i]];
-		struct BlockRotation* br = &block->rotations[0];
-
-		for (int i = 0; i < 4; i++) {
-			bool anySolid = false;
-
-			for (int j = 0; j < 4; j++) {
-				if (br->vals[i][j]) {
-					anySolid = true;
-
-					SDL_Color colour = block->colour;
-
-					SDL_Rect rect = { queueLeft + j * BLOCK_SIZE, y, BLOCK_SIZE, BLOCK_SIZE };
-					SDL_SetRenderDrawColor(renderer, colour.r, colour.g, colour.b, colour.a);
-					SDL_RenderFillRect(renderer, &rect);
-
-				}
-			}
-			if (anySolid) {
-				y += BLOCK_SIZE;
-			}
-		}
-		y += BLOCK_SIZE;
+		y = drawPanelPiece(rs->pieceQueue[i], queueLeft, y) + panelCellSize();
 	}
 }
 
-void drawHeldPiece() {
+void drawHeldPiece(const struct RenderState* rs) {
 	int left = BOARD_LEFT - 30;
 	int y = 60;
 
@@ -905,32 +1596,12 @@ void drawHeldPiece() {
 	};
 	drawString(&dsi, "Held");
 
-	if (pieceHeld) {
-		struct BlockDef* block = &BLOCKS[heldPieceType];
-		struct BlockRotation* br = &block->rotations[0];
-
-		for (int i = 0; i < 4; i++) {
-			bool anySolid = false;
-
-			for (int j = 0; j < 4; j++) {
-				if (br->vals[i][j]) {
-					anySolid = true;
-
-					SDL_Color colour = block->colour;
-
-					SDL_Rect rect = { 50 + j * BLOCK_SIZE, y, BLOCK_SIZE, BLOCK_SIZE };
-					SDL_SetRenderDrawColor(renderer, colour.r, colour.g, colour.b, colour.a);
-					SDL_RenderFillRect(renderer, &rect);
-				}
-			}
-			if (anySolid) {
-				y += BLOCK_SIZE;
-			}
-		}
+	if (rs->pieceHeld) {
+		drawPanelPiece(rs->heldPieceType, 50, y);
 	}
 }
 
-void drawScore() {
+void drawScore(const struct RenderState* rs) {
 	int left = BOARD_LEFT - 30;
 	int y = 300;
 
@@ -945,39 +1616,124 @@ void drawScore() {
 	drawString(&dsi, "Lines");
 
 	dsi.alignY = TEXT_ALIGN_BELOW;
-	drawStringf(&dsi, "%d", lines);
+	drawNumber(&dsi, rs->lines);
 
 	dsi.y += 100;
 	dsi.alignY = TEXT_ALIGN_ABOVE;
 	drawString(&dsi, "Level");
 
 	dsi.alignY = TEXT_ALIGN_BELOW;
-	drawStringf(&dsi, "%d", level);
+	drawNumber(&dsi, rs->level);
+
+	dsi.y += 100;
+	dsi.alignY = TEXT_ALIGN_ABOVE;
+	drawString(&dsi, "Faults");
+
+	dsi.alignY = TEXT_ALIGN_BELOW;
+	drawNumber(&dsi, rs->finesseFaults);
+}
+
+// What the side panels show, to tell when the cached copy is out of date
+struct PanelState {
+	enum PieceType pieceQueue[QUEUE_LENGTH];
+	bool pieceHeld;
+	enum PieceType heldPieceType;
+
+	int lines;
+	int level;
+	int finesseFaults;
+};
+
+// Frames between redraws of the cached panels, however often they change
+#define PANEL_REDRAW_INTERVAL 4
+
+struct {
+	SDL_Texture* texture;
+	bool valid;
+	struct PanelState state;
+	int framesSinceRedraw;
+} panelCache;
+
+bool drawCachedPanels(const struct RenderState* rs) {
+	if (panelCache.texture == NULL) {
+		if (!SDL_RenderTargetSupported(renderer)) {
+			return false;
+		}
+
+		panelCache.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, WINDOW_WIDTH, WINDOW_HEIGHT);
+		if (panelCache.texture == NULL) {
+			return false;
+		}
+		panelCache.valid = false;
+	}
+
+	struct PanelState state;
+	memset(&state, 0, sizeof(state));
+	memcpy(state.pieceQueue, rs->pieceQueue, sizeof(state.pieceQueue));
+	state.pieceHeld = rs->pieceHeld;
+	state.heldPieceType = rs->pieceHeld ? rs->heldPieceType : 0;
+	state.lines = rs->lines;
+	state.level = rs->level;
+	state.finesseFaults = rs->finesseFaults;
+
+	panelCache.framesSinceRedraw++;
+	bool changed = !panelCache.valid || memcmp(&state, &panelCache.state, sizeof(state)) != 0;
+
+	if (changed && (!panelCache.valid || panelCache.framesSinceRedraw >= PANEL_REDRAW_INTERVAL)) {
+		SDL_SetRenderTarget(renderer, panelCache.texture);
+		SDL_SetRenderDrawColor(renderer, backgroundColour.r, backgroundColour.g, backgroundColour.b, backgroundColour.a);
+		SDL_RenderClear(renderer);
+
+		drawPieceQueue(rs);
+		drawHeldPiece(rs);
+		drawScore(rs);
+
+		SDL_SetRenderTarget(renderer, NULL);
+
+		panelCache.state = state;
+		panelCache.valid = true;
+		panelCache.framesSinceRedraw = 0;
+		governorCounters.panelRedraws++;
+	}
+	else {
+		governorCounters.panelReuses++;
+	}
+
+	// Either side of the board, which is drawn every frame
+	SDL_Rect left = { 0, 0, BOARD_LEFT, WINDOW_HEIGHT };
+	SDL_Rect right = { BOARD_RIGHT, 0, WINDOW_WIDTH - BOARD_RIGHT, WINDOW_HEIGHT };
+	SDL_RenderCopy(renderer, panelCache.texture, &left, &left);
+	SDL_RenderCopy(renderer, panelCache.texture, &right, &right);
+	return true;
+}
+
+void drawPanels(const struct RenderState* rs) {
+	if (renderQuality() >= QUALITY_CACHED_PANELS && drawCachedPanels(rs)) {
+		return;
+	}
+
+	// The cache may have missed changes while it wasn't used
+	panelCache.valid = false;
+
+	drawPieceQueue(rs);
+	drawHeldPiece(rs);
+	drawScore(rs);
 }
 
 void checkForLines() {
-	struct BlockDef* block = &BLOCKS[currentBlock.type];
-	struct BlockRotation* br = &block->rotations[currentBlock.rotation];
-
-	for (int i = 0; i < 4; i++) {
-		for (int j = 0; j < 4; j++) {
-			int x = j + currentBlock.x + currentBlock.dx;
-			int y = i + currentBlock.y + currentBlock.dy;
-
-			if (br->vals[i][j]) {
-				for (int x2 = 0; x2 < BLOCKS_X; x2++) {
-					if (!board.cells[x2][y].solid) {
-						goto checkNextLine;
-					}
-				}
+	const struct PieceRotation* shape = &pieceSet.pieces[currentBlock.type].rotations[currentBlock.rotation];
 
-				linesToClear[lineCount++] = y;
-				gameState = GAME_LINE_CLEAR;
+	for (int i = shape->top; i <= shape->bottom; i++) {
+		int y = i + currentBlock.y + currentBlock.dy;
 
-				goto checkNextLine;
-			}
+		if (shape->rows[i] != 0 && y >= 0 && solidCells(board.rows[y]) == (1 << BLOCKS_X) - 1) {
+			linesToClear[lineCount++] = y;
+			gameState = GAME_LINE_CLEAR;
 		}
-	checkNextLine:;
+	}
+
+	if (lineCount > 0) {
+		emitGameEvent(EVENT_LINES, lineCount);
 	}
 }
 
@@ -987,172 +1743,265 @@ void removeLine(int y) {
 	lines++;
 	if (lines % 10 == 0) {
 		level++;
-		blockTimerLength *= 2;
-		blockTimerLength /= 3;
+		emitGameEvent(EVENT_LEVEL_UP, level);
 	}
 
-	for (int x = 0; x < BLOCKS_X; x++) {
-		board.cells[x][y].solid = false;
-	}
+	// Every row from the cleared one up shifts down
+	dirtyRows |= (2u << y) - 1;
+	changedRows |= (2u << y) - 1;
 
-	for (int y2 = y; y2 > 0; y2--) {
-		for (int x = 0; x < BLOCKS_X; x++) {
-			board.cells[x][y2] = board.cells[x][y2 - 1];
-			board.cells[x][y2 - 1].solid = false;
-		}
-	}
-	for (int x = 0; x < BLOCKS_X; x++) {
-		board.cells[x][0].solid = false;
-	}
+	memmove(&board.rows[1], &board.rows[0], y * sizeof(board.rows[0]));
+	board.rows[0] = 0;
 }
 
 bool tryMove() {
-	struct BlockDef* block = &BLOCKS[currentBlock.type];
-	struct BlockRotation* br = &block->rotations[currentBlock.rotation];
-
-	bool success = true;
-
-	for (int i = 0; i < 4; i++) {
-		for (int j = 0; j < 4; j++) {
-			int x = j + currentBlock.x + currentBlock.dx;
-			int y = i + currentBlock.y + currentBlock.dy;
-
-			// Non - inclusion of check for y >= 0 intentional
-			bool inRange = x >= 0 && x < BLOCKS_X&& y < BLOCKS_Y;
-
-			bool blocked = false;
-			if (inRange) {
-				blocked = board.cells[x][y].solid;
-			}
+	bool success = pieceFits(currentBlock.type, currentBlock.rotation,
+		currentBlock.x + currentBlock.dx, currentBlock.y + currentBlock.dy);
 
-			if (br->vals[i][j] && (!inRange || blocked)) {
-				success = false;
-				goto moveFailed;
-			}
-		}
+	if (success) {
+		currentBlock.x += currentBlock.dx;
+		currentBlock.y += currentBlock.dy;
 	}
 
-	currentBlock.x += currentBlock.dx;
-	currentBlock.y += currentBlock.dy;
-
-moveFailed:;
 	currentBlock.dx = 0;
 	currentBlock.dy = 0;
 
 	return success;
 }
 
-bool tryRotate() {
-	bool success = true;
+static Uint64 shiftCells(Uint64 cells, int x) {
+	return x >= 0 ? cells << (CELL_BITS * x) : cells >> (CELL_BITS * -x);
+}
 
-	int newRot = currentBlock.rotation + currentBlock.dr;
-	if (newRot == -1) {
-		newRot = 3;
-	}
-	else if (newRot == 4) {
-		newRot = 0;
+// Collision and placement for pieces in an n by n box, defined once for each
+// box size so the loops over the box have a fixed length and unroll. Each row
+// of the piece is tested against or merged into a board row as one mask. The
+// caller has already checked the piece is within the walls and the floor, and
+// anything above the board counts as empty.
+#define DEFINE_PIECE_FUNCTIONS(n) \
+	static bool pieceFits##n(const struct PieceRotation* shape, int x, int y) { \
+		for (int i = 0; i < n; i++) { \
+			if (shape->cells[i] != 0 && y + i >= 0 && (board.rows[y + i] & shiftCells(shape->cells[i], x))) { \
+				return false; \
+			} \
+		} \
+		return true; \
+	} \
+	\
+	static Uint32 placePiece##n(const struct PieceRotation* shape, Uint64 fill, int x, int y) { \
+		Uint32 placed = 0; \
+		for (int i = 0; i < n; i++) { \
+			if (shape->cells[i] != 0 && y + i >= 0) { \
+				board.rows[y + i] |= shiftCells(shape->cells[i] & fill, x); \
+				placed |= 1u << (y + i); \
+			} \
+		} \
+		return placed; \
 	}
 
-	struct BlockDef* block = &BLOCKS[currentBlock.type];
-	struct BlockRotation* br = &block->rotations[newRot];
+DEFINE_PIECE_FUNCTIONS(1)
+DEFINE_PIECE_FUNCTIONS(2)
+DEFINE_PIECE_FUNCTIONS(3)
+DEFINE_PIECE_FUNCTIONS(4)
+DEFINE_PIECE_FUNCTIONS(5)
 
-	int oldRot = currentBlock.rotation;
-	currentBlock.rotation = newRot;
+SDL_COMPILE_TIME_ASSERT(pieceFunctions, MAX_PIECE_SIZE == 5);
 
-	for (int i = 0; i < 4; i++) {
-		for (int j = 0; j < 4; j++) {
-			int x = j + currentBlock.x + currentBlock.dx;
-			int y = i + currentBlock.y + currentBlock.dy;
+bool pieceFits(enum PieceType type, int rotation, int x, int y) {
+	const struct PieceDef* piece = &pieceSet.pieces[type];
+	const struct PieceRotation* shape = &piece->rotations[rotation];
 
-			// Non - inclusion of check for y >= 0 intentional
-			bool inRange = x >= 0 && x < BLOCKS_X&& y < BLOCKS_Y;
+	if (x + shape->left < 0 || x + shape->right >= BLOCKS_X || y + shape->bottom >= BLOCKS_Y) {
+		return false;
+	}
 
-			bool blocked = false;
-			if (inRange) {
-				blocked = board.cells[x][y].solid;
-			}
+	switch (piece->size) {
+	case 1: return pieceFits1(shape, x, y);
+	case 2: return pieceFits2(shape, x, y);
+	case 3: return pieceFits3(shape, x, y);
+	case 4: return pieceFits4(shape, x, y);
+	default: return pieceFits5(shape, x, y);
+	}
+}
 
-			if (br->vals[i][j] && (!inRange || blocked)) {
-				//printf("%d %d\n", x, y);
+// Lock a piece into the board, returning a mask of the rows it was put in
+Uint32 placePiece(enum PieceType type, int rotation, int x, int y) {
+	const struct PieceDef* piece = &pieceSet.pieces[type];
+	const struct PieceRotation* shape = &piece->rotations[rotation];
+	Uint64 fill = CELL_REPEAT * PIECE_CELL(type);
+
+	switch (piece->size) {
+	case 1: return placePiece1(shape, fill, x, y);
+	case 2: return placePiece2(shape, fill, x, y);
+	case 3: return placePiece3(shape, fill, x, y);
+	case 4: return placePiece4(shape, fill, x, y);
+	default: return placePiece5(shape, fill, x, y);
+	}
+}
 
-				success = false;
+enum RotationSystem rotationSystem = ROTATION_LEGACY;
 
-				currentBlock.dx++;
-				success = tryMove();
-				if (success) {
-					continue;
-				}
-				currentBlock.dx += 2;
-				success = tryMove();
-				if (success) {
-					continue;
-				}
+bool tryRotate() {
+	int direction = currentBlock.dr > 0 ? 1 : -1;
+	currentBlock.dr = 0;
 
-				currentBlock.dx--;
-				success = tryMove();
-				if (success) {
-					continue;
-				}
-				currentBlock.dx -= 2;
-				success = tryMove();
-				if (success) {
-					continue;
-				}
+	// The SRS tables are only for the standard pieces
+	enum RotationSystem system = pieceSet.standard ? rotationSystem : ROTATION_LEGACY;
+	int target = (currentBlock.rotation + direction + 4) % 4;
 
-				currentBlock.dy--;
-				success = tryMove();
-				if (success) {
-					continue;
-				}
-				currentBlock.dy -= 2;
-				success = tryMove();
-				if (success) {
-					continue;
-				}
+	const struct Kick* kicks;
+	int count = rotationKicks(system, currentBlock.type, currentBlock.rotation, direction, &kicks);
 
-				if (!success) {
-					currentBlock.rotation = oldRot;
-					goto rotationFailed;
-				}
-			}
+	for (int i = 0; i < count; i++) {
+		int x = currentBlock.x + kicks[i].x;
+		int y = currentBlock.y + kicks[i].y;
+
+		if (pieceFits(currentBlock.type, target, x, y)) {
+			currentBlock.x = x;
+			currentBlock.y = y;
+			currentBlock.rotation = target;
+			return true;
 		}
 	}
 
-rotationFailed:;
-	currentBlock.dr = 0;
+	return false;
+}
 
-	return success;
+void readBoardRows(struct Bitboard* bitboard, int first, int last) {
+	first = SDL_max(first, 0);
+	last = SDL_min(last, BLOCKS_Y - 1);
+
+	for (int y = first; y <= last; y++) {
+		bitboard->rows[y] = solidCells(board.rows[y]);
+	}
 }
 
-void GAME_RUN_draw() {
+void GAME_RUN_draw(const struct RenderState* rs) {
 	SDL_SetRenderDrawColor(renderer, backgroundColour.r, backgroundColour.g, backgroundColour.b, backgroundColour.a);
 	SDL_RenderClear(renderer);
 
-	drawBoard();
-	drawCurrent();
-	drawPieceQueue();
-	drawHeldPiece();
-	drawScore();
+	drawBoard(rs);
+	drawCurrent(rs);
+	drawPanels(rs);
+}
+
+void drawFrame(const struct RenderState* rs) {
+	Uint64 start = SDL_GetPerformanceCounter();
 
+	switch (rs->gameState) {
+	case GAME_PAUSED:
+		GAME_PAUSED_draw(rs);
+		break;
+	case GAME_RUN:
+		GAME_RUN_draw(rs);
+		break;
+	case GAME_LINE_CLEAR:
+		GAME_LINE_CLEAR_draw(rs);
+		break;
+	case GAME_OVER:
+		GAME_OVER_draw(rs);
+		break;
+	default:
+		printf("Invalid game state\n");
+		exit(-1);
+	}
+
+	governFrame((SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency());
 	SDL_RenderPresent(renderer);
+
+	if (presentHook != NULL) {
+		struct PresentedFrame frame = {
+			.gameState = rs->gameState,
+			.unpausing = rs->unpausing,
+			.x = rs->x,
+			.rotation = rs->rotation,
+			.spawn = rs->spawn,
+			.presentedAt = SDL_GetPerformanceCounter(),
+		};
+		presentHook(&frame);
+	}
 }
 
-void drawBoard() {
+void (*presentHook)(const struct PresentedFrame* frame) = NULL;
+
+void publishRenderState() {
+	struct RenderState* rs = &renderStates[renderBack];
+
+	memcpy(rs->rows, board.rows, sizeof(rs->rows));
+
+	rs->x = currentBlock.x;
+	rs->y = currentBlock.y;
+	rs->type = currentBlock.type;
+	rs->rotation = currentBlock.rotation;
+
+	rs->ghostY = currentBlock.y;
+	while (pieceFits(currentBlock.type, currentBlock.rotation, currentBlock.x, rs->ghostY + 1)) {
+		rs->ghostY++;
+	}
+
+	rs->spawn = spawnCount;
+	rs->hints = SDL_AtomicGet(&hintsEnabled);
+
+	memcpy(rs->pieceQueue, pieceQueue, sizeof(rs->pieceQueue));
+	rs->pieceHeld = pieceHeld;
+	rs->heldPieceType = heldPieceType;
+
+	rs->lines = lines;
+	rs->level = level;
+	rs->finesseFaults = finesseFaults;
+
+	rs->gameState = gameState;
+	rs->unpausing = unpausing;
+	rs->unpauseCounter = unpauseCounter;
+
+	rs->lineCount = lineCount;
+	for (int i = 0; i < lineCount; i++) {
+		rs->linesToClear[i] = linesToClear[i];
+	}
+	rs->clearTimer = clearTimer;
+
+	rs->historyPos = historyPos;
+	rs->historyCount = historyCount;
+
+	renderBack = SDL_AtomicSet(&renderMiddle, renderBack | TRIPLE_BUFFER_DIRTY) & 3;
+}
+
+void drawBoard(const struct RenderState* rs) {
+	if (renderQuality() >= QUALITY_NO_GRID) {
+		SDL_Rect rect = { BOARD_LEFT, 0, BOARD_WIDTH, BOARD_HEIGHT };
+		SDL_Color empty = palette[CELL_EMPTY];
+		SDL_SetRenderDrawColor(renderer, empty.r, empty.g, empty.b, empty.a);
+		SDL_RenderFillRect(renderer, &rect);
+
+		for (int i = 0; i < BLOCKS_Y; i++) {
+			for (int j = 0; j < BLOCKS_X; j++) {
+				int cell = ROW_CELL(rs->rows[i], j);
+				if (cell != CELL_EMPTY) {
+					SDL_Rect rect = { BOARD_LEFT + j * BLOCK_SIZE, i * BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE };
+					SDL_Color colour = palette[cell];
+					SDL_SetRenderDrawColor(renderer, colour.r, colour.g, colour.b, colour.a);
+					SDL_RenderFillRect(renderer, &rect);
+				}
+			}
+		}
+		return;
+	}
+
 	for (int i = 0; i < BLOCKS_Y; i++) {
 		for (int j = 0; j < BLOCKS_X; j++) {
 			int x = BOARD_LEFT + j * BLOCK_SIZE;
 			int y = i * BLOCK_SIZE;
 
-			struct Cell* cell = &board.cells[j][i];
+			int cell = ROW_CELL(rs->rows[i], j);
 
 			SDL_Rect rect = { x, y, BLOCK_SIZE, BLOCK_SIZE };
-			if (cell->solid) {
-				SDL_Color colour = cell->colour;
+			if (cell != CELL_EMPTY) {
+				SDL_Color colour = palette[cell];
 				SDL_SetRenderDrawColor(renderer, colour.r, colour.g, colour.b, colour.a);
 				SDL_RenderFillRect(renderer, &rect);
 			}
 			else {
-				SDL_Color colour = (SDL_Color){ 0x2b, 0x2b, 0x2b, 0xff };
+				SDL_Color colour = palette[CELL_EMPTY];
 				SDL_SetRenderDrawColor(renderer, colour.r, colour.g, colour.b, colour.a);
 				SDL_RenderFillRect(renderer, &rect);
 
@@ -1164,32 +2013,21 @@ void drawBoard() {
 	}
 }
 
-void drawCurrent() {
-	struct BlockDef* block = &BLOCKS[currentBlock.type];
-	struct BlockRotation* br = &block->rotations[currentBlock.rotation];
+void drawCurrent(const struct RenderState* rs) {
+	const struct PieceDef* piece = &pieceSet.pieces[rs->type];
+	const struct PieceRotation* shape = &piece->rotations[rs->rotation];
 
 	// Draw ghost block
-	int y = currentBlock.y;
-	bool success;
-	do {
-		currentBlock.dy++;
-		success = tryMove();
-	} while (success);
-	int bottom = currentBlock.y;
-	currentBlock.y = y;
-
-	//printf("%d\n", bottom);
-
-	for (int i = 0; i < 4; i++) {
-		for (int j = 0; j < 4; j++) {
-			int x = currentBlock.x + j;
-			int y = bottom + i;
+	for (int i = 0; i < piece->size; i++) {
+		for (int j = 0; j < piece->size; j++) {
+			int x = rs->x + j;
+			int y = rs->ghostY + i;
 
 			if (x < 0 || x >= BLOCKS_X || y < 0 || y >= BLOCKS_Y) {
 				continue;
 			}
 
-			if (br->vals[i][j]) {
+			if (PIECE_SOLID(shape, j, i)) {
 				SDL_Color colour = { 0x45, 0x45, 0x45, 0xbf };
 
 				SDL_Rect rect = { BOARD_LEFT + x * BLOCK_SIZE, y * BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE };
@@ -1199,17 +2037,41 @@ void drawCurrent() {
 		}
 	}
 
-	for (int i = 0; i < 4; i++) {
-		for (int j = 0; j < 4; j++) {
-			int x = currentBlock.x + j;
-			int y = currentBlock.y + i;
+	// Draw the hint as an outline of where the bot would put the piece, which
+	// may be the hold piece instead
+	struct Move hint;
+	if (rs->hints && readHint(rs->spawn, &hint)) {
+		enum PieceType type = !hint.useHold ? rs->type : rs->pieceHeld ? rs->heldPieceType : rs->pieceQueue[0];
+		const struct PieceDef* hintPiece = &pieceSet.pieces[type];
+		const struct PieceRotation* hintShape = &hintPiece->rotations[hint.rotation];
+
+		SDL_Color colour = palette[PIECE_CELL(type)];
+		SDL_SetRenderDrawColor(renderer, colour.r, colour.g, colour.b, colour.a);
+
+		for (int i = 0; i < hintPiece->size; i++) {
+			for (int j = 0; j < hintPiece->size; j++) {
+				int x = hint.x + j;
+				int y = hint.y + i;
+
+				if (PIECE_SOLID(hintShape, j, i) && x >= 0 && x < BLOCKS_X && y >= 0 && y < BLOCKS_Y) {
+					SDL_Rect rect = { BOARD_LEFT + x * BLOCK_SIZE + 2, y * BLOCK_SIZE + 2, BLOCK_SIZE - 4, BLOCK_SIZE - 4 };
+					SDL_RenderDrawRect(renderer, &rect);
+				}
+			}
+		}
+	}
+
+	for (int i = 0; i < piece->size; i++) {
+		for (int j = 0; j < piece->size; j++) {
+			int x = rs->x + j;
+			int y = rs->y + i;
 
 			if (x < 0 || x >= BLOCKS_X || y < 0 || y >= BLOCKS_Y) {
 				continue;
 			}
 
-			if (br->vals[i][j]) {
-				SDL_Color colour = block->colour;
+			if (PIECE_SOLID(shape, j, i)) {
+				SDL_Color colour = palette[PIECE_CELL(rs->type)];
 
 				SDL_Rect rect = { BOARD_LEFT + x * BLOCK_SIZE, y * BLOCK_SIZE, BLOCK_SIZE, BLOCK_SIZE };
 				SDL_SetRenderDrawColor(renderer, colour.r, colour.g, colour.b, colour.a);
@@ -1219,15 +2081,126 @@ void drawCurrent() {
 	}
 }
 
+// The font is embedded in the executable (see tools/embed_font.py) so it
+// doesn't depend on the working directory.
+TTF_Font* openEmbeddedFont(int size) {
+	SDL_RWops* rw = SDL_RWFromConstMem(FONT_DATA, sizeof(FONT_DATA));
+	TTF_Font* font = TTF_OpenFontRW(rw, 1, size);
+	if (font == NULL) {
+		printf("Failed to load font: %s\n", SDL_GetError());
+	}
+	return font;
+}
+
 void loadFont() {
-	font_big = TTF_OpenFont("resources/Blinker/Blinker-Regular.ttf", 80);
-	font_small = TTF_OpenFont("resources/Blinker/Blinker-Regular.ttf", 40);
+	font_small = openEmbeddedFont(40);
 }
 
-void drawString(struct DrawStringInfo* dsi, const char* msg) {
-	SDL_Surface* surf = TTF_RenderUTF8_Blended(dsi->font, msg, dsi->colour);
-	SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
+void loadDeferredFont() {
+	if (font_big == NULL) {
+		font_big = openEmbeddedFont(80);
+	}
+}
+
+void markStartup(const char* name) {
+	if (startupStageCount < MAX_STARTUP_STAGES) {
+		startupStages[startupStageCount].name = name;
+		startupStages[startupStageCount].counter = SDL_GetPerformanceCounter();
+		startupStageCount++;
+	}
+}
 
+void reportStartup() {
+	double freq = (double)SDL_GetPerformanceFrequency();
+
+	printf("Startup:");
+	for (int i = 1; i < startupStageCount; i++) {
+		double ms = (startupStages[i].counter - startupStages[i - 1].counter) * 1000.0 / freq;
+		printf(" %s %.2fms,", startupStages[i].name, ms);
+	}
+
+	double total = (startupStages[startupStageCount - 1].counter - startupStages[0].counter) * 1000.0 / freq;
+	printf(" total %.2fms\n", total);
+}
+
+// Textures of recently drawn strings, so text that doesn't change from one
+// frame to the next is only rendered once. The least recently used entry makes
+// way for a new string.
+#define TEXT_CACHE_SIZE 32
+#define MAX_CACHED_TEXT 32
+
+struct CachedText {
+	TTF_Font* font;
+	SDL_Color colour;
+	char text[MAX_CACHED_TEXT];
+
+	SDL_Texture* texture;
+	int w;
+	int h;
+	Uint32 lastUsed;
+};
+
+struct CachedText textCache[TEXT_CACHE_SIZE];
+Uint32 textCacheClock = 0;
+
+// Textures go with the renderer that made them
+SDL_Renderer* textCacheRenderer;
+
+bool sameColour(SDL_Color a, SDL_Color b) {
+	return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+// The cached texture for a string, rendering it if it isn't there. Returns
+// NULL for strings too long to cache.
+struct CachedText* cachedText(TTF_Font* font, SDL_Color colour, const char* msg) {
+	if (strlen(msg) >= MAX_CACHED_TEXT) {
+		return NULL;
+	}
+
+	if (textCacheRenderer != renderer) {
+		memset(textCache, 0, sizeof(textCache));
+		textCacheRenderer = renderer;
+	}
+
+	textCacheClock++;
+
+	// Unused entries were last used at 0, so they go first
+	struct CachedText* oldest = &textCache[0];
+	for (int i = 0; i < TEXT_CACHE_SIZE; i++) {
+		struct CachedText* entry = &textCache[i];
+		if (entry->texture != NULL && entry->font == font && sameColour(entry->colour, colour) && strcmp(entry->text, msg) == 0) {
+			entry->lastUsed = textCacheClock;
+			return entry;
+		}
+
+		if (entry->lastUsed < oldest->lastUsed) {
+			oldest = entry;
+		}
+	}
+
+	SDL_Surface* surf = TTF_RenderUTF8_Blended(font, msg, colour);
+	if (surf == NULL) {
+		return NULL;
+	}
+
+	if (oldest->texture != NULL) {
+		SDL_DestroyTexture(oldest->texture);
+	}
+
+	oldest->font = font;
+	oldest->colour = colour;
+	strcpy(oldest->text, msg);
+	oldest->texture = SDL_CreateTextureFromSurface(renderer, surf);
+	oldest->w = surf->w;
+	oldest->h = surf->h;
+	oldest->lastUsed = textCacheClock;
+
+	SDL_FreeSurface(surf);
+	return oldest->texture != NULL ? oldest : NULL;
+}
+
+// Where the top left of text w by h goes, for the alignment asked for
+SDL_Point textOrigin(const struct DrawStringInfo* dsi, int w, int h) {
 	int x = dsi->x;
 	int y = dsi->y;
 
@@ -1236,11 +2209,11 @@ void drawString(struct DrawStringInfo* dsi, const char* msg) {
 		break;
 
 	case TEXT_ALIGN_RIGHT:
-		x -= surf->w;
+		x -= w;
 		break;
 
 	case TEXT_ALIGN_CENTRE:
-		x -= surf->w / 2;
+		x -= w / 2;
 		break;
 
 	default:
@@ -1253,11 +2226,11 @@ void drawString(struct DrawStringInfo* dsi, const char* msg) {
 		break;
 
 	case TEXT_ALIGN_ABOVE:
-		y -= surf->h;
+		y -= h;
 		break;
 
 	case TEXT_ALIGN_CENTRE:
-		y -= surf->h / 2;
+		y -= h / 2;
 		break;
 
 	default:
@@ -1265,41 +2238,636 @@ void drawString(struct DrawStringInfo* dsi, const char* msg) {
 		exit(-1);
 	}
 
+	return (SDL_Point){ x, y };
+}
+
+void drawString(struct DrawStringInfo* dsi, const char* msg) {
+	// Fonts that are loaded after the first frame may not be ready yet
+	if (dsi->font == NULL) {
+		return;
+	}
+
+	struct CachedText uncached = { 0 };
+	struct CachedText* text = cachedText(dsi->font, dsi->colour, msg);
+	if (text == NULL) {
+		SDL_Surface* surf = TTF_RenderUTF8_Blended(dsi->font, msg, dsi->colour);
+		if (surf == NULL) {
+			return;
+		}
+
+		uncached.texture = SDL_CreateTextureFromSurface(renderer, surf);
+		uncached.w = surf->w;
+		uncached.h = surf->h;
+		SDL_FreeSurface(surf);
+		text = &uncached;
+	}
+
+	SDL_Point origin = textOrigin(dsi, text->w, text->h);
 	SDL_Rect dest = {
-		x,
-		y,
-		surf->w,
-		surf->h
+		origin.x,
+		origin.y,
+		text->w,
+		text->h
 	};
 
-	SDL_RenderCopy(renderer, tex, NULL, &dest);
+	SDL_RenderCopy(renderer, text->texture, NULL, &dest);
 
-	SDL_FreeSurface(surf);
-	SDL_DestroyTexture(tex);
+	if (uncached.texture != NULL) {
+		SDL_DestroyTexture(uncached.texture);
+	}
+}
+
+// Numbers that change during play are put together a digit at a time from the
+// text cache, so a new count of lines doesn't render a new string. All ten
+// digits are looked up every time, so they're rendered on the first frame and
+// none is pushed out of the cache for going unused a while.
+void drawNumber(struct DrawStringInfo* dsi, int value) {
+	char digits[16];
+	int length = snprintf(digits, sizeof(digits), "%d", value);
+
+	struct CachedText* glyphs[10];
+	for (int d = 0; d < 10; d++) {
+		char glyph[2] = { (char)('0' + d), '\0' };
+		glyphs[d] = dsi->font != NULL ? cachedText(dsi->font, dsi->colour, glyph) : NULL;
+	}
+
+	int w = 0;
+	int h = 0;
+	for (int i = 0; i < length; i++) {
+		struct CachedText* glyph = digits[i] >= '0' && digits[i] <= '9' ? glyphs[digits[i] - '0'] : NULL;
+		if (glyph == NULL) {
+			drawString(dsi, digits);
+			return;
+		}
+
+		w += glyph->w;
+		h = SDL_max(h, glyph->h);
+	}
+
+	SDL_Point origin = textOrigin(dsi, w, h);
+	for (int i = 0; i < length; i++) {
+		struct CachedText* glyph = glyphs[digits[i] - '0'];
+		SDL_Rect dest = { origin.x, origin.y, glyph->w, glyph->h };
+		SDL_RenderCopy(renderer, glyph->texture, NULL, &dest);
+		origin.x += glyph->w;
+	}
 }
 
 void drawStringf(struct DrawStringInfo* dsi, const char* fmt, ...) {
-	static char* buf;
-	static int bufSize;
+	// Everything the game draws fits, so formatting doesn't allocate
+	char buf[128];
 
-	while (true) {
-		va_list args;
-		va_start(args, fmt);
+	va_list args;
+	va_start(args, fmt);
+	int ret = vsnprintf(buf, sizeof(buf), fmt, args);
+	va_end(args);
+
+	if (ret < 0) {
+		return;
+	}
+	if (ret < (int)sizeof(buf)) {
+		drawString(dsi, buf);
+		return;
+	}
+
+	// Too long, so format it again into a buffer that fits, with a fresh va_list
+	char* longBuf = malloc(ret + 1);
+	if (longBuf == NULL) {
+		return;
+	}
+
+	va_start(args, fmt);
+	vsnprintf(longBuf, ret + 1, fmt, args);
+	va_end(args);
+
+	drawString(dsi, longBuf);
+	free(longBuf);
+}
+
+void (*placementHook)(const struct Placement* placement) = NULL;
+
+void resetGame(Uint32 seed) {
+	memset(&board, 0, sizeof(board));
+	changedRows = (1 << BLOCKS_Y) - 1;
+	memset(&currentBlock, 0, sizeof(currentBlock));
 
-		if (buf == NULL) {
-			bufSize = 4;
-			buf = malloc(bufSize);
+	lines = 0;
+	level = 1;
+	finesseFaults = 0;
+	gravityProgress = 0;
+	lockTimer = LOCK_DELAY_TICKS;
+	lockResets = 0;
+	lowestY = 0;
+
+	memset(bagUsed, 0, sizeof(bagUsed));
+	pieceQueueInitialised = false;
+	pieceHeld = false;
+	canHold = true;
+
+	gameState = GAME_RUN;
+	unpausing = false;
+	lineCount = 0;
+	clearTimer = CLEAR_TIMER_LENGTH;
+
+	time = 0;
+	lastTime = 0;
+	dt = 0;
+	buttons = 0;
+	lastButtons = 0;
+	lastLeft = 0;
+	lastRight = 0;
+	lastDown = 0;
+	lastRotR = 0;
+	lastRotL = 0;
+
+	seedRandom(seed);
+	resetHistory();
+
+	selectPiece();
+	recordCheckpoint();
+}
+
+void seedRandom(Uint32 seed) {
+	// xorshift32 gets stuck on a zero state
+	rngState = seed != 0 ? seed : 0x9e3779b9;
+}
+
+Uint32 nextRandom() {
+	Uint32 x = rngState;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	rngState = x;
+	return x;
+}
+
+void packRow(int y, Uint16* solid, Uint32* pieces, Uint16* high) {
+	*solid = 0;
+	*pieces = 0;
+	if (high != NULL) {
+		*high = 0;
+	}
+
+	for (int x = 0; x < BLOCKS_X; x++) {
+		int cell = ROW_CELL(board.rows[y], x);
+		if (cell != CELL_EMPTY) {
+			int type = cell - PIECE_CELL(0);
+			*solid |= 1 << x;
+			*pieces |= (Uint32)(type & 7) << (3 * x);
+			if (high != NULL) {
+				*high |= (type >> 3) << x;
+			}
+		}
+	}
+}
+
+void unpackRow(int y, Uint16 solid, Uint32 pieces, Uint16 high) {
+	Uint64 row = 0;
+	for (int x = 0; x < BLOCKS_X; x++) {
+		if ((solid >> x) & 1) {
+			enum PieceType type = ((pieces >> (3 * x)) & 7) | (((high >> x) & 1) << 3);
+			if (type >= pieceSet.count) {
+				type = O_PIECE;
+			}
+			row |= (Uint64)PIECE_CELL(type) << (CELL_BITS * x);
+		}
+	}
+	board.rows[y] = row;
+
+	changedRows |= 1 << y;
+}
+
+SDL_COMPILE_TIME_ASSERT(snapshotSize, sizeof(struct GameSnapshot) == 240);
+
+void saveSnapshot(struct GameSnapshot* snap) {
+	memset(snap, 0, sizeof(*snap));
+
+	snap->magic = SNAPSHOT_MAGIC;
+	snap->version = SNAPSHOT_VERSION;
+	snap->size = sizeof(*snap);
+
+	for (int y = 0; y < BLOCKS_Y; y++) {
+		packRow(y, &snap->solid[y], &snap->pieces[y], &snap->piecesHigh[y]);
+	}
+
+	snap->rngState = rngState;
+	snap->lines = lines;
+	snap->level = level;
+	snap->gravityProgress = gravityProgress;
+	snap->lockResets = lockResets;
+	snap->lockTimer = lockTimer;
+	snap->unpauseTimer = unpauseTimer;
+
+	snap->leftAge = time - lastLeft;
+	snap->rightAge = time - lastRight;
+	snap->downAge = time - lastDown;
+	snap->rotRAge = time - lastRotR;
+	snap->rotLAge = time - lastRotL;
+
+	for (int i = 0; i < QUEUE_LENGTH; i++) {
+		snap->pieceQueue[i] = pieceQueue[i];
+	}
+	snap->type = currentBlock.type;
+	snap->rotation = currentBlock.rotation;
+	snap->x = currentBlock.x;
+	snap->y = currentBlock.y;
+	snap->heldPieceType = heldPieceType;
+
+	for (int i = 0; i < pieceSet.count; i++) {
+		if (bagUsed[i]) {
+			if (i < 8) {
+				snap->bagUsed |= 1 << i;
+			}
+			else {
+				snap->bagUsedHigh |= 1 << (i - 8);
+			}
 		}
-		int ret = vsnprintf(buf, bufSize, fmt, args);
-		if (ret > bufSize) {
-			bufSize = ret + 1;
-			buf = realloc(buf, bufSize);
+	}
+
+	snap->gameState = gameState;
+	snap->flags =
+		(pieceHeld ? SNAPSHOT_PIECE_HELD : 0) |
+		(canHold ? SNAPSHOT_CAN_HOLD : 0) |
+		(unpausing ? SNAPSHOT_UNPAUSING : 0) |
+		(pieceQueueInitialised ? SNAPSHOT_QUEUE_INITIALISED : 0);
+
+	snap->lineCount = lineCount;
+	for (int i = 0; i < lineCount; i++) {
+		if (i < 4) {
+			snap->linesToClear[i] = linesToClear[i];
 		}
 		else {
-			drawString(dsi, buf);
-			return;
+			snap->moreLinesToClear[i - 4] = linesToClear[i];
 		}
+	}
+	snap->clearTimer = clearTimer;
+	snap->unpauseCounter = unpauseCounter;
+	snap->lowestY = lowestY;
+}
+
+bool loadSnapshot(const struct GameSnapshot* src) {
+	if (src->magic != SNAPSHOT_MAGIC || src->size < offsetof(struct GameSnapshot, lowestY)) {
+		return false;
+	}
 
-		va_end(args);
+	// Fields unknown to the writer keep the values of a fresh snapshot
+	struct GameSnapshot snap;
+	saveSnapshot(&snap);
+	memcpy(&snap, src, SDL_min(src->size, sizeof(snap)));
+
+	if (snap.version < 3) {
+		// Written when only the standard pieces existed
+		memset(snap.piecesHigh, 0, sizeof(snap.piecesHigh));
+		snap.bagUsedHigh = 0;
+	}
+
+	if (snap.lineCount > MAX_PIECE_SIZE || snap.gameState > GAME_OVER || snap.rotation > 3) {
+		return false;
+	}
+
+	// The lines to clear and the current piece index the board, so a corrupt
+	// file mustn't put them outside it. The piece may stick out above the top,
+	// as it can in play.
+	for (int i = 0; i < snap.lineCount; i++) {
+		if ((i < 4 ? snap.linesToClear[i] : snap.moreLinesToClear[i - 4]) >= BLOCKS_Y) {
+			return false;
+		}
+	}
+
+	const struct PieceRotation* shape = &pieceSet.pieces[snap.type % pieceSet.count].rotations[snap.rotation];
+	if (snap.x + shape->left < 0 || snap.x + shape->right >= BLOCKS_X || snap.y + shape->bottom < 0 || snap.y + shape->bottom >= BLOCKS_Y) {
+		return false;
+	}
+
+	for (int y = 0; y < BLOCKS_Y; y++) {
+		unpackRow(y, snap.solid[y], snap.pieces[y], snap.piecesHigh[y]);
+	}
+
+	rngState = snap.rngState;
+	lines = snap.lines;
+	level = snap.level;
+	if (snap.version < 2) {
+		// Version 1 only had the placement timer in milliseconds worth carrying over
+		gravityProgress = 0;
+		lockResets = 0;
+		lockTimer = SDL_max(snap.lockTimer / TICK_LENGTH, 1);
+	}
+	else {
+		gravityProgress = snap.gravityProgress;
+		lockResets = snap.lockResets;
+		lockTimer = snap.lockTimer;
 	}
-}
\ No newline at end of file
+	unpauseTimer = snap.unpauseTimer;
+
+	lastLeft = time - snap.leftAge;
+	lastRight = time - snap.rightAge;
+	lastDown = time - snap.downAge;
+	lastRotR = time - snap.rotRAge;
+	lastRotL = time - snap.rotLAge;
+
+	for (int i = 0; i < QUEUE_LENGTH; i++) {
+		pieceQueue[i] = snap.pieceQueue[i] % pieceSet.count;
+	}
+	currentBlock.type = snap.type % pieceSet.count;
+	currentBlock.rotation = snap.rotation;
+	currentBlock.x = snap.x;
+	currentBlock.y = snap.y;
+	currentBlock.dx = 0;
+	currentBlock.dy = 0;
+	currentBlock.dr = 0;
+	spawnCount++;
+	heldPieceType = snap.heldPieceType % pieceSet.count;
+
+	for (int i = 0; i < pieceSet.count; i++) {
+		bagUsed[i] = i < 8 ? (snap.bagUsed >> i) & 1 : (snap.bagUsedHigh >> (i - 8)) & 1;
+	}
+
+	gameState = snap.gameState;
+	pieceHeld = snap.flags & SNAPSHOT_PIECE_HELD;
+	canHold = snap.flags & SNAPSHOT_CAN_HOLD;
+	unpausing = snap.flags & SNAPSHOT_UNPAUSING;
+	pieceQueueInitialised = snap.flags & SNAPSHOT_QUEUE_INITIALISED;
+
+	lineCount = snap.lineCount;
+	for (int i = 0; i < lineCount; i++) {
+		linesToClear[i] = i < 4 ? snap.linesToClear[i] : snap.moreLinesToClear[i - 4];
+	}
+	clearTimer = snap.clearTimer;
+	unpauseCounter = snap.unpauseCounter;
+	lowestY = snap.version < 2 ? currentBlock.y : snap.lowestY;
+
+	return true;
+}
+
+bool writeSnapshotFile(const char* path) {
+	struct GameSnapshot snap;
+	saveSnapshot(&snap);
+
+	SDL_RWops* file = SDL_RWFromFile(path, "wb");
+	if (file == NULL) {
+		printf("Failed to open %s: %s\n", path, SDL_GetError());
+		return false;
+	}
+
+	bool success = SDL_RWwrite(file, &snap, sizeof(snap), 1) == 1;
+	SDL_RWclose(file);
+
+	return success;
+}
+
+bool readSnapshotFile(const char* path) {
+	SDL_RWops* file = SDL_RWFromFile(path, "rb");
+	if (file == NULL) {
+		printf("Failed to open %s: %s\n", path, SDL_GetError());
+		return false;
+	}
+
+	// Snapshots written by a newer version may be longer, only read the part we understand
+	struct GameSnapshot snap = { 0 };
+	size_t read = SDL_RWread(file, &snap, 1, sizeof(snap));
+	SDL_RWclose(file);
+
+	if (read < snap.size && read < sizeof(snap)) {
+		printf("Snapshot %s is truncated\n", path);
+		return false;
+	}
+
+	if (!loadSnapshot(&snap)) {
+		printf("Snapshot %s is not valid\n", path);
+		return false;
+	}
+
+	return true;
+}
+
+struct Checkpoint history[HISTORY_CHECKPOINTS];
+Uint8 historyData[HISTORY_BYTES];
+
+// The board as of the current checkpoint
+Uint64 historyRows[BLOCKS_Y];
+
+void writeHistoryRow(Uint8* data, Uint64 row) {
+	for (int i = 0; i < HISTORY_ROW_BYTES; i++) {
+		data[i] = (Uint8)(row >> (8 * i));
+	}
+}
+
+Uint64 readHistoryRow(const Uint8* data) {
+	Uint64 row = 0;
+	for (int i = 0; i < HISTORY_ROW_BYTES; i++) {
+		row |= (Uint64)data[i] << (8 * i);
+	}
+	return row;
+}
+
+// Put a row of historyRows back on the board
+void restoreHistoryRow(int y) {
+	board.rows[y] = historyRows[y];
+	changedRows |= 1 << y;
+}
+
+struct Checkpoint* checkpointAt(int pos) {
+	return &history[(historyFirst + pos) % HISTORY_CHECKPOINTS];
+}
+
+void resetHistory() {
+	historyFirst = 0;
+	historyCount = 0;
+	historyPos = -1;
+	historyWrite = 0;
+
+	// Everything differs from an empty board
+	memset(historyRows, 0, sizeof(historyRows));
+	dirtyRows = (1u << BLOCKS_Y) - 1;
+}
+
+Uint32 checkpointSize(const struct Checkpoint* cp) {
+	return cp->deltaRows * HISTORY_DELTA_SIZE + (cp->keyframe ? HISTORY_KEYFRAME_SIZE : 0);
+}
+
+void evictOldest() {
+	historyFirst = (historyFirst + 1) % HISTORY_CHECKPOINTS;
+	historyCount--;
+	historyPos--;
+}
+
+// Drop the oldest checkpoint if its rows overlap [offset, offset + size)
+bool evictOverlapping(Uint32 offset, Uint32 size) {
+	if (historyCount == 0) {
+		return false;
+	}
+
+	struct Checkpoint* oldest = checkpointAt(0);
+	Uint32 oldestEnd = oldest->offset + checkpointSize(oldest);
+	if (oldest->offset >= offset + size || oldestEnd <= offset) {
+		return false;
+	}
+
+	evictOldest();
+	return true;
+}
+
+void recordCheckpoint() {
+	if (!historyEnabled) {
+		return;
+	}
+
+	// Playing on after a rewind replaces the old future
+	if (historyPos + 1 < historyCount) {
+		historyCount = historyPos + 1;
+		if (historyCount > 0) {
+			struct Checkpoint* current = checkpointAt(historyPos);
+			historyWrite = current->offset + checkpointSize(current);
+		}
+	}
+
+	Uint8 rows[BLOCKS_Y * HISTORY_DELTA_SIZE + HISTORY_KEYFRAME_SIZE];
+	Uint32 size = 0;
+	int deltaRows = 0;
+
+	for (int y = 0; y < BLOCKS_Y; y++) {
+		if (!(dirtyRows & (1 << y))) {
+			continue;
+		}
+
+		Uint64 delta = board.rows[y] ^ historyRows[y];
+		if (delta == 0) {
+			continue;
+		}
+
+		historyRows[y] = board.rows[y];
+
+		rows[size] = y;
+		writeHistoryRow(&rows[size + 1], delta);
+		size += HISTORY_DELTA_SIZE;
+		deltaRows++;
+	}
+	dirtyRows = 0;
+
+	int index = historyFirst + historyCount;
+	bool keyframe = index % HISTORY_KEYFRAME_INTERVAL == 0;
+	if (keyframe) {
+		for (int y = 0; y < BLOCKS_Y; y++) {
+			writeHistoryRow(&rows[size], historyRows[y]);
+			size += HISTORY_ROW_BYTES;
+		}
+	}
+
+	if (historyCount == HISTORY_CHECKPOINTS) {
+		evictOldest();
+	}
+
+	if (historyWrite + size > HISTORY_BYTES) {
+		// Whatever lies between here and the end is older than what is at the start
+		while (historyCount > 0 && checkpointAt(0)->offset >= historyWrite) {
+			evictOldest();
+		}
+		historyWrite = 0;
+	}
+	while (evictOverlapping(historyWrite, size));
+
+	struct Checkpoint* cp = checkpointAt(historyCount);
+	cp->offset = historyWrite;
+	cp->deltaRows = deltaRows;
+	cp->keyframe = keyframe;
+
+	cp->rngState = rngState;
+	cp->lines = lines;
+	cp->level = level;
+	for (int i = 0; i < QUEUE_LENGTH; i++) {
+		cp->pieceQueue[i] = pieceQueue[i];
+	}
+	cp->type = currentBlock.type;
+	cp->heldPieceType = heldPieceType;
+	cp->bagUsed = 0;
+	for (int i = 0; i < pieceSet.count; i++) {
+		if (bagUsed[i]) {
+			cp->bagUsed |= 1 << i;
+		}
+	}
+	cp->pieceHeld = pieceHeld;
+
+	memcpy(&historyData[historyWrite], rows, size);
+	historyWrite += size;
+
+	historyCount++;
+	historyPos = historyCount - 1;
+}
+
+// XOR a checkpoint's row deltas into the board. Applying it twice undoes it.
+void applyCheckpointDelta(const struct Checkpoint* cp) {
+	const Uint8* rows = &historyData[cp->offset];
+
+	for (int i = 0; i < cp->deltaRows; i++) {
+		int y = rows[0];
+		historyRows[y] ^= readHistoryRow(&rows[1]);
+		restoreHistoryRow(y);
+
+		rows += HISTORY_DELTA_SIZE;
+	}
+}
+
+// Restore everything but the board to how it was when the checkpoint was taken
+void restoreCheckpoint(const struct Checkpoint* cp) {
+	if (cp->keyframe) {
+		const Uint8* rows = &historyData[cp->offset + cp->deltaRows * HISTORY_DELTA_SIZE];
+
+		for (int y = 0; y < BLOCKS_Y; y++) {
+			historyRows[y] = readHistoryRow(rows);
+			restoreHistoryRow(y);
+			rows += HISTORY_ROW_BYTES;
+		}
+	}
+
+	rngState = cp->rngState;
+	lines = cp->lines;
+	level = cp->level;
+	for (int i = 0; i < QUEUE_LENGTH; i++) {
+		pieceQueue[i] = cp->pieceQueue[i];
+	}
+	for (int i = 0; i < pieceSet.count; i++) {
+		bagUsed[i] = (cp->bagUsed >> i) & 1;
+	}
+	heldPieceType = cp->heldPieceType;
+	pieceHeld = cp->pieceHeld;
+	canHold = true;
+
+	currentBlock.x = BLOCKS_X / 2 - 1;
+	currentBlock.y = 0;
+	currentBlock.rotation = 0;
+	currentBlock.type = cp->type;
+	currentBlock.dx = 0;
+	currentBlock.dy = 0;
+	currentBlock.dr = 0;
+	spawnCount++;
+
+	gravityProgress = 0;
+	resetLockDelay();
+	lineCount = 0;
+	clearTimer = CLEAR_TIMER_LENGTH;
+	unpausing = false;
+}
+
+bool rewindPiece() {
+	if (historyPos <= 0) {
+		return false;
+	}
+
+	applyCheckpointDelta(checkpointAt(historyPos));
+	historyPos--;
+	restoreCheckpoint(checkpointAt(historyPos));
+
+	return true;
+}
+
+bool replayPiece() {
+	if (historyPos + 1 >= historyCount) {
+		return false;
+	}
+
+	historyPos++;
+	applyCheckpointDelta(checkpointAt(historyPos));
+	restoreCheckpoint(checkpointAt(historyPos));
+
+	return true;
+}
@@ -0,0 +1,75 @@
+#include <stdio.h>
+
+#include "mapfile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+const void* mapFile(const char* path, size_t* size) {
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) {
+		printf("Failed to open %s\n", path);
+		return NULL;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+		CloseHandle(file);
+		return NULL;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (mapping == NULL) {
+		printf("Failed to map %s\n", path);
+		return NULL;
+	}
+
+	// The view keeps the mapping alive
+	const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+
+	*size = (size_t)fileSize.QuadPart;
+	return data;
+}
+
+void unmapFile(const void* data, size_t size) {
+	UnmapViewOfFile(data);
+}
+
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+const void* mapFile(const char* path, size_t* size) {
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		printf("Failed to open %s\n", path);
+		return NULL;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size == 0) {
+		close(fd);
+		return NULL;
+	}
+
+	void* data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		printf("Failed to map %s\n", path);
+		return NULL;
+	}
+
+	*size = st.st_size;
+	return data;
+}
+
+void unmapFile(const void* data, size_t size) {
+	munmap((void*)data, size);
+}
+
+#endif
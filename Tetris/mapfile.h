@@ -0,0 +1,7 @@
+#pragma once
+
+#include <stddef.h>
+
+// Map a whole file read-only into memory. Returns NULL if it can't be opened.
+const void* mapFile(const char* path, size_t* size);
+void unmapFile(const void* data, size_t size);
@@ -0,0 +1,1026 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mapfile.h"
+#include "pcsolver.h"
+
+SDL_COMPILE_TIME_ASSERT(pcTableHeaderSize, sizeof(struct PcTableHeader) == 24);
+SDL_COMPILE_TIME_ASSERT(pcTableEntrySize, sizeof(struct PcTableEntry) == 24);
+
+static const char PIECE_LETTERS[] = "OITLJSZ";
+
+// Columns 0, 2, 4, 6 and 8 of a row
+#define EVEN_COLUMNS 0x155
+
+// How far one piece can tip the balance between empty cells in even and odd
+// columns. L and J always cover one parity three times, T and I only when
+// standing up, and O, S and Z never.
+static const int COLUMN_SPREAD[NUM_BLOCKS] = { 0, 4, 2, 2, 2, 0, 0 };
+
+// A rotation as a field mask with its bottom left cell at bit 0
+struct FieldShape {
+	Uint64 mask;
+	int width;
+	int height;
+
+	// False if an earlier rotation has the same shape
+	bool distinct;
+};
+
+static struct FieldShape fieldShapes[NUM_BLOCKS][4];
+static bool solverInitialised = false;
+
+static void initSolver() {
+	if (solverInitialised) {
+		return;
+	}
+
+	initEngine();
+
+	for (int type = 0; type < NUM_BLOCKS; type++) {
+		for (int rotation = 0; rotation < 4; rotation++) {
+			const struct PieceShape* piece = &PIECE_SHAPES[type][rotation];
+			struct FieldShape* shape = &fieldShapes[type][rotation];
+
+			shape->mask = 0;
+			shape->width = piece->right - piece->left + 1;
+			shape->height = piece->bottom - piece->top + 1;
+
+			for (int i = piece->top; i <= piece->bottom; i++) {
+				Uint64 row = piece->rows[i] >> piece->left;
+				shape->mask |= row << ((piece->bottom - i) * BLOCKS_X);
+			}
+
+			shape->distinct = true;
+			for (int other = 0; other < rotation; other++) {
+				if (fieldShapes[type][other].mask == shape->mask) {
+					shape->distinct = false;
+				}
+			}
+		}
+	}
+
+	solverInitialised = true;
+}
+
+static int countBits(Uint64 bits) {
+	int count = 0;
+	while (bits != 0) {
+		bits &= bits - 1;
+		count++;
+	}
+	return count;
+}
+
+static Uint16 fieldRow(Uint64 board, int row) {
+	return (board >> (row * BLOCKS_X)) & FULL_ROW;
+}
+
+// Rows count up from the bottom of the field, which is the bottom of the board
+struct Node {
+	Uint64 board;
+	Uint8 height;
+
+	// Index of the current piece in the sequence
+	Uint8 next;
+	Uint8 held;
+	bool canHold;
+};
+
+struct Search {
+	enum PieceType sequence[PC_MAX_PIECES];
+	int length;
+
+	SDL_atomic_t found;
+	struct PcSolution solution;
+
+	// Tasks queued or running on any worker
+	SDL_atomic_t pending;
+	struct Worker* workers;
+	int workerCount;
+};
+
+// Subtrees this close to the root are queued as tasks for other workers to
+// steal. Anything deeper is searched on the spot.
+#define SPLIT_DEPTH 2
+#define DEQUE_SIZE 4096
+
+// Visited positions that led nowhere, per worker so the table needs no locking
+#define MEMO_BITS 18
+#define MEMO_SIZE (1 << MEMO_BITS)
+#define MEMO_PROBES 8
+
+struct MemoEntry {
+	Uint64 board;
+	Uint32 state;
+
+	// Entries from earlier searches are stale, which saves clearing the table
+	Uint32 generation;
+};
+
+struct Task {
+	struct Node node;
+	int depth;
+	struct PcStep path[PC_MAX_PIECES];
+};
+
+struct Worker {
+	struct Search* search;
+	int index;
+
+	struct MemoEntry* memo;
+	Uint32 generation;
+
+	// The owner takes from the tail, thieves from the head, where the bigger subtrees are
+	struct Task* tasks;
+	Uint32 head;
+	Uint32 tail;
+	SDL_SpinLock lock;
+
+	Uint32 rngState;
+	Uint64 nodes;
+};
+
+static bool initWorker(struct Worker* worker, struct Search* search, int index) {
+	memset(worker, 0, sizeof(*worker));
+	worker->search = search;
+	worker->index = index;
+	worker->rngState = 0x9e3779b9 * (index + 1);
+	worker->memo = calloc(MEMO_SIZE, sizeof(struct MemoEntry));
+	worker->tasks = malloc(DEQUE_SIZE * sizeof(struct Task));
+	return worker->memo != NULL && worker->tasks != NULL;
+}
+
+static void freeWorker(struct Worker* worker) {
+	free(worker->memo);
+	free(worker->tasks);
+}
+
+static Uint32 nodeState(const struct Node* node) {
+	return node->height | node->next << 3 | node->held << 8 | node->canHold << 11;
+}
+
+static struct MemoEntry* memoSlot(struct Worker* worker, const struct Node* node, bool* present) {
+	Uint32 state = nodeState(node);
+	Uint64 hash = (node->board ^ (Uint64)state << 60 ^ state) * 0x9e3779b97f4a7c15;
+	Uint32 index = (Uint32)(hash >> (64 - MEMO_BITS));
+
+	// Linear probing. If every probe is taken, the first gets overwritten.
+	struct MemoEntry* first = &worker->memo[index];
+	for (int i = 0; i < MEMO_PROBES; i++) {
+		struct MemoEntry* entry = &worker->memo[(index + i) & (MEMO_SIZE - 1)];
+
+		if (entry->generation != worker->generation) {
+			*present = false;
+			return entry;
+		}
+		if (entry->board == node->board && entry->state == state) {
+			*present = true;
+			return entry;
+		}
+	}
+
+	*present = false;
+	return first;
+}
+
+static bool memoContains(struct Worker* worker, const struct Node* node) {
+	bool present;
+	memoSlot(worker, node, &present);
+	return present;
+}
+
+static void memoInsert(struct Worker* worker, const struct Node* node) {
+	bool present;
+	struct MemoEntry* entry = memoSlot(worker, node, &present);
+	entry->board = node->board;
+	entry->state = nodeState(node);
+	entry->generation = worker->generation;
+}
+
+// Empty cells with something above them can't be reached by dropping a piece
+static bool hasCoveredCells(Uint64 board, int height) {
+	Uint16 above = 0;
+	for (int row = height - 1; row >= 0; row--) {
+		Uint16 bits = fieldRow(board, row);
+		if (above & ~bits) {
+			return true;
+		}
+		above |= bits;
+	}
+	return false;
+}
+
+static Uint64 clearFullRows(Uint64 board, int* height) {
+	for (int row = *height - 1; row >= 0; row--) {
+		if (fieldRow(board, row) == FULL_ROW) {
+			Uint64 below = ((Uint64)1 << (row * BLOCKS_X)) - 1;
+			board = (board & below) | ((board >> BLOCKS_X) & ~below);
+			(*height)--;
+		}
+	}
+	return board;
+}
+
+static bool parityPossible(int imbalance, const enum PieceType* candidates, int count, int needed) {
+	int spread = 0;
+	for (int i = 0; i < count; i++) {
+		spread += COLUMN_SPREAD[candidates[i]];
+	}
+	if (SDL_abs(imbalance) > spread || (imbalance & 1)) {
+		return false;
+	}
+
+	// Every piece changes the imbalance by a multiple of 2. L and J change it by
+	// an odd multiple, so without a T to make up the difference, their count
+	// has to match half the imbalance. One candidate may be left over in hold.
+	for (int skip = count > needed ? 0 : -1; skip < count; skip++) {
+		int lj = 0;
+		int t = 0;
+
+		for (int i = 0; i < count; i++) {
+			if (i != skip) {
+				lj += candidates[i] == L_PIECE || candidates[i] == J_PIECE;
+				t += candidates[i] == T_PIECE;
+			}
+		}
+
+		if (t > 0 || ((imbalance / 2 - lj) & 1) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Whether the rest of the field could still be filled with the pieces to come
+static bool feasible(const struct Search* search, const struct Node* node) {
+	int filled[BLOCKS_X] = { 0 };
+	Uint16 fullColumns = FULL_ROW;
+
+	for (int row = 0; row < node->height; row++) {
+		Uint16 bits = fieldRow(node->board, row);
+		fullColumns &= bits;
+
+		for (int x = 0; x < BLOCKS_X; x++) {
+			filled[x] += (bits >> x) & 1;
+		}
+	}
+
+	// With nothing covered, a full column is a wall no piece can cross, even
+	// after rows clear, so each side has to take whole pieces.
+	int empty = 0;
+	int segment = 0;
+	int imbalance = 0;
+	for (int x = 0; x < BLOCKS_X; x++) {
+		if (fullColumns & (1 << x)) {
+			if (segment % 4 != 0) {
+				return false;
+			}
+			segment = 0;
+		}
+
+		int cells = node->height - filled[x];
+		segment += cells;
+		empty += cells;
+		imbalance += (EVEN_COLUMNS & (1 << x)) ? cells : -cells;
+	}
+	if (segment % 4 != 0) {
+		return false;
+	}
+
+	// Any of the held piece and the next ones could be used, but only one can be left over
+	int needed = empty / 4;
+	enum PieceType candidates[PC_MAX_PIECES + 1];
+	int count = 0;
+
+	if (node->held != NO_PIECE) {
+		candidates[count++] = node->held;
+	}
+	for (int i = node->next; i < search->length && count <= needed; i++) {
+		candidates[count++] = search->sequence[i];
+	}
+
+	return count >= needed && parityPossible(imbalance, candidates, count, needed);
+}
+
+static bool foundSolution(struct Search* search, const struct PcStep* path, int length) {
+	if (SDL_AtomicCAS(&search->found, 0, 1)) {
+		memcpy(search->solution.steps, path, length * sizeof(struct PcStep));
+		search->solution.length = length;
+	}
+	return true;
+}
+
+typedef bool (*ChildCallback)(struct Worker* worker, const struct Node* child, const struct PcStep* step, void* data);
+
+// Calls back with every position the current piece, or the held one, can
+// leave. Stops and returns true as soon as the callback does.
+static bool expand(struct Worker* worker, const struct Node* node, ChildCallback callback, void* data) {
+	const struct Search* search = worker->search;
+	if (node->next >= search->length) {
+		return false;
+	}
+
+	struct {
+		bool hold;
+		enum PieceType type;
+		int next;
+		int held;
+	} options[2];
+	int optionCount = 0;
+
+	enum PieceType current = search->sequence[node->next];
+	options[optionCount].hold = false;
+	options[optionCount].type = current;
+	options[optionCount].next = node->next + 1;
+	options[optionCount].held = node->held;
+	optionCount++;
+
+	if (node->canHold) {
+		// Swapping a piece for the same type changes nothing
+		if (node->held != NO_PIECE && node->held != current) {
+			options[optionCount].hold = true;
+			options[optionCount].type = node->held;
+			options[optionCount].next = node->next + 1;
+			options[optionCount].held = current;
+			optionCount++;
+		}
+		else if (node->held == NO_PIECE && node->next + 1 < search->length) {
+			options[optionCount].hold = true;
+			options[optionCount].type = search->sequence[node->next + 1];
+			options[optionCount].next = node->next + 2;
+			options[optionCount].held = current;
+			optionCount++;
+		}
+	}
+
+	for (int i = 0; i < optionCount; i++) {
+		for (int rotation = 0; rotation < 4; rotation++) {
+			const struct FieldShape* shape = &fieldShapes[options[i].type][rotation];
+			if (!shape->distinct || shape->height > node->height) {
+				continue;
+			}
+
+			for (int x = 0; x + shape->width <= BLOCKS_X; x++) {
+				int y = node->height - shape->height;
+				Uint64 piece = shape->mask << (y * BLOCKS_X + x);
+				if (piece & node->board) {
+					continue;
+				}
+
+				while (y > 0 && !((piece >> BLOCKS_X) & node->board)) {
+					piece >>= BLOCKS_X;
+					y--;
+				}
+
+				Uint64 filled = node->board | piece;
+				if (hasCoveredCells(filled, node->height)) {
+					continue;
+				}
+
+				int height = node->height;
+				struct Node child;
+				child.board = clearFullRows(filled, &height);
+				child.height = height;
+				child.next = options[i].next;
+				child.held = options[i].held;
+				child.canHold = true;
+
+				if (child.board != 0 && !feasible(search, &child)) {
+					continue;
+				}
+
+				struct PcStep step = { options[i].hold, options[i].type, rotation, x };
+				if (callback(worker, &child, &step, data)) {
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+static bool searchNode(struct Worker* worker, const struct Node* node, struct PcStep* path, int depth);
+
+struct DepthFirst {
+	struct PcStep* path;
+	int depth;
+};
+
+static bool visitChild(struct Worker* worker, const struct Node* child, const struct PcStep* step, void* data) {
+	struct DepthFirst* context = data;
+	context->path[context->depth] = *step;
+	return searchNode(worker, child, context->path, context->depth + 1);
+}
+
+static bool searchNode(struct Worker* worker, const struct Node* node, struct PcStep* path, int depth) {
+	struct Search* search = worker->search;
+
+	if (node->board == 0 && depth > 0) {
+		return foundSolution(search, path, depth);
+	}
+
+	// Another worker has already finished
+	if (SDL_AtomicGet(&search->found)) {
+		return true;
+	}
+
+	worker->nodes++;
+	if (memoContains(worker, node)) {
+		return false;
+	}
+
+	struct DepthFirst context = { path, depth };
+	if (expand(worker, node, visitChild, &context)) {
+		return true;
+	}
+
+	memoInsert(worker, node);
+	return false;
+}
+
+static bool pushTask(struct Worker* worker, const struct Task* task) {
+	SDL_AtomicLock(&worker->lock);
+
+	bool pushed = worker->tail - worker->head < DEQUE_SIZE;
+	if (pushed) {
+		worker->tasks[worker->tail % DEQUE_SIZE] = *task;
+		worker->tail++;
+		SDL_AtomicAdd(&worker->search->pending, 1);
+	}
+
+	SDL_AtomicUnlock(&worker->lock);
+	return pushed;
+}
+
+static bool popTask(struct Worker* worker, struct Task* task) {
+	SDL_AtomicLock(&worker->lock);
+
+	bool popped = worker->tail != worker->head;
+	if (popped) {
+		worker->tail--;
+		*task = worker->tasks[worker->tail % DEQUE_SIZE];
+	}
+
+	SDL_AtomicUnlock(&worker->lock);
+	return popped;
+}
+
+static bool stealTask(struct Worker* thief, struct Task* task) {
+	struct Search* search = thief->search;
+
+	// Start from a random victim so thieves spread out
+	Uint32 x = thief->rngState;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	thief->rngState = x;
+
+	for (int i = 0; i < search->workerCount; i++) {
+		struct Worker* victim = &search->workers[(x + i) % search->workerCount];
+		if (victim == thief) {
+			continue;
+		}
+
+		SDL_AtomicLock(&victim->lock);
+
+		bool stolen = victim->tail != victim->head;
+		if (stolen) {
+			*task = victim->tasks[victim->head % DEQUE_SIZE];
+			victim->head++;
+		}
+
+		SDL_AtomicUnlock(&victim->lock);
+
+		if (stolen) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool queueChild(struct Worker* worker, const struct Node* child, const struct PcStep* step, void* data) {
+	const struct Task* parent = data;
+
+	struct Task task;
+	task.node = *child;
+	task.depth = parent->depth + 1;
+	memcpy(task.path, parent->path, parent->depth * sizeof(struct PcStep));
+	task.path[parent->depth] = *step;
+
+	if (child->board == 0) {
+		return foundSolution(worker->search, task.path, task.depth);
+	}
+
+	// With the deque full, there's plenty for everyone else already
+	if (!pushTask(worker, &task)) {
+		return searchNode(worker, &task.node, task.path, task.depth);
+	}
+	return false;
+}
+
+static void runTask(struct Worker* worker, struct Task* task) {
+	if (task->depth < SPLIT_DEPTH) {
+		worker->nodes++;
+		expand(worker, &task->node, queueChild, task);
+	}
+	else {
+		searchNode(worker, &task->node, task->path, task->depth);
+	}
+}
+
+static int searchThread(void* data) {
+	struct Worker* worker = data;
+	struct Search* search = worker->search;
+	struct Task task;
+
+	while (!SDL_AtomicGet(&search->found)) {
+		if (popTask(worker, &task) || stealTask(worker, &task)) {
+			runTask(worker, &task);
+			SDL_AtomicAdd(&search->pending, -1);
+		}
+		else if (SDL_AtomicGet(&search->pending) == 0) {
+			break;
+		}
+		else {
+			SDL_Delay(0);
+		}
+	}
+
+	return 0;
+}
+
+static Uint64 fieldFromBoard(const struct Bitboard* board, int maxLines, bool* fits) {
+	Uint64 field = 0;
+	*fits = true;
+
+	for (int row = 0; row < BLOCKS_Y; row++) {
+		Uint16 bits = board->rows[BLOCKS_Y - 1 - row];
+		if (bits != 0) {
+			if (row >= maxLines) {
+				*fits = false;
+				return 0;
+			}
+			field |= (Uint64)bits << (row * BLOCKS_X);
+		}
+	}
+
+	return field;
+}
+
+static void setSequence(struct Search* search, const enum PieceType* sequence, int length) {
+	search->length = SDL_min(length, PC_MAX_PIECES);
+	memcpy(search->sequence, sequence, search->length * sizeof(enum PieceType));
+}
+
+void pcProblemFromGame(struct PcProblem* problem, int maxLines) {
+	memset(problem, 0, sizeof(*problem));
+	readBoardRows(&problem->board, 0, BLOCKS_Y - 1);
+
+	problem->sequence[problem->length++] = currentBlock.type;
+	for (int i = 0; i < QUEUE_LENGTH; i++) {
+		problem->sequence[problem->length++] = pieceQueue[i];
+	}
+
+	// With one piece left in the bag, it's certain to come next
+	int remaining = 0;
+	enum PieceType last = O_PIECE;
+	for (int i = 0; i < NUM_BLOCKS; i++) {
+		if (!bagUsed[i]) {
+			remaining++;
+			last = i;
+		}
+	}
+	if (remaining == 1) {
+		problem->sequence[problem->length++] = last;
+	}
+
+	problem->held = pieceHeld ? heldPieceType : NO_PIECE;
+	problem->canHold = canHold;
+	problem->maxLines = maxLines;
+}
+
+static Uint64 lastSearchNodes;
+
+bool solvePerfectClear(const struct PcProblem* problem, int threadCount, struct PcSolution* solution) {
+	initSolver();
+
+	int maxLines = SDL_max(SDL_min(problem->maxLines, PC_MAX_LINES), 1);
+	threadCount = SDL_max(threadCount, 1);
+	lastSearchNodes = 0;
+
+	bool fits;
+	Uint64 field = fieldFromBoard(&problem->board, maxLines, &fits);
+	if (!fits) {
+		return false;
+	}
+
+	struct Search* search = calloc(1, sizeof(struct Search));
+	struct Worker* workers = calloc(threadCount, sizeof(struct Worker));
+	SDL_Thread** threads = calloc(threadCount, sizeof(SDL_Thread*));
+	bool ready = search != NULL && workers != NULL && threads != NULL;
+
+	if (ready) {
+		setSequence(search, problem->sequence, problem->length);
+		search->workers = workers;
+		search->workerCount = threadCount;
+
+		for (int i = 0; i < threadCount; i++) {
+			ready &= initWorker(&workers[i], search, i);
+		}
+	}
+
+	bool solved = false;
+	int lowest = 0;
+	while (lowest < maxLines && (field >> (lowest * BLOCKS_X)) != 0) {
+		lowest++;
+	}
+
+	// Try the fewest lines first. Each number of lines takes a fixed number of pieces.
+	for (int lines = SDL_max(lowest, 1); ready && !solved && lines <= maxLines; lines++) {
+		struct Task root;
+		root.node.board = field;
+		root.node.height = lines;
+		root.node.next = 0;
+		root.node.held = problem->held;
+		root.node.canHold = problem->canHold;
+		root.depth = 0;
+
+		if ((lines * BLOCKS_X - countBits(field)) % 4 != 0 || !feasible(search, &root.node)) {
+			continue;
+		}
+
+		SDL_AtomicSet(&search->found, 0);
+		SDL_AtomicSet(&search->pending, 0);
+		for (int i = 0; i < threadCount; i++) {
+			workers[i].generation++;
+			workers[i].head = workers[i].tail = 0;
+		}
+		pushTask(&workers[0], &root);
+
+		for (int i = 0; i < threadCount; i++) {
+			threads[i] = SDL_CreateThread(searchThread, "pc search", &workers[i]);
+		}
+		for (int i = 0; i < threadCount; i++) {
+			SDL_WaitThread(threads[i], NULL);
+		}
+
+		if (SDL_AtomicGet(&search->found)) {
+			*solution = search->solution;
+			solution->lines = lines;
+			solved = true;
+		}
+	}
+
+	for (int i = 0; ready && i < threadCount; i++) {
+		lastSearchNodes += workers[i].nodes;
+	}
+	for (int i = 0; workers != NULL && i < threadCount; i++) {
+		freeWorker(&workers[i]);
+	}
+	free(threads);
+	free(workers);
+	free(search);
+
+	return solved;
+}
+
+static bool parsePieces(const char* text, enum PieceType* sequence, int* length, int maxLength) {
+	*length = 0;
+	for (const char* c = text; *c != '\0'; c++) {
+		const char* letter = strchr(PIECE_LETTERS, SDL_toupper(*c));
+		if (letter == NULL || *length >= maxLength) {
+			return false;
+		}
+		sequence[(*length)++] = letter - PIECE_LETTERS;
+	}
+	return *length > 0;
+}
+
+static void printSteps(const struct PcStep* steps, int length) {
+	for (int i = 0; i < length; i++) {
+		printf("%2d. %s%c rotation %d, leftmost column %d\n", i + 1,
+			steps[i].hold ? "hold, " : "", PIECE_LETTERS[steps[i].type], steps[i].rotation, steps[i].column);
+	}
+}
+
+int solvePcMain(int argc, char* argv[]) {
+	if (argc < 1) {
+		printf("Usage: --solve-pc <quicksave file or pieces, eg. TIOLJSZ> [max lines] [threads] [held piece]\n");
+		return 1;
+	}
+
+	int maxLines = argc > 1 ? atoi(argv[1]) : 4;
+	int threadCount = argc > 2 ? atoi(argv[2]) : SDL_GetCPUCount();
+
+	struct PcProblem problem;
+	memset(&problem, 0, sizeof(problem));
+
+	if (parsePieces(argv[0], problem.sequence, &problem.length, PC_MAX_PIECES)) {
+		problem.held = NO_PIECE;
+		problem.canHold = true;
+		problem.maxLines = maxLines;
+
+		enum PieceType held;
+		int heldCount;
+		if (argc > 3 && parsePieces(argv[3], &held, &heldCount, 1)) {
+			problem.held = held;
+		}
+	}
+	else if (readSnapshotFile(argv[0])) {
+		pcProblemFromGame(&problem, maxLines);
+	}
+	else {
+		printf("%s is neither a list of pieces nor a quicksave\n", argv[0]);
+		return 1;
+	}
+
+	Uint64 start = SDL_GetPerformanceCounter();
+
+	struct PcSolution solution;
+	bool solved = solvePerfectClear(&problem, threadCount, &solution);
+
+	double seconds = (SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+
+	if (!solved) {
+		printf("No perfect clear within %d lines (%.1fms, %llu nodes)\n",
+			maxLines, seconds * 1000, (unsigned long long)lastSearchNodes);
+		return 1;
+	}
+
+	printf("Perfect clear of %d lines with %d pieces (%.1fms, %llu nodes):\n",
+		solution.lines, solution.length, seconds * 1000, (unsigned long long)lastSearchNodes);
+	printSteps(solution.steps, solution.length);
+	return 0;
+}
+
+Uint64 pcTableKey(const enum PieceType* sequence) {
+	Uint64 key = 0;
+	for (int i = 0; i < PC_TABLE_SEQUENCE; i++) {
+		key = key << 3 | sequence[i];
+	}
+	return key;
+}
+
+// The table covers a whole bag in each of its 7! orders followed by the first
+// 4 pieces of the next bag, which is every way a game can start.
+#define BAG_ORDERS 5040
+#define NEXT_BAG_STARTS (7 * 6 * 5 * 4)
+#define TABLE_SEQUENCES (BAG_ORDERS * NEXT_BAG_STARTS)
+
+static void tableSequence(Uint32 index, enum PieceType* sequence) {
+	decodeBagPrefix(index / NEXT_BAG_STARTS, sequence, NUM_BLOCKS);
+	decodeBagPrefix(index % NEXT_BAG_STARTS, sequence + NUM_BLOCKS, PC_TABLE_SEQUENCE - NUM_BLOCKS);
+}
+
+struct TableWorker {
+	struct Worker worker;
+	struct Search search;
+
+	struct PcTableEntry* entries;
+	Uint64 count;
+	Uint64 capacity;
+};
+
+static SDL_atomic_t nextSequence;
+static Uint32 tableFirst;
+static Uint32 tableCount;
+
+// Each sequence is small enough to search on one thread, so the table is
+// split by sequence instead of by subtree.
+static int tableThread(void* data) {
+	struct TableWorker* table = data;
+	struct Worker* worker = &table->worker;
+	struct Search* search = &table->search;
+	struct PcStep path[PC_MAX_PIECES];
+
+	for (;;) {
+		Uint32 index = SDL_AtomicAdd(&nextSequence, 1);
+		if (index >= tableCount) {
+			break;
+		}
+
+		enum PieceType sequence[PC_TABLE_SEQUENCE];
+		tableSequence(tableFirst + index, sequence);
+		setSequence(search, sequence, PC_TABLE_SEQUENCE);
+		SDL_AtomicSet(&search->found, 0);
+		worker->generation++;
+
+		struct Node root = { 0, PC_TABLE_LINES, 0, NO_PIECE, true };
+		if (!searchNode(worker, &root, path, 0)) {
+			continue;
+		}
+
+		if (table->count == table->capacity) {
+			table->capacity = SDL_max(table->capacity * 2, 1024);
+			table->entries = realloc(table->entries, table->capacity * sizeof(struct PcTableEntry));
+		}
+
+		struct PcTableEntry* entry = &table->entries[table->count++];
+		memset(entry, 0, sizeof(*entry));
+		entry->key = pcTableKey(sequence);
+		entry->length = search->solution.length;
+
+		for (int i = 0; i < search->solution.length; i++) {
+			const struct PcStep* step = &search->solution.steps[i];
+			entry->placements[i] = step->rotation << 4 | step->column;
+			entry->holds |= step->hold << i;
+		}
+	}
+
+	return 0;
+}
+
+static int compareEntries(const void* a, const void* b) {
+	Uint64 x = ((const struct PcTableEntry*)a)->key;
+	Uint64 y = ((const struct PcTableEntry*)b)->key;
+	return x < y ? -1 : x > y;
+}
+
+int buildPcTableMain(int argc, char* argv[]) {
+	if (argc < 1) {
+		printf("Usage: --pc-table <table> [first sequence] [count] [threads]\n");
+		return 1;
+	}
+
+	Uint32 first = argc > 1 ? (Uint32)strtoul(argv[1], NULL, 10) : 0;
+	Uint32 count = argc > 2 ? (Uint32)strtoul(argv[2], NULL, 10) : TABLE_SEQUENCES;
+	int threadCount = argc > 3 ? atoi(argv[3]) : SDL_GetCPUCount();
+	threadCount = SDL_max(threadCount, 1);
+
+	first = SDL_min(first, TABLE_SEQUENCES);
+	tableFirst = first;
+	tableCount = SDL_min(count, TABLE_SEQUENCES - first);
+
+	initSolver();
+
+	struct TableWorker* workers = calloc(threadCount, sizeof(struct TableWorker));
+	SDL_Thread** threads = calloc(threadCount, sizeof(SDL_Thread*));
+	bool success = workers != NULL && threads != NULL;
+
+	for (int i = 0; success && i < threadCount; i++) {
+		success = initWorker(&workers[i].worker, &workers[i].search, i);
+		workers[i].search.workers = &workers[i].worker;
+		workers[i].search.workerCount = 1;
+	}
+
+	if (success) {
+		SDL_AtomicSet(&nextSequence, 0);
+		Uint64 start = SDL_GetPerformanceCounter();
+
+		for (int i = 0; i < threadCount; i++) {
+			threads[i] = SDL_CreateThread(tableThread, "pc table", &workers[i]);
+		}
+		for (int i = 0; i < threadCount; i++) {
+			SDL_WaitThread(threads[i], NULL);
+		}
+
+		double seconds = (SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+
+		// Gather everything into one sorted array
+		struct PcTableHeader header = { PC_TABLE_MAGIC, PC_TABLE_VERSION, sizeof(header), sizeof(struct PcTableEntry), PC_TABLE_LINES, 0 };
+		Uint64 nodes = 0;
+		for (int i = 0; i < threadCount; i++) {
+			header.count += workers[i].count;
+			nodes += workers[i].worker.nodes;
+		}
+
+		struct PcTableEntry* entries = malloc(SDL_max(header.count, 1) * sizeof(struct PcTableEntry));
+		Uint64 gathered = 0;
+		for (int i = 0; entries != NULL && i < threadCount; i++) {
+			memcpy(&entries[gathered], workers[i].entries, workers[i].count * sizeof(struct PcTableEntry));
+			gathered += workers[i].count;
+		}
+
+		SDL_RWops* file = SDL_RWFromFile(argv[0], "wb");
+		success = entries != NULL && file != NULL;
+
+		if (success) {
+			qsort(entries, header.count, sizeof(struct PcTableEntry), compareEntries);
+			success = SDL_RWwrite(file, &header, sizeof(header), 1) == 1 &&
+				SDL_RWwrite(file, entries, sizeof(struct PcTableEntry), header.count) == header.count;
+		}
+		if (file != NULL) {
+			success &= SDL_RWclose(file) == 0;
+		}
+		free(entries);
+
+		if (success) {
+			printf("Solved %llu of %u sequences in %.2fs (%.0f sequences/s, %llu nodes)\n",
+				(unsigned long long)header.count, tableCount, seconds, tableCount / SDL_max(seconds, 1e-9), (unsigned long long)nodes);
+		}
+		else {
+			printf("Failed to write %s\n", argv[0]);
+		}
+	}
+
+	for (int i = 0; workers != NULL && i < threadCount; i++) {
+		freeWorker(&workers[i].worker);
+		free(workers[i].entries);
+	}
+	free(threads);
+	free(workers);
+
+	return success ? 0 : 1;
+}
+
+bool openPcTable(struct PcTable* table, const char* path) {
+	memset(table, 0, sizeof(*table));
+
+	table->data = mapFile(path, &table->size);
+	if (table->data == NULL) {
+		return false;
+	}
+
+	const struct PcTableHeader* header = table->data;
+
+	bool valid = table->size >= sizeof(*header) &&
+		header->magic == PC_TABLE_MAGIC &&
+		header->version == PC_TABLE_VERSION &&
+		header->entrySize == sizeof(struct PcTableEntry) &&
+		header->headerSize + header->count * sizeof(struct PcTableEntry) <= table->size;
+
+	if (!valid) {
+		printf("%s is not a valid perfect clear table\n", path);
+		closePcTable(table);
+		return false;
+	}
+
+	table->header = header;
+	table->entries = (const struct PcTableEntry*)((const Uint8*)table->data + header->headerSize);
+	return true;
+}
+
+void closePcTable(struct PcTable* table) {
+	if (table->data != NULL) {
+		unmapFile(table->data, table->size);
+	}
+	memset(table, 0, sizeof(*table));
+}
+
+const struct PcTableEntry* lookupPcTable(const struct PcTable* table, const enum PieceType* sequence) {
+	Uint64 key = pcTableKey(sequence);
+	Uint64 low = 0;
+	Uint64 high = table->header->count;
+
+	while (low < high) {
+		Uint64 middle = low + (high - low) / 2;
+		if (table->entries[middle].key < key) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
+	}
+
+	return low < table->header->count && table->entries[low].key == key ? &table->entries[low] : NULL;
+}
+
+int lookupPcMain(int argc, char* argv[]) {
+	enum PieceType sequence[PC_TABLE_SEQUENCE];
+	int length;
+
+	if (argc < 2 || !parsePieces(argv[1], sequence, &length, PC_TABLE_SEQUENCE) || length != PC_TABLE_SEQUENCE) {
+		printf("Usage: --pc-lookup <table> <%d pieces, eg. TIOLJSZIOTL>\n", PC_TABLE_SEQUENCE);
+		return 1;
+	}
+
+	struct PcTable table;
+	if (!openPcTable(&table, argv[0])) {
+		return 1;
+	}
+
+	const struct PcTableEntry* entry = lookupPcTable(&table, sequence);
+	if (entry == NULL) {
+		printf("No perfect clear for %s among %llu entries\n", argv[1], (unsigned long long)table.header->count);
+	}
+	else {
+		struct PcStep steps[PC_TABLE_PLACEMENTS];
+		int next = 0;
+		enum PieceType held = NO_PIECE;
+
+		// Replay the holds to recover which piece each placement used
+		for (int i = 0; i < entry->length; i++) {
+			steps[i].hold = (entry->holds >> i) & 1;
+			steps[i].rotation = entry->placements[i] >> 4;
+			steps[i].column = entry->placements[i] & 15;
+
+			enum PieceType current = sequence[next++];
+			if (steps[i].hold) {
+				enum PieceType swapped = held != NO_PIECE ? held : sequence[next++];
+				held = current;
+				current = swapped;
+			}
+			steps[i].type = current;
+		}
+
+		printSteps(steps, entry->length);
+	}
+
+	closePcTable(&table);
+	return entry != NULL ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+#include "engine.h"
+
+// Perfect clear search: find placements for the known pieces that leave the
+// board completely empty, using at most maxLines lines from the bottom.
+//
+// The field is a bitboard of up to PC_MAX_LINES rows, 10 bits a row from the
+// bottom up. Only placements that leave no covered empty cells are tried, so
+// pieces are always reachable by dropping straight down and any column that is
+// full to the top of the field splits it into parts that must each be filled
+// with whole pieces. Columns keep their parity when rows clear, so the balance
+// of empty cells in odd and even columns bounds which pieces can finish the job.
+#define PC_MAX_LINES 6
+#define PC_MAX_PIECES 16
+
+struct PcProblem {
+	struct Bitboard board;
+
+	// The current piece followed by every piece known to come after it
+	enum PieceType sequence[PC_MAX_PIECES];
+	int length;
+
+	// NO_PIECE if nothing is held
+	enum PieceType held;
+	bool canHold;
+
+	int maxLines;
+};
+
+struct PcStep {
+	// Whether hold is pressed before placing
+	bool hold;
+	enum PieceType type;
+	int rotation;
+
+	// Column of the piece's leftmost cell. The piece is then dropped straight down.
+	int column;
+};
+
+struct PcSolution {
+	struct PcStep steps[PC_MAX_PIECES];
+	int length;
+	int lines;
+};
+
+// The problem posed by the game as it stands: the board, current piece, hold
+// and queue, plus the last piece of the bag when only one is left in it.
+void pcProblemFromGame(struct PcProblem* problem, int maxLines);
+
+// Search on several threads, stealing work from each other. Returns false if there is no perfect clear.
+bool solvePerfectClear(const struct PcProblem* problem, int threadCount, struct PcSolution* solution);
+
+#define PC_TABLE_MAGIC SDL_FOURCC('T', 'P', 'C', 'T')
+#define PC_TABLE_VERSION 1
+
+// Pieces in a table key. A 4 line perfect clear takes 10 pieces, plus one
+// more that can sit in hold.
+#define PC_TABLE_SEQUENCE 11
+#define PC_TABLE_LINES 4
+#define PC_TABLE_PLACEMENTS 10
+
+// A table of 4 line perfect clears from an empty board with nothing held, one
+// entry per solvable sequence, sorted by key so it can be binary searched
+// straight from a memory-mapped file.
+struct PcTableHeader {
+	Uint32 magic;
+	Uint16 version;
+	Uint16 headerSize;
+	Uint32 entrySize;
+	Uint32 lines;
+	Uint64 count;
+};
+
+struct PcTableEntry {
+	// 3 bits per piece, the first in the highest bits
+	Uint64 key;
+
+	// Rotation in the high nibble, column of the leftmost cell in the low one
+	Uint8 placements[PC_TABLE_PLACEMENTS];
+
+	// Bit i set if hold is pressed before placement i
+	Uint16 holds;
+
+	// Fewer than PC_TABLE_PLACEMENTS if the board empties early, after 2 lines
+	Uint8 length;
+	Uint8 reserved[3];
+};
+
+struct PcTable {
+	const void* data;
+	size_t size;
+	const struct PcTableHeader* header;
+	const struct PcTableEntry* entries;
+};
+
+Uint64 pcTableKey(const enum PieceType* sequence);
+
+bool openPcTable(struct PcTable* table, const char* path);
+void closePcTable(struct PcTable* table);
+const struct PcTableEntry* lookupPcTable(const struct PcTable* table, const enum PieceType* sequence);
+
+// Arguments: <quicksave file or pieces, eg. TIOLJSZ> [max lines] [threads] [held piece]
+int solvePcMain(int argc, char* argv[]);
+
+// Solve a range of bag-ordered sequences and write the table.
+// Arguments: <table> [first sequence] [count] [threads]
+int buildPcTableMain(int argc, char* argv[]);
+
+// Arguments: <table> <pieces>
+int lookupPcMain(int argc, char* argv[]);
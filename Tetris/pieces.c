@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL2/SDL.h>
+
+#include "pieces.h"
+
+struct PieceSet pieceSet;
+
+// Fill in the cell masks and bounds from the rows
+static void finishRotation(struct PieceRotation* rotation, int size) {
+	rotation->left = size;
+	rotation->right = -1;
+	rotation->top = size;
+	rotation->bottom = -1;
+
+	for (int y = 0; y < MAX_PIECE_SIZE; y++) {
+		rotation->cells[y] = 0;
+
+		for (int x = 0; x < size; x++) {
+			if (PIECE_SOLID(rotation, x, y)) {
+				rotation->cells[y] |= (Uint64)CELL_MASK << (CELL_BITS * x);
+				rotation->left = SDL_min(rotation->left, x);
+				rotation->right = SDL_max(rotation->right, x);
+				rotation->top = SDL_min(rotation->top, y);
+				rotation->bottom = SDL_max(rotation->bottom, y);
+			}
+		}
+	}
+}
+
+// Each rotation is the one before turned clockwise
+static void deriveRotations(struct PieceDef* piece) {
+	for (int r = 1; r < 4; r++) {
+		const struct PieceRotation* from = &piece->rotations[r - 1];
+		struct PieceRotation* to = &piece->rotations[r];
+		memset(to->rows, 0, sizeof(to->rows));
+
+		for (int y = 0; y < piece->size; y++) {
+			for (int x = 0; x < piece->size; x++) {
+				if (PIECE_SOLID(from, x, piece->size - 1 - y)) {
+					to->rows[x] |= 1 << y;
+				}
+			}
+		}
+	}
+
+	for (int r = 0; r < 4; r++) {
+		finishRotation(&piece->rotations[r], piece->size);
+	}
+}
+
+void initPieceSet() {
+	memset(&pieceSet, 0, sizeof(pieceSet));
+	pieceSet.count = NUM_BLOCKS;
+	pieceSet.maxSize = 4;
+	pieceSet.standard = true;
+
+	// Taken as they are rather than derived, since they follow the rotation states of SRS
+	for (int type = 0; type < NUM_BLOCKS; type++) {
+		struct PieceDef* piece = &pieceSet.pieces[type];
+		piece->colour = BLOCKS[type].colour;
+		piece->size = 4;
+
+		for (int r = 0; r < 4; r++) {
+			for (int y = 0; y < 4; y++) {
+				for (int x = 0; x < 4; x++) {
+					if (BLOCKS[type].rotations[r].vals[y][x]) {
+						piece->rotations[r].rows[y] |= 1 << x;
+					}
+				}
+			}
+			finishRotation(&piece->rotations[r], 4);
+		}
+	}
+}
+
+static bool parsePieceSet(char* text, struct PieceSet* set) {
+	memset(set, 0, sizeof(*set));
+
+	struct PieceDef* piece = NULL;
+	int row = 0;
+
+	for (char* line = strtok(text, "\n"); line != NULL; line = strtok(NULL, "\n")) {
+		line[strcspn(line, "\r")] = '\0';
+		if (line[0] == '#' || line[0] == '\0') {
+			continue;
+		}
+
+		if (strncmp(line, "piece", 5) == 0) {
+			if (piece != NULL && row < piece->size) {
+				printf("Piece %d has %d rows, not %d\n", set->count, row, piece->size);
+				return false;
+			}
+			if (set->count == MAX_PIECE_TYPES) {
+				printf("More than %d pieces\n", MAX_PIECE_TYPES);
+				return false;
+			}
+
+			int size;
+			unsigned int colour;
+			if (sscanf(line, "piece %d %6x", &size, &colour) != 2 || size < 1 || size > MAX_PIECE_SIZE) {
+				printf("Expected \"piece <box size up to %d> <rrggbb>\", got \"%s\"\n", MAX_PIECE_SIZE, line);
+				return false;
+			}
+
+			piece = &set->pieces[set->count++];
+			piece->size = size;
+			piece->colour = (SDL_Color){ (colour >> 16) & 0xff, (colour >> 8) & 0xff, colour & 0xff, 0xff };
+			set->maxSize = SDL_max(set->maxSize, size);
+			row = 0;
+			continue;
+		}
+
+		if (piece == NULL || row == piece->size || (int)strlen(line) < piece->size) {
+			printf("Unexpected line \"%s\"\n", line);
+			return false;
+		}
+
+		for (int x = 0; x < piece->size; x++) {
+			if (line[x] == 'X') {
+				piece->rotations[0].rows[row] |= 1 << x;
+			}
+			else if (line[x] != '.') {
+				printf("Unexpected \"%c\" in \"%s\"\n", line[x], line);
+				return false;
+			}
+		}
+		row++;
+	}
+
+	if (set->count == 0) {
+		printf("No pieces\n");
+		return false;
+	}
+	if (row < piece->size) {
+		printf("Piece %d has %d rows, not %d\n", set->count, row, piece->size);
+		return false;
+	}
+
+	for (int i = 0; i < set->count; i++) {
+		deriveRotations(&set->pieces[i]);
+
+		if (set->pieces[i].rotations[0].bottom < 0) {
+			printf("Piece %d has no solid cells\n", i + 1);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool loadPieceSet(const char* path, struct PieceSet* set) {
+	SDL_RWops* file = SDL_RWFromFile(path, "rb");
+	if (file == NULL) {
+		printf("Failed to open %s: %s\n", path, SDL_GetError());
+		return false;
+	}
+
+	Sint64 size = SDL_RWsize(file);
+	char* text = malloc(size + 1);
+	bool read = text != NULL && size >= 0 && SDL_RWread(file, text, size, 1) == (size > 0 ? 1 : 0);
+	SDL_RWclose(file);
+
+	if (!read) {
+		printf("Failed to read %s\n", path);
+		free(text);
+		return false;
+	}
+	text[size] = '\0';
+
+	// Parsed into a copy so a bad file leaves the set as it was
+	struct PieceSet* parsed = malloc(sizeof(*parsed));
+	bool valid = parsed != NULL && parsePieceSet(text, parsed);
+	if (valid) {
+		*set = *parsed;
+	}
+	else {
+		printf("Failed to load the piece set %s\n", path);
+	}
+
+	free(parsed);
+	free(text);
+	return valid;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "tetris.h"
+
+// Piece sets: the standard tetrominoes, or any polyominoes loaded from a text
+// file such as resources/pieces/pentominoes.txt. Lines starting with # are
+// comments. Each piece is a line
+//
+//     piece <box size> <colour as rrggbb>
+//
+// followed by one line per row of its box, X for a solid cell and . for an
+// empty one. The box is the piece's first rotation, and the others are found
+// by turning the box about its centre. The bag deals one of each piece.
+
+// Fill pieceSet with the standard set from BLOCKS. Must be called before the
+// game starts.
+void initPieceSet();
+
+// Returns false, having printed why, if the file can't be read or isn't a
+// valid set
+bool loadPieceSet(const char* path, struct PieceSet* set);
@@ -0,0 +1,479 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include "tetris.h"
+#include "bot.h"
+#include "events.h"
+#include "hint.h"
+#include "renderbench.h"
+#include "alloccount.h"
+
+#define DRAW_COUNT_IMPLEMENTATION
+#include "drawcount.h"
+
+struct DrawCounters drawCounters;
+
+static SDL_Color lastColour;
+static bool colourKnown = false;
+
+int countedSetRenderDrawColor(SDL_Renderer* renderer, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+	drawCounters.colourChanges++;
+	if (colourKnown && lastColour.r == r && lastColour.g == g && lastColour.b == b && lastColour.a == a) {
+		drawCounters.redundantColours++;
+	}
+
+	lastColour.r = r;
+	lastColour.g = g;
+	lastColour.b = b;
+	lastColour.a = a;
+	colourKnown = true;
+
+	return SDL_SetRenderDrawColor(renderer, r, g, b, a);
+}
+
+// Each call also names itself for any allocations SDL makes inside it
+int countedRenderClear(SDL_Renderer* renderer) {
+	drawCounters.drawCalls++;
+	const char* site = setAllocSite("SDL_RenderClear");
+	int result = SDL_RenderClear(renderer);
+	setAllocSite(site);
+	return result;
+}
+
+int countedRenderFillRect(SDL_Renderer* renderer, const SDL_Rect* rect) {
+	drawCounters.drawCalls++;
+	const char* site = setAllocSite("SDL_RenderFillRect");
+	int result = SDL_RenderFillRect(renderer, rect);
+	setAllocSite(site);
+	return result;
+}
+
+int countedRenderDrawRect(SDL_Renderer* renderer, const SDL_Rect* rect) {
+	drawCounters.drawCalls++;
+	const char* site = setAllocSite("SDL_RenderDrawRect");
+	int result = SDL_RenderDrawRect(renderer, rect);
+	setAllocSite(site);
+	return result;
+}
+
+int countedRenderCopy(SDL_Renderer* renderer, SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dest) {
+	drawCounters.drawCalls++;
+	const char* site = setAllocSite("SDL_RenderCopy");
+	int result = SDL_RenderCopy(renderer, texture, src, dest);
+	setAllocSite(site);
+	return result;
+}
+
+SDL_Texture* countedCreateTexture(SDL_Renderer* renderer, Uint32 format, int access, int w, int h) {
+	drawCounters.textureCreations++;
+	const char* site = setAllocSite("SDL_CreateTexture");
+	SDL_Texture* texture = SDL_CreateTexture(renderer, format, access, w, h);
+	setAllocSite(site);
+	return texture;
+}
+
+SDL_Texture* countedCreateTextureFromSurface(SDL_Renderer* renderer, SDL_Surface* surface) {
+	drawCounters.textureCreations++;
+	const char* site = setAllocSite("SDL_CreateTextureFromSurface");
+	SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+	setAllocSite(site);
+	return texture;
+}
+
+SDL_Surface* countedRenderUTF8_Blended(TTF_Font* font, const char* text, SDL_Color colour) {
+	drawCounters.surfaceAllocations++;
+	const char* site = setAllocSite("TTF_RenderUTF8_Blended");
+	SDL_Surface* surface = TTF_RenderUTF8_Blended(font, text, colour);
+	setAllocSite(site);
+	return surface;
+}
+
+#define COUNTER_COUNT 5
+
+static const char* COUNTER_NAMES[COUNTER_COUNT] = {
+	"draws", "colours", "redundant", "textures", "surfaces",
+};
+
+static void readCounters(const struct DrawCounters* counters, Uint64* values) {
+	values[0] = counters->drawCalls;
+	values[1] = counters->colourChanges;
+	values[2] = counters->redundantColours;
+	values[3] = counters->textureCreations;
+	values[4] = counters->surfaceAllocations;
+}
+
+// Fixtures start from the same seed, so the current piece and queue are always the same
+#define FIXTURE_SEED 12345
+
+static void fillRow(int y, int gap) {
+	for (int x = 0; x < BLOCKS_X; x++) {
+		if (x != gap) {
+			enum PieceType type = (x + y) % NUM_BLOCKS;
+			board.rows[y] |= (Uint64)PIECE_CELL(type) << (CELL_BITS * x);
+		}
+	}
+}
+
+// A messy stack 12 rows high, with something held
+static void stackedBoard() {
+	for (int y = BLOCKS_Y - 12; y < BLOCKS_Y; y++) {
+		fillRow(y, (y * 7) % BLOCKS_X);
+	}
+	pieceHeld = true;
+	heldPieceType = T_PIECE;
+}
+
+static void setupEmpty() {
+}
+
+static void setupStacked() {
+	stackedBoard();
+}
+
+static void setupLineClear() {
+	stackedBoard();
+
+	// Fill the bottom 4 rows in, half way through the flash
+	gameState = GAME_LINE_CLEAR;
+	lineCount = 4;
+	for (int i = 0; i < lineCount; i++) {
+		linesToClear[i] = BLOCKS_Y - 1 - i;
+		fillRow(linesToClear[i], -1);
+	}
+	clearTimer = CLEAR_TIMER_LENGTH / 2;
+}
+
+static void setupPaused() {
+	stackedBoard();
+	gameState = GAME_PAUSED;
+}
+
+static void setupUnpausing() {
+	stackedBoard();
+	gameState = GAME_PAUSED;
+	unpausing = true;
+	unpauseCounter = 2;
+}
+
+static void setupGameOver() {
+	for (int y = 0; y < BLOCKS_Y; y++) {
+		fillRow(y, (y * 3) % BLOCKS_X);
+	}
+	gameState = GAME_OVER;
+}
+
+static const struct {
+	const char* name;
+	void (*setup)();
+} FIXTURES[] = {
+	{ "empty", setupEmpty },
+	{ "stacked", setupStacked },
+	{ "line-clear", setupLineClear },
+	{ "paused", setupPaused },
+	{ "unpausing", setupUnpausing },
+	{ "game-over", setupGameOver },
+};
+
+#define FIXTURE_COUNT SDL_arraysize(FIXTURES)
+
+struct FixtureResult {
+	double p50;
+	double p90;
+	double p99;
+	double max;
+
+	// The most any one frame did
+	Uint64 counters[COUNTER_COUNT];
+};
+
+static int compareDoubles(const void* a, const void* b) {
+	double x = *(const double*)a;
+	double y = *(const double*)b;
+	return x < y ? -1 : x > y;
+}
+
+static double percentile(const double* sorted, int count, int percent) {
+	return sorted[SDL_min(count - 1, count * percent / 100)];
+}
+
+static void runFixture(int index, int frames, double* times, struct FixtureResult* result) {
+	resetGame(FIXTURE_SEED);
+	FIXTURES[index].setup();
+	publishRenderState();
+	const struct RenderState* rs = acquireRenderState();
+
+	// The first frame pays for one-off work, like glyph caches filling
+	drawFrame(rs);
+
+	double frequency = (double)SDL_GetPerformanceFrequency();
+	memset(result, 0, sizeof(*result));
+
+	for (int frame = 0; frame < frames; frame++) {
+		Uint64 before[COUNTER_COUNT];
+		Uint64 after[COUNTER_COUNT];
+		readCounters(&drawCounters, before);
+
+		Uint64 start = SDL_GetPerformanceCounter();
+		drawFrame(rs);
+		times[frame] = (SDL_GetPerformanceCounter() - start) * 1000.0 / frequency;
+
+		readCounters(&drawCounters, after);
+		for (int i = 0; i < COUNTER_COUNT; i++) {
+			result->counters[i] = SDL_max(result->counters[i], after[i] - before[i]);
+		}
+	}
+
+	qsort(times, frames, sizeof(double), compareDoubles);
+	result->p50 = percentile(times, frames, 50);
+	result->p90 = percentile(times, frames, 90);
+	result->p99 = percentile(times, frames, 99);
+	result->max = times[frames - 1];
+}
+
+// The baseline is text, one "fixture counter value" line per counter, so it
+// can be checked in and diffed.
+static bool writeBaseline(const char* path, const struct FixtureResult* results) {
+	SDL_RWops* file = SDL_RWFromFile(path, "wb");
+	if (file == NULL) {
+		printf("Failed to open %s: %s\n", path, SDL_GetError());
+		return false;
+	}
+
+	bool success = true;
+	for (int i = 0; i < FIXTURE_COUNT; i++) {
+		for (int j = 0; j < COUNTER_COUNT; j++) {
+			char line[128];
+			int length = snprintf(line, sizeof(line), "%s %s %llu\n",
+				FIXTURES[i].name, COUNTER_NAMES[j], (unsigned long long)results[i].counters[j]);
+			success &= SDL_RWwrite(file, line, length, 1) == 1;
+		}
+	}
+
+	success &= SDL_RWclose(file) == 0;
+	return success;
+}
+
+// Returns the number of counters above the baseline, or -1 if it can't be read
+static int compareBaseline(const char* path, const struct FixtureResult* results) {
+	SDL_RWops* file = SDL_RWFromFile(path, "rb");
+	if (file == NULL) {
+		return -1;
+	}
+
+	Sint64 size = SDL_RWsize(file);
+	char* text = malloc(size + 1);
+	bool read = text != NULL && size >= 0 && SDL_RWread(file, text, size, 1) == (size > 0 ? 1 : 0);
+	SDL_RWclose(file);
+
+	if (!read) {
+		free(text);
+		return -1;
+	}
+	text[size] = '\0';
+
+	int regressions = 0;
+	bool seen[FIXTURE_COUNT][COUNTER_COUNT] = { 0 };
+
+	for (char* line = strtok(text, "\n"); line != NULL; line = strtok(NULL, "\n")) {
+		char fixture[64];
+		char counter[64];
+		unsigned long long expected;
+		if (sscanf(line, "%63s %63s %llu", fixture, counter, &expected) != 3) {
+			continue;
+		}
+
+		for (int i = 0; i < FIXTURE_COUNT; i++) {
+			for (int j = 0; j < COUNTER_COUNT; j++) {
+				if (strcmp(fixture, FIXTURES[i].name) != 0 || strcmp(counter, COUNTER_NAMES[j]) != 0) {
+					continue;
+				}
+
+				seen[i][j] = true;
+				if (results[i].counters[j] > expected) {
+					printf("REGRESSION: %s %s per frame went from %llu to %llu\n",
+						fixture, counter, expected, (unsigned long long)results[i].counters[j]);
+					regressions++;
+				}
+				else if (results[i].counters[j] < expected) {
+					printf("Improved: %s %s per frame went from %llu to %llu\n",
+						fixture, counter, expected, (unsigned long long)results[i].counters[j]);
+				}
+			}
+		}
+	}
+
+	for (int i = 0; i < FIXTURE_COUNT; i++) {
+		for (int j = 0; j < COUNTER_COUNT; j++) {
+			if (!seen[i][j]) {
+				printf("Baseline has no %s %s, write it again to include it\n", FIXTURES[i].name, COUNTER_NAMES[j]);
+			}
+		}
+	}
+
+	free(text);
+	return regressions;
+}
+
+// Draw with the software renderer into a surface, so no window or GPU is involved
+static SDL_Surface* openSoftwareRenderer() {
+	TTF_Init();
+	SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, WINDOW_WIDTH, WINDOW_HEIGHT, 32, SDL_PIXELFORMAT_ARGB8888);
+	renderer = surface != NULL ? SDL_CreateSoftwareRenderer(surface) : NULL;
+	if (renderer == NULL) {
+		printf("Failed to create the software renderer: %s\n", SDL_GetError());
+		SDL_FreeSurface(surface);
+		return NULL;
+	}
+	SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+	loadFont();
+	loadDeferredFont();
+	return surface;
+}
+
+static void closeSoftwareRenderer(SDL_Surface* surface) {
+	SDL_DestroyRenderer(renderer);
+	renderer = NULL;
+	SDL_FreeSurface(surface);
+}
+
+int benchRenderMain(int argc, char* argv[]) {
+	int frames = argc > 0 ? atoi(argv[0]) : 200;
+	const char* baseline = argc > 1 ? argv[1] : RENDER_BASELINE_PATH;
+	bool write = argc > 2 && strcmp(argv[2], "write") == 0;
+	frames = SDL_max(frames, 1);
+
+	SDL_Surface* surface = openSoftwareRenderer();
+	if (surface == NULL) {
+		return 1;
+	}
+
+	historyEnabled = false;
+
+	double* times = malloc(frames * sizeof(double));
+	struct FixtureResult results[FIXTURE_COUNT];
+
+	printf("%-12s %8s %8s %8s %8s", "fixture", "p50 ms", "p90 ms", "p99 ms", "max ms");
+	for (int j = 0; j < COUNTER_COUNT; j++) {
+		printf(" %9s", COUNTER_NAMES[j]);
+	}
+	printf("\n");
+
+	for (int i = 0; i < FIXTURE_COUNT; i++) {
+		runFixture(i, frames, times, &results[i]);
+
+		printf("%-12s %8.3f %8.3f %8.3f %8.3f", FIXTURES[i].name, results[i].p50, results[i].p90, results[i].p99, results[i].max);
+		for (int j = 0; j < COUNTER_COUNT; j++) {
+			printf(" %9llu", (unsigned long long)results[i].counters[j]);
+		}
+		printf("\n");
+	}
+
+	free(times);
+	closeSoftwareRenderer(surface);
+
+	if (write) {
+		if (!writeBaseline(baseline, results)) {
+			printf("Failed to write %s\n", baseline);
+			return 1;
+		}
+		printf("Wrote baseline %s\n", baseline);
+		return 0;
+	}
+
+	// A missing baseline is a failure, or a gate run from the wrong directory would always pass
+	int regressions = compareBaseline(baseline, results);
+	if (regressions < 0) {
+		printf("FAILED: couldn't read the baseline %s, pass write to make one\n", baseline);
+		return 1;
+	}
+
+	if (regressions > 0) {
+		printf("FAILED: %d counters regressed against %s\n", regressions, baseline);
+		return 1;
+	}
+
+	printf("No counters regressed against %s\n", baseline);
+	return 0;
+}
+
+// Ticks in a 60Hz frame
+#define FRAME_TICKS (1000 / 60 / TICK_LENGTH)
+
+// Where check-alloc streams its events, deleted afterwards
+#define CHECK_ALLOC_EVENTS_PATH "checkalloc.events"
+
+// A frame as the game plays it: runDueTicks with a frame's worth of ticks due,
+// so recording the replay is counted along with the logic, then drawing
+static void playFrame() {
+	Uint64 tickCounts = SDL_GetPerformanceFrequency() * TICK_LENGTH / 1000;
+	nextTick = SDL_GetPerformanceCounter() - (FRAME_TICKS - 1) * tickCounts;
+
+	runDueTicks();
+	drawFrame(acquireRenderState());
+}
+
+int checkAllocMain(int argc, char* argv[]) {
+	int frames = SDL_max(argc > 0 ? atoi(argv[0]) : 600, 1);
+
+	// Before SDL has allocated anything, so everything it frees went through the hooks
+	startAllocTracking();
+
+	SDL_Surface* surface = openSoftwareRenderer();
+	if (surface == NULL) {
+		return 1;
+	}
+
+	// The bot plays, with hints and events on, so pieces lock and lines clear
+	// through everything a real game runs between frames
+	autoplayWeights = DEFAULT_WEIGHTS;
+	SDL_AtomicSet(&autoplayEnabled, true);
+	SDL_AtomicSet(&hintsEnabled, true);
+	bool started = startHints(&autoplayWeights) && startEventStream(CHECK_ALLOC_EVENTS_PATH, EVENT_FORMAT_BINARY);
+
+	resetGame(FIXTURE_SEED);
+	beginLiveReplay(FIXTURE_SEED);
+
+	// The first frames fill caches, which is expected to allocate
+	int warmup = 60;
+	for (int frame = 0; frame < warmup; frame++) {
+		playFrame();
+	}
+
+	resetAllocCounts();
+	int startLines = lines;
+	for (int frame = 0; frame < frames; frame++) {
+		playFrame();
+	}
+	Uint64 allocations = reportAllocations(frames);
+	int linesCleared = lines - startLines;
+
+	stopAllocTracking();
+	stopEventStream();
+	stopHints();
+	remove(CHECK_ALLOC_EVENTS_PATH);
+	closeSoftwareRenderer(surface);
+
+	if (!started) {
+		printf("FAILED: couldn't start the hint thread or the event stream\n");
+		return 1;
+	}
+
+	if (gameState == GAME_OVER) {
+		printf("FAILED: the bot lost the game part way through\n");
+		return 1;
+	}
+	if (linesCleared == 0) {
+		printf("FAILED: no lines were cleared, so no piece locking was counted\n");
+		return 1;
+	}
+	printf("%d lines cleared\n", linesCleared);
+	if (allocations > 0) {
+		printf("FAILED: %llu allocations in %d frames of play\n", (unsigned long long)allocations, frames);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+// The checked in counters bench-render compares against, relative to the
+// Tetris directory it's run from
+#define RENDER_BASELINE_PATH "resources/render_baseline.txt"
+
+// Draw fixed game states with the software renderer and report frame time
+// percentiles and what each frame asks of SDL. Fails if any counter is higher
+// than the baseline's, or if the baseline can't be read. With write, writes
+// the baseline instead.
+// Arguments: [frames] [baseline file] [write]
+int benchRenderMain(int argc, char* argv[]);
+
+// Let the bot play the game with the software renderer, hints and an event
+// stream, and count the heap allocations made by the logic thread's ticks,
+// replay recording included, and by drawing once the first second has filled
+// any caches. Fails if there are any, or if no lines were cleared.
+// Arguments: [frames]
+int checkAllocMain(int argc, char* argv[]);
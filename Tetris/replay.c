@@ -0,0 +1,129 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "replay.h"
+#include "tetris.h"
+
+// After the C library, so recording the live replay is counted
+#include "alloccount.h"
+
+SDL_COMPILE_TIME_ASSERT(replayHeaderSize, sizeof(struct ReplayHeader) == 20);
+
+void beginReplay(struct Replay* replay, Uint32 seed) {
+	replay->seed = seed;
+	replay->rotationSystem = rotationSystem;
+	replay->tickCount = 0;
+}
+
+bool reserveReplay(struct Replay* replay, Uint32 ticks) {
+	if (replay->capacity >= ticks) {
+		return true;
+	}
+
+	Uint16* inputs = realloc(replay->inputs, ticks * sizeof(Uint16));
+	if (inputs == NULL) {
+		return false;
+	}
+
+	replay->inputs = inputs;
+	replay->capacity = ticks;
+	return true;
+}
+
+bool recordReplayTick(struct Replay* replay, Uint32 input) {
+	if (replay->tickCount == replay->capacity &&
+		!reserveReplay(replay, replay->capacity == 0 ? 4096 : replay->capacity * 2)) {
+		return false;
+	}
+
+	replay->inputs[replay->tickCount++] = input;
+	return true;
+}
+
+void freeReplay(struct Replay* replay) {
+	free(replay->inputs);
+	memset(replay, 0, sizeof(*replay));
+}
+
+bool appendReplayFile(const char* path, const struct Replay* replay) {
+	SDL_RWops* file = SDL_RWFromFile(path, "ab");
+	if (file == NULL) {
+		printf("Failed to open %s: %s\n", path, SDL_GetError());
+		return false;
+	}
+
+	struct ReplayHeader header = {
+		.magic = REPLAY_MAGIC,
+		.version = REPLAY_VERSION,
+		.size = sizeof(header),
+		.seed = replay->seed,
+		.tickCount = replay->tickCount,
+		.rotationSystem = replay->rotationSystem,
+	};
+
+	bool success = SDL_RWwrite(file, &header, sizeof(header), 1) == 1 &&
+		SDL_RWwrite(file, replay->inputs, sizeof(Uint16), replay->tickCount) == replay->tickCount;
+	SDL_RWclose(file);
+
+	return success;
+}
+
+bool readReplay(SDL_RWops* file, struct Replay* replay) {
+	struct ReplayHeader header;
+	while (true) {
+		memset(&header, 0, sizeof(header));
+		if (SDL_RWread(file, &header, REPLAY_BASE_HEADER_SIZE, 1) != 1) {
+			return false;
+		}
+
+		if (header.magic != REPLAY_MAGIC || header.size < REPLAY_BASE_HEADER_SIZE) {
+			printf("Invalid replay\n");
+			return false;
+		}
+
+		// Read the fields this version knows about and skip any added since
+		size_t known = SDL_min(header.size, sizeof(header));
+		if (known > REPLAY_BASE_HEADER_SIZE &&
+			SDL_RWread(file, (Uint8*)&header + REPLAY_BASE_HEADER_SIZE, known - REPLAY_BASE_HEADER_SIZE, 1) != 1) {
+			return false;
+		}
+		SDL_RWseek(file, header.size - known, RW_SEEK_CUR);
+
+		if (header.version >= REPLAY_VERSION) {
+			break;
+		}
+
+		// The inputs only reproduce the game under the rules they were recorded with
+		printf("Skipping replay from older version %d\n", header.version);
+		SDL_RWseek(file, (Sint64)header.tickCount * sizeof(Uint16), RW_SEEK_CUR);
+	}
+
+	beginReplay(replay, header.seed);
+	replay->rotationSystem = header.rotationSystem;
+	if (!reserveReplay(replay, header.tickCount)) {
+		printf("Not enough memory for a replay of %u ticks\n", header.tickCount);
+		return false;
+	}
+
+	if (SDL_RWread(file, replay->inputs, sizeof(Uint16), header.tickCount) != header.tickCount) {
+		printf("Replay is truncated\n");
+		return false;
+	}
+	replay->tickCount = header.tickCount;
+
+	return true;
+}
+
+void startReplay(const struct Replay* replay) {
+	rotationSystem = replay->rotationSystem;
+	resetGame(replay->seed);
+}
+
+void playReplay(const struct Replay* replay) {
+	startReplay(replay);
+
+	for (Uint32 i = 0; i < replay->tickCount; i++) {
+		stepGame(replay->inputs[i]);
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+#define REPLAY_MAGIC SDL_FOURCC('T', 'R', 'P', 'L')
+// Bumped whenever a change to the game logic would make old inputs play out
+// differently. Version 2 has tick based gravity and lock delay. Version 3
+// resolves each rotation against the whole piece once, and records the
+// rotation system.
+#define REPLAY_VERSION 3
+
+// A game recorded as its seed plus the buttons held on every tick. Feeding the
+// inputs back through stepGame reproduces the game exactly.
+struct Replay {
+	Uint32 seed;
+	Uint8 rotationSystem;
+	Uint32 tickCount;
+	Uint32 capacity;
+	Uint16* inputs;
+};
+
+// On disk each replay is this header followed by tickCount Uint16 inputs.
+// Replay files hold any number of replays back to back.
+struct ReplayHeader {
+	Uint32 magic;
+	Uint16 version;
+	Uint16 size;
+	Uint32 seed;
+	Uint32 tickCount;
+
+	// From version 3
+	Uint8 rotationSystem;
+	Uint8 reserved[3];
+};
+
+// The header as version 2 wrote it. Later fields follow.
+#define REPLAY_BASE_HEADER_SIZE 16
+
+// Records the rotation system in use as well
+void beginReplay(struct Replay* replay, Uint32 seed);
+
+// Make room for at least this many ticks. Returns false, leaving the replay as
+// it was, if there isn't the memory.
+bool reserveReplay(struct Replay* replay, Uint32 ticks);
+
+// Returns false, without recording the tick, if there's no room and no memory
+// for more
+bool recordReplayTick(struct Replay* replay, Uint32 input);
+void freeReplay(struct Replay* replay);
+
+bool appendReplayFile(const char* path, const struct Replay* replay);
+
+// Read the next replay from an open replay file. Returns false at the end of
+// the file or if the replay is invalid.
+bool readReplay(SDL_RWops* file, struct Replay* replay);
+
+// Reset the game to the start of a replay, under the rules it was recorded with
+void startReplay(const struct Replay* replay);
+
+// Run a replay through the game logic from the start, without drawing anything.
+void playReplay(const struct Replay* replay);
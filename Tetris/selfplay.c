@@ -0,0 +1,290 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bot.h"
+#include "engine.h"
+#include "selfplay.h"
+
+SDL_COMPILE_TIME_ASSERT(selfPlayHeaderSize, sizeof(struct SelfPlayHeader) == 32);
+SDL_COMPILE_TIME_ASSERT(selfPlaySampleSize, sizeof(struct SelfPlaySample) == 56);
+
+// Samples are handed to the writer in chunks of this many
+#define CHUNK_SAMPLES 16384
+
+// A good bot can play for a very long time, so games are cut off to keep the data varied
+#define MAX_GAME_PIECES 5000
+
+struct Chunk {
+	struct SelfPlaySample* samples;
+	int count;
+	struct Worker* worker;
+	struct Chunk* next;
+};
+
+// Each worker fills one chunk while the writer thread saves the other
+struct Worker {
+	int index;
+	Uint64 quota;
+	Uint64 written;
+
+	struct Chunk chunks[2];
+	SDL_sem* freeChunks;
+
+	SDL_RWops* file;
+	bool failed;
+};
+
+static struct {
+	SDL_mutex* lock;
+	SDL_cond* ready;
+	struct Chunk* head;
+	struct Chunk* tail;
+	int runningWorkers;
+} writeQueue;
+
+static SDL_atomic_t nextGame;
+static Uint32 baseSeed;
+
+static void queueChunk(struct Chunk* chunk) {
+	SDL_LockMutex(writeQueue.lock);
+
+	chunk->next = NULL;
+	if (writeQueue.tail != NULL) {
+		writeQueue.tail->next = chunk;
+	}
+	else {
+		writeQueue.head = chunk;
+	}
+	writeQueue.tail = chunk;
+
+	SDL_CondSignal(writeQueue.ready);
+	SDL_UnlockMutex(writeQueue.lock);
+}
+
+static void workerDone() {
+	SDL_LockMutex(writeQueue.lock);
+	writeQueue.runningWorkers--;
+	SDL_CondSignal(writeQueue.ready);
+	SDL_UnlockMutex(writeQueue.lock);
+}
+
+static int writerThread(void* data) {
+	SDL_LockMutex(writeQueue.lock);
+
+	for (;;) {
+		while (writeQueue.head == NULL && writeQueue.runningWorkers > 0) {
+			SDL_CondWait(writeQueue.ready, writeQueue.lock);
+		}
+
+		struct Chunk* chunk = writeQueue.head;
+		if (chunk == NULL) {
+			break;
+		}
+
+		writeQueue.head = chunk->next;
+		if (writeQueue.head == NULL) {
+			writeQueue.tail = NULL;
+		}
+
+		// Don't hold up the workers while writing
+		SDL_UnlockMutex(writeQueue.lock);
+
+		struct Worker* worker = chunk->worker;
+		if (!worker->failed) {
+			if (SDL_RWwrite(worker->file, chunk->samples, sizeof(struct SelfPlaySample), chunk->count) == chunk->count) {
+				worker->written += chunk->count;
+			}
+			else {
+				printf("Failed to write shard %d: %s\n", worker->index, SDL_GetError());
+				worker->failed = true;
+			}
+		}
+
+		chunk->count = 0;
+		SDL_SemPost(worker->freeChunks);
+
+		SDL_LockMutex(writeQueue.lock);
+	}
+
+	SDL_UnlockMutex(writeQueue.lock);
+	return 0;
+}
+
+static void recordSample(struct SelfPlaySample* sample, Uint32 gameIndex, const struct SimGame* game, const struct BotMove* move) {
+	memcpy(sample->rows, game->board.rows, sizeof(sample->rows));
+	sample->game = gameIndex;
+
+	sample->current = game->current;
+	for (int i = 0; i < QUEUE_LENGTH; i++) {
+		sample->queue[i] = game->queue[i];
+	}
+	sample->held = game->held;
+	sample->canHold = game->canHold;
+
+	sample->useHold = move->move.useHold;
+	sample->rotation = move->move.rotation;
+	sample->x = move->move.x;
+	sample->y = move->move.y;
+	sample->linesCleared = move->linesCleared;
+}
+
+static int selfPlayWorker(void* data) {
+	struct Worker* worker = data;
+
+	struct Chunk* chunk = NULL;
+	int nextChunk = 0;
+	Uint64 remaining = worker->quota;
+
+	struct SimGame game;
+	Uint32 gameIndex = 0;
+	bool playing = false;
+
+	while (remaining > 0 && !worker->failed) {
+		if (chunk == NULL) {
+			SDL_SemWait(worker->freeChunks);
+			chunk = &worker->chunks[nextChunk];
+			nextChunk ^= 1;
+		}
+
+		if (!playing) {
+			gameIndex = (Uint32)SDL_AtomicAdd(&nextGame, 1);
+			// Spread consecutive games over the seed space
+			simReset(&game, baseSeed ^ (gameIndex * 0x9e3779b9u));
+			playing = true;
+		}
+
+		struct BotMove move;
+		if (!findBestMove(&game, &DEFAULT_WEIGHTS, &move)) {
+			playing = false;
+			continue;
+		}
+
+		recordSample(&chunk->samples[chunk->count++], gameIndex, &game, &move);
+		remaining--;
+
+		simPlay(&game, &move.move);
+		if (game.over || game.pieces >= MAX_GAME_PIECES) {
+			playing = false;
+		}
+
+		if (chunk->count == CHUNK_SAMPLES || remaining == 0) {
+			queueChunk(chunk);
+			chunk = NULL;
+		}
+	}
+
+	if (chunk != NULL) {
+		SDL_SemPost(worker->freeChunks);
+	}
+
+	workerDone();
+	return 0;
+}
+
+static bool writeHeader(struct Worker* worker) {
+	struct SelfPlayHeader header = {
+		.magic = SELFPLAY_MAGIC,
+		.version = SELFPLAY_VERSION,
+		.headerSize = sizeof(header),
+		.sampleSize = sizeof(struct SelfPlaySample),
+		.shard = worker->index,
+		.sampleCount = worker->written,
+		.seed = baseSeed,
+	};
+
+	return SDL_RWseek(worker->file, 0, RW_SEEK_SET) == 0 && SDL_RWwrite(worker->file, &header, sizeof(header), 1) == 1;
+}
+
+int selfPlayMain(int argc, char* argv[]) {
+	if (argc < 2) {
+		printf("Usage: --selfplay <output prefix> <samples> [threads] [seed]\n");
+		return 1;
+	}
+
+	const char* prefix = argv[0];
+	Uint64 samples = strtoull(argv[1], NULL, 10);
+	int threadCount = argc > 2 ? atoi(argv[2]) : SDL_GetCPUCount();
+	threadCount = SDL_max(threadCount, 1);
+	baseSeed = argc > 3 ? (Uint32)strtoul(argv[3], NULL, 10) : SDL_GetTicks();
+
+	initEngine();
+
+	struct Worker* workers = calloc(threadCount, sizeof(struct Worker));
+	SDL_Thread** threads = calloc(threadCount, sizeof(SDL_Thread*));
+	bool success = true;
+
+	for (int i = 0; i < threadCount; i++) {
+		struct Worker* worker = &workers[i];
+		worker->index = i;
+		worker->quota = samples * (i + 1) / threadCount - samples * i / threadCount;
+
+		char path[1024];
+		snprintf(path, sizeof(path), "%s-%d.bin", prefix, i);
+
+		worker->file = SDL_RWFromFile(path, "wb");
+		if (worker->file == NULL) {
+			printf("Failed to open %s: %s\n", path, SDL_GetError());
+			success = false;
+			break;
+		}
+
+		// Leave room for the header, which is filled in once the sample count is known
+		writeHeader(worker);
+
+		for (int j = 0; j < 2; j++) {
+			worker->chunks[j].samples = malloc(CHUNK_SAMPLES * sizeof(struct SelfPlaySample));
+			worker->chunks[j].worker = worker;
+		}
+		worker->freeChunks = SDL_CreateSemaphore(2);
+	}
+
+	if (success) {
+		writeQueue.lock = SDL_CreateMutex();
+		writeQueue.ready = SDL_CreateCond();
+		writeQueue.runningWorkers = threadCount;
+		SDL_AtomicSet(&nextGame, 0);
+
+		Uint64 start = SDL_GetPerformanceCounter();
+
+		SDL_Thread* writer = SDL_CreateThread(writerThread, "selfplay writer", NULL);
+		for (int i = 0; i < threadCount; i++) {
+			threads[i] = SDL_CreateThread(selfPlayWorker, "selfplay", &workers[i]);
+		}
+
+		for (int i = 0; i < threadCount; i++) {
+			SDL_WaitThread(threads[i], NULL);
+		}
+		SDL_WaitThread(writer, NULL);
+
+		double seconds = (SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+
+		Uint64 written = 0;
+		for (int i = 0; i < threadCount; i++) {
+			success &= !workers[i].failed && writeHeader(&workers[i]);
+			written += workers[i].written;
+		}
+
+		printf("Wrote %llu samples from %d games to %d shards in %.2fs (%.0f samples/s)\n",
+			(unsigned long long)written, SDL_AtomicGet(&nextGame), threadCount, seconds, written / SDL_max(seconds, 1e-9));
+
+		SDL_DestroyCond(writeQueue.ready);
+		SDL_DestroyMutex(writeQueue.lock);
+	}
+
+	for (int i = 0; i < threadCount; i++) {
+		struct Worker* worker = &workers[i];
+		if (worker->file != NULL) {
+			SDL_RWclose(worker->file);
+		}
+		if (worker->freeChunks != NULL) {
+			SDL_DestroySemaphore(worker->freeChunks);
+		}
+		free(worker->chunks[0].samples);
+		free(worker->chunks[1].samples);
+	}
+	free(threads);
+	free(workers);
+
+	return success ? 0 : 1;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+
+#include "tetris.h"
+
+#define SELFPLAY_MAGIC SDL_FOURCC('T', 'S', 'L', 'F')
+#define SELFPLAY_VERSION 1
+
+// Self-play data is written as one shard per worker thread, <prefix>-<n>.bin.
+// Each shard is a header followed by sampleCount fixed-width samples, so a
+// shard can be memory-mapped and indexed directly. Values are in native byte order.
+struct SelfPlayHeader {
+	Uint32 magic;
+	Uint16 version;
+	Uint16 headerSize;
+	Uint32 sampleSize;
+	Uint32 shard;
+	Uint64 sampleCount;
+	Uint32 seed;
+	Uint32 reserved;
+};
+
+// One decision: the position the bot saw and the placement it chose
+struct SelfPlaySample {
+	// Board occupancy, bit x of row y set if the cell is solid. Row 0 is the top.
+	Uint16 rows[BLOCKS_Y];
+	Uint32 game;
+
+	Uint8 current;
+	Uint8 queue[QUEUE_LENGTH];
+	// NUM_BLOCKS if nothing has been held yet
+	Uint8 held;
+	Uint8 canHold;
+
+	// The chosen placement, in the coordinates of the piece actually placed
+	Uint8 useHold;
+	Uint8 rotation;
+	Sint8 x;
+	Sint8 y;
+	Uint8 linesCleared;
+};
+
+// Play games with the bot on several threads and export every decision.
+// Arguments: <output prefix> <samples> [threads] [seed]
+int selfPlayMain(int argc, char* argv[]);
@@ -0,0 +1,164 @@
+// ftruncate and shm_open are POSIX, not C
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+
+#include "shm.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+void* createSharedMemory(const char* name, size_t size) {
+	HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+		(DWORD)((unsigned long long)size >> 32), (DWORD)size, name);
+	if (mapping == NULL) {
+		printf("Failed to create shared memory %s\n", name);
+		return NULL;
+	}
+
+	// Unlike the views of a file in mapFile, the mapping has to stay open, or
+	// the memory goes away as soon as nobody else has it open
+	void* data = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+	if (data == NULL) {
+		printf("Failed to map shared memory %s\n", name);
+		CloseHandle(mapping);
+	}
+	return data;
+}
+
+static void* openMapping(const char* name, size_t* size, DWORD access) {
+	HANDLE mapping = OpenFileMappingA(access, FALSE, name);
+	if (mapping == NULL) {
+		return NULL;
+	}
+
+	void* data = MapViewOfFile(mapping, access, 0, 0, 0);
+	CloseHandle(mapping);
+	if (data == NULL) {
+		return NULL;
+	}
+
+	MEMORY_BASIC_INFORMATION info;
+	VirtualQuery(data, &info, sizeof(info));
+	*size = info.RegionSize;
+	return data;
+}
+
+const void* openSharedMemory(const char* name, size_t* size) {
+	return openMapping(name, size, FILE_MAP_READ);
+}
+
+void* openWritableSharedMemory(const char* name, size_t* size) {
+	return openMapping(name, size, FILE_MAP_READ | FILE_MAP_WRITE);
+}
+
+void closeSharedMemory(const char* name, const void* data, size_t size, bool creator) {
+	// The mapping handle is leaked by design in createSharedMemory; Windows
+	// frees the memory once the last process holding it exits
+	UnmapViewOfFile(data);
+}
+
+#elif defined(__EMSCRIPTEN__)
+
+// There are no other processes to share with on the web
+void* createSharedMemory(const char* name, size_t size) {
+	return NULL;
+}
+
+const void* openSharedMemory(const char* name, size_t* size) {
+	return NULL;
+}
+
+void* openWritableSharedMemory(const char* name, size_t* size) {
+	return NULL;
+}
+
+void closeSharedMemory(const char* name, const void* data, size_t size, bool creator) {
+}
+
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// POSIX names must start with a slash
+static void posixName(const char* name, char* out, size_t outSize) {
+	snprintf(out, outSize, "/%s", name);
+}
+
+void* createSharedMemory(const char* name, size_t size) {
+	char path[256];
+	posixName(name, path, sizeof(path));
+
+	int fd = shm_open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) {
+		printf("Failed to create shared memory %s\n", name);
+		return NULL;
+	}
+
+	if (ftruncate(fd, size) != 0) {
+		printf("Failed to size shared memory %s\n", name);
+		close(fd);
+		shm_unlink(path);
+		return NULL;
+	}
+
+	void* data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		printf("Failed to map shared memory %s\n", name);
+		shm_unlink(path);
+		return NULL;
+	}
+
+	return data;
+}
+
+static void* openMapping(const char* name, size_t* size, bool writable) {
+	char path[256];
+	posixName(name, path, sizeof(path));
+
+	int fd = shm_open(path, writable ? O_RDWR : O_RDONLY, 0);
+	if (fd < 0) {
+		return NULL;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size == 0) {
+		close(fd);
+		return NULL;
+	}
+
+	void* data = mmap(NULL, st.st_size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		return NULL;
+	}
+
+	*size = st.st_size;
+	return data;
+}
+
+const void* openSharedMemory(const char* name, size_t* size) {
+	return openMapping(name, size, false);
+}
+
+void* openWritableSharedMemory(const char* name, size_t* size) {
+	return openMapping(name, size, true);
+}
+
+void closeSharedMemory(const char* name, const void* data, size_t size, bool creator) {
+	munmap((void*)data, size);
+
+	if (creator) {
+		char path[256];
+		posixName(name, path, sizeof(path));
+		shm_unlink(path);
+	}
+}
+
+#endif
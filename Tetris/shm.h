@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Named shared memory that other processes can open by the same name.
+// Returns NULL on failure.
+void* createSharedMemory(const char* name, size_t size);
+
+// Map memory created by another process read-only, and report its size
+const void* openSharedMemory(const char* name, size_t* size);
+
+// Map memory created by another process for reading and writing
+void* openWritableSharedMemory(const char* name, size_t* size);
+
+// Unmap shared memory. The creator also removes the name so nothing new can open it.
+void closeSharedMemory(const char* name, const void* data, size_t size, bool creator);
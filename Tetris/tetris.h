@@ -0,0 +1,377 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+// Game state and logic shared between the game itself (main.c) and the tools
+// that drive it headlessly.
+
+#define BLOCKS_X 10
+#define BLOCKS_Y 20
+
+struct BlockRotation {
+	bool vals[4][4];
+};
+
+struct BlockDef {
+	SDL_Color colour;
+	struct BlockRotation rotations[4];
+};
+
+// The standard tetrominoes. engine.c and everything built on it (the bot,
+// hints, finesse, SRS kicks and the tools) only know these.
+#define NUM_BLOCKS 7
+
+extern const struct BlockDef BLOCKS[NUM_BLOCKS];
+
+enum PieceType {
+	O_PIECE = 0,
+	I_PIECE = 1,
+	T_PIECE = 2,
+	L_PIECE = 3,
+	J_PIECE = 4,
+	S_PIECE = 5,
+	Z_PIECE = 6,
+};
+
+struct CurrentBlock {
+	int x;
+	int y;
+
+	enum PieceType type;
+
+	int rotation;
+
+	// How much to move on this frame.
+	int dx;
+	int dy;
+
+	// How much to rotate on this frame.
+	int dr;
+};
+
+extern struct CurrentBlock currentBlock;
+
+// Each board row packs 4 bits per cell, cell x at bit 4 * x, holding an index
+// into the palette: 0 for an empty cell, otherwise the piece type plus one.
+// Colours are only looked up when drawing, so a row moves as one word and a
+// new palette recolours everything for free.
+#define CELL_BITS 4
+#define CELL_MASK 0xf
+#define CELL_EMPTY 0
+#define PIECE_CELL(type) ((type) + 1)
+#define ROW_CELL(row, x) ((int)((row) >> (CELL_BITS * (x))) & CELL_MASK)
+
+struct Board {
+	Uint64 rows[BLOCKS_Y];
+};
+
+// Every cell of a row set to 1, for filling a mask of cells with one value
+#define CELL_REPEAT 0x1111111111111111ull
+
+#define PALETTE_SIZE (1 << CELL_BITS)
+
+// The colours cells and pieces are drawn with, from the current theme
+extern SDL_Color palette[PALETTE_SIZE];
+
+// Switch to the next theme: the pieces' own colours, or ones told apart with
+// any colour vision
+void nextTheme();
+
+// Colour the pieces again, after the piece set changes
+void applyTheme();
+
+// Pieces the game deals, in boxes of up to MAX_PIECE_SIZE cells square. The
+// standard set is built from BLOCKS. Other sets are loaded from a file (see
+// pieces.h) with the other rotations derived by turning the box.
+#define MAX_PIECE_SIZE 5
+
+// Cells are palette indices, and index 0 is empty
+#define MAX_PIECE_TYPES (PALETTE_SIZE - 1)
+
+struct PieceRotation {
+	// Bit x of row y set if that cell of the box is solid
+	Uint8 rows[MAX_PIECE_SIZE];
+
+	// The same rows with CELL_MASK in each solid cell, laid out like board rows
+	Uint64 cells[MAX_PIECE_SIZE];
+
+	// The part of the box the piece covers
+	Sint8 left;
+	Sint8 right;
+	Sint8 top;
+	Sint8 bottom;
+};
+
+#define PIECE_SOLID(rotation, x, y) (((rotation)->rows[y] >> (x)) & 1)
+
+struct PieceDef {
+	SDL_Color colour;
+	int size;
+	struct PieceRotation rotations[4];
+};
+
+struct PieceSet {
+	int count;
+
+	// The widest box, so panels can fit every piece
+	int maxSize;
+
+	// Whether this is the standard set, which the bot, hints, finesse and SRS need
+	bool standard;
+
+	struct PieceDef pieces[MAX_PIECE_TYPES];
+};
+
+extern struct PieceSet pieceSet;
+
+extern struct Board board;
+
+extern int lines;
+extern int level;
+
+#define QUEUE_LENGTH 4
+extern enum PieceType pieceQueue[QUEUE_LENGTH];
+
+// Pieces of the current bag already dealt into the queue. A bag holds one of
+// each piece in the set.
+extern bool bagUsed[MAX_PIECE_TYPES];
+
+// How a rotation that doesn't fit is kicked clear of walls and blocks. Legacy
+// tries shifting right, left and then up, SRS uses the standard tables.
+enum RotationSystem {
+	ROTATION_LEGACY,
+	ROTATION_SRS,
+};
+
+extern enum RotationSystem rotationSystem;
+
+extern bool pieceHeld;
+extern bool canHold;
+extern enum PieceType heldPieceType;
+
+enum GameState {
+	GAME_PAUSED,
+	GAME_RUN,
+	GAME_LINE_CLEAR,
+	GAME_OVER
+};
+
+extern enum GameState gameState;
+
+// The logic runs at a fixed rate, independent of how fast frames are drawn.
+#define TICK_LENGTH 4
+
+// Game time in milliseconds, advanced by TICK_LENGTH every tick
+extern int time;
+
+enum Button {
+	BUTTON_LEFT = 1 << 0,
+	BUTTON_RIGHT = 1 << 1,
+	BUTTON_DOWN = 1 << 2,
+	BUTTON_ROTATE_RIGHT = 1 << 3,
+	BUTTON_ROTATE_LEFT = 1 << 4,
+	BUTTON_DROP = 1 << 5,
+	BUTTON_HOLD = 1 << 6,
+	BUTTON_PAUSE = 1 << 7,
+	BUTTON_REWIND = 1 << 8,
+	BUTTON_SAVE = 1 << 9,
+	BUTTON_LOAD = 1 << 10,
+};
+
+// Quicksave and quickload aren't game input: they're handled between ticks and
+// never reach stepGame or a replay
+#define QUICKSAVE_BUTTONS (BUTTON_SAVE | BUTTON_LOAD)
+
+// Start a new game. The same seed and the same buttons each tick always play
+// out the same game.
+void resetGame(Uint32 seed);
+
+// Advance the game by one tick with the given buttons held.
+void stepGame(Uint32 input);
+
+#define SNAPSHOT_MAGIC SDL_FOURCC('T', 'S', 'N', 'P')
+// Version 2 replaced the millisecond gravity and placement timers with tick
+// based gravity and lock delay, in the same fields. Version 3 added the fields
+// for piece sets with more than 8 pieces, or pieces more than 4 rows tall.
+#define SNAPSHOT_VERSION 3
+
+// A complete copy of the game state in a fixed-size binary layout (native byte
+// order). New fields must only ever be appended: a reader copies the prefix it
+// knows about and leaves the rest at their defaults, so snapshots stay loadable
+// across versions.
+struct GameSnapshot {
+	Uint32 magic;
+	Uint16 version;
+	Uint16 size;
+
+	// Bit x is set if cell x of board row y is solid.
+	Uint16 solid[BLOCKS_Y];
+
+	// 3 bits per cell holding the piece type, cell x at bit 3 * x.
+	Uint32 pieces[BLOCKS_Y];
+
+	Uint32 rngState;
+	Sint32 lines;
+	Sint32 level;
+	Sint32 gravityProgress;
+	Sint32 lockResets;
+	Sint32 lockTimer;
+	Sint32 unpauseTimer;
+
+	// Time since each repeating key last took effect.
+	Sint32 leftAge;
+	Sint32 rightAge;
+	Sint32 downAge;
+	Sint32 rotRAge;
+	Sint32 rotLAge;
+
+	Uint8 pieceQueue[QUEUE_LENGTH];
+	Uint8 type;
+	Uint8 rotation;
+	Sint8 x;
+	Sint8 y;
+	Uint8 heldPieceType;
+	Uint8 bagUsed;
+	Uint8 gameState;
+	Uint8 flags;
+
+	// A tetromino covers at most 4 rows, so no more lines can clear at once.
+	Uint8 lineCount;
+	Uint8 linesToClear[4];
+	Sint8 clearTimer;
+	Sint8 unpauseCounter;
+	Sint8 lowestY;
+
+	// Bit x is set if the piece type of cell x of row y is 8 or more
+	Uint16 piecesHigh[BLOCKS_Y];
+
+	// bagUsed for piece types 8 and up
+	Uint8 bagUsedHigh;
+
+	// Lines past the fourth, for pieces taller than 4
+	Uint8 moreLinesToClear[MAX_PIECE_SIZE - 4];
+};
+
+#define SNAPSHOT_PIECE_HELD (1 << 0)
+#define SNAPSHOT_CAN_HOLD (1 << 1)
+#define SNAPSHOT_UNPAUSING (1 << 2)
+#define SNAPSHOT_QUEUE_INITIALISED (1 << 3)
+
+void saveSnapshot(struct GameSnapshot* snap);
+bool loadSnapshot(const struct GameSnapshot* snap);
+bool writeSnapshotFile(const char* path);
+bool readSnapshotFile(const char* path);
+
+// Rows as a bitmask of solid cells plus 3 bits per cell of piece type, as used
+// by snapshots, with the type's 4th bit in high if it isn't NULL. Unpacking
+// marks the row in changedRows.
+void packRow(int y, Uint16* solid, Uint32* pieces, Uint16* high);
+void unpackRow(int y, Uint16 solid, Uint32 pieces, Uint16 high);
+
+// Bit y is set when row y of the board changes. Whoever consumes it clears it.
+extern Uint32 changedRows;
+
+// Buttons held on the last tick, compared against the next tick's to find
+// presses. Not part of a snapshot, so anything restoring snapshots tick by
+// tick has to carry it itself.
+extern Uint32 buttons;
+
+// Whether placing pieces records rewind checkpoints. Tools that step several
+// games through the same globals turn this off.
+extern bool historyEnabled;
+
+struct Placement {
+	int tick;
+	enum PieceType type;
+	int rotation;
+	int x;
+	int y;
+
+	// Lines completed by this piece, and the level it was placed on
+	int linesCleared;
+	int level;
+};
+
+// Called whenever a piece is locked into the board, if set.
+extern void (*placementHook)(const struct Placement* placement);
+
+#define BLOCK_SIZE 40
+
+#define BOARD_WIDTH (BLOCKS_X * BLOCK_SIZE)
+#define BOARD_HEIGHT (BLOCKS_Y * BLOCK_SIZE)
+
+#define WINDOW_WIDTH (BOARD_WIDTH * 2)
+#define WINDOW_HEIGHT BOARD_HEIGHT
+
+// Drawing, so tools can render the game into something other than the window
+struct RenderState;
+
+extern SDL_Renderer* renderer;
+
+void loadFont();
+void loadDeferredFont();
+
+// Snapshot the game for drawing, and get the most recently published snapshot
+void publishRenderState();
+const struct RenderState* acquireRenderState();
+
+void drawFrame(const struct RenderState* rs);
+
+// What the line clear and unpause animations need to draw
+extern int lineCount;
+extern int linesToClear[BLOCKS_Y];
+#define CLEAR_TIMER_LENGTH 40
+extern int clearTimer;
+extern bool unpausing;
+extern int unpauseCounter;
+
+// Copy the solid cells of board rows first to last into bitboard. Rows outside
+// that range are left as they are.
+struct Bitboard;
+void readBoardRows(struct Bitboard* bitboard, int first, int last);
+
+// SDL, the window, the renderer and the font
+void openWindow(const char* title);
+
+// Run the game in a window until it is closed
+int runGame();
+
+// The pieces of runGame: one frame of events and drawing, returning false once
+// the window is closed, and the thread that runs ticks until quitting is set
+bool mainLoop(double _emTime, void* _emUserData);
+int logicThread(void* data);
+extern SDL_atomic_t quitting;
+
+// One pass of the logic thread: run the ticks due by nextTick, in performance
+// counter units, with the keys pressed since the last pass, record them in the
+// live replay, and publish the result for drawing
+int runDueTicks();
+extern Uint64 nextTick;
+extern SDL_atomic_t pressedButtons;
+
+// Start recording the live replay, with room for a long game
+void beginLiveReplay(Uint32 seed);
+
+// The bot playing the game and hinting at moves, toggled with B and H
+struct Weights;
+extern SDL_atomic_t autoplayEnabled;
+extern struct Weights autoplayWeights;
+extern SDL_atomic_t hintsEnabled;
+
+// The key bound to a button
+SDL_Scancode scancodeForButton(Uint32 button);
+
+// What a frame showed, and when it was presented
+struct PresentedFrame {
+	enum GameState gameState;
+	bool unpausing;
+	int x;
+	int rotation;
+	Uint32 spawn;
+	Uint64 presentedAt;
+};
+
+// Called on the render thread after every frame is presented, if set
+extern void (*presentHook)(const struct PresentedFrame* frame);
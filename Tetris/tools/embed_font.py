@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# Regenerates font_data.h, which embeds the game font in the executable so it
+# doesn't have to be found relative to the working directory at startup.
+#
+# Usage (from the Tetris directory): python tools/embed_font.py
+
+import os
+
+FONT_PATH = "resources/Blinker/Blinker-Regular.ttf"
+OUTPUT_PATH = "font_data.h"
+BYTES_PER_LINE = 16
+
+with open(FONT_PATH, "rb") as f:
+	data = f.read()
+
+lines = []
+for i in range(0, len(data), BYTES_PER_LINE):
+	chunk = data[i:i + BYTES_PER_LINE]
+	lines.append("\t" + ", ".join("0x%02x" % b for b in chunk) + ",")
+
+with open(OUTPUT_PATH, "w", newline="\n") as f:
+	f.write("// Generated by tools/embed_font.py from %s, do not edit.\n" % FONT_PATH)
+	f.write("#pragma once\n\n")
+	f.write("const unsigned char FONT_DATA[%d] = {\n" % len(data))
+	f.write("\n".join(lines))
+	f.write("\n};\n")
+
+print("Wrote %s (%d bytes of font data)" % (OUTPUT_PATH, len(data)))
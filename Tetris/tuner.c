@@ -0,0 +1,330 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bot.h"
+#include "engine.h"
+#include "tuner.h"
+
+SDL_COMPILE_TIME_ASSERT(tunerWeights, sizeof(struct Weights) == TUNER_WEIGHTS * sizeof(float));
+
+// Games are cut off here, which bounds both the time a candidate takes and
+// the lines it can score in one game
+#define TUNER_MAX_PIECES 500
+#define MAX_GAME_LINES (TUNER_MAX_PIECES * 4 / BLOCKS_X)
+
+// Good weights survive every game, so the score for a game is the lines
+// cleared plus a bonus below one line for keeping the stack low, which
+// separates candidates that clear the same lines
+#define MAX_GAME_SCORE (MAX_GAME_LINES + 1)
+
+#define INITIAL_SIGMA 0.5f
+
+// Keeps the search from collapsing onto one point before it has converged
+#define SIGMA_FLOOR 0.02f
+
+struct Candidate {
+	float weights[TUNER_WEIGHTS];
+	float score;
+	int games;
+	Uint64 pieces;
+
+	// Whether every game was played, rather than giving up on it as hopeless
+	bool finished;
+};
+
+// One generation, shared by the worker threads
+struct Generation {
+	struct Candidate* candidates;
+	int count;
+	SDL_atomic_t next;
+
+	// The bag seeds, the same for every candidate so they're compared on the same games
+	Uint32* seeds;
+	int games;
+
+	float cutoff;
+};
+
+static Uint32 randomBits(Uint32* state) {
+	Uint32 x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+static float uniform(Uint32* state) {
+	return ((randomBits(state) >> 8) + 0.5f) / (1 << 24);
+}
+
+// Box-Muller, using one of the pair
+static float gaussian(Uint32* state) {
+	float u = uniform(state);
+	float v = uniform(state);
+	return SDL_sqrtf(-2.0f * SDL_logf(u)) * SDL_cosf(2.0f * 3.14159265f * v);
+}
+
+static void normalise(float* weights) {
+	float length = 0;
+	for (int i = 0; i < TUNER_WEIGHTS; i++) {
+		length += weights[i] * weights[i];
+	}
+
+	length = SDL_sqrtf(length);
+	if (length > 0) {
+		for (int i = 0; i < TUNER_WEIGHTS; i++) {
+			weights[i] /= length;
+		}
+	}
+}
+
+static void evaluateCandidate(const struct Generation* generation, struct Candidate* candidate) {
+	struct Weights weights;
+	memcpy(&weights, candidate->weights, sizeof(weights));
+
+	float total = 0;
+	candidate->games = 0;
+	candidate->pieces = 0;
+
+	for (int i = 0; i < generation->games; i++) {
+		struct SimGame game;
+		simReset(&game, generation->seeds[i]);
+
+		int heights = 0;
+		while (!game.over && game.pieces < TUNER_MAX_PIECES) {
+			struct BotMove move;
+			if (!findBestMove(&game, &weights, &move)) {
+				break;
+			}
+			simPlay(&game, &move.move);
+
+			int top = 0;
+			while (top < BLOCKS_Y && game.board.rows[top] == 0) {
+				top++;
+			}
+			heights += BLOCKS_Y - top;
+		}
+
+		float meanHeight = game.pieces > 0 ? (float)heights / game.pieces : BLOCKS_Y;
+		total += game.lines + (BLOCKS_Y - meanHeight) / (BLOCKS_Y + 1);
+		candidate->games++;
+		candidate->pieces += game.pieces;
+
+		// Give up once a perfect score in every remaining game still couldn't reach the elites
+		int remaining = generation->games - candidate->games;
+		if (total + remaining * MAX_GAME_SCORE < generation->cutoff * generation->games) {
+			break;
+		}
+	}
+
+	candidate->finished = candidate->games == generation->games;
+	candidate->score = total / candidate->games;
+}
+
+static int tunerWorker(void* data) {
+	struct Generation* generation = data;
+
+	while (true) {
+		int index = SDL_AtomicAdd(&generation->next, 1);
+		if (index >= generation->count) {
+			break;
+		}
+		evaluateCandidate(generation, &generation->candidates[index]);
+	}
+
+	return 0;
+}
+
+// Finished candidates first, then by score
+static int compareCandidates(const void* a, const void* b) {
+	const struct Candidate* x = a;
+	const struct Candidate* y = b;
+
+	if (x->finished != y->finished) {
+		return x->finished ? -1 : 1;
+	}
+	return x->score > y->score ? -1 : x->score < y->score;
+}
+
+static bool readCheckpoint(const char* path, struct TunerCheckpoint* checkpoint) {
+	SDL_RWops* file = SDL_RWFromFile(path, "rb");
+	if (file == NULL) {
+		return false;
+	}
+
+	bool read = SDL_RWread(file, checkpoint, sizeof(*checkpoint), 1) == 1;
+	SDL_RWclose(file);
+
+	if (!read || checkpoint->magic != TUNER_MAGIC || checkpoint->version != TUNER_VERSION || checkpoint->headerSize != sizeof(*checkpoint)) {
+		printf("%s is not a valid checkpoint\n", path);
+		return false;
+	}
+	return true;
+}
+
+// Write to a temporary file first, so stopping part way through never leaves a broken checkpoint
+static bool writeCheckpoint(const char* path, const struct TunerCheckpoint* checkpoint) {
+	char temporary[1024];
+	if (snprintf(temporary, sizeof(temporary), "%s.tmp", path) >= (int)sizeof(temporary)) {
+		printf("Checkpoint path %s is too long\n", path);
+		return false;
+	}
+
+	SDL_RWops* file = SDL_RWFromFile(temporary, "wb");
+	if (file == NULL) {
+		printf("Failed to open %s: %s\n", temporary, SDL_GetError());
+		return false;
+	}
+
+	bool success = SDL_RWwrite(file, checkpoint, sizeof(*checkpoint), 1) == 1;
+	success &= SDL_RWclose(file) == 0;
+
+	remove(path);
+	return success && rename(temporary, path) == 0;
+}
+
+int tuneMain(int argc, char* argv[]) {
+	if (argc < 1) {
+		printf("Usage: --tune <weights file> [generations] [population] [games] [threads] [seed]\n");
+		return 1;
+	}
+
+	const char* weightsPath = argv[0];
+	int generations = argc > 1 ? atoi(argv[1]) : 30;
+	int population = SDL_max(argc > 2 ? atoi(argv[2]) : 32, 4);
+	int games = SDL_max(argc > 3 ? atoi(argv[3]) : 16, 1);
+	int threadCount = SDL_max(argc > 4 ? atoi(argv[4]) : SDL_GetCPUCount(), 1);
+	Uint32 seed = argc > 5 ? (Uint32)strtoul(argv[5], NULL, 10) : SDL_GetTicks();
+
+	char checkpointPath[1024];
+	snprintf(checkpointPath, sizeof(checkpointPath), "%s.checkpoint", weightsPath);
+
+	initEngine();
+
+	struct TunerCheckpoint state;
+	if (readCheckpoint(checkpointPath, &state)) {
+		printf("Resuming from generation %u of %s\n", state.generation, checkpointPath);
+	}
+	else {
+		memset(&state, 0, sizeof(state));
+		state.magic = TUNER_MAGIC;
+		state.version = TUNER_VERSION;
+		state.headerSize = sizeof(state);
+		state.seed = seed;
+		state.rngState = seed != 0 ? seed : 0x9e3779b9;
+		state.bestScore = -1;
+
+		memcpy(state.mean, &DEFAULT_WEIGHTS, sizeof(state.mean));
+		normalise(state.mean);
+		for (int i = 0; i < TUNER_WEIGHTS; i++) {
+			state.sigma[i] = INITIAL_SIGMA;
+		}
+	}
+
+	int eliteCount = population / 4;
+
+	struct Generation generation;
+	generation.candidates = calloc(population, sizeof(struct Candidate));
+	generation.count = population;
+	generation.seeds = malloc(games * sizeof(Uint32));
+	generation.games = games;
+
+	SDL_Thread** threads = calloc(threadCount, sizeof(SDL_Thread*));
+	bool success = true;
+
+	printf("%4s %8s %8s %8s %9s %10s %12s\n", "gen", "best", "elites", "sigma", "finished", "games/s", "pieces/s");
+
+	for (; state.generation < (Uint32)generations && success; state.generation++) {
+		// The current mean is always one of the candidates, the rest are drawn around it
+		for (int i = 0; i < population; i++) {
+			struct Candidate* candidate = &generation.candidates[i];
+			memset(candidate, 0, sizeof(*candidate));
+
+			for (int j = 0; j < TUNER_WEIGHTS; j++) {
+				candidate->weights[j] = state.mean[j] + (i > 0 ? state.sigma[j] * gaussian(&state.rngState) : 0);
+			}
+			normalise(candidate->weights);
+		}
+
+		for (int i = 0; i < games; i++) {
+			generation.seeds[i] = state.seed ^ ((state.generation * games + i + 1) * 0x9e3779b9u);
+		}
+		generation.cutoff = state.cutoff;
+		SDL_AtomicSet(&generation.next, 0);
+
+		Uint64 start = SDL_GetPerformanceCounter();
+		for (int i = 0; i < threadCount; i++) {
+			threads[i] = SDL_CreateThread(tunerWorker, "tuner", &generation);
+		}
+		for (int i = 0; i < threadCount; i++) {
+			SDL_WaitThread(threads[i], NULL);
+		}
+		double seconds = (SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+
+		qsort(generation.candidates, population, sizeof(struct Candidate), compareCandidates);
+
+		// Refit to the elites
+		float eliteScore = 0;
+		float spread = 0;
+		for (int j = 0; j < TUNER_WEIGHTS; j++) {
+			float mean = 0;
+			for (int i = 0; i < eliteCount; i++) {
+				mean += generation.candidates[i].weights[j];
+			}
+			mean /= eliteCount;
+
+			float variance = 0;
+			for (int i = 0; i < eliteCount; i++) {
+				float d = generation.candidates[i].weights[j] - mean;
+				variance += d * d;
+			}
+
+			state.mean[j] = mean;
+			state.sigma[j] = SDL_max(SDL_sqrtf(variance / eliteCount), SIGMA_FLOOR);
+			spread += state.sigma[j] * state.sigma[j];
+		}
+		normalise(state.mean);
+
+		int finished = 0;
+		Uint64 pieces = 0;
+		int played = 0;
+		for (int i = 0; i < population; i++) {
+			finished += generation.candidates[i].finished;
+			pieces += generation.candidates[i].pieces;
+			played += generation.candidates[i].games;
+		}
+		for (int i = 0; i < eliteCount; i++) {
+			eliteScore += generation.candidates[i].score;
+		}
+
+		const struct Candidate* best = &generation.candidates[0];
+		state.cutoff = generation.candidates[eliteCount - 1].score;
+		if (best->finished && best->score > state.bestScore) {
+			state.bestScore = best->score;
+			memcpy(state.best, best->weights, sizeof(state.best));
+		}
+
+		printf("%4u %8.2f %8.2f %8.4f %4d/%-4d %10.1f %12.0f\n", state.generation, best->score, eliteScore / eliteCount,
+			SDL_sqrtf(spread), finished, population, played / SDL_max(seconds, 1e-9), pieces / SDL_max(seconds, 1e-9));
+
+		struct TunerCheckpoint next = state;
+		next.generation++;
+		success &= writeCheckpoint(checkpointPath, &next);
+		success &= writeWeights(weightsPath, (const struct Weights*)state.best);
+	}
+
+	if (success && state.bestScore >= 0) {
+		const struct Weights* weights = (const struct Weights*)state.best;
+		printf("Best weights scored %.2f a game: height %.4f, holes %.4f, bumpiness %.4f, wells %.4f, lines %.4f\n",
+			state.bestScore, weights->height, weights->holes, weights->bumpiness, weights->wells, weights->lines);
+		printf("Written to %s\n", weightsPath);
+	}
+
+	free(threads);
+	free(generation.seeds);
+	free(generation.candidates);
+
+	return success ? 0 : 1;
+}
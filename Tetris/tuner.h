@@ -0,0 +1,43 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+
+#include "bot.h"
+
+#define TUNER_MAGIC SDL_FOURCC('T', 'T', 'U', 'N')
+#define TUNER_VERSION 1
+
+#define TUNER_WEIGHTS (sizeof(struct Weights) / sizeof(float))
+
+// The tuner searches for bot weights with the cross-entropy method: each
+// generation samples candidates from a Gaussian per weight, plays every
+// candidate through the same set of seeded games, and refits the Gaussians to
+// the best quarter. A candidate's score is the lines it clears in a game,
+// with ties broken by how low it keeps the stack. Only the direction of the
+// weights matters to the bot, so candidates are normalised to unit length.
+//
+// A checkpoint is written after every generation, and picked up again if the
+// tuner is restarted with the same weights file. Native byte order.
+struct TunerCheckpoint {
+	Uint32 magic;
+	Uint16 version;
+	Uint16 headerSize;
+
+	Uint32 generation;
+	Uint32 seed;
+	Uint32 rngState;
+
+	// The worst elite's score, which later candidates have to be able to reach
+	float cutoff;
+
+	float mean[TUNER_WEIGHTS];
+	float sigma[TUNER_WEIGHTS];
+
+	float best[TUNER_WEIGHTS];
+	float bestScore;
+};
+
+// Tune the weights and write them out. The checkpoint is kept next to the
+// weights, in <weights file>.checkpoint.
+// Arguments: <weights file> [generations] [population] [games] [threads] [seed]
+int tuneMain(int argc, char* argv[]);
@@ -0,0 +1,464 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "versus.h"
+
+#define NO_CHECKSUM 0xffffffff
+
+static int remotePlayer(const struct VersusSession* session) {
+	return 1 - session->localPlayer;
+}
+
+static bool remoteKnown(const struct VersusSession* session, Uint32 tick) {
+	return session->remoteTicks[tick % REMOTE_RING] == tick + 1;
+}
+
+static Uint16 remoteInput(const struct VersusSession* session, Uint32 tick) {
+	if (remoteKnown(session, tick)) {
+		return session->remoteInputs[tick % REMOTE_RING];
+	}
+
+	// Guess the other player is still holding whatever they held last
+	if (session->remoteConfirmed == 0) {
+		return 0;
+	}
+	return session->remoteInputs[(session->remoteConfirmed - 1) % REMOTE_RING];
+}
+
+static Uint32 hashBytes(Uint32 hash, const void* data, size_t size) {
+	const Uint8* bytes = data;
+	for (size_t i = 0; i < size; i++) {
+		hash ^= bytes[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+void loadPlayerState(const struct PlayerState* state, Uint32 tick) {
+	time = tick * TICK_LENGTH;
+	loadSnapshot(&state->snap);
+	buttons = state->buttons;
+}
+
+static void savePlayerState(struct PlayerState* state) {
+	saveSnapshot(&state->snap);
+	state->buttons = buttons;
+}
+
+// Step both games through a tick using the inputs in its record
+static void simulateTick(struct VersusSession* session, Uint32 tick) {
+	struct TickRecord* record = &session->ring[tick % ROLLBACK_WINDOW];
+	struct TickRecord* next = &session->ring[(tick + 1) % ROLLBACK_WINDOW];
+
+	Uint32 checksum = 2166136261u;
+	for (int p = 0; p < 2; p++) {
+		loadPlayerState(&record->players[p], tick);
+		stepGame(record->inputs[p]);
+		savePlayerState(&next->players[p]);
+
+		checksum = hashBytes(checksum, &next->players[p], sizeof(struct PlayerState));
+	}
+	record->checksum = checksum;
+}
+
+void beginVersus(struct VersusSession* session, int localPlayer, Uint32 seed) {
+	memset(session, 0, sizeof(*session));
+	session->localPlayer = localPlayer;
+
+	// The games are stepped in and out of the globals every tick, far too often to keep rewind history
+	historyEnabled = false;
+
+	resetGame(seed);
+	savePlayerState(&session->ring[0].players[0]);
+	session->ring[0].players[1] = session->ring[0].players[0];
+}
+
+void versusReceive(struct VersusSession* session, const struct VersusPacket* packet) {
+	int remote = remotePlayer(session);
+
+	for (int i = 0; i < packet->inputCount && i < INPUT_REDUNDANCY; i++) {
+		Uint32 tick = packet->firstTick + i;
+		if (tick < session->remoteConfirmed || remoteKnown(session, tick)) {
+			continue;
+		}
+
+		// Beyond this the ring would be overwritten before the tick is reached; the sender must have misbehaved
+		if (tick >= session->remoteConfirmed + REMOTE_RING) {
+			break;
+		}
+
+		Uint16 input = packet->inputs[i] & VERSUS_BUTTONS;
+
+		// A tick already simulated on a guess has to be played again if the guess was wrong
+		if (tick < session->tick && session->ring[tick % ROLLBACK_WINDOW].inputs[remote] != input) {
+			if (!session->rollbackPending || tick < session->rollbackTick) {
+				session->rollbackTick = tick;
+			}
+			session->rollbackPending = true;
+		}
+
+		session->remoteInputs[tick % REMOTE_RING] = input;
+		session->remoteTicks[tick % REMOTE_RING] = tick + 1;
+	}
+
+	while (remoteKnown(session, session->remoteConfirmed)) {
+		session->remoteConfirmed++;
+	}
+
+	if (packet->checksumTick != NO_CHECKSUM &&
+		(!session->remoteChecksumPending || packet->checksumTick > session->remoteChecksumTick)) {
+		session->remoteChecksumTick = packet->checksumTick;
+		session->remoteChecksum = packet->checksum;
+		session->remoteChecksumPending = true;
+	}
+}
+
+// Compare the other side's checksum once this side has the same tick on real inputs
+static void checkRemoteChecksum(struct VersusSession* session) {
+	if (!session->remoteChecksumPending) {
+		return;
+	}
+
+	Uint32 tick = session->remoteChecksumTick;
+	if (tick >= session->remoteConfirmed || tick >= session->tick) {
+		return;
+	}
+
+	session->remoteChecksumPending = false;
+
+	// Too old to check any more
+	if (tick + ROLLBACK_WINDOW <= session->tick) {
+		return;
+	}
+
+	session->checksumsCompared++;
+	if (versusChecksum(session, tick) != session->remoteChecksum) {
+		if (session->desyncs == 0) {
+			session->firstDesyncTick = tick;
+		}
+		session->desyncs++;
+	}
+}
+
+void versusResolve(struct VersusSession* session) {
+	if (session->rollbackPending) {
+		int remote = remotePlayer(session);
+
+		for (Uint32 tick = session->rollbackTick; tick < session->tick; tick++) {
+			session->ring[tick % ROLLBACK_WINDOW].inputs[remote] = remoteInput(session, tick);
+			simulateTick(session, tick);
+		}
+
+		Uint32 length = session->tick - session->rollbackTick;
+		session->rollbacks++;
+		session->resimulatedTicks += length;
+		session->longestRollback = SDL_max(session->longestRollback, length);
+		session->rollbackPending = false;
+	}
+
+	checkRemoteChecksum(session);
+}
+
+bool versusAdvance(struct VersusSession* session, Uint32 localInput) {
+	versusResolve(session);
+
+	// Simulating this tick overwrites the state from a window ago, which must no longer be needed.
+	// The remote can be ahead of us, in which case nothing we keep is needed.
+	if (session->tick >= session->remoteConfirmed && session->tick + 1 - session->remoteConfirmed >= ROLLBACK_WINDOW) {
+		return false;
+	}
+
+	struct TickRecord* record = &session->ring[session->tick % ROLLBACK_WINDOW];
+	record->inputs[session->localPlayer] = localInput & VERSUS_BUTTONS;
+	record->inputs[remotePlayer(session)] = remoteInput(session, session->tick);
+
+	simulateTick(session, session->tick);
+	session->tick++;
+
+	checkRemoteChecksum(session);
+	return true;
+}
+
+void versusMakePacket(const struct VersusSession* session, struct VersusPacket* packet) {
+	memset(packet, 0, sizeof(*packet));
+
+	packet->firstTick = session->tick > INPUT_REDUNDANCY ? session->tick - INPUT_REDUNDANCY : 0;
+	packet->inputCount = session->tick - packet->firstTick;
+	for (int i = 0; i < packet->inputCount; i++) {
+		packet->inputs[i] = session->ring[(packet->firstTick + i) % ROLLBACK_WINDOW].inputs[session->localPlayer];
+	}
+
+	// The newest tick simulated with nothing but real inputs
+	Uint32 settled = SDL_min(session->remoteConfirmed, session->tick);
+	if (session->rollbackPending) {
+		settled = SDL_min(settled, session->rollbackTick);
+	}
+
+	if (settled > 0) {
+		packet->checksumTick = settled - 1;
+		packet->checksum = versusChecksum(session, settled - 1);
+	}
+	else {
+		packet->checksumTick = NO_CHECKSUM;
+	}
+}
+
+Uint32 versusChecksum(const struct VersusSession* session, Uint32 tick) {
+	return session->ring[tick % ROLLBACK_WINDOW].checksum;
+}
+
+// A stand-in for a network connection: packets come out after a fixed latency
+// plus random jitter, so they can arrive out of order. Times are in ticks.
+#define LINK_CAPACITY 1024
+
+struct LoopbackLink {
+	struct {
+		struct VersusPacket packet;
+		Uint32 deliverAt;
+	} queue[LINK_CAPACITY];
+	int count;
+
+	Uint32 latency;
+	Uint32 jitter;
+	Uint32 rngState;
+};
+
+static Uint32 nextLinkRandom(Uint32* state) {
+	Uint32 x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+static void linkSend(struct LoopbackLink* link, Uint32 now, const struct VersusPacket* packet) {
+	if (link->count == LINK_CAPACITY) {
+		return;
+	}
+
+	link->queue[link->count].packet = *packet;
+	link->queue[link->count].deliverAt = now + link->latency + nextLinkRandom(&link->rngState) % (link->jitter + 1);
+	link->count++;
+}
+
+static bool linkReceive(struct LoopbackLink* link, Uint32 now, struct VersusPacket* packet) {
+	for (int i = 0; i < link->count; i++) {
+		if (link->queue[i].deliverAt <= now) {
+			*packet = link->queue[i].packet;
+			link->queue[i] = link->queue[--link->count];
+			return true;
+		}
+	}
+	return false;
+}
+
+// Scripted players that hold random buttons for random lengths of time
+static void scriptInputs(Uint16* inputs, Uint32 ticks, Uint32 seed) {
+	Uint32 state = seed;
+	Uint16 held = 0;
+	Uint32 holdFor = 0;
+
+	for (Uint32 i = 0; i < ticks; i++) {
+		if (holdFor == 0) {
+			held = nextLinkRandom(&state) & VERSUS_BUTTONS;
+			// Mostly short taps, so pieces actually get placed
+			held &= nextLinkRandom(&state) & nextLinkRandom(&state);
+			holdFor = 1 + nextLinkRandom(&state) % 40;
+		}
+		inputs[i] = held;
+		holdFor--;
+	}
+}
+
+static double elapsedUs(Uint64 start) {
+	return (SDL_GetPerformanceCounter() - start) * 1000000.0 / SDL_GetPerformanceFrequency();
+}
+
+// Time the operations a rollback is made of
+static void benchmarkPrimitives() {
+	const int iterations = 20000;
+
+	struct PlayerState state;
+	resetGame(1);
+	for (int i = 0; i < 2000; i++) {
+		stepGame((i / 50) % 2 ? BUTTON_DROP : BUTTON_LEFT);
+	}
+
+	Uint64 start = SDL_GetPerformanceCounter();
+	for (int i = 0; i < iterations; i++) {
+		savePlayerState(&state);
+	}
+	double saveUs = elapsedUs(start) / iterations;
+
+	start = SDL_GetPerformanceCounter();
+	for (int i = 0; i < iterations; i++) {
+		loadPlayerState(&state, 2000);
+	}
+	double loadUs = elapsedUs(start) / iterations;
+
+	start = SDL_GetPerformanceCounter();
+	for (int i = 0; i < iterations; i++) {
+		loadPlayerState(&state, 2000);
+		stepGame(i % 7 == 0 ? BUTTON_LEFT : 0);
+		savePlayerState(&state);
+	}
+	double tickUs = elapsedUs(start) / iterations;
+
+	printf("Snapshot %.3fus, restore %.3fus, restore + step + snapshot %.3fus\n", saveUs, loadUs, tickUs);
+}
+
+// One run of the two peers over the link. Each peer can be made to do nothing
+// at all for a while, not even reading packets, as if it started late or
+// hitched, so the other runs ahead until its window fills.
+struct LoopbackScenario {
+	const char* name;
+	Uint32 pauseAt[2];
+	Uint32 pauseLength[2];
+};
+
+static bool runLoopback(const struct LoopbackScenario* scenario, Uint16* inputs[2], Uint32 totalTicks, Uint32 seed,
+	int latencyMs, int jitterMs, Uint32 referenceChecksum) {
+	struct VersusSession* sessions = calloc(2, sizeof(struct VersusSession));
+	struct LoopbackLink* links = calloc(2, sizeof(struct LoopbackLink));
+	for (int p = 0; p < 2; p++) {
+		beginVersus(&sessions[p], p, seed);
+		links[p].latency = latencyMs / TICK_LENGTH;
+		links[p].jitter = jitterMs / TICK_LENGTH;
+		links[p].rngState = 77 + p;
+	}
+
+	Uint64 stalls = 0;
+	double worstUpdateUs = 0;
+	double totalUpdateUs = 0;
+	Uint64 updates = 0;
+
+	// Both peers run off the same clock, sending each other a packet every tick
+	Uint32 now = 0;
+	Uint32 deadline = totalTicks * 4 + 10000;
+	for (; now < deadline; now++) {
+		bool finished = true;
+
+		for (int p = 0; p < 2; p++) {
+			struct VersusSession* session = &sessions[p];
+			finished &= session->tick == totalTicks && session->remoteConfirmed == totalTicks && !session->rollbackPending;
+
+			if (now >= scenario->pauseAt[p] && now - scenario->pauseAt[p] < scenario->pauseLength[p]) {
+				finished = false;
+				continue;
+			}
+
+			struct VersusPacket packet;
+			while (linkReceive(&links[1 - p], now, &packet)) {
+				versusReceive(session, &packet);
+			}
+
+			Uint64 start = SDL_GetPerformanceCounter();
+			if (session->tick < totalTicks) {
+				if (!versusAdvance(session, inputs[p][session->tick])) {
+					stalls++;
+				}
+			}
+			else {
+				versusResolve(session);
+			}
+			double us = elapsedUs(start);
+			worstUpdateUs = SDL_max(worstUpdateUs, us);
+			totalUpdateUs += us;
+			updates++;
+
+			versusMakePacket(session, &packet);
+			linkSend(&links[p], now, &packet);
+		}
+
+		if (finished) {
+			break;
+		}
+	}
+
+	printf("%s:\n", scenario->name);
+
+	bool success = now < deadline;
+	for (int p = 0; p < 2; p++) {
+		const struct VersusSession* session = &sessions[p];
+		bool matches = session->tick == totalTicks && versusChecksum(session, totalTicks - 1) == referenceChecksum;
+		success &= matches && session->desyncs == 0;
+
+		printf("  Peer %d: %llu rollbacks, %llu ticks resimulated, longest %u ticks, %llu checksums compared, %llu desyncs, %s the reference\n",
+			p, (unsigned long long)session->rollbacks, (unsigned long long)session->resimulatedTicks, session->longestRollback,
+			(unsigned long long)session->checksumsCompared, (unsigned long long)session->desyncs, matches ? "matches" : "DIFFERS FROM");
+		if (session->desyncs > 0) {
+			printf("    First desync at tick %u\n", session->firstDesyncTick);
+		}
+		if (session->tick < totalTicks) {
+			printf("    Stuck at tick %u of %u\n", session->tick, totalTicks);
+		}
+	}
+
+	printf("  %u ticks at %dms latency, %dms jitter: %llu stalls, update mean %.1fus, worst %.1fus (frame budget 16667us)\n",
+		totalTicks, latencyMs, jitterMs, (unsigned long long)stalls, totalUpdateUs / SDL_max(updates, 1), worstUpdateUs);
+
+	free(links);
+	free(sessions);
+	return success;
+}
+
+int versusTestMain(int argc, char* argv[]) {
+	int latencyMs = argc > 0 ? atoi(argv[0]) : 100;
+	int jitterMs = argc > 1 ? atoi(argv[1]) : 30;
+	int seconds = argc > 2 ? atoi(argv[2]) : 60;
+
+	Uint32 totalTicks = SDL_max(seconds, 1) * 1000 / TICK_LENGTH;
+	Uint32 seed = 12345;
+
+	Uint16* inputs[2];
+	for (int p = 0; p < 2; p++) {
+		inputs[p] = malloc(totalTicks * sizeof(Uint16));
+		scriptInputs(inputs[p], totalTicks, 1000 + p);
+	}
+
+	benchmarkPrimitives();
+
+	// The same inputs played straight through, with nothing predicted
+	struct PlayerState reference[2];
+	resetGame(seed);
+	savePlayerState(&reference[0]);
+	reference[1] = reference[0];
+
+	Uint32 referenceChecksum = 0;
+	for (Uint32 tick = 0; tick < totalTicks; tick++) {
+		referenceChecksum = 2166136261u;
+		for (int p = 0; p < 2; p++) {
+			loadPlayerState(&reference[p], tick);
+			stepGame(inputs[p][tick]);
+			savePlayerState(&reference[p]);
+			referenceChecksum = hashBytes(referenceChecksum, &reference[p], sizeof(struct PlayerState));
+		}
+	}
+
+	// Long enough past the latency for the other peer to fill its window and
+	// have every input of it arrive at once
+	Uint32 pause = (latencyMs + jitterMs) / TICK_LENGTH + ROLLBACK_WINDOW * 2;
+	Uint32 hitchAt = SDL_min(totalTicks / 2, 1000);
+
+	const struct LoopbackScenario scenarios[] = {
+		{ "In step", { 0, 0 }, { 0, 0 } },
+		{ "Peer 1 starts late", { 0, 0 }, { 0, pause } },
+		{ "Peer 0 hitches", { hitchAt, 0 }, { pause, 0 } },
+	};
+
+	bool success = true;
+	for (int i = 0; i < SDL_arraysize(scenarios); i++) {
+		success &= runLoopback(&scenarios[i], inputs, totalTicks, seed, latencyMs, jitterMs, referenceChecksum);
+	}
+
+	historyEnabled = true;
+
+	printf(success ? "PASS\n" : "FAIL\n");
+
+	free(inputs[0]);
+	free(inputs[1]);
+
+	return success ? 0 : 1;
+}
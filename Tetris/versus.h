@@ -0,0 +1,115 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include <SDL2/SDL.h>
+
+#include "tetris.h"
+
+// Two player versus with rollback. Each peer simulates both games, guessing
+// the remote player's input until it arrives. A late input that differs from
+// the guess rolls both games back to that tick and plays the ticks since
+// again, all before the next frame is drawn.
+
+// Ticks of state kept for rolling back, which is also how far a peer may run
+// ahead of the last input it has from the other side (512ms)
+#define ROLLBACK_WINDOW 128
+
+// The other side can be up to a window ahead of this one, and this one up to a
+// window ahead of what it has confirmed, so remote inputs need twice the room
+#define REMOTE_RING (ROLLBACK_WINDOW * 2)
+
+// Inputs a packet repeats, so one that arrives late or out of order is covered by the next
+#define INPUT_REDUNDANCY 8
+
+// Buttons that mean anything in versus. Pausing, rewinding and quicksaves would
+// have to be agreed by both players, so they are masked off.
+#define VERSUS_BUTTONS (BUTTON_LEFT | BUTTON_RIGHT | BUTTON_DOWN | BUTTON_ROTATE_RIGHT | BUTTON_ROTATE_LEFT | BUTTON_DROP | BUTTON_HOLD)
+
+struct VersusPacket {
+	// Inputs for ticks [firstTick, firstTick + inputCount)
+	Uint32 firstTick;
+	Uint16 inputCount;
+	Uint16 inputs[INPUT_REDUNDANCY];
+
+	// The sender's checksum of both games after a tick it has every input for
+	Uint32 checksumTick;
+	Uint32 checksum;
+};
+
+// One game as it was at the start of a tick
+struct PlayerState {
+	struct GameSnapshot snap;
+	Uint32 buttons;
+};
+
+struct TickRecord {
+	struct PlayerState players[2];
+	Uint16 inputs[2];
+	bool remoteKnown;
+
+	// Checksum of both games at the end of the tick
+	Uint32 checksum;
+};
+
+struct VersusSession {
+	int localPlayer;
+
+	// The next tick to simulate
+	Uint32 tick;
+
+	// Every remote input before this tick has arrived
+	Uint32 remoteConfirmed;
+
+	// The earliest tick whose remote input turned out to be mispredicted, if rollbackPending
+	Uint32 rollbackTick;
+	bool rollbackPending;
+
+	// The latest checksum the other side has sent, checked once this side has simulated that tick with real inputs
+	Uint32 remoteChecksumTick;
+	Uint32 remoteChecksum;
+	bool remoteChecksumPending;
+
+	struct TickRecord ring[ROLLBACK_WINDOW];
+
+	// Remote inputs by tick, kept apart from the state ring because they can
+	// arrive for ticks not simulated yet. remoteTicks holds tick + 1, or 0 if
+	// nothing has arrived for that slot.
+	Uint16 remoteInputs[REMOTE_RING];
+	Uint32 remoteTicks[REMOTE_RING];
+
+	Uint64 rollbacks;
+	Uint64 resimulatedTicks;
+	Uint32 longestRollback;
+	Uint64 checksumsCompared;
+	Uint64 desyncs;
+	Uint32 firstDesyncTick;
+};
+
+void beginVersus(struct VersusSession* session, int localPlayer, Uint32 seed);
+
+// Handle an input packet from the other side
+void versusReceive(struct VersusSession* session, const struct VersusPacket* packet);
+
+// Roll back and replay anything that was mispredicted. Advancing does this
+// itself; it only needs calling to catch up without moving on.
+void versusResolve(struct VersusSession* session);
+
+// Simulate the next tick with the local player's input. Returns false without
+// doing anything if that would run further ahead of the other side than the
+// rollback window allows.
+bool versusAdvance(struct VersusSession* session, Uint32 localInput);
+
+// The packet to send after advancing
+void versusMakePacket(const struct VersusSession* session, struct VersusPacket* packet);
+
+// Checksum of both games at the end of a tick still in the window
+Uint32 versusChecksum(const struct VersusSession* session, Uint32 tick);
+
+// Restore one player's game into the game globals, eg. for drawing
+void loadPlayerState(const struct PlayerState* state, Uint32 tick);
+
+// Play two sessions against each other over a simulated link with latency and
+// jitter, and check they agree with a plain run of the same inputs.
+// Arguments: [latency ms] [jitter ms] [seconds]
+int versusTestMain(int argc, char* argv[]);
@@ -0,0 +1,273 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL2/SDL_ttf.h>
+
+#include "replay.h"
+#include "tetris.h"
+#include "video.h"
+
+#define FRAME_WIDTH WINDOW_WIDTH
+#define FRAME_HEIGHT WINDOW_HEIGHT
+
+#define FRAME_PIXELS (FRAME_WIDTH * FRAME_HEIGHT)
+#define FRAME_YUV_SIZE (FRAME_PIXELS * 3 / 2)
+
+SDL_COMPILE_TIME_ASSERT(evenFrameSize, FRAME_WIDTH % 2 == 0 && FRAME_HEIGHT % 2 == 0);
+
+// Frames move through a fixed ring of slots: the render thread draws frame n
+// into slot n % slotCount, any worker converts it, and the writer thread saves
+// the slots strictly in order and hands them back. Everything is allocated up
+// front, so the only thing that can stall the pipeline is a full ring.
+struct FrameSlot {
+	Uint32* pixels;
+	Uint8* yuv;
+
+	// Posted once the slot has been converted and can be written
+	SDL_sem* encoded;
+};
+
+static struct {
+	struct FrameSlot* slots;
+	int slotCount;
+
+	// Slots the writer has finished with
+	SDL_sem* freeSlots;
+
+	// Frames drawn and waiting to be claimed by a worker
+	SDL_sem* rendered;
+	SDL_atomic_t nextEncode;
+
+	// Set once the replay has finished. Frames at or past this index are shutdown signals.
+	SDL_atomic_t frameCount;
+
+	SDL_RWops* file;
+	bool failed;
+} pipeline;
+
+static struct FrameSlot* slotFor(int frame) {
+	return &pipeline.slots[frame % pipeline.slotCount];
+}
+
+// Full range BT.601, as declared by C420jpeg in the stream header, in 8.8 fixed point
+static void convertFrame(const Uint32* pixels, Uint8* yuv) {
+	Uint8* yPlane = yuv;
+	Uint8* uPlane = yuv + FRAME_PIXELS;
+	Uint8* vPlane = uPlane + FRAME_PIXELS / 4;
+
+	for (int y = 0; y < FRAME_HEIGHT; y += 2) {
+		for (int x = 0; x < FRAME_WIDTH; x += 2) {
+			int rSum = 0;
+			int gSum = 0;
+			int bSum = 0;
+
+			for (int dy = 0; dy < 2; dy++) {
+				for (int dx = 0; dx < 2; dx++) {
+					Uint32 p = pixels[(y + dy) * FRAME_WIDTH + x + dx];
+					int r = (p >> 16) & 0xff;
+					int g = (p >> 8) & 0xff;
+					int b = p & 0xff;
+
+					yPlane[(y + dy) * FRAME_WIDTH + x + dx] = (Uint8)((77 * r + 150 * g + 29 * b + 128) >> 8);
+
+					rSum += r;
+					gSum += g;
+					bSum += b;
+				}
+			}
+
+			// Chroma is shared by each 2x2 block, so average it over the block
+			int u = ((-43 * rSum - 85 * gSum + 128 * bSum) / 4 + 128) / 256 + 128;
+			int v = ((128 * rSum - 107 * gSum - 21 * bSum) / 4 + 128) / 256 + 128;
+
+			int c = (y / 2) * (FRAME_WIDTH / 2) + x / 2;
+			uPlane[c] = (Uint8)SDL_min(SDL_max(u, 0), 255);
+			vPlane[c] = (Uint8)SDL_min(SDL_max(v, 0), 255);
+		}
+	}
+}
+
+static int encodeWorker(void* data) {
+	for (;;) {
+		SDL_SemWait(pipeline.rendered);
+
+		int frame = SDL_AtomicAdd(&pipeline.nextEncode, 1);
+		if (frame >= SDL_AtomicGet(&pipeline.frameCount)) {
+			return 0;
+		}
+
+		struct FrameSlot* slot = slotFor(frame);
+		convertFrame(slot->pixels, slot->yuv);
+		SDL_SemPost(slot->encoded);
+	}
+}
+
+static int writerThread(void* data) {
+	static const char FRAME_HEADER[] = "FRAME\n";
+
+	for (int frame = 0; ; frame++) {
+		struct FrameSlot* slot = slotFor(frame);
+		SDL_SemWait(slot->encoded);
+
+		if (frame >= SDL_AtomicGet(&pipeline.frameCount)) {
+			return 0;
+		}
+
+		if (!pipeline.failed) {
+			bool success =
+				SDL_RWwrite(pipeline.file, FRAME_HEADER, sizeof(FRAME_HEADER) - 1, 1) == 1 &&
+				SDL_RWwrite(pipeline.file, slot->yuv, FRAME_YUV_SIZE, 1) == 1;
+
+			if (!success) {
+				printf("Failed to write frame %d: %s\n", frame, SDL_GetError());
+				pipeline.failed = true;
+			}
+		}
+
+		SDL_SemPost(pipeline.freeSlots);
+	}
+}
+
+// Draw the current game state into the next slot and pass it on
+static void renderFrame(SDL_Renderer* target, int frame) {
+	SDL_SemWait(pipeline.freeSlots);
+
+	publishRenderState();
+	drawFrame(acquireRenderState());
+
+	struct FrameSlot* slot = slotFor(frame);
+	SDL_RenderReadPixels(target, NULL, SDL_PIXELFORMAT_ARGB8888, slot->pixels, FRAME_WIDTH * sizeof(Uint32));
+
+	SDL_SemPost(pipeline.rendered);
+}
+
+static bool loadReplay(const char* path, int index, struct Replay* replay) {
+	SDL_RWops* file = SDL_RWFromFile(path, "rb");
+	if (file == NULL) {
+		printf("Failed to open %s: %s\n", path, SDL_GetError());
+		return false;
+	}
+
+	bool found = false;
+	for (int i = 0; i <= index; i++) {
+		found = readReplay(file, replay);
+		if (!found) {
+			printf("%s has no replay %d\n", path, index);
+			break;
+		}
+	}
+
+	SDL_RWclose(file);
+	return found;
+}
+
+int renderVideoMain(int argc, char* argv[]) {
+	if (argc < 2) {
+		printf("Usage: --render-video <replay file> <output.y4m> [replay index] [fps] [threads]\n");
+		return 1;
+	}
+
+	int index = argc > 2 ? atoi(argv[2]) : 0;
+	int fps = argc > 3 ? atoi(argv[3]) : 60;
+	int threadCount = argc > 4 ? atoi(argv[4]) : SDL_GetCPUCount();
+	fps = SDL_max(fps, 1);
+	threadCount = SDL_max(threadCount, 1);
+
+	struct Replay replay = { 0 };
+	if (!loadReplay(argv[0], index, &replay)) {
+		freeReplay(&replay);
+		return 1;
+	}
+
+	pipeline.file = SDL_RWFromFile(argv[1], "wb");
+	if (pipeline.file == NULL) {
+		printf("Failed to open %s: %s\n", argv[1], SDL_GetError());
+		freeReplay(&replay);
+		return 1;
+	}
+
+	char header[128];
+	int headerLength = snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", FRAME_WIDTH, FRAME_HEIGHT, fps);
+	SDL_RWwrite(pipeline.file, header, headerLength, 1);
+
+	// The software renderer draws straight into a surface, so no window or GPU is needed
+	TTF_Init();
+	SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, FRAME_WIDTH, FRAME_HEIGHT, 32, SDL_PIXELFORMAT_ARGB8888);
+	renderer = SDL_CreateSoftwareRenderer(surface);
+	SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+	loadFont();
+	loadDeferredFont();
+
+	// Enough slots for every worker to be busy while one frame is drawn and one written
+	pipeline.slotCount = threadCount + 2;
+	pipeline.slots = calloc(pipeline.slotCount, sizeof(struct FrameSlot));
+	for (int i = 0; i < pipeline.slotCount; i++) {
+		pipeline.slots[i].pixels = malloc(FRAME_PIXELS * sizeof(Uint32));
+		pipeline.slots[i].yuv = malloc(FRAME_YUV_SIZE);
+		pipeline.slots[i].encoded = SDL_CreateSemaphore(0);
+	}
+	pipeline.freeSlots = SDL_CreateSemaphore(pipeline.slotCount);
+	pipeline.rendered = SDL_CreateSemaphore(0);
+	SDL_AtomicSet(&pipeline.nextEncode, 0);
+	SDL_AtomicSet(&pipeline.frameCount, SDL_MAX_SINT32);
+
+	SDL_Thread** workers = calloc(threadCount, sizeof(SDL_Thread*));
+	for (int i = 0; i < threadCount; i++) {
+		workers[i] = SDL_CreateThread(encodeWorker, "encode", NULL);
+	}
+	SDL_Thread* writer = SDL_CreateThread(writerThread, "video writer", NULL);
+
+	Uint64 start = SDL_GetPerformanceCounter();
+
+	// Step the replay at its own tick rate and take a frame whenever the video clock falls behind
+	startReplay(&replay);
+
+	int frame = 0;
+	renderFrame(renderer, frame++);
+
+	for (Uint32 tick = 0; tick < replay.tickCount; tick++) {
+		stepGame(replay.inputs[tick]);
+
+		Uint64 elapsedMs = (Uint64)(tick + 1) * TICK_LENGTH;
+		while ((Uint64)frame * 1000 <= elapsedMs * fps) {
+			renderFrame(renderer, frame++);
+		}
+	}
+
+	// Signal the end: one wake-up per worker, and one for the writer on the slot it waits on next
+	SDL_AtomicSet(&pipeline.frameCount, frame);
+	for (int i = 0; i < threadCount; i++) {
+		SDL_SemPost(pipeline.rendered);
+	}
+	for (int i = 0; i < threadCount; i++) {
+		SDL_WaitThread(workers[i], NULL);
+	}
+	SDL_SemPost(slotFor(frame)->encoded);
+	SDL_WaitThread(writer, NULL);
+
+	double seconds = (SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+	double videoSeconds = (double)frame / fps;
+	printf("Wrote %d frames (%.1fs of video) in %.2fs, %.1fx real time\n",
+		frame, videoSeconds, seconds, videoSeconds / SDL_max(seconds, 1e-9));
+
+	bool success = !pipeline.failed;
+
+	SDL_RWclose(pipeline.file);
+	for (int i = 0; i < pipeline.slotCount; i++) {
+		free(pipeline.slots[i].pixels);
+		free(pipeline.slots[i].yuv);
+		SDL_DestroySemaphore(pipeline.slots[i].encoded);
+	}
+	free(pipeline.slots);
+	free(workers);
+	SDL_DestroySemaphore(pipeline.freeSlots);
+	SDL_DestroySemaphore(pipeline.rendered);
+
+	SDL_DestroyRenderer(renderer);
+	renderer = NULL;
+	SDL_FreeSurface(surface);
+	freeReplay(&replay);
+
+	return success ? 0 : 1;
+}
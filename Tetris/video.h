@@ -0,0 +1,6 @@
+#pragma once
+
+// Render a replay offscreen with the software renderer and write it out as a
+// Y4M video, converting frames on several threads while the next ones are drawn.
+// Arguments: <replay file> <output.y4m> [replay index] [fps] [threads]
+int renderVideoMain(int argc, char* argv[]);